@@ -41,6 +41,11 @@
 #ifndef TESSERACT_COLLISION_BULLET_CAST_BVH_MANAGERS_H
 #define TESSERACT_COLLISION_BULLET_CAST_BVH_MANAGERS_H
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <set>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_collision/bullet/bullet_utils.h>
 #include <tesseract_collision/core/continuous_contact_manager.h>
 #include <tesseract_collision/bullet/tesseract_collision_configuration.h>
@@ -56,7 +61,13 @@ public:
   using UPtr = std::unique_ptr<BulletCastBVHManager>;
   using ConstUPtr = std::unique_ptr<const BulletCastBVHManager>;
 
-  BulletCastBVHManager(std::string name = "BulletCastBVHManager");
+  /**
+   * @brief Constructor
+   * @param name The name of the contact manager
+   * @param broadphase_config The broadphase configuration
+   */
+  BulletCastBVHManager(std::string name = "BulletCastBVHManager",
+                       BulletBroadphaseConfig broadphase_config = BulletBroadphaseConfig());
   ~BulletCastBVHManager() override;
   BulletCastBVHManager(const BulletCastBVHManager&) = delete;
   BulletCastBVHManager& operator=(const BulletCastBVHManager&) = delete;
@@ -67,6 +78,9 @@ public:
 
   ContinuousContactManager::UPtr clone() const override final;
 
+  /** @brief Get the broadphase configuration */
+  const BulletBroadphaseConfig& getBroadphaseConfig() const;
+
   bool addCollisionObject(const std::string& name,
                           const int& mask_id,
                           const CollisionShapesConst& shapes,
@@ -106,6 +120,21 @@ public:
   void setCollisionObjectsTransform(const tesseract_common::TransformMap& pose1,
                                     const tesseract_common::TransformMap& pose2) override final;
 
+  /**
+   * @copydoc ContinuousContactManager::updateCollisionObjectOctree
+   * @note Only octrees of static links are updated, because the cast collision object wraps every child of the octree.
+   * The cast collision object of an updated link is rebuilt when the link becomes active.
+   */
+  bool updateCollisionObjectOctree(const std::string& name,
+                                   std::size_t shape_index,
+                                   const tesseract_geometry::Octree::ConstPtr& octree,
+                                   const OctreeDelta& delta) override final;
+
+  void setDenseLinkNames(const std::vector<std::string>& link_names) override final;
+
+  void setDenseCollisionObjectsTransform(const tesseract_common::VectorIsometry3d& pose1,
+                                         const tesseract_common::VectorIsometry3d& pose2) override final;
+
   const std::vector<std::string>& getCollisionObjects() const override final;
 
   void setActiveCollisionObjects(const std::vector<std::string>& names) override final;
@@ -128,8 +157,16 @@ public:
 
   IsContactAllowedFn getIsContactAllowedFn() const override final;
 
+  using ContinuousContactManager::contactTest;
+
   void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
 
+  void contactTest(CompactContactResults& collisions, const ContactRequest& request) override final;
+
+  bool anyContactTest(const ContactRequest& request) override final;
+
+  void setStatisticsEnabled(bool enabled) override final;
+
   /**
    * @brief A a bullet collision object to the manager
    * @param cow The tesseract bullet collision object
@@ -138,6 +175,7 @@ public:
 
 private:
   std::string name_;
+  BulletBroadphaseConfig broadphase_config_;   /**< @brief The broadphase configuration */
   std::vector<std::string> active_;            /**< @brief A list of the active collision objects */
   std::vector<std::string> collision_objects_; /**< @brief A list of the collision objects */
 
@@ -158,8 +196,56 @@ private:
   /** @brief Filter collision objects before broadphase check */
   TesseractOverlapFilterCallback broadphase_overlap_cb_;
 
+  /** @brief The collision objects ordered as the dense link names, nullptr if the link has no collision object */
+  std::vector<COW::Ptr> dense_cows_;
+
+  /** @brief The cast collision objects ordered as the dense link names, nullptr if the link has no collision object */
+  std::vector<COW::Ptr> dense_cast_cows_;
+
+  /** @brief The collision margin data indexed by the collision object ids */
+  CollisionMarginTable collision_margin_table_;
+
+  /** @brief Indicates the collision objects changed since the collision margin table was last updated */
+  bool collision_margin_table_dirty_{ false };
+
+  /** @brief The link id revision of the allowed collision matrix the link ids of the collision objects were set for */
+  std::size_t allowed_collision_link_id_revision_{ 0 };
+
+  /** @brief Indicates the collision objects changed since their allowed collision matrix link ids were last set */
+  bool allowed_collision_link_ids_dirty_{ true };
+
+  /** @brief The links whose octree was updated since their cast collision object was created */
+  std::set<std::string> stale_cast_cows_;
+
+  /** @brief This function will rebuild the cast collision object of a link if its octree was updated */
+  void updateStaleCastCollisionObject(const COW::Ptr& cow);
+
   /** @brief This function will update internal data when margin data has changed */
   void onCollisionMarginDataChanged();
+
+  /** @brief This function will assign the collision object ids and rebuild the collision margin table */
+  void updateCollisionMarginTable();
+
+  /** @brief This function will set the allowed collision matrix link ids of the collision objects if they changed */
+  void updateAllowedCollisionLinkIds();
+
+  /** @brief Perform the contact test using the request and results currently set in the contact test data */
+  void contactTest();
+
+  /** @brief This function will resolve the collision objects of the dense link names */
+  void updateDenseCollisionObjects();
+
+  /**
+   * @brief Set a cast(moving) collision object's transforms
+   * @param cow The collision object
+   * @param cast_cow The cast collision object
+   * @param pose1 The start transformation in world
+   * @param pose2 The end transformation in world
+   */
+  void setCastCollisionObjectsTransform(const COW::Ptr& cow,
+                                        const COW::Ptr& cast_cow,
+                                        const Eigen::Isometry3d& pose1,
+                                        const Eigen::Isometry3d& pose2);
 };
 }  // namespace tesseract_collision::tesseract_collision_bullet
 
@@ -56,7 +56,13 @@ public:
   using UPtr = std::unique_ptr<BulletDiscreteBVHManager>;
   using ConstUPtr = std::unique_ptr<const BulletDiscreteBVHManager>;
 
-  BulletDiscreteBVHManager(std::string name = "BulletDiscreteBVHManager");
+  /**
+   * @brief Constructor
+   * @param name The name of the contact manager
+   * @param broadphase_config The broadphase configuration
+   */
+  BulletDiscreteBVHManager(std::string name = "BulletDiscreteBVHManager",
+                           BulletBroadphaseConfig broadphase_config = BulletBroadphaseConfig());
   ~BulletDiscreteBVHManager() override;
   BulletDiscreteBVHManager(const BulletDiscreteBVHManager&) = delete;
   BulletDiscreteBVHManager& operator=(const BulletDiscreteBVHManager&) = delete;
@@ -67,6 +73,9 @@ public:
 
   DiscreteContactManager::UPtr clone() const override final;
 
+  /** @brief Get the broadphase configuration */
+  const BulletBroadphaseConfig& getBroadphaseConfig() const;
+
   bool addCollisionObject(const std::string& name,
                           const int& mask_id,
                           const CollisionShapesConst& shapes,
@@ -95,6 +104,15 @@ public:
 
   void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override final;
 
+  bool updateCollisionObjectOctree(const std::string& name,
+                                   std::size_t shape_index,
+                                   const tesseract_geometry::Octree::ConstPtr& octree,
+                                   const OctreeDelta& delta) override final;
+
+  void setDenseLinkNames(const std::vector<std::string>& link_names) override final;
+
+  void setDenseCollisionObjectsTransform(const tesseract_common::VectorIsometry3d& link_transforms) override final;
+
   const std::vector<std::string>& getCollisionObjects() const override final;
 
   void setActiveCollisionObjects(const std::vector<std::string>& names) override final;
@@ -117,8 +135,33 @@ public:
 
   IsContactAllowedFn getIsContactAllowedFn() const override final;
 
+  using DiscreteContactManager::contactTest;
+
   void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
 
+  void contactTest(CompactContactResults& collisions, const ContactRequest& request) override final;
+
+  bool anyContactTest(const ContactRequest& request) override final;
+
+  void setStatisticsEnabled(bool enabled) override final;
+
+  void contactTest(std::vector<ContactResultMap>& collisions,
+                   const std::vector<std::string>& names,
+                   const std::vector<tesseract_common::VectorIsometry3d>& states,
+                   const ContactRequest& request) override final;
+
+  void contactTest(ContactResultMap& collisions,
+                   const std::vector<std::string>& query_objects,
+                   const ContactRequest& request) override final;
+
+  void pointContactTest(PointContactResultVector& results,
+                        const Eigen::Ref<const Eigen::Matrix3Xd>& points,
+                        double contact_distance) override final;
+
+  void pointContactTest(PointContactResultVector& results,
+                        const tesseract_common::VectorVector3d& points,
+                        double contact_distance) override final;
+
   /**
    * @brief A a bullet collision object to the manager
    * @param cow The tesseract bullet collision object
@@ -127,6 +170,7 @@ public:
 
 private:
   std::string name_;
+  BulletBroadphaseConfig broadphase_config_;   /**< @brief The broadphase configuration */
   std::vector<std::string> active_;            /**< @brief A list of the active collision objects */
   std::vector<std::string> collision_objects_; /**< @brief A list of the collision objects */
 
@@ -143,11 +187,56 @@ private:
    */
   ContactTestData contact_test_data_;
 
+  /** @brief The collision object moved to each point by the point contact test, created on first use */
+  COW::Ptr point_cow_;
+
   /** @brief Filter collision objects before broadphase check */
   TesseractOverlapFilterCallback broadphase_overlap_cb_;
 
+  /** @brief The collision objects ordered as the dense link names, nullptr if the link has no collision object */
+  std::vector<COW::Ptr> dense_cows_;
+
+  /** @brief The query objects of the last query contact test, kept to reuse the storage */
+  std::vector<CollisionObjectWrapper*> query_cows_;
+
+  /** @brief The broadphase overlaps of a query object, kept to reuse the storage */
+  std::vector<CollisionObjectWrapper*> query_overlaps_;
+
+  /** @brief Accepts every pair added to the query pair cache */
+  QueryOverlapFilterCallback query_overlap_cb_;
+
+  /**
+   * @brief The pairs of the query contact test which are not in the broadphase pair cache, like pairs of two static
+   * collision objects, so their collision algorithms are kept between query contact tests
+   */
+  std::unique_ptr<btHashedOverlappingPairCache> query_pair_cache_;
+
+  /** @brief The collision margin data indexed by the collision object ids */
+  CollisionMarginTable collision_margin_table_;
+
+  /** @brief Indicates the collision objects changed since the collision margin table was last updated */
+  bool collision_margin_table_dirty_{ false };
+
+  /** @brief The link id revision of the allowed collision matrix the link ids of the collision objects were set for */
+  std::size_t allowed_collision_link_id_revision_{ 0 };
+
+  /** @brief Indicates the collision objects changed since their allowed collision matrix link ids were last set */
+  bool allowed_collision_link_ids_dirty_{ true };
+
   /** @brief This function will update internal data when margin data has changed */
   void onCollisionMarginDataChanged();
+
+  /** @brief This function will assign the collision object ids and rebuild the collision margin table */
+  void updateCollisionMarginTable();
+
+  /** @brief This function will set the allowed collision matrix link ids of the collision objects if they changed */
+  void updateAllowedCollisionLinkIds();
+
+  /** @brief Perform the contact test using the request and results currently set in the contact test data */
+  void contactTest();
+
+  /** @brief This function will resolve the collision objects of the dense link names */
+  void updateDenseCollisionObjects();
 };
 
 }  // namespace tesseract_collision::tesseract_collision_bullet
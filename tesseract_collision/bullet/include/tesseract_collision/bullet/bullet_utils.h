@@ -49,6 +49,11 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <BulletCollision/CollisionDispatch/btManifoldResult.h>
 #include <btBulletCollisionCommon.h>
 #include <console_bridge/console.h>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <unordered_map>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/core/types.h>
@@ -79,6 +84,60 @@ btTransform convertEigenToBt(const Eigen::Isometry3d& t);
 
 Eigen::Isometry3d convertBtToEigen(const btTransform& t);
 
+/**
+ * @brief The key of a GJK warm start cache entry
+ *
+ * This is the id of the other collision object followed by the shape id and subshape id of this and the other collision
+ * object, which identifies the same pair of convex shapes as ContactResult::shape_id and ContactResult::subshape_id.
+ */
+using GjkWarmStartKey = std::array<int, 5>;
+
+struct GjkWarmStartKeyHash
+{
+  std::size_t operator()(const GjkWarmStartKey& key) const;
+};
+
+/**
+ * @brief Maps a pair of convex shapes to the separating axis GJK found between them in the previous contact test
+ *
+ * When ContactRequest::warm_start is set, the convex-convex algorithm seeds GJK with the cached axis and writes back
+ * the axis it finds. Each pair is stored once, in the collision object with the lower id, so the cache is only valid
+ * while the contact manager keeps the same ids:
+ * - The contact managers clone their collision objects in insertion order, so a clone assigns the same ids and copies
+ *   the caches as they are.
+ * - Removing a collision object or changing any id clears the caches of every collision object.
+ *
+ * A stale axis only slows GJK down, it does not change the result.
+ */
+using GjkWarmStartCache = std::unordered_map<GjkWarmStartKey, btVector3, GjkWarmStartKeyHash>;
+
+/**
+ * @brief The compound shape created for an octree, with the data needed to update it incrementally
+ *
+ * The compound has one child per sub shape of the octree, see tesseract_geometry::Octree::forEachSubShape. Each child
+ * is identified by the morton code of the first maximum depth voxel it contains, so all children inside an octree node
+ * form a contiguous range of codes.
+ */
+struct OctreeCompoundShape
+{
+  using Ptr = std::shared_ptr<OctreeCompoundShape>;
+
+  /** @brief The octree geometry the compound was created from */
+  tesseract_geometry::Octree::ConstPtr geom;
+  /** @brief The index of the octree in the collision object shapes */
+  int shape_index{ -1 };
+  /** @brief The compound shape with one child per sub shape */
+  std::shared_ptr<btCompoundShape> compound;
+  /** @brief The child shape of each octree depth, shared by all children at that depth */
+  std::vector<std::shared_ptr<btCollisionShape>> depth_shapes;
+  /** @brief Maps the morton code of each child to its child index, this is built on the first update */
+  std::map<std::uint64_t, int> child_index;
+  /** @brief The morton code of each child indexed by child index, this is built on the first update */
+  std::vector<std::uint64_t> child_codes;
+  /** @brief The octree depth of each child indexed by child index, this is built on the first update */
+  std::vector<unsigned> child_depths;
+};
+
 /**
  * @brief This is a tesseract bullet collsion object.
  *
@@ -103,6 +162,18 @@ public:
   short int m_collisionFilterMask{ btBroadphaseProxy::StaticFilter | btBroadphaseProxy::KinematicFilter };
   bool m_enabled{ true };
 
+  /** @brief The id of the collision object in the contact manager's collision margin table, -1 if not assigned */
+  int m_collisionObjectId{ -1 };
+
+  /** @brief The link id of the collision object in the compiled allowed collision matrix, see ContactTestData */
+  long m_allowedCollisionLinkId{ -1 };
+
+  /**
+   * @brief The GJK separating axes found against collision objects with a higher id, used to warm start GJK
+   * @details This is keyed by collision object id, so the contact manager must clear it when the ids change.
+   */
+  mutable GjkWarmStartCache m_gjkWarmStartCache;
+
   /** @brief Get the collision object name */
   const std::string& getName() const;
   /** @brief Get a user defined type */
@@ -131,6 +202,35 @@ public:
 
   void manageReserve(std::size_t s);
 
+  /**
+   * @brief Store the compound shape created for an octree so it can be updated incrementally
+   * @param t The octree compound shape
+   */
+  void manageOctree(const OctreeCompoundShape::Ptr& t);
+
+  /**
+   * @brief Stop sharing the octree compound shapes with the collision object this was cloned from
+   * @details The shapes stay alive because they are managed, but the octrees can no longer be updated. This is used by
+   * cast collision objects, which wrap the children of the compound shapes and are rebuilt instead of updated.
+   */
+  void releaseOctrees();
+
+  /**
+   * @brief Replace an octree with an updated copy and rebuild the parts of its compound shape that changed
+   *
+   * Every octree node containing a changed voxel is rebuilt from the updated octree, the other children of the compound
+   * are kept. If the compound is shared with a clone it is copied once, so the clone is not modified, and later updates
+   * modify the copy in place. The caller must update the broadphase AABB afterwards.
+   *
+   * @param shape_index The index of the octree in the collision object shapes
+   * @param octree The updated octree, which must have the same resolution and options as the current octree
+   * @param delta The voxels that changed between the current and the updated octree
+   * @return True if the shape is an octree and it was updated, otherwise false
+   */
+  bool updateOctree(std::size_t shape_index,
+                    const tesseract_geometry::Octree::ConstPtr& octree,
+                    const OctreeDelta& delta);
+
 protected:
   /** @brief The name of the collision object */
   std::string m_name;
@@ -142,6 +242,8 @@ protected:
   tesseract_common::VectorIsometry3d m_shape_poses{};
   /** @brief This manages the collision shape pointer so they get destroyed */
   std::vector<std::shared_ptr<btCollisionShape>> m_data{};
+  /** @brief The compound shapes of the octrees keyed by shape index, these are shared with clones until updated */
+  std::map<int, OctreeCompoundShape::Ptr> m_octree_data{};
 };
 
 using COW = CollisionObjectWrapper;
@@ -213,6 +315,96 @@ btTransform getLinkTransformFromCOW(const btCollisionObjectWrapper* cow);
  */
 bool needsCollisionCheck(const COW& cow1, const COW& cow2, const IsContactAllowedFn& acm, bool verbose = false);
 
+/**
+ * @brief This is used to check if a collision check is required between the provided two collision objects
+ * @details If the contact test data provides a compiled allowed collision matrix the link ids cached on the collision
+ * objects are used instead of the contact allowed function.
+ * @param cow1 The first collision object
+ * @param cow2 The second collision object
+ * @param cdata The contact test data
+ * @param verbose Indicate if verbose information should be printed to the terminal
+ * @return True if the two collision objects should be checked for collision, otherwise false
+ */
+bool needsCollisionCheck(const COW& cow1, const COW& cow2, const ContactTestData& cdata, bool verbose = false);
+
+/**
+ * @brief Get the GJK warm start cache entry for a pair of convex shapes
+ *
+ * The entry is stored in the collision object with the lower id and holds the separating axis with that collision
+ * object first. A new entry holds a zero axis.
+ *
+ * @param colObj0Wrap The first collision object wrapper
+ * @param colObj1Wrap The second collision object wrapper
+ * @param negate Set to true if the stored axis must be negated for colObj0Wrap being first
+ * @return The cache entry, nullptr if either collision object has not been assigned an id
+ */
+btVector3* getGjkWarmStartAxis(const btCollisionObjectWrapper* colObj0Wrap,
+                               const btCollisionObjectWrapper* colObj1Wrap,
+                               bool& negate);
+
+/**
+ * @brief Clear the GJK warm start caches of the collision objects
+ * @param link2cow The collision objects
+ */
+void clearGjkWarmStartCaches(const Link2Cow& link2cow);
+
+/**
+ * @brief Set the allowed collision matrix link ids of the collision objects
+ * @param link2cow The collision objects
+ * @param compiled_acm The compiled allowed collision matrix to look up the link ids
+ */
+void setAllowedCollisionLinkIds(const Link2Cow& link2cow,
+                                const tesseract_common::CompiledAllowedCollisionMatrix& compiled_acm);
+
+/**
+ * @brief Record a narrowphase check between two shapes in the contact test statistics
+ * @details The shapes are counted by the geometry type they were created from. Checks involving a compound shape are
+ * not recorded, they are recorded for its child shapes instead.
+ * @param statistics The contact test statistics
+ * @param obj0Wrap The first collision object wrapper, its collision shape is the checked shape
+ * @param obj1Wrap The second collision object wrapper, its collision shape is the checked shape
+ */
+void recordNarrowphaseCall(ContactTestStatistics& statistics,
+                           const btCollisionObjectWrapper* obj0Wrap,
+                           const btCollisionObjectWrapper* obj1Wrap);
+
+/**
+ * @brief Run the narrowphase for a pair of collision objects
+ * @param algorithm The collision algorithm for the pair
+ * @param obj0Wrap The first collision object wrapper
+ * @param obj1Wrap The second collision object wrapper
+ * @param dispatch_info The dispatcher info
+ * @param result The manifold result the contacts are reported to
+ * @param statistics The contact test statistics to add the narrowphase time to, nullptr if not collected
+ */
+void processNarrowphase(btCollisionAlgorithm* algorithm,
+                        const btCollisionObjectWrapper* obj0Wrap,
+                        const btCollisionObjectWrapper* obj1Wrap,
+                        const btDispatcherInfo& dispatch_info,
+                        btManifoldResult* result,
+                        ContactTestStatistics* statistics);
+
+/**
+ * @brief Times a contact test from construction to destruction
+ * @details The time not spent in the narrowphase is added to the broadphase time of the statistics. Does nothing if the
+ * statistics are nullptr.
+ */
+class ContactTestStatisticsTimer
+{
+public:
+  explicit ContactTestStatisticsTimer(ContactTestStatistics* statistics);
+  ~ContactTestStatisticsTimer();
+  ContactTestStatisticsTimer(const ContactTestStatisticsTimer&) = delete;
+  ContactTestStatisticsTimer& operator=(const ContactTestStatisticsTimer&) = delete;
+  ContactTestStatisticsTimer(ContactTestStatisticsTimer&&) = delete;
+  ContactTestStatisticsTimer& operator=(ContactTestStatisticsTimer&&) = delete;
+
+private:
+  ContactTestStatistics* statistics_;
+  std::chrono::steady_clock::time_point start_time_;
+  std::chrono::nanoseconds start_narrowphase_time_{ 0 };
+};
+
 btScalar addDiscreteSingleResult(btManifoldPoint& cp,
                                  const btCollisionObjectWrapper* colObj0Wrap,
                                  const btCollisionObjectWrapper* colObj1Wrap,
@@ -292,6 +484,91 @@ struct DiscreteBroadphaseContactResultCallback : public BroadphaseContactResultC
                            int index1) override;
 };
 
+/**
+ * @brief The DiscreteQueryContactResultCallback is used to report contact points of the pairs of query objects
+ *
+ * The collision filter groups are set from the active collision objects, so they are ignored and every pair of enabled
+ * collision objects which is not allowed to be in contact is checked.
+ */
+struct DiscreteQueryContactResultCallback : public DiscreteBroadphaseContactResultCallback
+{
+  DiscreteQueryContactResultCallback(ContactTestData& collisions, double contact_distance, bool verbose = false);
+
+  bool needsCollision(const CollisionObjectWrapper* cow0, const CollisionObjectWrapper* cow1) const override;
+};
+
+/** @brief Collects the collision objects whose broadphase AABB overlaps the AABB of btBroadphaseInterface::aabbTest */
+struct BroadphaseAabbCollector : public btBroadphaseAabbCallback
+{
+  std::vector<CollisionObjectWrapper*>& overlaps_;
+
+  BroadphaseAabbCollector(std::vector<CollisionObjectWrapper*>& overlaps);
+
+  bool process(const btBroadphaseProxy* proxy) override;
+};
+
+/** @brief Keeps the closest contact between a point collision object and the collision objects it is checked against */
+struct PointCollisionCollector : public btCollisionWorld::ContactResultCallback
+{
+  const CollisionObjectWrapper* point_cow_;
+  PointContactResult& result_;
+
+  PointCollisionCollector(const CollisionObjectWrapper* point_cow, PointContactResult& result, double contact_distance);
+
+  btScalar addSingleResult(btManifoldPoint& cp,
+                           const btCollisionObjectWrapper* colObj0Wrap,
+                           int partId0,
+                           int index0,
+                           const btCollisionObjectWrapper* colObj1Wrap,
+                           int partId1,
+                           int index1) override;
+};
+
+/**
+ * @brief Keeps the collision algorithm between the point collision object and each collision object during a point
+ * contact test
+ * @details The point shape does not change between points, so the algorithm found for a collision object is reused for
+ * every point checked against it. The algorithms are freed when the cache is destroyed.
+ */
+class PointCollisionAlgorithmCache
+{
+public:
+  PointCollisionAlgorithmCache(btCollisionDispatcher& dispatcher);
+  ~PointCollisionAlgorithmCache();
+  PointCollisionAlgorithmCache(const PointCollisionAlgorithmCache&) = delete;
+  PointCollisionAlgorithmCache& operator=(const PointCollisionAlgorithmCache&) = delete;
+  PointCollisionAlgorithmCache(PointCollisionAlgorithmCache&&) = delete;
+  PointCollisionAlgorithmCache& operator=(PointCollisionAlgorithmCache&&) = delete;
+
+  /**
+   * @brief Get the collision algorithm between the point and a collision object, finding it on first use
+   * @param point_wrap The wrapper of the point collision object
+   * @param cow_wrap The wrapper of the collision object
+   * @return The collision algorithm, nullptr if the dispatcher has none for the pair
+   */
+  btCollisionAlgorithm* get(const btCollisionObjectWrapper* point_wrap, const btCollisionObjectWrapper* cow_wrap);
+
+private:
+  btCollisionDispatcher& dispatcher_;
+  std::unordered_map<const btCollisionObject*, btCollisionAlgorithm*> algorithms_;
+};
+
+/**
+ * @brief Run the narrowphase between a point collision object and a collision object
+ * @param point_cow The collision object of the point
+ * @param cow The collision object checked against the point
+ * @param algorithms The collision algorithms of the point contact test
+ * @param dispatch_info The dispatcher info
+ * @param cc The collector which keeps the closest contact of the point
+ * @param statistics The contact test statistics, nullptr if not collected
+ */
+void pointContactTestPair(const CollisionObjectWrapper& point_cow,
+                          const CollisionObjectWrapper& cow,
+                          PointCollisionAlgorithmCache& algorithms,
+                          const btDispatcherInfo& dispatch_info,
+                          PointCollisionCollector& cc,
+                          ContactTestStatistics* statistics);
+
 struct CastBroadphaseContactResultCallback : public BroadphaseContactResultCallback
 {
   CastBroadphaseContactResultCallback(ContactTestData& collisions, double contact_distance, bool verbose = false);
@@ -354,6 +631,17 @@ private:
   bool verbose_{ false };
 };
 
+/**
+ * @brief Accepts every pair added to an overlapping pair cache
+ * @details Used by the pair cache of the query contact test, which ignores the collision filter groups and leaves the
+ * filtering to DiscreteQueryContactResultCallback.
+ */
+class QueryOverlapFilterCallback : public btOverlapFilterCallback
+{
+public:
+  bool needBroadphaseCollision(btBroadphaseProxy* proxy0, btBroadphaseProxy* proxy1) const override;
+};
+
 /**
  * @brief Create a bullet collision shape from tesseract collision shape
  * @param geom Tesseract collision shape
@@ -424,6 +712,66 @@ struct CastCollisionCollector : public btCollisionWorld::ContactResultCallback
 
 COW::Ptr makeCastCollisionObject(const COW::Ptr& cow);
 
+/**
+ * @brief Create the collision object used to check points against the collision objects
+ * @details It is a sphere with zero radius which is moved to each point by setting its world transform.
+ * @return The point collision object
+ */
+COW::Ptr makePointCollisionObject();
+
+/** @brief The broadphase algorithms available to the Bullet BVH contact managers */
+enum class BulletBroadphaseType
+{
+  /** @brief Dynamic AABB tree (btDbvtBroadphase), suited to most scenes */
+  DBVT = 0,
+  /** @brief Sweep and prune within known world bounds (btAxisSweep3), suited to mostly static scenes */
+  SWEEP_AND_PRUNE = 1,
+  /** @brief Uniform spatial hash grid, suited to scenes with thousands of similarly sized objects */
+  HASH_GRID = 2
+};
+
+static const std::vector<std::string> BulletBroadphaseTypeStrings = {
+  "DBVT",
+  "SWEEP_AND_PRUNE",
+  "HASH_GRID",
+};
+
+/** @brief The broadphase configuration of the Bullet BVH contact managers */
+struct BulletBroadphaseConfig
+{
+  /** @brief The broadphase algorithm */
+  BulletBroadphaseType type{ BulletBroadphaseType::DBVT };
+
+  /**
+   * @brief The minimum corner of the world bounds used by sweep and prune
+   * @note Objects outside of the world bounds are still checked, but the broadphase gets less efficient
+   */
+  Eigen::Vector3d world_min{ -10, -10, -10 };
+
+  /** @brief The maximum corner of the world bounds used by sweep and prune */
+  Eigen::Vector3d world_max{ 10, 10, 10 };
+
+  /**
+   * @brief The maximum number of broadphase proxies used by sweep and prune
+   * @details Above 16384 the 32 bit version (bt32BitAxisSweep3) is used. The cast managers use a proxy per active
+   * collision object for the cast shape in addition to the proxy per collision object.
+   */
+  unsigned max_handles{ 16384 };
+
+  /** @brief The size of the hash grid cells, which should be close to the size of the collision objects */
+  double cell_size{ 0.2 };
+
+  /** @brief The maximum number of hash grid cells a collision object is stored in before it is treated as large */
+  std::size_t max_cells_per_proxy{ 64 };
+};
+
+/**
+ * @brief Create the broadphase of a Bullet BVH contact manager
+ * @param config The broadphase configuration
+ * @return The broadphase
+ */
+std::unique_ptr<btBroadphaseInterface> createBroadphase(const BulletBroadphaseConfig& config);
+
 /**
  * @brief Update the Broadphase AABB for the input collision object
  * @param cow The collision objects
@@ -466,6 +814,13 @@ void updateCollisionObjectFilters(const std::vector<std::string>& active,
                                   const std::unique_ptr<btBroadphaseInterface>& broadphase,
                                   const std::unique_ptr<btCollisionDispatcher>& dispatcher);
 
+/**
+ * @brief Remove the pairs whose broadphase AABBs no longer overlap from an overlapping pair cache
+ * @param pair_cache The overlapping pair cache
+ * @param dispatcher The bullet collision dispatcher, which frees the cached collision algorithms of the removed pairs
+ */
+void removeSeparatedPairs(btOverlappingPairCache& pair_cache, const std::unique_ptr<btCollisionDispatcher>& dispatcher);
+
 /**
  * @brief Refresh the broadphase data structure
  * @details When change certain properties of a collision object the broadphase is not aware so this function can be
@@ -64,6 +64,12 @@ class TesseractGjkPairDetector : public btDiscreteCollisionDetectorInterface
 
   const ContactTestData* m_cdata;
 
+  btVector3* m_warmStartAxis{ nullptr };
+  bool m_warmStartNegate{ false };
+
+  /** @brief Store the separating axis in the warm start cache entry if one was provided */
+  void updateWarmStartAxis(const btVector3& separatingAxis);
+
 public:
   // some debugging to fix degeneracy problems
   int m_lastUsedMethod;
@@ -101,6 +107,22 @@ public:
   void setCachedSeparatingAxis(const btVector3& separatingAxis) { m_cachedSeparatingAxis = separatingAxis; }
 
   const btVector3& getCachedSeparatingAxis() const { return m_cachedSeparatingAxis; }
+
+  /**
+   * @brief Set the cache entry used to warm start GJK
+   *
+   * If set, GJK starts from the separating axis stored in the entry instead of a fixed axis and the entry is updated
+   * with the separating axis found. When the same pair is checked again in a nearby configuration, GJK then starts
+   * close to the solution and needs fewer iterations.
+   *
+   * @param axis The cache entry, nullptr to disable warm starting. A zero axis is ignored.
+   * @param negate If true the entry stores the axis with the objects in the opposite order
+   */
+  void setWarmStartAxis(btVector3* axis, bool negate)
+  {
+    m_warmStartAxis = axis;
+    m_warmStartNegate = negate;
+  }
   btScalar getCachedSeparatingDistance() const { return m_cachedSeparatingDistance; }
 
   void setPenetrationDepthSolver(btConvexPenetrationDepthSolver* penetrationDepthSolver)
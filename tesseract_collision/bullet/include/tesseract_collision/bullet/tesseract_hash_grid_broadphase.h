@@ -0,0 +1,198 @@
+/**
+ * @file tesseract_hash_grid_broadphase.h
+ * @brief A uniform spatial hash grid broadphase
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, agent
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef TESSERACT_COLLISION_TESSERACT_HASH_GRID_BROADPHASE_H
+#define TESSERACT_COLLISION_TESSERACT_HASH_GRID_BROADPHASE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <BulletCollision/BroadphaseCollision/btBroadphaseInterface.h>
+#include <BulletCollision/BroadphaseCollision/btOverlappingPairCache.h>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_collision::tesseract_collision_bullet
+{
+/** @brief The broadphase proxy of the hash grid broadphase */
+struct HashGridProxy : public btBroadphaseProxy
+{
+  HashGridProxy(const btVector3& aabb_min,
+                const btVector3& aabb_max,
+                void* user_ptr,
+                int collision_filter_group,
+                int collision_filter_mask);
+
+  /** @brief The first cell covered by the AABB */
+  std::array<int, 3> cell_min{ 0, 0, 0 };
+  /** @brief The last cell covered by the AABB */
+  std::array<int, 3> cell_max{ 0, 0, 0 };
+  /** @brief Indicates the AABB covers too many cells, so the proxy is kept in the large proxies instead */
+  bool large{ false };
+  /** @brief Indicates the proxy was created or its AABB changed since the overlapping pairs were last calculated */
+  bool moved{ false };
+  /** @brief The index of the proxy in the proxies of the broadphase */
+  std::size_t index{ 0 };
+  /** @brief The last query which visited the proxy, used to skip proxies found in several cells */
+  std::size_t query_stamp{ 0 };
+};
+
+/**
+ * @brief A broadphase which stores the proxies in a uniform grid of cells found by hashing the cell coordinates
+ *
+ * Each proxy is stored in every cell its AABB covers, so the candidate pairs of a proxy are found by visiting the
+ * proxies in its cells. Only the proxies created or moved since the last call are checked when calculating the
+ * overlapping pairs, so the cost follows the number of moved proxies and not the total number of proxies. This suits
+ * scenes with thousands of objects of similar size, where a cell size close to the object size keeps the number of
+ * proxies per cell small.
+ *
+ * Proxies whose AABB covers more than the maximum number of cells, like large static objects, are kept in a separate
+ * list which is checked against every moved proxy.
+ */
+class TesseractHashGridBroadphase : public btBroadphaseInterface
+{
+public:
+  /**
+   * @brief Constructor
+   * @param cell_size The size of the grid cells
+   * @param max_cells_per_proxy The maximum number of cells a proxy is stored in before it is treated as large
+   */
+  TesseractHashGridBroadphase(double cell_size = 0.2, std::size_t max_cells_per_proxy = 64);
+  ~TesseractHashGridBroadphase() override;
+  TesseractHashGridBroadphase(const TesseractHashGridBroadphase&) = delete;
+  TesseractHashGridBroadphase& operator=(const TesseractHashGridBroadphase&) = delete;
+  TesseractHashGridBroadphase(TesseractHashGridBroadphase&&) = delete;
+  TesseractHashGridBroadphase& operator=(TesseractHashGridBroadphase&&) = delete;
+
+  btBroadphaseProxy* createProxy(const btVector3& aabbMin,
+                                 const btVector3& aabbMax,
+                                 int shapeType,
+                                 void* userPtr,
+                                 int collisionFilterGroup,
+                                 int collisionFilterMask,
+                                 btDispatcher* dispatcher) override;
+
+  void destroyProxy(btBroadphaseProxy* proxy, btDispatcher* dispatcher) override;
+
+  void setAabb(btBroadphaseProxy* proxy,
+               const btVector3& aabbMin,
+               const btVector3& aabbMax,
+               btDispatcher* dispatcher) override;
+
+  void getAabb(btBroadphaseProxy* proxy, btVector3& aabbMin, btVector3& aabbMax) const override;
+
+  void rayTest(const btVector3& rayFrom,
+               const btVector3& rayTo,
+               btBroadphaseRayCallback& rayCallback,
+               const btVector3& aabbMin = btVector3(0, 0, 0),
+               const btVector3& aabbMax = btVector3(0, 0, 0)) override;
+
+  void aabbTest(const btVector3& aabbMin, const btVector3& aabbMax, btBroadphaseAabbCallback& callback) override;
+
+  void calculateOverlappingPairs(btDispatcher* dispatcher) override;
+
+  btOverlappingPairCache* getOverlappingPairCache() override;
+
+  const btOverlappingPairCache* getOverlappingPairCache() const override;
+
+  void getBroadphaseAabb(btVector3& aabbMin, btVector3& aabbMax) const override;
+
+  void printStats() override;
+
+  /** @brief The size of the grid cells */
+  double getCellSize() const;
+
+  /** @brief The maximum number of cells a proxy is stored in before it is treated as large */
+  std::size_t getMaxCellsPerProxy() const;
+
+private:
+  btScalar cell_size_;
+  btScalar inv_cell_size_;
+  std::size_t max_cells_per_proxy_;
+
+  /** @brief The overlapping pairs of the proxies */
+  std::unique_ptr<btOverlappingPairCache> pair_cache_;
+
+  /** @brief All proxies */
+  std::vector<std::unique_ptr<HashGridProxy>> proxies_;
+
+  /** @brief The proxies stored in each cell, keyed by the hashed cell coordinates */
+  std::unordered_map<std::uint64_t, std::vector<HashGridProxy*>> cells_;
+
+  /** @brief The proxies whose AABB covers too many cells to be stored in the cells */
+  std::vector<HashGridProxy*> large_proxies_;
+
+  /** @brief The proxies created or moved since the overlapping pairs were last calculated */
+  std::vector<HashGridProxy*> moved_proxies_;
+
+  /** @brief The unique id assigned to the next proxy, used by the pair cache to order and hash the pairs */
+  int next_unique_id_{ 0 };
+
+  /** @brief The current query stamp, incremented for every query */
+  std::size_t query_stamp_{ 0 };
+
+  /**
+   * @brief Get the range of cells covered by an AABB
+   * @return The number of cells covered by the AABB, which is limited to more than the maximum cells per proxy
+   */
+  std::size_t getCellRange(const btVector3& aabb_min,
+                           const btVector3& aabb_max,
+                           std::array<int, 3>& cell_min,
+                           std::array<int, 3>& cell_max) const;
+
+  /** @brief Store the proxy in the cells covered by its AABB */
+  void addToGrid(HashGridProxy* proxy);
+
+  /** @brief Remove the proxy from the cells it is stored in */
+  void removeFromGrid(HashGridProxy* proxy);
+
+  /**
+   * @brief Visit every proxy whose AABB may overlap the AABB, each proxy is visited once
+   * @param fn The function called with each proxy
+   */
+  template <typename Fn>
+  void forEachCandidate(const btVector3& aabb_min, const btVector3& aabb_max, Fn&& fn);
+};
+
+}  // namespace tesseract_collision::tesseract_collision_bullet
+#endif  // TESSERACT_COLLISION_TESSERACT_HASH_GRID_BROADPHASE_H
@@ -48,7 +48,8 @@ namespace tesseract_collision::tesseract_collision_bullet
 static const CollisionShapesConst EMPTY_COLLISION_SHAPES_CONST;
 static const tesseract_common::VectorIsometry3d EMPTY_COLLISION_SHAPES_TRANSFORMS;
 
-BulletCastBVHManager::BulletCastBVHManager(std::string name) : name_(std::move(name))
+BulletCastBVHManager::BulletCastBVHManager(std::string name, BulletBroadphaseConfig broadphase_config)
+  : name_(std::move(name)), broadphase_config_(std::move(broadphase_config))
 {
   // Bullet adds a margin of 5cm to which is an extern variable, so we set it to zero.
   gDbvtMargin = 0;
@@ -63,10 +64,11 @@ BulletCastBVHManager::BulletCastBVHManager(std::string name) : name_(std::move(n
   dispatcher_->setDispatcherFlags(dispatcher_->getDispatcherFlags() &
                                   ~btCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD);
 
-  broadphase_ = std::make_unique<btDbvtBroadphase>();
+  broadphase_ = createBroadphase(broadphase_config_);
   broadphase_->getOverlappingPairCache()->setOverlapFilterCallback(&broadphase_overlap_cb_);
 
   contact_test_data_.collision_margin_data = CollisionMarginData(0);
+  contact_test_data_.collision_margin_table = &collision_margin_table_;
 }
 
 BulletCastBVHManager::~BulletCastBVHManager()
@@ -84,30 +86,37 @@ std::string BulletCastBVHManager::getName() const { return name_; }
 
 ContinuousContactManager::UPtr BulletCastBVHManager::clone() const
 {
-  auto manager = std::make_unique<BulletCastBVHManager>();
+  auto manager = std::make_unique<BulletCastBVHManager>(name_, broadphase_config_);
 
   auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
 
-  for (const auto& cow : link2cow_)
+  // Keep the insertion order so the clone assigns the same ids, see GjkWarmStartCache
+  for (const auto& name : collision_objects_)
   {
-    COW::Ptr new_cow = cow.second->clone();
+    const COW::Ptr& cow = link2cow_.at(name);
+    COW::Ptr new_cow = cow->clone();
 
     assert(new_cow->getCollisionShape());
     assert(new_cow->getCollisionShape()->getShapeType() != CUSTOM_CONVEX_SHAPE_TYPE);
 
-    new_cow->setWorldTransform(cow.second->getWorldTransform());
+    new_cow->setWorldTransform(cow->getWorldTransform());
     new_cow->setContactProcessingThreshold(margin);
 
     manager->addCollisionObject(new_cow);
+    manager->link2castcow_.at(name)->m_gjkWarmStartCache = link2castcow_.at(name)->m_gjkWarmStartCache;
   }
 
   manager->setActiveCollisionObjects(active_);
   manager->setCollisionMarginData(contact_test_data_.collision_margin_data);
   manager->setIsContactAllowedFn(contact_test_data_.fn);
+  manager->setStatisticsEnabled(statistics_enabled_);
+  manager->setDenseLinkNames(dense_link_names_);
 
   return manager;
 }
 
+const BulletBroadphaseConfig& BulletCastBVHManager::getBroadphaseConfig() const { return broadphase_config_; }
+
 bool BulletCastBVHManager::addCollisionObject(const std::string& name,
                                               const int& mask_id,
                                               const CollisionShapesConst& shapes,
@@ -162,7 +171,12 @@ bool BulletCastBVHManager::removeCollisionObject(const std::string& name)
     COW::Ptr& cow2 = link2castcow_[name];
     removeCollisionObjectFromBroadphase(cow2, broadphase_, dispatcher_);
     link2castcow_.erase(name);
+    stale_cast_cows_.erase(name);
 
+    collision_margin_table_dirty_ = true;
+    clearGjkWarmStartCaches(link2cow_);
+    clearGjkWarmStartCaches(link2castcow_);
+    updateDenseCollisionObjects();
     return true;
   }
 
@@ -274,70 +288,7 @@ void BulletCastBVHManager::setCollisionObjectsTransform(const std::string& name,
   // geometry
   auto it = link2castcow_.find(name);
   if (it != link2castcow_.end())
-  {
-    COW::Ptr& cow = it->second;
-    assert(cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter);
-
-    btTransform tf1 = convertEigenToBt(pose1);
-    btTransform tf2 = convertEigenToBt(pose2);
-
-    cow->setWorldTransform(tf1);
-    link2cow_[name]->setWorldTransform(tf1);
-
-    // If collision object is disabled dont proceed
-    if (cow->m_enabled)
-    {
-      if (btBroadphaseProxy::isConvex(cow->getCollisionShape()->getShapeType()))
-      {
-        assert(dynamic_cast<CastHullShape*>(cow->getCollisionShape()) != nullptr);
-        static_cast<CastHullShape*>(cow->getCollisionShape())->updateCastTransform(tf1.inverseTimes(tf2));
-      }
-      else if (btBroadphaseProxy::isCompound(cow->getCollisionShape()->getShapeType()))
-      {
-        assert(dynamic_cast<btCompoundShape*>(cow->getCollisionShape()) != nullptr);
-        auto* compound = static_cast<btCompoundShape*>(cow->getCollisionShape());
-        for (int i = 0; i < compound->getNumChildShapes(); ++i)
-        {
-          if (btBroadphaseProxy::isConvex(compound->getChildShape(i)->getShapeType()))
-          {
-            assert(dynamic_cast<CastHullShape*>(compound->getChildShape(i)) != nullptr);
-            const btTransform& local_tf = compound->getChildTransform(i);
-
-            btTransform delta_tf = (tf1 * local_tf).inverseTimes(tf2 * local_tf);
-            static_cast<CastHullShape*>(compound->getChildShape(i))->updateCastTransform(delta_tf);
-            compound->updateChildTransform(i, local_tf, false);  // This is required to update the BVH tree
-          }
-          else if (btBroadphaseProxy::isCompound(compound->getChildShape(i)->getShapeType()))
-          {
-            assert(dynamic_cast<btCompoundShape*>(compound->getChildShape(i)) != nullptr);
-            auto* second_compound = static_cast<btCompoundShape*>(compound->getChildShape(i));
-
-            for (int j = 0; j < second_compound->getNumChildShapes(); ++j)
-            {
-              assert(!btBroadphaseProxy::isCompound(second_compound->getChildShape(j)->getShapeType()));
-              assert(dynamic_cast<CastHullShape*>(second_compound->getChildShape(j)) != nullptr);
-              const btTransform& local_tf = second_compound->getChildTransform(j);
-
-              btTransform delta_tf = (tf1 * local_tf).inverseTimes(tf2 * local_tf);
-              static_cast<CastHullShape*>(second_compound->getChildShape(j))->updateCastTransform(delta_tf);
-              second_compound->updateChildTransform(j, local_tf, false);  // This is required to update the BVH tree
-            }
-            second_compound->recalculateLocalAabb();
-          }
-        }
-        compound->recalculateLocalAabb();
-      }
-      else
-      {
-        throw std::runtime_error("I can only continuous collision check convex shapes and compound shapes made of "
-                                 "convex "
-                                 "shapes");
-      }
-
-      // Now update Broadphase AABB (See BulletWorld updateSingleAabb function)
-      updateBroadphaseAABB(cow, broadphase_, dispatcher_);
-    }
-  }
+    setCastCollisionObjectsTransform(link2cow_[name], it->second, pose1, pose2);
 }
 
 void BulletCastBVHManager::setCollisionObjectsTransform(const std::vector<std::string>& names,
@@ -365,6 +316,46 @@ void BulletCastBVHManager::setCollisionObjectsTransform(const tesseract_common::
   }
 }
 
+bool BulletCastBVHManager::updateCollisionObjectOctree(const std::string& name,
+                                                       std::size_t shape_index,
+                                                       const tesseract_geometry::Octree::ConstPtr& octree,
+                                                       const OctreeDelta& delta)
+{
+  // The cast collision object of an active link wraps every child of the octree, so it is replaced instead
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end() || it->second->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter ||
+      !it->second->updateOctree(shape_index, octree, delta))
+    return false;
+
+  // The cached collision algorithms may still reference the previous compound shape
+  broadphase_->getOverlappingPairCache()->cleanProxyFromPairs(it->second->getBroadphaseHandle(), dispatcher_.get());
+  updateBroadphaseAABB(it->second, broadphase_, dispatcher_);
+
+  stale_cast_cows_.insert(name);
+  return true;
+}
+
+void BulletCastBVHManager::setDenseLinkNames(const std::vector<std::string>& link_names)
+{
+  ContinuousContactManager::setDenseLinkNames(link_names);
+  updateDenseCollisionObjects();
+}
+
+void BulletCastBVHManager::setDenseCollisionObjectsTransform(const tesseract_common::VectorIsometry3d& pose1,
+                                                             const tesseract_common::VectorIsometry3d& pose2)
+{
+  assert(pose1.size() == dense_cows_.size());
+  assert(pose2.size() == dense_cows_.size());
+  for (std::size_t i = 0; i < dense_cows_.size(); ++i)
+  {
+    const COW::Ptr& cast_cow = dense_cast_cows_[i];
+    if (cast_cow == nullptr || cast_cow->m_collisionFilterGroup != btBroadphaseProxy::KinematicFilter)
+      continue;
+
+    setCastCollisionObjectsTransform(dense_cows_[i], cast_cow, pose1[i], pose2[i]);
+  }
+}
+
 const std::vector<std::string>& BulletCastBVHManager::getCollisionObjects() const { return collision_objects_; }
 
 void BulletCastBVHManager::setActiveCollisionObjects(const std::vector<std::string>& names)
@@ -404,6 +395,10 @@ void BulletCastBVHManager::setActiveCollisionObjects(const std::vector<std::stri
       // Update with active
       updateCollisionObjectFilters(active_, cow, broadphase_, dispatcher_);
 
+      // The cast collision object of a link whose octree was updated is rebuilt when the link becomes active
+      if (isLinkActive(active_, cow->getName()))
+        updateStaleCastCollisionObject(cow);
+
       // Get the active collision object
       COW::Ptr& active_cow = link2castcow_[cow->getName()];
 
@@ -455,8 +450,43 @@ IsContactAllowedFn BulletCastBVHManager::getIsContactAllowedFn() const { return
 void BulletCastBVHManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
   contact_test_data_.res = &collisions;
+  contact_test_data_.res_pool = &contact_result_map_pool_;
   contact_test_data_.req = request;
+  contactTest();
+}
+
+void BulletCastBVHManager::contactTest(CompactContactResults& collisions, const ContactRequest& request)
+{
+  collisions.clear();
+  contact_test_data_.res = nullptr;
+  contact_test_data_.compact_res = &collisions;
+  contact_test_data_.req = request;
+  contactTest();
+  contact_test_data_.compact_res = nullptr;
+
+  // The collision margin table is up to date after the contact test, so its names match the collision object ids
+  collisions.setObjectNames(collision_margin_table_.getObjectNames());
+}
+
+bool BulletCastBVHManager::anyContactTest(const ContactRequest& request)
+{
+  contact_test_data_.res = nullptr;
+  contact_test_data_.req = request;
+  contactTest();
+  return contact_test_data_.done;
+}
+
+void BulletCastBVHManager::setStatisticsEnabled(bool enabled) { statistics_enabled_ = enabled; }
+
+void BulletCastBVHManager::contactTest()
+{
+  if (collision_margin_table_dirty_)
+    updateCollisionMarginTable();
+  updateAllowedCollisionLinkIds();
+
   contact_test_data_.done = false;
+  contact_test_data_.statistics = statistics_enabled_ ? &statistics_ : nullptr;
+  ContactTestStatisticsTimer timer(contact_test_data_.statistics);
 
   broadphase_->calculateOverlappingPairs(dispatcher_.get());
 
@@ -496,10 +526,16 @@ void BulletCastBVHManager::addCollisionObject(const COW::Ptr& cow)
                                                              selected_cow->m_collisionFilterGroup,
                                                              selected_cow->m_collisionFilterMask,
                                                              dispatcher_.get()));
+
+  collision_margin_table_dirty_ = true;
+  allowed_collision_link_ids_dirty_ = true;
+  updateDenseCollisionObjects();
 }
 
 void BulletCastBVHManager::onCollisionMarginDataChanged()
 {
+  updateCollisionMarginTable();
+
   auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
   for (auto& co : link2cow_)
   {
@@ -518,4 +554,149 @@ void BulletCastBVHManager::onCollisionMarginDataChanged()
   }
 }
 
+void BulletCastBVHManager::updateStaleCastCollisionObject(const COW::Ptr& cow)
+{
+  auto it = stale_cast_cows_.find(cow->getName());
+  if (it == stale_cast_cows_.end())
+    return;
+
+  stale_cast_cows_.erase(it);
+  COW::Ptr& cast_cow = link2castcow_[cow->getName()];
+  COW::Ptr new_cast_cow = makeCastCollisionObject(cow);
+  new_cast_cow->setUserPointer(&contact_test_data_);
+  new_cast_cow->setContactProcessingThreshold(cast_cow->getContactProcessingThreshold());
+  cast_cow = new_cast_cow;
+  updateDenseCollisionObjects();
+}
+
+void BulletCastBVHManager::updateDenseCollisionObjects()
+{
+  dense_cows_.clear();
+  dense_cast_cows_.clear();
+  dense_cows_.reserve(dense_link_names_.size());
+  dense_cast_cows_.reserve(dense_link_names_.size());
+  for (const auto& link_name : dense_link_names_)
+  {
+    auto it = link2cow_.find(link_name);
+    if (it != link2cow_.end())
+    {
+      dense_cows_.push_back(it->second);
+      dense_cast_cows_.push_back(link2castcow_.at(link_name));
+    }
+    else
+    {
+      dense_cows_.push_back(nullptr);
+      dense_cast_cows_.push_back(nullptr);
+    }
+  }
+}
+
+void BulletCastBVHManager::setCastCollisionObjectsTransform(const COW::Ptr& cow,
+                                                            const COW::Ptr& cast_cow,
+                                                            const Eigen::Isometry3d& pose1,
+                                                            const Eigen::Isometry3d& pose2)
+{
+  assert(cast_cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter);
+
+  btTransform tf1 = convertEigenToBt(pose1);
+  btTransform tf2 = convertEigenToBt(pose2);
+
+  cast_cow->setWorldTransform(tf1);
+  cow->setWorldTransform(tf1);
+
+  // If collision object is disabled dont proceed
+  if (cast_cow->m_enabled)
+  {
+    if (btBroadphaseProxy::isConvex(cast_cow->getCollisionShape()->getShapeType()))
+    {
+      assert(dynamic_cast<CastHullShape*>(cast_cow->getCollisionShape()) != nullptr);
+      static_cast<CastHullShape*>(cast_cow->getCollisionShape())->updateCastTransform(tf1.inverseTimes(tf2));
+    }
+    else if (btBroadphaseProxy::isCompound(cast_cow->getCollisionShape()->getShapeType()))
+    {
+      assert(dynamic_cast<btCompoundShape*>(cast_cow->getCollisionShape()) != nullptr);
+      auto* compound = static_cast<btCompoundShape*>(cast_cow->getCollisionShape());
+      for (int i = 0; i < compound->getNumChildShapes(); ++i)
+      {
+        if (btBroadphaseProxy::isConvex(compound->getChildShape(i)->getShapeType()))
+        {
+          assert(dynamic_cast<CastHullShape*>(compound->getChildShape(i)) != nullptr);
+          const btTransform& local_tf = compound->getChildTransform(i);
+
+          btTransform delta_tf = (tf1 * local_tf).inverseTimes(tf2 * local_tf);
+          static_cast<CastHullShape*>(compound->getChildShape(i))->updateCastTransform(delta_tf);
+          compound->updateChildTransform(i, local_tf, false);  // This is required to update the BVH tree
+        }
+        else if (btBroadphaseProxy::isCompound(compound->getChildShape(i)->getShapeType()))
+        {
+          assert(dynamic_cast<btCompoundShape*>(compound->getChildShape(i)) != nullptr);
+          auto* second_compound = static_cast<btCompoundShape*>(compound->getChildShape(i));
+
+          for (int j = 0; j < second_compound->getNumChildShapes(); ++j)
+          {
+            assert(!btBroadphaseProxy::isCompound(second_compound->getChildShape(j)->getShapeType()));
+            assert(dynamic_cast<CastHullShape*>(second_compound->getChildShape(j)) != nullptr);
+            const btTransform& local_tf = second_compound->getChildTransform(j);
+
+            btTransform delta_tf = (tf1 * local_tf).inverseTimes(tf2 * local_tf);
+            static_cast<CastHullShape*>(second_compound->getChildShape(j))->updateCastTransform(delta_tf);
+            second_compound->updateChildTransform(j, local_tf, false);  // This is required to update the BVH tree
+          }
+          second_compound->recalculateLocalAabb();
+        }
+      }
+      compound->recalculateLocalAabb();
+    }
+    else
+    {
+      throw std::runtime_error("I can only continuous collision check convex shapes and compound shapes made of "
+                               "convex "
+                               "shapes");
+    }
+
+    // Now update Broadphase AABB (See BulletWorld updateSingleAabb function)
+    updateBroadphaseAABB(cast_cow, broadphase_, dispatcher_);
+  }
+}
+
+void BulletCastBVHManager::updateCollisionMarginTable()
+{
+  // The GJK warm start caches are only valid while the ids do not change, see GjkWarmStartCache
+  bool clear_warm_start{ false };
+
+  collision_margin_table_.update(contact_test_data_.collision_margin_data, collision_objects_);
+  for (std::size_t i = 0; i < collision_objects_.size(); ++i)
+  {
+    const COW::Ptr& cow = link2cow_.at(collision_objects_[i]);
+    const COW::Ptr& cast_cow = link2castcow_.at(collision_objects_[i]);
+    clear_warm_start = clear_warm_start || (cow->m_collisionObjectId != static_cast<int>(i)) ||
+                       (cast_cow->m_collisionObjectId != static_cast<int>(i));
+    cow->m_collisionObjectId = static_cast<int>(i);
+    cast_cow->m_collisionObjectId = static_cast<int>(i);
+  }
+
+  if (clear_warm_start)
+  {
+    clearGjkWarmStartCaches(link2cow_);
+    clearGjkWarmStartCaches(link2castcow_);
+  }
+
+  collision_margin_table_dirty_ = false;
+}
+
+void BulletCastBVHManager::updateAllowedCollisionLinkIds()
+{
+  contact_test_data_.compiled_acm = getCompiledAllowedCollisionMatrix(contact_test_data_.fn);
+  if (contact_test_data_.compiled_acm == nullptr)
+    return;
+
+  const std::size_t revision = contact_test_data_.compiled_acm->getLinkIdRevision();
+  if (!allowed_collision_link_ids_dirty_ && revision == allowed_collision_link_id_revision_)
+    return;
+
+  setAllowedCollisionLinkIds(link2cow_, *contact_test_data_.compiled_acm);
+  setAllowedCollisionLinkIds(link2castcow_, *contact_test_data_.compiled_acm);
+  allowed_collision_link_id_revision_ = revision;
+  allowed_collision_link_ids_dirty_ = false;
+}
 }  // namespace tesseract_collision::tesseract_collision_bullet
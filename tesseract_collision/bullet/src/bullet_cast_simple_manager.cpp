@@ -58,6 +58,7 @@ BulletCastSimpleManager::BulletCastSimpleManager(std::string name) : name_(std::
   dispatcher_->setDispatcherFlags(dispatcher_->getDispatcherFlags() &
                                   ~btCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD);
   contact_test_data_.collision_margin_data = CollisionMarginData(0);
+  contact_test_data_.collision_margin_table = &collision_margin_table_;
 }
 
 std::string BulletCastSimpleManager::getName() const { return name_; }
@@ -68,22 +69,27 @@ ContinuousContactManager::UPtr BulletCastSimpleManager::clone() const
 
   auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
 
-  for (const auto& cow : link2cow_)
+  // Keep the insertion order so the clone assigns the same ids, see GjkWarmStartCache
+  for (const auto& name : collision_objects_)
   {
-    COW::Ptr new_cow = cow.second->clone();
+    const COW::Ptr& cow = link2cow_.at(name);
+    COW::Ptr new_cow = cow->clone();
 
     assert(new_cow->getCollisionShape());
     assert(new_cow->getCollisionShape()->getShapeType() != CUSTOM_CONVEX_SHAPE_TYPE);
 
-    new_cow->setWorldTransform(cow.second->getWorldTransform());
+    new_cow->setWorldTransform(cow->getWorldTransform());
     new_cow->setContactProcessingThreshold(margin);
 
     manager->addCollisionObject(new_cow);
+    manager->link2castcow_.at(name)->m_gjkWarmStartCache = link2castcow_.at(name)->m_gjkWarmStartCache;
   }
 
   manager->setActiveCollisionObjects(active_);
   manager->setCollisionMarginData(contact_test_data_.collision_margin_data);
   manager->setIsContactAllowedFn(contact_test_data_.fn);
+  manager->setStatisticsEnabled(statistics_enabled_);
+  manager->setDenseLinkNames(dense_link_names_);
 
   return manager;
 }
@@ -138,6 +144,11 @@ bool BulletCastSimpleManager::removeCollisionObject(const std::string& name)
     collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
     link2cow_.erase(name);
     link2castcow_.erase(name);
+    stale_cast_cows_.erase(name);
+    collision_margin_table_dirty_ = true;
+    clearGjkWarmStartCaches(link2cow_);
+    clearGjkWarmStartCaches(link2castcow_);
+    updateDenseCollisionObjects();
     return true;
   }
 
@@ -214,65 +225,7 @@ void BulletCastSimpleManager::setCollisionObjectsTransform(const std::string& na
   // geometry
   auto it = link2castcow_.find(name);
   if (it != link2castcow_.end())
-  {
-    COW::Ptr& cow = it->second;
-    assert(cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter);
-
-    btTransform tf1 = convertEigenToBt(pose1);
-    btTransform tf2 = convertEigenToBt(pose2);
-
-    cow->setWorldTransform(tf1);
-    link2cow_[name]->setWorldTransform(tf1);
-
-    // If collision object is disabled dont proceed
-    if (cow->m_enabled)
-    {
-      if (btBroadphaseProxy::isConvex(cow->getCollisionShape()->getShapeType()))
-      {
-        assert(dynamic_cast<CastHullShape*>(cow->getCollisionShape()) != nullptr);
-        static_cast<CastHullShape*>(cow->getCollisionShape())->updateCastTransform(tf1.inverseTimes(tf2));
-      }
-      else if (btBroadphaseProxy::isCompound(cow->getCollisionShape()->getShapeType()))
-      {
-        assert(dynamic_cast<btCompoundShape*>(cow->getCollisionShape()) != nullptr);
-        auto* compound = static_cast<btCompoundShape*>(cow->getCollisionShape());
-        for (int i = 0; i < compound->getNumChildShapes(); ++i)
-        {
-          if (btBroadphaseProxy::isConvex(compound->getChildShape(i)->getShapeType()))
-          {
-            assert(dynamic_cast<CastHullShape*>(compound->getChildShape(i)) != nullptr);
-            const btTransform& local_tf = compound->getChildTransform(i);
-
-            btTransform delta_tf = (tf1 * local_tf).inverseTimes(tf2 * local_tf);
-            static_cast<CastHullShape*>(compound->getChildShape(i))->updateCastTransform(delta_tf);
-            compound->updateChildTransform(i, local_tf, false);  // This is required to update the BVH tree
-          }
-          else if (btBroadphaseProxy::isCompound(compound->getChildShape(i)->getShapeType()))
-          {
-            assert(dynamic_cast<btCompoundShape*>(compound->getChildShape(i)) != nullptr);
-            auto* second_compound = static_cast<btCompoundShape*>(compound->getChildShape(i));
-
-            for (int j = 0; j < second_compound->getNumChildShapes(); ++j)
-            {
-              assert(!btBroadphaseProxy::isCompound(second_compound->getChildShape(j)->getShapeType()));
-              assert(dynamic_cast<CastHullShape*>(second_compound->getChildShape(j)) != nullptr);
-              const btTransform& local_tf = second_compound->getChildTransform(j);
-
-              btTransform delta_tf = (tf1 * local_tf).inverseTimes(tf2 * local_tf);
-              static_cast<CastHullShape*>(second_compound->getChildShape(j))->updateCastTransform(delta_tf);
-              second_compound->updateChildTransform(j, local_tf, false);  // This is required to update the BVH tree
-            }
-            second_compound->recalculateLocalAabb();
-          }
-        }
-        compound->recalculateLocalAabb();
-      }
-      else
-      {
-        throw std::runtime_error("I can only collision check convex shapes and compound shapes made of convex shapes");
-      }
-    }
-  }
+    setCastCollisionObjectsTransform(link2cow_[name], it->second, pose1, pose2);
 }
 
 void BulletCastSimpleManager::setCollisionObjectsTransform(const std::vector<std::string>& names,
@@ -300,6 +253,42 @@ void BulletCastSimpleManager::setCollisionObjectsTransform(const tesseract_commo
   }
 }
 
+bool BulletCastSimpleManager::updateCollisionObjectOctree(const std::string& name,
+                                                          std::size_t shape_index,
+                                                          const tesseract_geometry::Octree::ConstPtr& octree,
+                                                          const OctreeDelta& delta)
+{
+  // The cast collision object of an active link wraps every child of the octree, so it is replaced instead
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end() || it->second->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter ||
+      !it->second->updateOctree(shape_index, octree, delta))
+    return false;
+
+  stale_cast_cows_.insert(name);
+  return true;
+}
+
+void BulletCastSimpleManager::setDenseLinkNames(const std::vector<std::string>& link_names)
+{
+  ContinuousContactManager::setDenseLinkNames(link_names);
+  updateDenseCollisionObjects();
+}
+
+void BulletCastSimpleManager::setDenseCollisionObjectsTransform(const tesseract_common::VectorIsometry3d& pose1,
+                                                                const tesseract_common::VectorIsometry3d& pose2)
+{
+  assert(pose1.size() == dense_cows_.size());
+  assert(pose2.size() == dense_cows_.size());
+  for (std::size_t i = 0; i < dense_cows_.size(); ++i)
+  {
+    const COW::Ptr& cast_cow = dense_cast_cows_[i];
+    if (cast_cow == nullptr || cast_cow->m_collisionFilterGroup != btBroadphaseProxy::KinematicFilter)
+      continue;
+
+    setCastCollisionObjectsTransform(dense_cows_[i], cast_cow, pose1[i], pose2[i]);
+  }
+}
+
 const std::vector<std::string>& BulletCastSimpleManager::getCollisionObjects() const { return collision_objects_; }
 
 void BulletCastSimpleManager::setActiveCollisionObjects(const std::vector<std::string>& names)
@@ -318,6 +307,10 @@ void BulletCastSimpleManager::setActiveCollisionObjects(const std::vector<std::s
     // Update with request
     updateCollisionObjectFilters(active_, cow);
 
+    // The cast collision object of a link whose octree was updated is rebuilt when the link becomes active
+    if (cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter)
+      updateStaleCastCollisionObject(cow);
+
     // Get the cast collision object
     COW::Ptr cast_cow = link2castcow_[cow->getName()];
 
@@ -368,8 +361,43 @@ IsContactAllowedFn BulletCastSimpleManager::getIsContactAllowedFn() const { retu
 void BulletCastSimpleManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
   contact_test_data_.res = &collisions;
+  contact_test_data_.res_pool = &contact_result_map_pool_;
+  contact_test_data_.req = request;
+  contactTest();
+}
+
+void BulletCastSimpleManager::contactTest(CompactContactResults& collisions, const ContactRequest& request)
+{
+  collisions.clear();
+  contact_test_data_.res = nullptr;
+  contact_test_data_.compact_res = &collisions;
   contact_test_data_.req = request;
+  contactTest();
+  contact_test_data_.compact_res = nullptr;
+
+  // The collision margin table is up to date after the contact test, so its names match the collision object ids
+  collisions.setObjectNames(collision_margin_table_.getObjectNames());
+}
+
+bool BulletCastSimpleManager::anyContactTest(const ContactRequest& request)
+{
+  contact_test_data_.res = nullptr;
+  contact_test_data_.req = request;
+  contactTest();
+  return contact_test_data_.done;
+}
+
+void BulletCastSimpleManager::setStatisticsEnabled(bool enabled) { statistics_enabled_ = enabled; }
+
+void BulletCastSimpleManager::contactTest()
+{
+  if (collision_margin_table_dirty_)
+    updateCollisionMarginTable();
+  updateAllowedCollisionLinkIds();
+
   contact_test_data_.done = false;
+  contact_test_data_.statistics = statistics_enabled_ ? &statistics_ : nullptr;
+  ContactTestStatisticsTimer timer(contact_test_data_.statistics);
 
   for (auto cow1_iter = cows_.begin(); cow1_iter != (cows_.end() - 1); cow1_iter++)
   {
@@ -400,7 +428,10 @@ void BulletCastSimpleManager::contactTest(ContactResultMap& collisions, const Co
 
       if (aabb_check)
       {
-        bool needs_collision = needsCollisionCheck(*cow1, *cow2, contact_test_data_.fn, false);
+        if (contact_test_data_.statistics != nullptr)
+          ++contact_test_data_.statistics->broadphase_pairs;
+
+        bool needs_collision = needsCollisionCheck(*cow1, *cow2, contact_test_data_, false);
 
         if (needs_collision)
         {
@@ -416,12 +447,17 @@ void BulletCastSimpleManager::contactTest(ContactResultMap& collisions, const Co
             contactPointResult.m_closestPointDistanceThreshold = cc.m_closestDistanceThreshold;
 
             // discrete collision detection query
-            algorithm->processCollision(&obA, &obB, dispatch_info_, &contactPointResult);
+            processNarrowphase(
+                algorithm, &obA, &obB, dispatch_info_, &contactPointResult, contact_test_data_.statistics);
 
             algorithm->~btCollisionAlgorithm();
             dispatcher_->freeCollisionAlgorithm(algorithm);
           }
         }
+        else if (contact_test_data_.statistics != nullptr)
+        {
+          ++contact_test_data_.statistics->rejected_pairs;
+        }
       }
 
       if (contact_test_data_.done)
@@ -450,10 +486,16 @@ void BulletCastSimpleManager::addCollisionObject(const COW::Ptr& cow)
     cows_.insert(cows_.begin(), cast_cow);
   else
     cows_.push_back(cow);
+
+  collision_margin_table_dirty_ = true;
+  allowed_collision_link_ids_dirty_ = true;
+  updateDenseCollisionObjects();
 }
 
 void BulletCastSimpleManager::onCollisionMarginDataChanged()
 {
+  updateCollisionMarginTable();
+
   auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
   for (auto& co : link2cow_)
     co.second->setContactProcessingThreshold(margin);
@@ -462,4 +504,144 @@ void BulletCastSimpleManager::onCollisionMarginDataChanged()
     co.second->setContactProcessingThreshold(margin);
 }
 
+void BulletCastSimpleManager::updateStaleCastCollisionObject(const COW::Ptr& cow)
+{
+  auto it = stale_cast_cows_.find(cow->getName());
+  if (it == stale_cast_cows_.end())
+    return;
+
+  stale_cast_cows_.erase(it);
+  COW::Ptr& cast_cow = link2castcow_[cow->getName()];
+  COW::Ptr new_cast_cow = makeCastCollisionObject(cow);
+  new_cast_cow->setUserPointer(&contact_test_data_);
+  new_cast_cow->setContactProcessingThreshold(cast_cow->getContactProcessingThreshold());
+  cast_cow = new_cast_cow;
+  updateDenseCollisionObjects();
+}
+
+void BulletCastSimpleManager::updateDenseCollisionObjects()
+{
+  dense_cows_.clear();
+  dense_cast_cows_.clear();
+  dense_cows_.reserve(dense_link_names_.size());
+  dense_cast_cows_.reserve(dense_link_names_.size());
+  for (const auto& link_name : dense_link_names_)
+  {
+    auto it = link2cow_.find(link_name);
+    if (it != link2cow_.end())
+    {
+      dense_cows_.push_back(it->second);
+      dense_cast_cows_.push_back(link2castcow_.at(link_name));
+    }
+    else
+    {
+      dense_cows_.push_back(nullptr);
+      dense_cast_cows_.push_back(nullptr);
+    }
+  }
+}
+
+void BulletCastSimpleManager::setCastCollisionObjectsTransform(const COW::Ptr& cow,
+                                                               const COW::Ptr& cast_cow,
+                                                               const Eigen::Isometry3d& pose1,
+                                                               const Eigen::Isometry3d& pose2)
+{
+  assert(cast_cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter);
+
+  btTransform tf1 = convertEigenToBt(pose1);
+  btTransform tf2 = convertEigenToBt(pose2);
+
+  cast_cow->setWorldTransform(tf1);
+  cow->setWorldTransform(tf1);
+
+  // If collision object is disabled dont proceed
+  if (cast_cow->m_enabled)
+  {
+    if (btBroadphaseProxy::isConvex(cast_cow->getCollisionShape()->getShapeType()))
+    {
+      assert(dynamic_cast<CastHullShape*>(cast_cow->getCollisionShape()) != nullptr);
+      static_cast<CastHullShape*>(cast_cow->getCollisionShape())->updateCastTransform(tf1.inverseTimes(tf2));
+    }
+    else if (btBroadphaseProxy::isCompound(cast_cow->getCollisionShape()->getShapeType()))
+    {
+      assert(dynamic_cast<btCompoundShape*>(cast_cow->getCollisionShape()) != nullptr);
+      auto* compound = static_cast<btCompoundShape*>(cast_cow->getCollisionShape());
+      for (int i = 0; i < compound->getNumChildShapes(); ++i)
+      {
+        if (btBroadphaseProxy::isConvex(compound->getChildShape(i)->getShapeType()))
+        {
+          assert(dynamic_cast<CastHullShape*>(compound->getChildShape(i)) != nullptr);
+          const btTransform& local_tf = compound->getChildTransform(i);
+
+          btTransform delta_tf = (tf1 * local_tf).inverseTimes(tf2 * local_tf);
+          static_cast<CastHullShape*>(compound->getChildShape(i))->updateCastTransform(delta_tf);
+          compound->updateChildTransform(i, local_tf, false);  // This is required to update the BVH tree
+        }
+        else if (btBroadphaseProxy::isCompound(compound->getChildShape(i)->getShapeType()))
+        {
+          assert(dynamic_cast<btCompoundShape*>(compound->getChildShape(i)) != nullptr);
+          auto* second_compound = static_cast<btCompoundShape*>(compound->getChildShape(i));
+
+          for (int j = 0; j < second_compound->getNumChildShapes(); ++j)
+          {
+            assert(!btBroadphaseProxy::isCompound(second_compound->getChildShape(j)->getShapeType()));
+            assert(dynamic_cast<CastHullShape*>(second_compound->getChildShape(j)) != nullptr);
+            const btTransform& local_tf = second_compound->getChildTransform(j);
+
+            btTransform delta_tf = (tf1 * local_tf).inverseTimes(tf2 * local_tf);
+            static_cast<CastHullShape*>(second_compound->getChildShape(j))->updateCastTransform(delta_tf);
+            second_compound->updateChildTransform(j, local_tf, false);  // This is required to update the BVH tree
+          }
+          second_compound->recalculateLocalAabb();
+        }
+      }
+      compound->recalculateLocalAabb();
+    }
+    else
+    {
+      throw std::runtime_error("I can only collision check convex shapes and compound shapes made of convex shapes");
+    }
+  }
+}
+
+void BulletCastSimpleManager::updateCollisionMarginTable()
+{
+  // The GJK warm start caches are only valid while the ids do not change, see GjkWarmStartCache
+  bool clear_warm_start{ false };
+
+  collision_margin_table_.update(contact_test_data_.collision_margin_data, collision_objects_);
+  for (std::size_t i = 0; i < collision_objects_.size(); ++i)
+  {
+    const COW::Ptr& cow = link2cow_.at(collision_objects_[i]);
+    const COW::Ptr& cast_cow = link2castcow_.at(collision_objects_[i]);
+    clear_warm_start = clear_warm_start || (cow->m_collisionObjectId != static_cast<int>(i)) ||
+                       (cast_cow->m_collisionObjectId != static_cast<int>(i));
+    cow->m_collisionObjectId = static_cast<int>(i);
+    cast_cow->m_collisionObjectId = static_cast<int>(i);
+  }
+
+  if (clear_warm_start)
+  {
+    clearGjkWarmStartCaches(link2cow_);
+    clearGjkWarmStartCaches(link2castcow_);
+  }
+
+  collision_margin_table_dirty_ = false;
+}
+
+void BulletCastSimpleManager::updateAllowedCollisionLinkIds()
+{
+  contact_test_data_.compiled_acm = getCompiledAllowedCollisionMatrix(contact_test_data_.fn);
+  if (contact_test_data_.compiled_acm == nullptr)
+    return;
+
+  const std::size_t revision = contact_test_data_.compiled_acm->getLinkIdRevision();
+  if (!allowed_collision_link_ids_dirty_ && revision == allowed_collision_link_id_revision_)
+    return;
+
+  setAllowedCollisionLinkIds(link2cow_, *contact_test_data_.compiled_acm);
+  setAllowedCollisionLinkIds(link2castcow_, *contact_test_data_.compiled_acm);
+  allowed_collision_link_id_revision_ = revision;
+  allowed_collision_link_ids_dirty_ = false;
+}
 }  // namespace tesseract_collision::tesseract_collision_bullet
@@ -48,7 +48,8 @@ namespace tesseract_collision::tesseract_collision_bullet
 static const CollisionShapesConst EMPTY_COLLISION_SHAPES_CONST;
 static const tesseract_common::VectorIsometry3d EMPTY_COLLISION_SHAPES_TRANSFORMS;
 
-BulletDiscreteBVHManager::BulletDiscreteBVHManager(std::string name) : name_(std::move(name))
+BulletDiscreteBVHManager::BulletDiscreteBVHManager(std::string name, BulletBroadphaseConfig broadphase_config)
+  : name_(std::move(name)), broadphase_config_(std::move(broadphase_config))
 {
   // Bullet adds a margin of 5cm to which is an extern variable, so we set it to zero.
   gDbvtMargin = 0;
@@ -63,35 +64,44 @@ BulletDiscreteBVHManager::BulletDiscreteBVHManager(std::string name) : name_(std
   dispatcher_->setDispatcherFlags(dispatcher_->getDispatcherFlags() &
                                   ~btCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD);
 
-  broadphase_ = std::make_unique<btDbvtBroadphase>();
+  broadphase_ = createBroadphase(broadphase_config_);
   broadphase_->getOverlappingPairCache()->setOverlapFilterCallback(&broadphase_overlap_cb_);
 
+  query_pair_cache_ = std::make_unique<btHashedOverlappingPairCache>();
+  query_pair_cache_->setOverlapFilterCallback(&query_overlap_cb_);
+
   contact_test_data_.collision_margin_data = CollisionMarginData(0);
+  contact_test_data_.collision_margin_table = &collision_margin_table_;
 }
 
 BulletDiscreteBVHManager::~BulletDiscreteBVHManager()
 {
   // clean up remaining objects
   for (auto& co : link2cow_)
+  {
+    query_pair_cache_->removeOverlappingPairsContainingProxy(co.second->getBroadphaseHandle(), dispatcher_.get());
     removeCollisionObjectFromBroadphase(co.second, broadphase_, dispatcher_);
+  }
 }
 
 std::string BulletDiscreteBVHManager::getName() const { return name_; }
 
 DiscreteContactManager::UPtr BulletDiscreteBVHManager::clone() const
 {
-  auto manager = std::make_unique<BulletDiscreteBVHManager>();
+  auto manager = std::make_unique<BulletDiscreteBVHManager>(name_, broadphase_config_);
 
   auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
 
-  for (const auto& cow : link2cow_)
+  // Keep the insertion order so the clone assigns the same ids, see GjkWarmStartCache
+  for (const auto& name : collision_objects_)
   {
-    COW::Ptr new_cow = cow.second->clone();
+    const COW::Ptr& cow = link2cow_.at(name);
+    COW::Ptr new_cow = cow->clone();
 
     assert(new_cow->getCollisionShape());
     assert(new_cow->getCollisionShape()->getShapeType() != CUSTOM_CONVEX_SHAPE_TYPE);
 
-    new_cow->setWorldTransform(cow.second->getWorldTransform());
+    new_cow->setWorldTransform(cow->getWorldTransform());
     new_cow->setContactProcessingThreshold(margin);
 
     manager->addCollisionObject(new_cow);
@@ -100,10 +110,14 @@ DiscreteContactManager::UPtr BulletDiscreteBVHManager::clone() const
   manager->setActiveCollisionObjects(active_);
   manager->setCollisionMarginData(contact_test_data_.collision_margin_data);
   manager->setIsContactAllowedFn(contact_test_data_.fn);
+  manager->setStatisticsEnabled(statistics_enabled_);
+  manager->setDenseLinkNames(dense_link_names_);
 
   return manager;
 }
 
+const BulletBroadphaseConfig& BulletDiscreteBVHManager::getBroadphaseConfig() const { return broadphase_config_; }
+
 bool BulletDiscreteBVHManager::addCollisionObject(const std::string& name,
                                                   const int& mask_id,
                                                   const CollisionShapesConst& shapes,
@@ -151,8 +165,12 @@ bool BulletDiscreteBVHManager::removeCollisionObject(const std::string& name)
   if (it != link2cow_.end())
   {
     collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
+    query_pair_cache_->removeOverlappingPairsContainingProxy(it->second->getBroadphaseHandle(), dispatcher_.get());
     removeCollisionObjectFromBroadphase(it->second, broadphase_, dispatcher_);
     link2cow_.erase(name);
+    collision_margin_table_dirty_ = true;
+    clearGjkWarmStartCaches(link2cow_);
+    updateDenseCollisionObjects();
     return true;
   }
 
@@ -229,6 +247,45 @@ void BulletDiscreteBVHManager::setCollisionObjectsTransform(const tesseract_comm
     setCollisionObjectsTransform(transform.first, transform.second);
 }
 
+bool BulletDiscreteBVHManager::updateCollisionObjectOctree(const std::string& name,
+                                                           std::size_t shape_index,
+                                                           const tesseract_geometry::Octree::ConstPtr& octree,
+                                                           const OctreeDelta& delta)
+{
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end() || !it->second->updateOctree(shape_index, octree, delta))
+    return false;
+
+  // The cached collision algorithms may still reference the previous compound shape
+  broadphase_->getOverlappingPairCache()->cleanProxyFromPairs(it->second->getBroadphaseHandle(), dispatcher_.get());
+  query_pair_cache_->cleanProxyFromPairs(it->second->getBroadphaseHandle(), dispatcher_.get());
+  updateBroadphaseAABB(it->second, broadphase_, dispatcher_);
+  return true;
+}
+
+void BulletDiscreteBVHManager::setDenseLinkNames(const std::vector<std::string>& link_names)
+{
+  DiscreteContactManager::setDenseLinkNames(link_names);
+  updateDenseCollisionObjects();
+}
+
+void BulletDiscreteBVHManager::setDenseCollisionObjectsTransform(
+    const tesseract_common::VectorIsometry3d& link_transforms)
+{
+  assert(link_transforms.size() == dense_cows_.size());
+  for (std::size_t i = 0; i < dense_cows_.size(); ++i)
+  {
+    const COW::Ptr& cow = dense_cows_[i];
+    if (cow == nullptr || cow->m_collisionFilterGroup != btBroadphaseProxy::KinematicFilter)
+      continue;
+
+    cow->setWorldTransform(convertEigenToBt(link_transforms[i]));
+
+    // Update Collision Object Broadphase AABB
+    updateBroadphaseAABB(cow, broadphase_, dispatcher_);
+  }
+}
+
 const std::vector<std::string>& BulletDiscreteBVHManager::getCollisionObjects() const { return collision_objects_; }
 
 void BulletDiscreteBVHManager::setActiveCollisionObjects(const std::vector<std::string>& names)
@@ -241,6 +298,7 @@ void BulletDiscreteBVHManager::setActiveCollisionObjects(const std::vector<std::
   {
     COW::Ptr& cow = co.second;
     updateCollisionObjectFilters(active_, cow, broadphase_, dispatcher_);
+    query_pair_cache_->removeOverlappingPairsContainingProxy(cow->getBroadphaseHandle(), dispatcher_.get());
     refreshBroadphaseProxy(cow, broadphase_, dispatcher_);
   }
 }
@@ -276,8 +334,43 @@ IsContactAllowedFn BulletDiscreteBVHManager::getIsContactAllowedFn() const { ret
 void BulletDiscreteBVHManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
   contact_test_data_.res = &collisions;
+  contact_test_data_.res_pool = &contact_result_map_pool_;
+  contact_test_data_.req = request;
+  contactTest();
+}
+
+void BulletDiscreteBVHManager::contactTest(CompactContactResults& collisions, const ContactRequest& request)
+{
+  collisions.clear();
+  contact_test_data_.res = nullptr;
+  contact_test_data_.compact_res = &collisions;
+  contact_test_data_.req = request;
+  contactTest();
+  contact_test_data_.compact_res = nullptr;
+
+  // The collision margin table is up to date after the contact test, so its names match the collision object ids
+  collisions.setObjectNames(collision_margin_table_.getObjectNames());
+}
+
+bool BulletDiscreteBVHManager::anyContactTest(const ContactRequest& request)
+{
+  contact_test_data_.res = nullptr;
   contact_test_data_.req = request;
+  contactTest();
+  return contact_test_data_.done;
+}
+
+void BulletDiscreteBVHManager::setStatisticsEnabled(bool enabled) { statistics_enabled_ = enabled; }
+
+void BulletDiscreteBVHManager::contactTest()
+{
+  if (collision_margin_table_dirty_)
+    updateCollisionMarginTable();
+  updateAllowedCollisionLinkIds();
+
   contact_test_data_.done = false;
+  contact_test_data_.statistics = statistics_enabled_ ? &statistics_ : nullptr;
+  ContactTestStatisticsTimer timer(contact_test_data_.statistics);
 
   btOverlappingPairCache* pairCache = broadphase_->getOverlappingPairCache();
 
@@ -291,6 +384,189 @@ void BulletDiscreteBVHManager::contactTest(ContactResultMap& collisions, const C
   pairCache->processAllOverlappingPairs(&collisionCallback, dispatcher_.get());
 }
 
+void BulletDiscreteBVHManager::contactTest(std::vector<ContactResultMap>& collisions,
+                                           const std::vector<std::string>& names,
+                                           const std::vector<tesseract_common::VectorIsometry3d>& states,
+                                           const ContactRequest& request)
+{
+  if (collision_margin_table_dirty_)
+    updateCollisionMarginTable();
+  updateAllowedCollisionLinkIds();
+
+  // Look up the collision objects once for the whole batch
+  std::vector<COW::Ptr> cows;
+  cows.reserve(names.size());
+  for (const auto& name : names)
+  {
+    auto it = link2cow_.find(name);
+    if (it != link2cow_.end())
+      cows.push_back(it->second);
+    else
+      cows.push_back(nullptr);
+  }
+
+  contact_test_data_.req = request;
+  contact_test_data_.statistics = statistics_enabled_ ? &statistics_ : nullptr;
+
+  btOverlappingPairCache* pairCache = broadphase_->getOverlappingPairCache();
+
+  DiscreteBroadphaseContactResultCallback cc(contact_test_data_,
+                                             contact_test_data_.collision_margin_data.getMaxCollisionMargin());
+
+  TesseractCollisionPairCallback collisionCallback(dispatch_info_, dispatcher_.get(), cc);
+
+  collisions.resize(states.size());
+  for (std::size_t i = 0; i < states.size(); ++i)
+  {
+    const tesseract_common::VectorIsometry3d& poses = states[i];
+    assert(poses.size() == cows.size());
+    for (std::size_t j = 0; j < cows.size(); ++j)
+    {
+      const COW::Ptr& cow = cows[j];
+      if (cow == nullptr)
+        continue;
+
+      cow->setWorldTransform(convertEigenToBt(poses[j]));
+      updateBroadphaseAABB(cow, broadphase_, dispatcher_);
+    }
+
+    clearContactResults(collisions[i]);
+    contact_test_data_.res = &collisions[i];
+    contact_test_data_.res_pool = &contact_result_map_pool_;
+    contact_test_data_.done = false;
+
+    ContactTestStatisticsTimer timer(contact_test_data_.statistics);
+    broadphase_->calculateOverlappingPairs(dispatcher_.get());
+    pairCache->processAllOverlappingPairs(&collisionCallback, dispatcher_.get());
+  }
+}
+
+void BulletDiscreteBVHManager::contactTest(ContactResultMap& collisions,
+                                           const std::vector<std::string>& query_objects,
+                                           const ContactRequest& request)
+{
+  contact_test_data_.res = &collisions;
+  contact_test_data_.res_pool = &contact_result_map_pool_;
+  contact_test_data_.req = request;
+
+  if (collision_margin_table_dirty_)
+    updateCollisionMarginTable();
+  updateAllowedCollisionLinkIds();
+
+  contact_test_data_.done = false;
+  contact_test_data_.statistics = statistics_enabled_ ? &statistics_ : nullptr;
+  ContactTestStatisticsTimer timer(contact_test_data_.statistics);
+
+  query_cows_.clear();
+  for (const auto& name : query_objects)
+  {
+    auto it = link2cow_.find(name);
+    if (it != link2cow_.end() && it->second->m_enabled &&
+        std::find(query_cows_.begin(), query_cows_.end(), it->second.get()) == query_cows_.end())
+      query_cows_.push_back(it->second.get());
+  }
+
+  DiscreteQueryContactResultCallback cc(contact_test_data_,
+                                        contact_test_data_.collision_margin_data.getMaxCollisionMargin());
+
+  TesseractCollisionPairCallback collisionCallback(dispatch_info_, dispatcher_.get(), cc);
+
+  btOverlappingPairCache* pair_cache = broadphase_->getOverlappingPairCache();
+  removeSeparatedPairs(*query_pair_cache_, dispatcher_);
+
+  // The pairs of each query object are found with an AABB query of the broadphase, so the collision object filters are
+  // left untouched. A pair in the broadphase pair cache reuses its collision algorithm, any other pair is added to the
+  // query pair cache which keeps its collision algorithm for the following query contact tests.
+  for (auto query_it = query_cows_.begin(); query_it != query_cows_.end() && !contact_test_data_.done; ++query_it)
+  {
+    CollisionObjectWrapper* cow = *query_it;
+    btVector3 aabb_min, aabb_max;
+    cow->getAABB(aabb_min, aabb_max);
+
+    query_overlaps_.clear();
+    BroadphaseAabbCollector collector(query_overlaps_);
+    broadphase_->aabbTest(aabb_min, aabb_max, collector);
+
+    for (CollisionObjectWrapper* other : query_overlaps_)
+    {
+      // Pairs with an earlier query object were already checked
+      if (other == cow || std::find(query_cows_.begin(), query_it, other) != query_it)
+        continue;
+
+      btBroadphasePair* pair = pair_cache->findPair(cow->getBroadphaseHandle(), other->getBroadphaseHandle());
+      if (pair == nullptr)
+        pair = query_pair_cache_->addOverlappingPair(cow->getBroadphaseHandle(), other->getBroadphaseHandle());
+
+      collisionCallback.processOverlap(*pair);
+
+      if (contact_test_data_.done)
+        break;
+    }
+  }
+}
+
+void BulletDiscreteBVHManager::pointContactTest(PointContactResultVector& results,
+                                                const Eigen::Ref<const Eigen::Matrix3Xd>& points,
+                                                double contact_distance)
+{
+  results.clear();
+
+  // The point contact test only uses the narrowphase settings of the default request
+  contact_test_data_.req = ContactRequest();
+  contact_test_data_.done = false;
+  contact_test_data_.statistics = statistics_enabled_ ? &statistics_ : nullptr;
+  ContactTestStatisticsTimer timer(contact_test_data_.statistics);
+
+  if (point_cow_ == nullptr)
+  {
+    point_cow_ = makePointCollisionObject();
+    point_cow_->setUserPointer(&contact_test_data_);
+  }
+
+  auto extent = static_cast<btScalar>(std::max(contact_distance, 0.0));
+  btVector3 point_extent(extent, extent, extent);
+
+  PointContactResult result;
+  PointCollisionCollector cc(point_cow_.get(), result, contact_distance);
+  PointCollisionAlgorithmCache algorithms(*dispatcher_);
+  for (Eigen::Index i = 0; i < points.cols(); ++i)
+  {
+    btVector3 point(static_cast<btScalar>(points(0, i)),
+                    static_cast<btScalar>(points(1, i)),
+                    static_cast<btScalar>(points(2, i)));
+    point_cow_->getWorldTransform().setOrigin(point);
+    btVector3 aabb_min = point - point_extent;
+    btVector3 aabb_max = point + point_extent;
+
+    result = PointContactResult();
+
+    // The broadphase AABBs include the contact processing threshold, so every collision object within the contact
+    // distance of the point overlaps the AABB of the point
+    query_overlaps_.clear();
+    BroadphaseAabbCollector collector(query_overlaps_);
+    broadphase_->aabbTest(aabb_min, aabb_max, collector);
+
+    for (CollisionObjectWrapper* cow : query_overlaps_)
+    {
+      if (cow->m_enabled && cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter)
+        pointContactTestPair(*point_cow_, *cow, algorithms, dispatch_info_, cc, contact_test_data_.statistics);
+    }
+
+    if (!result.link_name.empty())
+    {
+      result.point_index = static_cast<std::size_t>(i);
+      results.push_back(result);
+    }
+  }
+}
+
+void BulletDiscreteBVHManager::pointContactTest(PointContactResultVector& results,
+                                                const tesseract_common::VectorVector3d& points,
+                                                double contact_distance)
+{
+  DiscreteContactManager::pointContactTest(results, points, contact_distance);
+}
+
 void BulletDiscreteBVHManager::addCollisionObject(const COW::Ptr& cow)
 {
   cow->setUserPointer(&contact_test_data_);
@@ -299,10 +575,16 @@ void BulletDiscreteBVHManager::addCollisionObject(const COW::Ptr& cow)
 
   // Add collision object to broadphase
   addCollisionObjectToBroadphase(cow, broadphase_, dispatcher_);
+
+  collision_margin_table_dirty_ = true;
+  allowed_collision_link_ids_dirty_ = true;
+  updateDenseCollisionObjects();
 }
 
 void BulletDiscreteBVHManager::onCollisionMarginDataChanged()
 {
+  updateCollisionMarginTable();
+
   auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
   for (auto& co : link2cow_)
   {
@@ -312,4 +594,48 @@ void BulletDiscreteBVHManager::onCollisionMarginDataChanged()
     updateBroadphaseAABB(cow, broadphase_, dispatcher_);
   }
 }
+void BulletDiscreteBVHManager::updateDenseCollisionObjects()
+{
+  dense_cows_.clear();
+  dense_cows_.reserve(dense_link_names_.size());
+  for (const auto& link_name : dense_link_names_)
+  {
+    auto it = link2cow_.find(link_name);
+    dense_cows_.push_back((it != link2cow_.end()) ? it->second : nullptr);
+  }
+}
+
+void BulletDiscreteBVHManager::updateCollisionMarginTable()
+{
+  // The GJK warm start caches are only valid while the ids do not change, see GjkWarmStartCache
+  bool clear_warm_start{ false };
+
+  collision_margin_table_.update(contact_test_data_.collision_margin_data, collision_objects_);
+  for (std::size_t i = 0; i < collision_objects_.size(); ++i)
+  {
+    const COW::Ptr& cow = link2cow_.at(collision_objects_[i]);
+    clear_warm_start = clear_warm_start || (cow->m_collisionObjectId != static_cast<int>(i));
+    cow->m_collisionObjectId = static_cast<int>(i);
+  }
+
+  if (clear_warm_start)
+    clearGjkWarmStartCaches(link2cow_);
+
+  collision_margin_table_dirty_ = false;
+}
+
+void BulletDiscreteBVHManager::updateAllowedCollisionLinkIds()
+{
+  contact_test_data_.compiled_acm = getCompiledAllowedCollisionMatrix(contact_test_data_.fn);
+  if (contact_test_data_.compiled_acm == nullptr)
+    return;
+
+  const std::size_t revision = contact_test_data_.compiled_acm->getLinkIdRevision();
+  if (!allowed_collision_link_ids_dirty_ && revision == allowed_collision_link_id_revision_)
+    return;
+
+  setAllowedCollisionLinkIds(link2cow_, *contact_test_data_.compiled_acm);
+  allowed_collision_link_id_revision_ = revision;
+  allowed_collision_link_ids_dirty_ = false;
+}
 }  // namespace tesseract_collision::tesseract_collision_bullet
@@ -59,6 +59,7 @@ BulletDiscreteSimpleManager::BulletDiscreteSimpleManager(std::string name) : nam
                                   ~btCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD);
 
   contact_test_data_.collision_margin_data = CollisionMarginData(0);
+  contact_test_data_.collision_margin_table = &collision_margin_table_;
 }
 
 std::string BulletDiscreteSimpleManager::getName() const { return name_; }
@@ -69,14 +70,16 @@ DiscreteContactManager::UPtr BulletDiscreteSimpleManager::clone() const
 
   auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
 
-  for (const auto& cow : link2cow_)
+  // Keep the insertion order so the clone assigns the same ids, see GjkWarmStartCache
+  for (const auto& name : collision_objects_)
   {
-    COW::Ptr new_cow = cow.second->clone();
+    const COW::Ptr& cow = link2cow_.at(name);
+    COW::Ptr new_cow = cow->clone();
 
     assert(new_cow->getCollisionShape());
     assert(new_cow->getCollisionShape()->getShapeType() != CUSTOM_CONVEX_SHAPE_TYPE);
 
-    new_cow->setWorldTransform(cow.second->getWorldTransform());
+    new_cow->setWorldTransform(cow->getWorldTransform());
     new_cow->setContactProcessingThreshold(margin);
 
     manager->addCollisionObject(new_cow);
@@ -85,6 +88,8 @@ DiscreteContactManager::UPtr BulletDiscreteSimpleManager::clone() const
   manager->setActiveCollisionObjects(active_);
   manager->setCollisionMarginData(contact_test_data_.collision_margin_data);
   manager->setIsContactAllowedFn(contact_test_data_.fn);
+  manager->setStatisticsEnabled(statistics_enabled_);
+  manager->setDenseLinkNames(dense_link_names_);
 
   return manager;
 }
@@ -138,6 +143,9 @@ bool BulletDiscreteSimpleManager::removeCollisionObject(const std::string& name)
     cows_.erase(std::find(cows_.begin(), cows_.end(), it->second));
     collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
     link2cow_.erase(name);
+    collision_margin_table_dirty_ = true;
+    clearGjkWarmStartCaches(link2cow_);
+    updateDenseCollisionObjects();
     return true;
   }
 
@@ -198,6 +206,38 @@ void BulletDiscreteSimpleManager::setCollisionObjectsTransform(const tesseract_c
     setCollisionObjectsTransform(transform.first, transform.second);
 }
 
+bool BulletDiscreteSimpleManager::updateCollisionObjectOctree(const std::string& name,
+                                                              std::size_t shape_index,
+                                                              const tesseract_geometry::Octree::ConstPtr& octree,
+                                                              const OctreeDelta& delta)
+{
+  auto it = link2cow_.find(name);
+  if (it != link2cow_.end())
+    return it->second->updateOctree(shape_index, octree, delta);
+
+  return false;
+}
+
+void BulletDiscreteSimpleManager::setDenseLinkNames(const std::vector<std::string>& link_names)
+{
+  DiscreteContactManager::setDenseLinkNames(link_names);
+  updateDenseCollisionObjects();
+}
+
+void BulletDiscreteSimpleManager::setDenseCollisionObjectsTransform(
+    const tesseract_common::VectorIsometry3d& link_transforms)
+{
+  assert(link_transforms.size() == dense_cows_.size());
+  for (std::size_t i = 0; i < dense_cows_.size(); ++i)
+  {
+    const COW::Ptr& cow = dense_cows_[i];
+    if (cow == nullptr || cow->m_collisionFilterGroup != btBroadphaseProxy::KinematicFilter)
+      continue;
+
+    cow->setWorldTransform(convertEigenToBt(link_transforms[i]));
+  }
+}
+
 const std::vector<std::string>& BulletDiscreteSimpleManager::getCollisionObjects() const { return collision_objects_; }
 
 void BulletDiscreteSimpleManager::setActiveCollisionObjects(const std::vector<std::string>& names)
@@ -253,8 +293,43 @@ IsContactAllowedFn BulletDiscreteSimpleManager::getIsContactAllowedFn() const {
 void BulletDiscreteSimpleManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
   contact_test_data_.res = &collisions;
+  contact_test_data_.res_pool = &contact_result_map_pool_;
+  contact_test_data_.req = request;
+  contactTest();
+}
+
+void BulletDiscreteSimpleManager::contactTest(CompactContactResults& collisions, const ContactRequest& request)
+{
+  collisions.clear();
+  contact_test_data_.res = nullptr;
+  contact_test_data_.compact_res = &collisions;
+  contact_test_data_.req = request;
+  contactTest();
+  contact_test_data_.compact_res = nullptr;
+
+  // The collision margin table is up to date after the contact test, so its names match the collision object ids
+  collisions.setObjectNames(collision_margin_table_.getObjectNames());
+}
+
+bool BulletDiscreteSimpleManager::anyContactTest(const ContactRequest& request)
+{
+  contact_test_data_.res = nullptr;
   contact_test_data_.req = request;
+  contactTest();
+  return contact_test_data_.done;
+}
+
+void BulletDiscreteSimpleManager::setStatisticsEnabled(bool enabled) { statistics_enabled_ = enabled; }
+
+void BulletDiscreteSimpleManager::contactTest()
+{
+  if (collision_margin_table_dirty_)
+    updateCollisionMarginTable();
+  updateAllowedCollisionLinkIds();
+
   contact_test_data_.done = false;
+  contact_test_data_.statistics = statistics_enabled_ ? &statistics_ : nullptr;
+  ContactTestStatisticsTimer timer(contact_test_data_.statistics);
 
   for (auto cow1_iter = cows_.begin(); cow1_iter != (cows_.end() - 1); cow1_iter++)
   {
@@ -284,30 +359,7 @@ void BulletDiscreteSimpleManager::contactTest(ContactResultMap& collisions, cons
                         (min_aabb[0][2] <= max_aabb[1][2] && max_aabb[0][2] >= min_aabb[1][2]);
 
       if (aabb_check)
-      {
-        bool needs_collision = needsCollisionCheck(*cow1, *cow2, contact_test_data_.fn, false);
-
-        if (needs_collision)
-        {
-          btCollisionObjectWrapper obB(
-              nullptr, cow2->getCollisionShape(), cow2.get(), cow2->getWorldTransform(), -1, -1);
-
-          btCollisionAlgorithm* algorithm =
-              dispatcher_->findAlgorithm(&obA, &obB, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
-          assert(algorithm != nullptr);
-          if (algorithm != nullptr)
-          {
-            TesseractBridgedManifoldResult contactPointResult(&obA, &obB, cc);
-            contactPointResult.m_closestPointDistanceThreshold = cc.m_closestDistanceThreshold;
-
-            // discrete collision detection query
-            algorithm->processCollision(&obA, &obB, dispatch_info_, &contactPointResult);
-
-            algorithm->~btCollisionAlgorithm();
-            dispatcher_->freeCollisionAlgorithm(algorithm);
-          }
-        }
-      }
+        contactTestPair(obA, cow2, cc, needsCollisionCheck(*cow1, *cow2, contact_test_data_, false));
 
       if (contact_test_data_.done)
         break;
@@ -318,6 +370,174 @@ void BulletDiscreteSimpleManager::contactTest(ContactResultMap& collisions, cons
   }
 }
 
+void BulletDiscreteSimpleManager::contactTest(ContactResultMap& collisions,
+                                              const std::vector<std::string>& query_objects,
+                                              const ContactRequest& request)
+{
+  contact_test_data_.res = &collisions;
+  contact_test_data_.res_pool = &contact_result_map_pool_;
+  contact_test_data_.req = request;
+
+  if (collision_margin_table_dirty_)
+    updateCollisionMarginTable();
+  updateAllowedCollisionLinkIds();
+
+  contact_test_data_.done = false;
+  contact_test_data_.statistics = statistics_enabled_ ? &statistics_ : nullptr;
+  ContactTestStatisticsTimer timer(contact_test_data_.statistics);
+
+  query_cows_.clear();
+  for (const auto& name : query_objects)
+  {
+    auto it = link2cow_.find(name);
+    if (it != link2cow_.end() && it->second->m_enabled &&
+        std::find(query_cows_.begin(), query_cows_.end(), it->second) == query_cows_.end())
+      query_cows_.push_back(it->second);
+  }
+
+  // The query objects are checked against every collision object ignoring the collision object filters, which are set
+  // from the active collision objects
+  for (auto query_it = query_cows_.begin(); query_it != query_cows_.end() && !contact_test_data_.done; ++query_it)
+  {
+    const COW::Ptr& cow1 = *query_it;
+
+    btVector3 min_aabb[2], max_aabb[2];  // NOLINT
+    cow1->getAABB(min_aabb[0], max_aabb[0]);
+
+    btCollisionObjectWrapper obA(nullptr, cow1->getCollisionShape(), cow1.get(), cow1->getWorldTransform(), -1, -1);
+
+    DiscreteCollisionCollector cc(contact_test_data_, cow1, cow1->getContactProcessingThreshold());
+    for (const COW::Ptr& cow2 : cows_)
+    {
+      // Pairs with an earlier query object were already checked
+      if (cow2 == cow1 || std::find(query_cows_.begin(), query_it, cow2) != query_it)
+        continue;
+
+      cow2->getAABB(min_aabb[1], max_aabb[1]);
+
+      bool aabb_check = (min_aabb[0][0] <= max_aabb[1][0] && max_aabb[0][0] >= min_aabb[1][0]) &&
+                        (min_aabb[0][1] <= max_aabb[1][1] && max_aabb[0][1] >= min_aabb[1][1]) &&
+                        (min_aabb[0][2] <= max_aabb[1][2] && max_aabb[0][2] >= min_aabb[1][2]);
+
+      if (aabb_check)
+        contactTestPair(obA,
+                        cow2,
+                        cc,
+                        cow2->m_enabled && !isContactAllowed(cow1->getName(),
+                                                             cow1->m_allowedCollisionLinkId,
+                                                             cow2->getName(),
+                                                             cow2->m_allowedCollisionLinkId,
+                                                             contact_test_data_));
+
+      if (contact_test_data_.done)
+        break;
+    }
+  }
+}
+
+void BulletDiscreteSimpleManager::contactTestPair(const btCollisionObjectWrapper& obA,
+                                                  const COW::Ptr& cow2,
+                                                  DiscreteCollisionCollector& cc,
+                                                  bool needs_collision)
+{
+  if (contact_test_data_.statistics != nullptr)
+    ++contact_test_data_.statistics->broadphase_pairs;
+
+  if (!needs_collision)
+  {
+    if (contact_test_data_.statistics != nullptr)
+      ++contact_test_data_.statistics->rejected_pairs;
+
+    return;
+  }
+
+  btCollisionObjectWrapper obB(nullptr, cow2->getCollisionShape(), cow2.get(), cow2->getWorldTransform(), -1, -1);
+
+  btCollisionAlgorithm* algorithm = dispatcher_->findAlgorithm(&obA, &obB, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
+  assert(algorithm != nullptr);
+  if (algorithm != nullptr)
+  {
+    TesseractBridgedManifoldResult contactPointResult(&obA, &obB, cc);
+    contactPointResult.m_closestPointDistanceThreshold = cc.m_closestDistanceThreshold;
+
+    // discrete collision detection query
+    processNarrowphase(algorithm, &obA, &obB, dispatch_info_, &contactPointResult, contact_test_data_.statistics);
+
+    algorithm->~btCollisionAlgorithm();
+    dispatcher_->freeCollisionAlgorithm(algorithm);
+  }
+}
+
+void BulletDiscreteSimpleManager::pointContactTest(PointContactResultVector& results,
+                                                   const Eigen::Ref<const Eigen::Matrix3Xd>& points,
+                                                   double contact_distance)
+{
+  results.clear();
+
+  // The point contact test only uses the narrowphase settings of the default request
+  contact_test_data_.req = ContactRequest();
+  contact_test_data_.done = false;
+  contact_test_data_.statistics = statistics_enabled_ ? &statistics_ : nullptr;
+  ContactTestStatisticsTimer timer(contact_test_data_.statistics);
+
+  if (point_cow_ == nullptr)
+  {
+    point_cow_ = makePointCollisionObject();
+    point_cow_->setUserPointer(&contact_test_data_);
+  }
+
+  auto extent = static_cast<btScalar>(std::max(contact_distance, 0.0));
+  btVector3 point_extent(extent, extent, extent);
+
+  PointContactResult result;
+  PointCollisionCollector cc(point_cow_.get(), result, contact_distance);
+  PointCollisionAlgorithmCache algorithms(*dispatcher_);
+  for (Eigen::Index i = 0; i < points.cols(); ++i)
+  {
+    btVector3 point(static_cast<btScalar>(points(0, i)),
+                    static_cast<btScalar>(points(1, i)),
+                    static_cast<btScalar>(points(2, i)));
+    point_cow_->getWorldTransform().setOrigin(point);
+    btVector3 aabb_min = point - point_extent;
+    btVector3 aabb_max = point + point_extent;
+
+    result = PointContactResult();
+
+    // The active collision objects are at the front of the collision objects
+    for (const COW::Ptr& cow : cows_)
+    {
+      if (cow->m_collisionFilterGroup != btBroadphaseProxy::KinematicFilter)
+        break;
+
+      if (!cow->m_enabled)
+        continue;
+
+      btVector3 cow_aabb_min, cow_aabb_max;
+      cow->getAABB(cow_aabb_min, cow_aabb_max);
+
+      bool aabb_check = (aabb_min[0] <= cow_aabb_max[0] && aabb_max[0] >= cow_aabb_min[0]) &&
+                        (aabb_min[1] <= cow_aabb_max[1] && aabb_max[1] >= cow_aabb_min[1]) &&
+                        (aabb_min[2] <= cow_aabb_max[2] && aabb_max[2] >= cow_aabb_min[2]);
+
+      if (aabb_check)
+        pointContactTestPair(*point_cow_, *cow, algorithms, dispatch_info_, cc, contact_test_data_.statistics);
+    }
+
+    if (!result.link_name.empty())
+    {
+      result.point_index = static_cast<std::size_t>(i);
+      results.push_back(result);
+    }
+  }
+}
+
+void BulletDiscreteSimpleManager::pointContactTest(PointContactResultVector& results,
+                                                   const tesseract_common::VectorVector3d& points,
+                                                   double contact_distance)
+{
+  DiscreteContactManager::pointContactTest(results, points, contact_distance);
+}
+
 void BulletDiscreteSimpleManager::addCollisionObject(const COW::Ptr& cow)
 {
   cow->setUserPointer(&contact_test_data_);
@@ -328,13 +548,63 @@ void BulletDiscreteSimpleManager::addCollisionObject(const COW::Ptr& cow)
     cows_.insert(cows_.begin(), cow);
   else
     cows_.push_back(cow);
+
+  collision_margin_table_dirty_ = true;
+  allowed_collision_link_ids_dirty_ = true;
+  updateDenseCollisionObjects();
 }
 
 void BulletDiscreteSimpleManager::onCollisionMarginDataChanged()
 {
+  updateCollisionMarginTable();
+
   auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
   for (auto& co : link2cow_)
     co.second->setContactProcessingThreshold(margin);
 }
 
+void BulletDiscreteSimpleManager::updateDenseCollisionObjects()
+{
+  dense_cows_.clear();
+  dense_cows_.reserve(dense_link_names_.size());
+  for (const auto& link_name : dense_link_names_)
+  {
+    auto it = link2cow_.find(link_name);
+    dense_cows_.push_back((it != link2cow_.end()) ? it->second : nullptr);
+  }
+}
+
+void BulletDiscreteSimpleManager::updateCollisionMarginTable()
+{
+  // The GJK warm start caches are only valid while the ids do not change, see GjkWarmStartCache
+  bool clear_warm_start{ false };
+
+  collision_margin_table_.update(contact_test_data_.collision_margin_data, collision_objects_);
+  for (std::size_t i = 0; i < collision_objects_.size(); ++i)
+  {
+    const COW::Ptr& cow = link2cow_.at(collision_objects_[i]);
+    clear_warm_start = clear_warm_start || (cow->m_collisionObjectId != static_cast<int>(i));
+    cow->m_collisionObjectId = static_cast<int>(i);
+  }
+
+  if (clear_warm_start)
+    clearGjkWarmStartCaches(link2cow_);
+
+  collision_margin_table_dirty_ = false;
+}
+
+void BulletDiscreteSimpleManager::updateAllowedCollisionLinkIds()
+{
+  contact_test_data_.compiled_acm = getCompiledAllowedCollisionMatrix(contact_test_data_.fn);
+  if (contact_test_data_.compiled_acm == nullptr)
+    return;
+
+  const std::size_t revision = contact_test_data_.compiled_acm->getLinkIdRevision();
+  if (!allowed_collision_link_ids_dirty_ && revision == allowed_collision_link_id_revision_)
+    return;
+
+  setAllowedCollisionLinkIds(link2cow_, *contact_test_data_.compiled_acm);
+  allowed_collision_link_id_revision_ = revision;
+  allowed_collision_link_ids_dirty_ = false;
+}
 }  // namespace tesseract_collision::tesseract_collision_bullet
@@ -24,6 +24,13 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <yaml-cpp/yaml.h>
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_collision/bullet/bullet_factories.h>
 #include <tesseract_collision/bullet/bullet_cast_bvh_manager.h>
 #include <tesseract_collision/bullet/bullet_cast_simple_manager.h>
@@ -32,10 +39,95 @@
 
 namespace tesseract_collision::tesseract_collision_bullet
 {
+namespace
+{
+Eigen::Vector3d parseVector3d(const YAML::Node& node, const std::string& key)
+{
+  auto values = node.as<std::vector<double>>();
+  if (values.size() != 3)
+    throw std::runtime_error("'" + key + "' must have three values");
+
+  return { values[0], values[1], values[2] };
+}
+
+/**
+ * @brief Parse the optional broadphase entry of the plugin config
+ * @details For example:
+ * @code{.yaml}
+ * broadphase:
+ *   type: SWEEP_AND_PRUNE  # DBVT, SWEEP_AND_PRUNE or HASH_GRID
+ *   world_min: [-2, -2, -1]
+ *   world_max: [2, 2, 3]
+ *   max_handles: 16384
+ *   cell_size: 0.2
+ *   max_cells_per_proxy: 64
+ * @endcode
+ */
+BulletBroadphaseConfig parseBroadphaseConfig(const YAML::Node& config)
+{
+  BulletBroadphaseConfig broadphase_config;
+
+  const YAML::Node broadphase = config["broadphase"];
+  if (!broadphase)
+    return broadphase_config;
+
+  if (YAML::Node n = broadphase["type"])
+  {
+    auto type = n.as<std::string>();
+    auto it = std::find(BulletBroadphaseTypeStrings.begin(), BulletBroadphaseTypeStrings.end(), type);
+    if (it == BulletBroadphaseTypeStrings.end())
+      throw std::runtime_error("'type' must be DBVT, SWEEP_AND_PRUNE or HASH_GRID, got " + type);
+
+    broadphase_config.type = static_cast<BulletBroadphaseType>(std::distance(BulletBroadphaseTypeStrings.begin(), it));
+  }
+
+  if (YAML::Node n = broadphase["world_min"])
+    broadphase_config.world_min = parseVector3d(n, "world_min");
+
+  if (YAML::Node n = broadphase["world_max"])
+    broadphase_config.world_max = parseVector3d(n, "world_max");
+
+  if (YAML::Node n = broadphase["max_handles"])
+    broadphase_config.max_handles = n.as<unsigned>();
+
+  if (YAML::Node n = broadphase["cell_size"])
+    broadphase_config.cell_size = n.as<double>();
+
+  if (YAML::Node n = broadphase["max_cells_per_proxy"])
+    broadphase_config.max_cells_per_proxy = n.as<std::size_t>();
+
+  if ((broadphase_config.world_max.array() <= broadphase_config.world_min.array()).any())
+    throw std::runtime_error("'world_max' must be greater than 'world_min'");
+
+  if (broadphase_config.max_handles < 2)
+    throw std::runtime_error("'max_handles' must be at least two");
+
+  if (broadphase_config.cell_size <= 0)
+    throw std::runtime_error("'cell_size' must be greater than zero");
+
+  if (broadphase_config.max_cells_per_proxy == 0)
+    throw std::runtime_error("'max_cells_per_proxy' must be greater than zero");
+
+  return broadphase_config;
+}
+}  // namespace
+
 DiscreteContactManager::UPtr BulletDiscreteBVHManagerFactory::create(const std::string& name,
-                                                                     const YAML::Node& /*config*/) const
+                                                                     const YAML::Node& config) const
 {
-  return std::make_unique<BulletDiscreteBVHManager>(name);
+  BulletBroadphaseConfig broadphase_config;
+  try
+  {
+    broadphase_config = parseBroadphaseConfig(config);
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("BulletDiscreteBVHManagerFactory: Failed to parse yaml config data! Details: %s",
+                            e.what());
+    return nullptr;
+  }
+
+  return std::make_unique<BulletDiscreteBVHManager>(name, broadphase_config);
 }
 
 DiscreteContactManager::UPtr BulletDiscreteSimpleManagerFactory::create(const std::string& name,
@@ -45,9 +137,20 @@ DiscreteContactManager::UPtr BulletDiscreteSimpleManagerFactory::create(const st
 }
 
 ContinuousContactManager::UPtr BulletCastBVHManagerFactory::create(const std::string& name,
-                                                                   const YAML::Node& /*config*/) const
+                                                                   const YAML::Node& config) const
 {
-  return std::make_unique<BulletCastBVHManager>(name);
+  BulletBroadphaseConfig broadphase_config;
+  try
+  {
+    broadphase_config = parseBroadphaseConfig(config);
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("BulletCastBVHManagerFactory: Failed to parse yaml config data! Details: %s", e.what());
+    return nullptr;
+  }
+
+  return std::make_unique<BulletCastBVHManager>(name, broadphase_config);
 }
 
 ContinuousContactManager::UPtr BulletCastSimpleManagerFactory::create(const std::string& name,
@@ -42,13 +42,16 @@
  */
 
 #include "tesseract_collision/bullet/bullet_utils.h"
+#include "tesseract_collision/bullet/tesseract_hash_grid_broadphase.h"
 
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <LinearMath/btAabbUtil2.h>
 #include <LinearMath/btConvexHullComputer.h>
 #include <BulletCollision/CollisionDispatch/btConvexConvexAlgorithm.h>
 #include <BulletCollision/CollisionShapes/btShapeHull.h>
 #include <BulletCollision/Gimpact/btTriangleShapeEx.h>
 #include <boost/thread/mutex.hpp>
+#include <algorithm>
 #include <memory>
 #include <octomap/octomap.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
@@ -207,130 +210,218 @@ std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry:
   return nullptr;
 }
 
-std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry::Octree::ConstPtr& geom,
-                                                       CollisionObjectWrapper* cow,
-                                                       int shape_index)
+/**
+ * @brief Get the child shape used for all octree nodes at a depth, it is created the first time it is requested
+ * @param data The octree compound shape
+ * @param cow The collision object managing the child shapes
+ * @param depth The octree depth
+ * @return The child shape, nullptr if the octree sub type is not supported
+ */
+btCollisionShape* getOctreeChildShape(OctreeCompoundShape& data, CollisionObjectWrapper* cow, unsigned depth)
 {
-  const octomap::OcTree& octree = *(geom->getOctree());
-  auto subshape = std::make_shared<btCompoundShape>(BULLET_COMPOUND_USE_DYNAMIC_AABB, static_cast<int>(octree.size()));
-  double occupancy_threshold = octree.getOccupancyThres();
+  std::shared_ptr<btCollisionShape>& childshape = data.depth_shapes.at(depth);
+  if (childshape != nullptr)
+    return childshape.get();
 
-  std::vector<std::shared_ptr<btCollisionShape>> managed_shapes;
-  managed_shapes.resize(octree.getTreeDepth() + 1);
-  switch (geom->getSubType())
+  double size = data.geom->getOctree()->getNodeSize(depth);
+  switch (data.geom->getSubType())
   {
     case tesseract_geometry::Octree::SubType::BOX:
     {
-      for (auto it = octree.begin(static_cast<unsigned char>(octree.getTreeDepth())), end = octree.end(); it != end;
-           ++it)
-      {
-        if (it->getOccupancy() >= occupancy_threshold)
-        {
-          double size = it.getSize();
-          btTransform geomTrans;
-          geomTrans.setIdentity();
-          geomTrans.setOrigin(btVector3(
-              static_cast<btScalar>(it.getX()), static_cast<btScalar>(it.getY()), static_cast<btScalar>(it.getZ())));
-          auto l = static_cast<btScalar>(size / 2.0);
-
-          std::shared_ptr<btCollisionShape> childshape = managed_shapes.at(it.getDepth());
-          if (childshape == nullptr)
-          {
-            childshape = std::make_shared<btBoxShape>(btVector3(l, l, l));
-            childshape->setUserIndex(shape_index);
-            childshape->setMargin(BULLET_MARGIN);
-            managed_shapes.at(it.getDepth()) = childshape;
-          }
-
-          subshape->addChildShape(geomTrans, childshape.get());
-        }
-      }
-
-      cow->manageReserve(managed_shapes.size());
-      for (const auto& managed_shape : managed_shapes)
-      {
-        if (managed_shape != nullptr)
-          cow->manage(managed_shape);
-      }
-
-      return subshape;
+      auto l = static_cast<btScalar>(size / 2.0);
+      childshape = std::make_shared<btBoxShape>(btVector3(l, l, l));
+      childshape->setMargin(BULLET_MARGIN);
+      break;
     }
     case tesseract_geometry::Octree::SubType::SPHERE_INSIDE:
     {
-      for (auto it = octree.begin(static_cast<unsigned char>(octree.getTreeDepth())), end = octree.end(); it != end;
-           ++it)
-      {
-        if (it->getOccupancy() >= occupancy_threshold)
-        {
-          double size = it.getSize();
-          btTransform geomTrans;
-          geomTrans.setIdentity();
-          geomTrans.setOrigin(btVector3(
-              static_cast<btScalar>(it.getX()), static_cast<btScalar>(it.getY()), static_cast<btScalar>(it.getZ())));
-
-          std::shared_ptr<btCollisionShape> childshape = managed_shapes.at(it.getDepth());
-          if (childshape == nullptr)
-          {
-            childshape = std::make_shared<btSphereShape>(static_cast<btScalar>((size / 2)));
-            childshape->setUserIndex(shape_index);
-            // Sphere is a special case where you do not modify the margin which is internally set to the radius
-            managed_shapes.at(it.getDepth()) = childshape;
-          }
-
-          subshape->addChildShape(geomTrans, childshape.get());
-        }
-      }
-
-      cow->manageReserve(managed_shapes.size());
-      for (const auto& managed_shape : managed_shapes)
-      {
-        if (managed_shape != nullptr)
-          cow->manage(managed_shape);
-      }
-
-      return subshape;
+      childshape = std::make_shared<btSphereShape>(static_cast<btScalar>((size / 2)));
+      // Sphere is a special case where you do not modify the margin which is internally set to the radius
+      break;
     }
     case tesseract_geometry::Octree::SubType::SPHERE_OUTSIDE:
     {
-      for (auto it = octree.begin(static_cast<unsigned char>(octree.getTreeDepth())), end = octree.end(); it != end;
-           ++it)
-      {
-        if (it->getOccupancy() >= occupancy_threshold)
-        {
-          double size = it.getSize();
-          btTransform geomTrans;
-          geomTrans.setIdentity();
-          geomTrans.setOrigin(btVector3(
-              static_cast<btScalar>(it.getX()), static_cast<btScalar>(it.getY()), static_cast<btScalar>(it.getZ())));
-
-          std::shared_ptr<btCollisionShape> childshape = managed_shapes.at(it.getDepth());
-          if (childshape == nullptr)
-          {
-            childshape =
-                std::make_shared<btSphereShape>(static_cast<btScalar>(std::sqrt(2 * ((size / 2) * (size / 2)))));
-            childshape->setUserIndex(shape_index);
-            // Sphere is a special case where you do not modify the margin which is internally set to the radius
-            managed_shapes.at(it.getDepth()) = childshape;
-          }
-
-          subshape->addChildShape(geomTrans, childshape.get());
-        }
-      }
+      childshape = std::make_shared<btSphereShape>(static_cast<btScalar>(std::sqrt(2 * ((size / 2) * (size / 2)))));
+      // Sphere is a special case where you do not modify the margin which is internally set to the radius
+      break;
+    }
+    default:
+    {
+      CONSOLE_BRIDGE_logError("This bullet shape type (%d) is not supported for geometry octree",
+                              static_cast<int>(data.geom->getSubType()));
+      return nullptr;
+    }
+  }
 
-      cow->manageReserve(managed_shapes.size());
-      for (const auto& managed_shape : managed_shapes)
-      {
-        if (managed_shape != nullptr)
-          cow->manage(managed_shape);
-      }
+  childshape->setUserIndex(data.shape_index);
+  cow->manage(childshape);
+  return childshape.get();
+}
 
-      return subshape;
-    }
+/**
+ * @brief Get the morton code of an octree key, which interleaves the key bits starting with the most significant
+ * @details All maximum depth voxels inside an octree node share the leading bits, so they form a contiguous range.
+ */
+std::uint64_t getMortonCode(const octomap::OcTreeKey& key)
+{
+  std::uint64_t code{ 0 };
+  for (unsigned i = 0; i < 16; ++i)
+    for (unsigned j = 0; j < 3; ++j)
+      code |= static_cast<std::uint64_t>((key[j] >> i) & 1U) << ((3 * i) + j);
+
+  return code;
+}
+
+/** @brief Get the number of morton codes covered by an octree node levels above the maximum depth */
+std::uint64_t getMortonRange(unsigned levels) { return std::uint64_t(1) << (3 * levels); }
+
+/**
+ * @brief Get the depth of the octree sub shape containing a key
+ * @details If the key is in unknown space this is the depth of the missing node.
+ */
+unsigned getOctreeSubShapeDepth(const tesseract_geometry::Octree& geom, const octomap::OcTreeKey& key)
+{
+  const octomap::OcTree& octree = *(geom.getOctree());
+  if (octree.getRoot() == nullptr)
+    return 0;
+
+  const unsigned tree_depth = octree.getTreeDepth();
+  const unsigned sub_shape_depth = geom.getSubShapeDepth();
+  std::vector<const octomap::OcTreeNode*> path{ octree.getRoot() };
+  while (path.size() <= sub_shape_depth && octree.nodeHasChildren(path.back()))
+  {
+    const auto depth = static_cast<unsigned>(path.size() - 1);
+    unsigned pos = octomap::computeChildIdx(key, static_cast<int>(tree_depth - depth - 1));
+    if (!octree.nodeChildExists(path.back(), pos))
+      return depth + 1;
+
+    path.push_back(octree.getNodeChild(path.back(), pos));
   }
 
-  CONSOLE_BRIDGE_logError("This bullet shape type (%d) is not supported for geometry octree",
-                          static_cast<int>(geom->getSubType()));
-  return nullptr;
+  // The largest fully occupied ancestor is a single sub shape
+  auto depth = static_cast<unsigned>(path.size() - 1);
+  if (geom.getMergeOccupiedNodes())
+  {
+    while (depth > 0 && geom.isNodeFullyOccupied(path[depth - 1], depth - 1))
+      --depth;
+  }
+
+  return depth;
+}
+
+/** @brief Record the morton code and depth of every child of an octree compound shape */
+void buildOctreeChildIndex(OctreeCompoundShape& data)
+{
+  const octomap::OcTree& octree = *(data.geom->getOctree());
+  const unsigned tree_depth = octree.getTreeDepth();
+  const int num_children = data.compound->getNumChildShapes();
+  data.child_index.clear();
+  data.child_codes.resize(static_cast<std::size_t>(num_children));
+  data.child_depths.resize(static_cast<std::size_t>(num_children));
+  for (int i = 0; i < num_children; ++i)
+  {
+    const btCollisionShape* childshape = data.compound->getChildShape(i);
+    auto depth_it = std::find_if(data.depth_shapes.begin(),
+                                 data.depth_shapes.end(),
+                                 [childshape](const auto& shape) { return shape.get() == childshape; });
+    assert(depth_it != data.depth_shapes.end());
+    auto depth = static_cast<unsigned>(depth_it - data.depth_shapes.begin());
+
+    // The child is centered on the octree node, so its origin is inside the node
+    const btVector3& origin = data.compound->getChildTransform(i).getOrigin();
+    octomap::OcTreeKey key = octree.coordToKey(octomap::point3d(static_cast<float>(origin.x()),
+                                                                static_cast<float>(origin.y()),
+                                                                static_cast<float>(origin.z())));
+    std::uint64_t code = getMortonCode(key) & ~(getMortonRange(tree_depth - depth) - 1);
+
+    data.child_codes[static_cast<std::size_t>(i)] = code;
+    data.child_depths[static_cast<std::size_t>(i)] = depth;
+    data.child_index[code] = i;
+  }
+}
+
+/**
+ * @brief Add a sub shape of an octree to its compound shape
+ * @param data The octree compound shape
+ * @param cow The collision object managing the child shapes
+ * @param key The key of the first maximum depth voxel inside the node of the sub shape
+ * @param depth The depth of the node
+ * @param update_index Indicate if the child index should be updated
+ * @return True if the sub shape was added, otherwise false
+ */
+bool addOctreeChildShape(OctreeCompoundShape& data,
+                         CollisionObjectWrapper* cow,
+                         const octomap::OcTreeKey& key,
+                         unsigned depth,
+                         bool update_index)
+{
+  btCollisionShape* childshape = getOctreeChildShape(data, cow, depth);
+  if (childshape == nullptr)
+    return false;
+
+  octomap::point3d center = data.geom->getOctree()->keyToCoord(key, depth);
+  btTransform geomTrans;
+  geomTrans.setIdentity();
+  geomTrans.setOrigin(btVector3(
+      static_cast<btScalar>(center.x()), static_cast<btScalar>(center.y()), static_cast<btScalar>(center.z())));
+
+  if (update_index)
+  {
+    std::uint64_t code = getMortonCode(key);
+    data.child_index[code] = data.compound->getNumChildShapes();
+    data.child_codes.push_back(code);
+    data.child_depths.push_back(depth);
+  }
+
+  data.compound->addChildShape(geomTrans, childshape);
+  return true;
+}
+
+/**
+ * @brief Copy a compound shape, the children shapes are shared
+ * @param compound The compound shape to copy
+ * @param child The child shape to replace, it is replaced by new_child in the copy
+ * @param new_child The child shape used in place of child
+ * @return The copy of the compound shape
+ */
+std::shared_ptr<btCompoundShape> copyCompoundShape(btCompoundShape& compound,
+                                                   const btCollisionShape* child = nullptr,
+                                                   btCollisionShape* new_child = nullptr)
+{
+  auto copy = std::make_shared<btCompoundShape>(BULLET_COMPOUND_USE_DYNAMIC_AABB, compound.getNumChildShapes());
+  copy->setMargin(compound.getMargin());
+  for (int i = 0; i < compound.getNumChildShapes(); ++i)
+  {
+    btCollisionShape* childshape = compound.getChildShape(i);
+    copy->addChildShape(compound.getChildTransform(i), (childshape == child) ? new_child : childshape);
+  }
+
+  return copy;
+}
+
+std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry::Octree::ConstPtr& geom,
+                                                       CollisionObjectWrapper* cow,
+                                                       int shape_index)
+{
+  const octomap::OcTree& octree = *(geom->getOctree());
+  auto data = std::make_shared<OctreeCompoundShape>();
+  data->geom = geom;
+  data->shape_index = shape_index;
+  data->compound =
+      std::make_shared<btCompoundShape>(BULLET_COMPOUND_USE_DYNAMIC_AABB, static_cast<int>(octree.size()));
+  data->depth_shapes.resize(octree.getTreeDepth() + 1);
+
+  bool success{ true };
+  geom->forEachSubShape([&](const octomap::OcTreeKey& key, unsigned depth) {
+    if (success)
+      success = addOctreeChildShape(*data, cow, key, depth, false);
+  });
+
+  if (!success)
+    return nullptr;
+
+  cow->manageOctree(data);
+  return data->compound;
 }
 
 std::shared_ptr<btCollisionShape> createShapePrimitive(const CollisionShapeConstPtr& geom,
@@ -427,6 +518,15 @@ void updateCollisionObjectFilters(const std::vector<std::string>& active, const
   }
 }
 
+std::size_t GjkWarmStartKeyHash::operator()(const GjkWarmStartKey& key) const
+{
+  std::size_t seed{ 0 };
+  for (int value : key)
+    seed ^= std::hash<int>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+
+  return seed;
+}
+
 CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
                                                const int& type_id,
                                                CollisionShapesConst shapes,
@@ -513,11 +613,15 @@ std::shared_ptr<CollisionObjectWrapper> CollisionObjectWrapper::clone()
   clone_cow->m_shapes = m_shapes;
   clone_cow->m_shape_poses = m_shape_poses;
   clone_cow->m_data = m_data;
+  clone_cow->m_octree_data = m_octree_data;
   clone_cow->setCollisionShape(getCollisionShape());
   clone_cow->setWorldTransform(getWorldTransform());
   clone_cow->m_collisionFilterGroup = m_collisionFilterGroup;
   clone_cow->m_collisionFilterMask = m_collisionFilterMask;
   clone_cow->m_enabled = m_enabled;
+  clone_cow->m_collisionObjectId = m_collisionObjectId;
+  clone_cow->m_allowedCollisionLinkId = m_allowedCollisionLinkId;
+  clone_cow->m_gjkWarmStartCache = m_gjkWarmStartCache;
   clone_cow->setBroadphaseHandle(nullptr);
   return clone_cow;
 }
@@ -526,6 +630,178 @@ void CollisionObjectWrapper::manage(const std::shared_ptr<btCollisionShape>& t)
 
 void CollisionObjectWrapper::manageReserve(std::size_t s) { m_data.reserve(s); }
 
+void CollisionObjectWrapper::manageOctree(const OctreeCompoundShape::Ptr& t) { m_octree_data[t->shape_index] = t; }
+
+void CollisionObjectWrapper::releaseOctrees() { m_octree_data.clear(); }
+
+bool CollisionObjectWrapper::updateOctree(std::size_t shape_index,
+                                          const tesseract_geometry::Octree::ConstPtr& octree,
+                                          const OctreeDelta& delta)
+{
+  auto it = m_octree_data.find(static_cast<int>(shape_index));
+  if (it == m_octree_data.end() || octree == nullptr)
+    return false;
+
+  // The children are keyed by their octree node, so the updated octree must use the same nodes and sub shapes
+  const tesseract_geometry::Octree& current = *it->second->geom;
+  if (octree->getOctree()->getResolution() != current.getOctree()->getResolution() ||
+      octree->getOctree()->getTreeDepth() != current.getOctree()->getTreeDepth() ||
+      octree->getSubType() != current.getSubType() ||
+      octree->getMergeOccupiedNodes() != current.getMergeOccupiedNodes() ||
+      octree->getMaxCollisionDepth() != current.getMaxCollisionDepth())
+    return false;
+
+  // The compound is shared with clones, so it is copied before it gets modified. This also copies the parent compound
+  // when the collision object has multiple shapes.
+  if (it->second.use_count() > 1)
+  {
+    auto data = std::make_shared<OctreeCompoundShape>(*it->second);
+    data->compound = copyCompoundShape(*it->second->compound);
+
+    btCollisionShape* shape = getCollisionShape();
+    btCollisionShape* old_compound = it->second->compound.get();
+    if (shape != old_compound)
+    {
+      auto* parent = static_cast<btCompoundShape*>(shape);  // NOLINT
+      std::shared_ptr<btCompoundShape> new_parent = copyCompoundShape(*parent, old_compound, data->compound.get());
+      std::replace_if(
+          m_data.begin(), m_data.end(), [parent](const auto& t) { return t.get() == parent; }, new_parent);
+      setCollisionShape(new_parent.get());
+    }
+    else
+    {
+      setCollisionShape(data->compound.get());
+    }
+
+    std::replace_if(m_data.begin(),
+                    m_data.end(),
+                    [old_compound](const auto& t) { return t.get() == old_compound; },
+                    data->compound);
+    it->second = data;
+  }
+
+  OctreeCompoundShape& data = *it->second;
+  if (data.child_codes.size() != static_cast<std::size_t>(data.compound->getNumChildShapes()))
+    buildOctreeChildIndex(data);
+
+  data.geom = octree;
+  m_shapes[shape_index] = octree;
+
+  const octomap::OcTree& ot = *(octree->getOctree());
+  const unsigned tree_depth = ot.getTreeDepth();
+
+  // Find the octree nodes to rebuild, keyed by the morton code of their first voxel. A node must contain every child
+  // and sub shape it overlaps, so it is the largest of the child and the sub shape containing the changed voxel.
+  std::map<std::uint64_t, std::pair<unsigned, octomap::OcTreeKey>> nodes;
+  auto add_node = [&](const Eigen::Vector3d& voxel) {
+    octomap::OcTreeKey key;
+    if (!ot.coordToKeyChecked(voxel.x(), voxel.y(), voxel.z(), key))
+      return;
+
+    std::uint64_t code = getMortonCode(key);
+    unsigned depth = getOctreeSubShapeDepth(*data.geom, key);
+    auto child_it = data.child_index.upper_bound(code);
+    if (child_it != data.child_index.begin())
+    {
+      --child_it;
+      unsigned child_depth = data.child_depths[static_cast<std::size_t>(child_it->second)];
+      if (code - child_it->first < getMortonRange(tree_depth - child_depth))
+        depth = std::min(depth, child_depth);
+    }
+
+    const auto mask = static_cast<octomap::key_type>(~((1U << (tree_depth - depth)) - 1));
+    for (unsigned j = 0; j < 3; ++j)
+      key[j] = static_cast<octomap::key_type>(key[j] & mask);
+
+    auto node_it = nodes.try_emplace(getMortonCode(key), depth, key).first;
+    node_it->second.first = std::min(node_it->second.first, depth);
+  };
+
+  for (const auto& voxel : delta.occupied)
+    add_node(voxel);
+
+  for (const auto& voxel : delta.free)
+    add_node(voxel);
+
+  // Remove the children inside the nodes, nested nodes are skipped because their children are already removed
+  std::vector<int> removed;
+  std::uint64_t covered_end{ 0 };
+  for (auto node_it = nodes.begin(); node_it != nodes.end();)
+  {
+    std::uint64_t node_end = node_it->first + getMortonRange(tree_depth - node_it->second.first);
+    if (node_it->first < covered_end)
+    {
+      node_it = nodes.erase(node_it);
+      continue;
+    }
+
+    auto first = data.child_index.lower_bound(node_it->first);
+    auto last = data.child_index.lower_bound(node_end);
+    for (auto child_it = first; child_it != last; ++child_it)
+      removed.push_back(child_it->second);
+
+    data.child_index.erase(first, last);
+    covered_end = node_end;
+    ++node_it;
+  }
+
+  // The last child is moved to the index of the removed child, so remove from the back to keep the indices valid
+  std::sort(removed.begin(), removed.end(), std::greater<>());
+  for (int index : removed)
+  {
+    auto last = static_cast<int>(data.child_codes.size()) - 1;
+    data.compound->removeChildShapeByIndex(index);
+    if (index != last)
+    {
+      data.child_codes[static_cast<std::size_t>(index)] = data.child_codes.back();
+      data.child_depths[static_cast<std::size_t>(index)] = data.child_depths.back();
+      data.child_index[data.child_codes.back()] = index;
+    }
+    data.child_codes.pop_back();
+    data.child_depths.pop_back();
+  }
+
+  // Add the sub shapes inside the nodes from the updated octree
+  for (const auto& node : nodes)
+  {
+    const unsigned depth = node.second.first;
+    const octomap::OcTreeKey& key = node.second.second;
+    const octomap::OcTreeNode* octree_node = ot.getRoot();
+    for (unsigned d = 0; d < depth && octree_node != nullptr; ++d)
+    {
+      unsigned pos = octomap::computeChildIdx(key, static_cast<int>(tree_depth - d - 1));
+      octree_node = ot.nodeChildExists(octree_node, pos) ? ot.getNodeChild(octree_node, pos) : nullptr;
+    }
+
+    if (octree_node != nullptr)
+    {
+      data.geom->forEachSubShape(
+          octree_node, key, depth, [&](const octomap::OcTreeKey& child_key, unsigned child_depth) {
+            addOctreeChildShape(data, this, child_key, child_depth, true);
+          });
+    }
+  }
+
+  if (!removed.empty())
+    data.compound->recalculateLocalAabb();
+
+  // Update the bounding box of the octree in the parent compound
+  if (getCollisionShape() != data.compound.get())
+  {
+    auto* parent = static_cast<btCompoundShape*>(getCollisionShape());  // NOLINT
+    for (int i = 0; i < parent->getNumChildShapes(); ++i)
+    {
+      if (parent->getChildShape(i) == data.compound.get())
+      {
+        parent->updateChildTransform(i, parent->getChildTransform(i), true);
+        break;
+      }
+    }
+  }
+
+  return true;
+}
+
 CastHullShape::CastHullShape(btConvexShape* shape, const btTransform& t01) : m_shape(shape), m_t01(t01)
 {
   m_shapeType = CUSTOM_CONVEX_SHAPE_TYPE;
@@ -674,6 +950,119 @@ bool needsCollisionCheck(const COW& cow1, const COW& cow2, const IsContactAllowe
          !isContactAllowed(cow1.getName(), cow2.getName(), acm, verbose);
 }
 
+bool needsCollisionCheck(const COW& cow1, const COW& cow2, const ContactTestData& cdata, bool verbose)
+{
+  return cow1.m_enabled && cow2.m_enabled && (cow2.m_collisionFilterGroup & cow1.m_collisionFilterMask) &&  // NOLINT
+         (cow1.m_collisionFilterGroup & cow2.m_collisionFilterMask) &&                                      // NOLINT
+         !isContactAllowed(cow1.getName(),
+                           cow1.m_allowedCollisionLinkId,
+                           cow2.getName(),
+                           cow2.m_allowedCollisionLinkId,
+                           cdata,
+                           verbose);
+}
+
+btVector3* getGjkWarmStartAxis(const btCollisionObjectWrapper* colObj0Wrap,
+                               const btCollisionObjectWrapper* colObj1Wrap,
+                               bool& negate)
+{
+  assert(dynamic_cast<const CollisionObjectWrapper*>(colObj0Wrap->getCollisionObject()) != nullptr);
+  assert(dynamic_cast<const CollisionObjectWrapper*>(colObj1Wrap->getCollisionObject()) != nullptr);
+  const auto* cd0 = static_cast<const CollisionObjectWrapper*>(colObj0Wrap->getCollisionObject());  // NOLINT
+  const auto* cd1 = static_cast<const CollisionObjectWrapper*>(colObj1Wrap->getCollisionObject());  // NOLINT
+
+  if (cd0->m_collisionObjectId < 0 || cd1->m_collisionObjectId < 0)
+    return nullptr;
+
+  negate = (cd0->m_collisionObjectId > cd1->m_collisionObjectId);
+  const CollisionObjectWrapper* cd_first = negate ? cd1 : cd0;
+  const CollisionObjectWrapper* cd_second = negate ? cd0 : cd1;
+  const btCollisionObjectWrapper* first_wrap = negate ? colObj1Wrap : colObj0Wrap;
+  const btCollisionObjectWrapper* second_wrap = negate ? colObj0Wrap : colObj1Wrap;
+
+  GjkWarmStartKey key{ cd_second->m_collisionObjectId,
+                       first_wrap->getCollisionShape()->getUserIndex(),
+                       first_wrap->m_index,
+                       second_wrap->getCollisionShape()->getUserIndex(),
+                       second_wrap->m_index };
+
+  auto it = cd_first->m_gjkWarmStartCache.try_emplace(key, btScalar(0), btScalar(0), btScalar(0)).first;
+  return &(it->second);
+}
+
+void clearGjkWarmStartCaches(const Link2Cow& link2cow)
+{
+  for (const auto& cow : link2cow)
+    cow.second->m_gjkWarmStartCache.clear();
+}
+
+void setAllowedCollisionLinkIds(const Link2Cow& link2cow,
+                                const tesseract_common::CompiledAllowedCollisionMatrix& compiled_acm)
+{
+  for (const auto& cow : link2cow)
+    cow.second->m_allowedCollisionLinkId = compiled_acm.getLinkId(cow.first);
+}
+
+/** @brief Get the geometry type a collision shape of a collision object was created from */
+tesseract_geometry::GeometryType getGeometryType(const btCollisionObjectWrapper* objWrap)
+{
+  const auto* cow = static_cast<const CollisionObjectWrapper*>(objWrap->getCollisionObject());  // NOLINT
+  const CollisionShapesConst& shapes = cow->getCollisionGeometries();
+  const int shape_index = objWrap->getCollisionShape()->getUserIndex();
+  if (shape_index < 0 || static_cast<std::size_t>(shape_index) >= shapes.size())
+    return tesseract_geometry::GeometryType::UNINITIALIZED;
+
+  return shapes[static_cast<std::size_t>(shape_index)]->getType();
+}
+
+void recordNarrowphaseCall(ContactTestStatistics& statistics,
+                           const btCollisionObjectWrapper* obj0Wrap,
+                           const btCollisionObjectWrapper* obj1Wrap)
+{
+  if (obj0Wrap->getCollisionShape()->isCompound() || obj1Wrap->getCollisionShape()->isCompound())
+    return;
+
+  statistics.addNarrowphaseCall(getGeometryType(obj0Wrap), getGeometryType(obj1Wrap));
+}
+
+void processNarrowphase(btCollisionAlgorithm* algorithm,
+                        const btCollisionObjectWrapper* obj0Wrap,
+                        const btCollisionObjectWrapper* obj1Wrap,
+                        const btDispatcherInfo& dispatch_info,
+                        btManifoldResult* result,
+                        ContactTestStatistics* statistics)
+{
+  if (statistics == nullptr)
+  {
+    algorithm->processCollision(obj0Wrap, obj1Wrap, dispatch_info, result);
+    return;
+  }
+
+  auto start_time = std::chrono::steady_clock::now();
+  recordNarrowphaseCall(*statistics, obj0Wrap, obj1Wrap);
+  algorithm->processCollision(obj0Wrap, obj1Wrap, dispatch_info, result);
+  statistics->narrowphase_time += std::chrono::steady_clock::now() - start_time;
+}
+
+ContactTestStatisticsTimer::ContactTestStatisticsTimer(ContactTestStatistics* statistics) : statistics_(statistics)
+{
+  if (statistics_ == nullptr)
+    return;
+
+  ++statistics_->contact_tests;
+  start_narrowphase_time_ = statistics_->narrowphase_time;
+  start_time_ = std::chrono::steady_clock::now();
+}
+
+ContactTestStatisticsTimer::~ContactTestStatisticsTimer()
+{
+  if (statistics_ == nullptr)
+    return;
+
+  std::chrono::nanoseconds total_time = std::chrono::steady_clock::now() - start_time_;
+  statistics_->broadphase_time += total_time - (statistics_->narrowphase_time - start_narrowphase_time_);
+}
+
 btScalar addDiscreteSingleResult(btManifoldPoint& cp,
                                  const btCollisionObjectWrapper* colObj0Wrap,
                                  const btCollisionObjectWrapper* colObj1Wrap,
@@ -684,10 +1073,36 @@ btScalar addDiscreteSingleResult(btManifoldPoint& cp,
   const auto* cd0 = static_cast<const CollisionObjectWrapper*>(colObj0Wrap->getCollisionObject());  // NOLINT
   const auto* cd1 = static_cast<const CollisionObjectWrapper*>(colObj1Wrap->getCollisionObject());  // NOLINT
 
+  // Only checking if any contact exists so the contact result is not needed
+  if (collisions.res == nullptr && collisions.compact_res == nullptr && !collisions.req.is_valid)
+  {
+    bool in_contact = processAnyContact(collisions,
+                                        static_cast<double>(cp.m_distance1),
+                                        cd0->getName(),
+                                        cd1->getName(),
+                                        cd0->m_collisionObjectId,
+                                        cd1->m_collisionObjectId);
+    return (in_contact ? 1 : 0);
+  }
+
+  // Storing compact contact results so only the ids, distance, normal and world points are needed
+  if (collisions.compact_res != nullptr && !collisions.req.is_valid)
+  {
+    CompactContactResult contact;
+    contact.distance = static_cast<double>(cp.m_distance1);
+    contact.object_id = { cd0->m_collisionObjectId, cd1->m_collisionObjectId };
+    contact.shape_id = { colObj0Wrap->getCollisionShape()->getUserIndex(),
+                         colObj1Wrap->getCollisionShape()->getUserIndex() };
+    contact.subshape_id = { colObj0Wrap->m_index, colObj1Wrap->m_index };
+    contact.normal = convertBtToEigen(-1 * cp.m_normalWorldOnB);
+    contact.nearest_points[0] = convertBtToEigen(cp.m_positionWorldOnA);
+    contact.nearest_points[1] = convertBtToEigen(cp.m_positionWorldOnB);
+    return (processCompactResult(collisions, contact, cd0->getName(), cd1->getName()) ? 1 : 0);
+  }
+
   ObjectPairKey pc = getObjectPairKey(cd0->getName(), cd1->getName());
 
-  const auto& it = collisions.res->find(pc);
-  bool found = (it != collisions.res->end());
+  bool found = (collisions.res != nullptr && collisions.res->find(pc) != collisions.res->end());
 
   //    size_t l = 0;
   //    if (found)
@@ -721,7 +1136,7 @@ btScalar addDiscreteSingleResult(btManifoldPoint& cp,
   contact.distance = static_cast<double>(cp.m_distance1);
   contact.normal = convertBtToEigen(-1 * cp.m_normalWorldOnB);
 
-  if (processResult(collisions, contact, pc, found) == nullptr)
+  if (processResult(collisions, contact, pc, found, cd0->m_collisionObjectId, cd1->m_collisionObjectId) == nullptr)
     return 0;
 
   return 1;
@@ -815,12 +1230,45 @@ btScalar addCastSingleResult(btManifoldPoint& cp,
   const auto* cd0 = static_cast<const CollisionObjectWrapper*>(colObj0Wrap->getCollisionObject());  // NOLINT
   const auto* cd1 = static_cast<const CollisionObjectWrapper*>(colObj1Wrap->getCollisionObject());  // NOLINT
 
+  // Only checking if any contact exists so the contact result and continuous data are not needed
+  if (collisions.res == nullptr && collisions.compact_res == nullptr && !collisions.req.is_valid)
+  {
+    bool in_contact = processAnyContact(collisions,
+                                        static_cast<double>(cp.m_distance1),
+                                        cd0->getName(),
+                                        cd1->getName(),
+                                        cd0->m_collisionObjectId,
+                                        cd1->m_collisionObjectId);
+    return (in_contact ? 1 : 0);
+  }
+
+  // Storing compact contact results so the continuous data is not needed, the cast object is stored second
+  if (collisions.compact_res != nullptr && !collisions.req.is_valid)
+  {
+    bool swap = (cd0->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter &&
+                 cd1->m_collisionFilterGroup != btBroadphaseProxy::KinematicFilter);
+    const btCollisionObjectWrapper* first_wrap = swap ? colObj1Wrap : colObj0Wrap;
+    const btCollisionObjectWrapper* second_wrap = swap ? colObj0Wrap : colObj1Wrap;
+    const auto* first_cd = swap ? cd1 : cd0;
+    const auto* second_cd = swap ? cd0 : cd1;
+
+    CompactContactResult contact;
+    contact.distance = static_cast<double>(cp.m_distance1);
+    contact.object_id = { first_cd->m_collisionObjectId, second_cd->m_collisionObjectId };
+    contact.shape_id = { first_wrap->getCollisionShape()->getUserIndex(),
+                         second_wrap->getCollisionShape()->getUserIndex() };
+    contact.subshape_id = { first_wrap->m_index, second_wrap->m_index };
+    contact.normal = convertBtToEigen((swap ? 1 : -1) * cp.m_normalWorldOnB);
+    contact.nearest_points[0] = convertBtToEigen(swap ? cp.m_positionWorldOnB : cp.m_positionWorldOnA);
+    contact.nearest_points[1] = convertBtToEigen(swap ? cp.m_positionWorldOnA : cp.m_positionWorldOnB);
+    return (processCompactResult(collisions, contact, first_cd->getName(), second_cd->getName()) ? 1 : 0);
+  }
+
   const std::pair<std::string, std::string>& pc = cd0->getName() < cd1->getName() ?
                                                       std::make_pair(cd0->getName(), cd1->getName()) :
                                                       std::make_pair(cd1->getName(), cd0->getName());
 
-  auto it = collisions.res->find(pc);
-  bool found = it != collisions.res->end();
+  bool found = (collisions.res != nullptr && collisions.res->find(pc) != collisions.res->end());
 
   //    size_t l = 0;
   //    if (found)
@@ -853,7 +1301,8 @@ btScalar addCastSingleResult(btManifoldPoint& cp,
   contact.distance = static_cast<double>(cp.m_distance1);
   contact.normal = convertBtToEigen(-1 * cp.m_normalWorldOnB);
 
-  ContactResult* col = processResult(collisions, contact, pc, found);
+  ContactResult* col =
+      processResult(collisions, contact, pc, found, cd0->m_collisionObjectId, cd1->m_collisionObjectId);
   if (col == nullptr)
     return 0;
 
@@ -952,7 +1401,7 @@ BroadphaseContactResultCallback::BroadphaseContactResultCallback(ContactTestData
 bool BroadphaseContactResultCallback::needsCollision(const CollisionObjectWrapper* cow0,
                                                      const CollisionObjectWrapper* cow1) const
 {
-  return !collisions_.done && needsCollisionCheck(*cow0, *cow1, collisions_.fn, verbose_);
+  return !collisions_.done && needsCollisionCheck(*cow0, *cow1, collisions_, verbose_);
 }
 
 DiscreteBroadphaseContactResultCallback::DiscreteBroadphaseContactResultCallback(ContactTestData& collisions,
@@ -976,6 +1425,123 @@ btScalar DiscreteBroadphaseContactResultCallback::addSingleResult(btManifoldPoin
   return addDiscreteSingleResult(cp, colObj0Wrap, colObj1Wrap, collisions_);
 }
 
+DiscreteQueryContactResultCallback::DiscreteQueryContactResultCallback(ContactTestData& collisions,
+                                                                       double contact_distance,
+                                                                       bool verbose)
+  : DiscreteBroadphaseContactResultCallback(collisions, contact_distance, verbose)
+{
+}
+
+bool DiscreteQueryContactResultCallback::needsCollision(const CollisionObjectWrapper* cow0,
+                                                        const CollisionObjectWrapper* cow1) const
+{
+  return !collisions_.done && cow0->m_enabled && cow1->m_enabled &&
+         !isContactAllowed(cow0->getName(),
+                           cow0->m_allowedCollisionLinkId,
+                           cow1->getName(),
+                           cow1->m_allowedCollisionLinkId,
+                           collisions_,
+                           verbose_);
+}
+
+BroadphaseAabbCollector::BroadphaseAabbCollector(std::vector<CollisionObjectWrapper*>& overlaps) : overlaps_(overlaps)
+{
+}
+
+bool BroadphaseAabbCollector::process(const btBroadphaseProxy* proxy)
+{
+  overlaps_.push_back(static_cast<CollisionObjectWrapper*>(proxy->m_clientObject));
+  return true;
+}
+
+PointCollisionCollector::PointCollisionCollector(const CollisionObjectWrapper* point_cow,
+                                                 PointContactResult& result,
+                                                 double contact_distance)
+  : point_cow_(point_cow), result_(result)
+{
+  m_closestDistanceThreshold = static_cast<btScalar>(contact_distance);
+}
+
+btScalar PointCollisionCollector::addSingleResult(btManifoldPoint& cp,
+                                                  const btCollisionObjectWrapper* colObj0Wrap,
+                                                  int /*partId0*/,
+                                                  int /*index0*/,
+                                                  const btCollisionObjectWrapper* colObj1Wrap,
+                                                  int /*partId1*/,
+                                                  int /*index1*/)
+{
+  if (cp.m_distance1 > m_closestDistanceThreshold || static_cast<double>(cp.m_distance1) >= result_.distance)
+    return 0;
+
+  // The manifold result may swap the pair, so the point is identified by its collision object
+  bool point_is_first = (colObj0Wrap->getCollisionObject() == point_cow_);
+  const btCollisionObjectWrapper* link_wrap = point_is_first ? colObj1Wrap : colObj0Wrap;
+  assert(dynamic_cast<const CollisionObjectWrapper*>(link_wrap->getCollisionObject()) != nullptr);
+  const auto* cd = static_cast<const CollisionObjectWrapper*>(link_wrap->getCollisionObject());  // NOLINT
+
+  result_.distance = static_cast<double>(cp.m_distance1);
+  result_.link_name = cd->getName();
+  result_.shape_id = link_wrap->getCollisionShape()->getUserIndex();
+  result_.subshape_id = link_wrap->m_index;
+  result_.nearest_point = convertBtToEigen(point_is_first ? cp.m_positionWorldOnB : cp.m_positionWorldOnA);
+  return 1;
+}
+
+PointCollisionAlgorithmCache::PointCollisionAlgorithmCache(btCollisionDispatcher& dispatcher) : dispatcher_(dispatcher)
+{
+}
+
+PointCollisionAlgorithmCache::~PointCollisionAlgorithmCache()
+{
+  for (auto& algorithm : algorithms_)
+  {
+    if (algorithm.second != nullptr)
+    {
+      algorithm.second->~btCollisionAlgorithm();
+      dispatcher_.freeCollisionAlgorithm(algorithm.second);
+    }
+  }
+}
+
+btCollisionAlgorithm* PointCollisionAlgorithmCache::get(const btCollisionObjectWrapper* point_wrap,
+                                                        const btCollisionObjectWrapper* cow_wrap)
+{
+  auto it = algorithms_.find(cow_wrap->getCollisionObject());
+  if (it != algorithms_.end())
+    return it->second;
+
+  btCollisionAlgorithm* algorithm =
+      dispatcher_.findAlgorithm(point_wrap, cow_wrap, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
+  algorithms_.emplace(cow_wrap->getCollisionObject(), algorithm);
+  return algorithm;
+}
+
+void pointContactTestPair(const CollisionObjectWrapper& point_cow,
+                          const CollisionObjectWrapper& cow,
+                          PointCollisionAlgorithmCache& algorithms,
+                          const btDispatcherInfo& dispatch_info,
+                          PointCollisionCollector& cc,
+                          ContactTestStatistics* statistics)
+{
+  if (statistics != nullptr)
+    ++statistics->broadphase_pairs;
+
+  btCollisionObjectWrapper obA(
+      nullptr, point_cow.getCollisionShape(), &point_cow, point_cow.getWorldTransform(), -1, -1);
+  btCollisionObjectWrapper obB(nullptr, cow.getCollisionShape(), &cow, cow.getWorldTransform(), -1, -1);
+
+  btCollisionAlgorithm* algorithm = algorithms.get(&obA, &obB);
+  assert(algorithm != nullptr);
+  if (algorithm != nullptr)
+  {
+    TesseractBridgedManifoldResult contactPointResult(&obA, &obB, cc);
+    contactPointResult.m_closestPointDistanceThreshold = cc.m_closestDistanceThreshold;
+
+    // discrete collision detection query
+    processNarrowphase(algorithm, &obA, &obB, dispatch_info, &contactPointResult, statistics);
+  }
+}
+
 CastBroadphaseContactResultCallback::CastBroadphaseContactResultCallback(ContactTestData& collisions,
                                                                          double contact_distance,
                                                                          bool verbose)
@@ -1069,6 +1635,10 @@ bool TesseractCollisionPairCallback::processOverlap(btBroadphasePair& pair)
   const auto* cow0 = static_cast<const CollisionObjectWrapper*>(pair.m_pProxy0->m_clientObject);
   const auto* cow1 = static_cast<const CollisionObjectWrapper*>(pair.m_pProxy1->m_clientObject);
 
+  ContactTestStatistics* statistics = results_callback_.collisions_.statistics;
+  if (statistics != nullptr)
+    ++statistics->broadphase_pairs;
+
   if (results_callback_.needsCollision(cow0, cow1))
   {
     btCollisionObjectWrapper obj0Wrap(nullptr, cow0->getCollisionShape(), cow0, cow0->getWorldTransform(), -1, -1);
@@ -1086,9 +1656,13 @@ bool TesseractCollisionPairCallback::processOverlap(btBroadphasePair& pair)
       contactPointResult.m_closestPointDistanceThreshold = static_cast<btScalar>(results_callback_.contact_distance_);
 
       // discrete collision detection query
-      pair.m_algorithm->processCollision(&obj0Wrap, &obj1Wrap, dispatch_info_, &contactPointResult);
+      processNarrowphase(pair.m_algorithm, &obj0Wrap, &obj1Wrap, dispatch_info_, &contactPointResult, statistics);
     }
   }
+  else if (statistics != nullptr)
+  {
+    ++statistics->rejected_pairs;
+  }
   return false;
 }
 
@@ -1104,6 +1678,12 @@ bool TesseractOverlapFilterCallback::needBroadphaseCollision(btBroadphaseProxy*
                              verbose_);
 }
 
+bool QueryOverlapFilterCallback::needBroadphaseCollision(btBroadphaseProxy* /*proxy0*/,
+                                                         btBroadphaseProxy* /*proxy1*/) const
+{
+  return true;
+}
+
 COW::Ptr createCollisionObject(const std::string& name,
                                const int& type_id,
                                const CollisionShapesConst& shapes,
@@ -1155,7 +1735,7 @@ bool DiscreteCollisionCollector::needsCollision(btBroadphaseProxy* proxy0) const
 {
   return !collisions_.done &&
          needsCollisionCheck(
-             *cow_, *(static_cast<CollisionObjectWrapper*>(proxy0->m_clientObject)), collisions_.fn, verbose_);
+             *cow_, *(static_cast<CollisionObjectWrapper*>(proxy0->m_clientObject)), collisions_, verbose_);
 }
 
 CastCollisionCollector::CastCollisionCollector(ContactTestData& collisions,
@@ -1188,13 +1768,26 @@ bool CastCollisionCollector::needsCollision(btBroadphaseProxy* proxy0) const
 {
   return !collisions_.done &&
          needsCollisionCheck(
-             *cow_, *(static_cast<CollisionObjectWrapper*>(proxy0->m_clientObject)), collisions_.fn, verbose_);
+             *cow_, *(static_cast<CollisionObjectWrapper*>(proxy0->m_clientObject)), collisions_, verbose_);
+}
+
+COW::Ptr makePointCollisionObject()
+{
+  auto point_cow = std::make_shared<CollisionObjectWrapper>();
+  auto shape = std::make_shared<btSphereShape>(0);
+  point_cow->manage(shape);
+  point_cow->setCollisionShape(shape.get());
+  point_cow->setWorldTransform(btTransform::getIdentity());
+  return point_cow;
 }
 
 COW::Ptr makeCastCollisionObject(const COW::Ptr& cow)
 {
   COW::Ptr new_cow = cow->clone();
 
+  // The octrees are updated through the collision object, sharing them would force a copy on every update
+  new_cow->releaseOctrees();
+
   btTransform tf;
   tf.setIdentity();
 
@@ -1289,6 +1882,33 @@ COW::Ptr makeCastCollisionObject(const COW::Ptr& cow)
   return new_cow;
 }
 
+std::unique_ptr<btBroadphaseInterface> createBroadphase(const BulletBroadphaseConfig& config)
+{
+  switch (config.type)
+  {
+    case BulletBroadphaseType::SWEEP_AND_PRUNE:
+    {
+      btVector3 world_min = convertEigenToBt(config.world_min);
+      btVector3 world_max = convertEigenToBt(config.world_max);
+
+      // btAxisSweep3 stores the handles in 16 bits
+      if (config.max_handles <= 16384)
+      {
+        auto max_handles = static_cast<unsigned short int>(config.max_handles);
+        return std::make_unique<btAxisSweep3>(world_min, world_max, max_handles);
+      }
+
+      return std::make_unique<bt32BitAxisSweep3>(world_min, world_max, config.max_handles);
+    }
+    case BulletBroadphaseType::HASH_GRID:
+      return std::make_unique<TesseractHashGridBroadphase>(config.cell_size, config.max_cells_per_proxy);
+    case BulletBroadphaseType::DBVT:
+      break;
+  }
+
+  return std::make_unique<btDbvtBroadphase>();
+}
+
 void updateBroadphaseAABB(const COW::Ptr& cow,
                           const std::unique_ptr<btBroadphaseInterface>& broadphase,
                           const std::unique_ptr<btCollisionDispatcher>& dispatcher)
@@ -1342,6 +1962,24 @@ void updateCollisionObjectFilters(const std::vector<std::string>& active,
   broadphase->getOverlappingPairCache()->cleanProxyFromPairs(cow->getBroadphaseHandle(), dispatcher.get());
 }
 
+void removeSeparatedPairs(btOverlappingPairCache& pair_cache, const std::unique_ptr<btCollisionDispatcher>& dispatcher)
+{
+  struct SeparatedPairCallback : public btOverlapCallback
+  {
+    bool processOverlap(btBroadphasePair& pair) override
+    {
+      return !TestAabbAgainstAabb2(pair.m_pProxy0->m_aabbMin,
+                                   pair.m_pProxy0->m_aabbMax,
+                                   pair.m_pProxy1->m_aabbMin,
+                                   pair.m_pProxy1->m_aabbMax);
+    }
+  };
+
+  // The pair cache removes the pairs for which the callback returns true
+  SeparatedPairCallback callback;
+  pair_cache.processAllOverlappingPairs(&callback, dispatcher.get());
+}
+
 void refreshBroadphaseProxy(const COW::Ptr& cow,
                             const std::unique_ptr<btBroadphaseInterface>& broadphase,
                             const std::unique_ptr<btCollisionDispatcher>& dispatcher)
@@ -30,6 +30,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/bullet/tesseract_compound_collision_algorithm.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
 #include <tesseract_collision/core/types.h>
 
 // LCOV_EXCL_START
@@ -204,6 +205,9 @@ public:
         m_resultOut->setShapeIdentifiersB(-1, index);
       }
 
+      if (m_contact_test_data->statistics != nullptr)
+        recordNarrowphaseCall(*m_contact_test_data->statistics, &compoundWrap, m_otherObjWrap);
+
       algo->processCollision(&compoundWrap, m_otherObjWrap, m_dispatchInfo, m_resultOut);
 
 #if 0
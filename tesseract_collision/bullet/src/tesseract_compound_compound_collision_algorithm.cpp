@@ -36,6 +36,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #define USE_LOCAL_STACK 1
 
 #include <tesseract_collision/bullet/tesseract_compound_compound_collision_algorithm.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
 #include <tesseract_collision/core/types.h>
 
 // LCOV_EXCL_START
@@ -231,6 +232,11 @@ struct TesseractCompoundCompoundLeafCallback : btDbvt::ICollide
       m_resultOut->setShapeIdentifiersA(-1, childIndex0);
       m_resultOut->setShapeIdentifiersB(-1, childIndex1);
 
+      if (m_contact_test_data->statistics != nullptr)
+        recordNarrowphaseCall(*m_contact_test_data->statistics,
+                              compoundWrap0.getCollisionShape(),
+                              compoundWrap1.getCollisionShape());
+
       colAlgo->processCollision(&compoundWrap0, &compoundWrap1, m_dispatchInfo, m_resultOut);
 
       m_resultOut->setBody0Wrap(tmpWrap0);
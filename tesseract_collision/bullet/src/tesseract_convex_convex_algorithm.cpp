@@ -24,6 +24,7 @@ software.
 
 #include <tesseract_collision/bullet/tesseract_convex_convex_algorithm.h>
 #include <tesseract_collision/bullet/tesseract_gjk_pair_detector.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
 
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <BulletCollision/NarrowPhaseCollision/btDiscreteCollisionDetectorInterface.h>
@@ -413,6 +414,14 @@ void TesseractConvexConvexAlgorithm::processCollision(const btCollisionObjectWra
     gjkPairDetector.setMinkowskiA(min0);
     gjkPairDetector.setMinkowskiB(min1);
 
+    // Start GJK from the separating axis found for this pair in the previous contact test
+    if (m_cdata->req.warm_start)
+    {
+      bool negate{ false };
+      btVector3* warm_start_axis = getGjkWarmStartAxis(body0Wrap, body1Wrap, negate);
+      gjkPairDetector.setWarmStartAxis(warm_start_axis, negate);
+    }
+
 #ifdef USE_SEPDISTANCE_UTIL2
     if (dispatchInfo.m_useConvexConservativeDistanceUtil)
     {
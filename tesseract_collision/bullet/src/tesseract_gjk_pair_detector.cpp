@@ -697,7 +697,17 @@ void TesseractGjkPairDetector::getClosestPointsNonVirtual(const ClosestPointInpu
 
   m_curIter = 0;
   int gGjkMaxIter = 1000;  // this is to catch invalid input, perhaps check for #NaN?
-  m_cachedSeparatingAxis.setValue(0, 1, 0);
+
+  // Start from the separating axis of the previous query for this pair if available
+  bool warmStart = (m_warmStartAxis != nullptr && !m_warmStartAxis->fuzzyZero());
+  if (warmStart)
+  {
+    m_cachedSeparatingAxis = m_warmStartNegate ? -(*m_warmStartAxis) : *m_warmStartAxis;
+    if (m_cdata->statistics != nullptr)
+      ++m_cdata->statistics->gjk_warm_starts;
+  }
+  else
+    m_cachedSeparatingAxis.setValue(0, 1, 0);
 
   bool isValid = false;
   bool checkSimplex = false;
@@ -723,7 +733,8 @@ void TesseractGjkPairDetector::getClosestPointsNonVirtual(const ClosestPointInpu
     btSimplex* simplex = &simplex1;
     btSimplexInit(simplex);
 
-    btVector3 dir(1, 0, 0);
+    // The support of the Minkowski difference opposite to the previous separating axis quickly proves separation
+    btVector3 dir = warmStart ? -m_cachedSeparatingAxis : btVector3(1, 0, 0);
 
     {
       btVector3 lastSupV;
@@ -816,6 +827,7 @@ void TesseractGjkPairDetector::getClosestPointsNonVirtual(const ClosestPointInpu
     if (status == -1 && !m_cdata->req.calculate_distance)
     {
       // The shapes do not intersect and we did not request distance data so return.
+      updateWarmStartAxis(-dir);
       return;
     }
 
@@ -991,6 +1003,9 @@ void TesseractGjkPairDetector::getClosestPointsNonVirtual(const ClosestPointInpu
       }
     }
 
+    if (m_cdata->statistics != nullptr)
+      m_cdata->statistics->gjk_iterations += static_cast<std::size_t>(m_curIter);
+
     bool catchDegeneratePenetrationCase =
         (m_catchDegeneracies && m_penetrationDepthSolver && m_degenerateSimplex &&  // NOLINT
          ((distance + margin) < gGjkEpaPenetrationTolerance));
@@ -1008,6 +1023,9 @@ void TesseractGjkPairDetector::getClosestPointsNonVirtual(const ClosestPointInpu
 
         m_cachedSeparatingAxis.setZero();
 
+        if (m_cdata->statistics != nullptr)
+          ++m_cdata->statistics->penetration_depth_calls;
+
         bool isValid2 = m_penetrationDepthSolver->calcPenDepth(*m_simplexSolver,
                                                                m_minkowskiA,
                                                                m_minkowskiB,
@@ -1169,5 +1187,15 @@ void TesseractGjkPairDetector::getClosestPointsNonVirtual(const ClosestPointInpu
   {
     // printf("invalid gjk query\n");
   }
+
+  updateWarmStartAxis(m_cachedSeparatingAxis);
+}
+
+void TesseractGjkPairDetector::updateWarmStartAxis(const btVector3& separatingAxis)
+{
+  if (m_warmStartAxis == nullptr || separatingAxis.fuzzyZero())
+    return;
+
+  *m_warmStartAxis = m_warmStartNegate ? -separatingAxis : separatingAxis;
 }
 }  // namespace tesseract_collision::tesseract_collision_bullet
@@ -0,0 +1,343 @@
+/**
+ * @file tesseract_hash_grid_broadphase.cpp
+ * @brief A uniform spatial hash grid broadphase
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, agent
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <LinearMath/btAabbUtil2.h>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/bullet/tesseract_hash_grid_broadphase.h>
+
+namespace tesseract_collision::tesseract_collision_bullet
+{
+namespace
+{
+/** @brief The cell coordinates are limited so they fit an int and the AABBs of unbounded shapes can be handled */
+const double MAX_CELL_COORD = 1 << 30;
+
+int getCellCoord(btScalar value, btScalar inv_cell_size)
+{
+  double coord = std::floor(static_cast<double>(value * inv_cell_size));
+  return static_cast<int>(std::max(-MAX_CELL_COORD, std::min(MAX_CELL_COORD, coord)));
+}
+
+/** @brief Hash the cell coordinates, cells which wrap around to the same key only add candidates */
+std::uint64_t getCellKey(int x, int y, int z)
+{
+  const std::uint64_t mask = (1ULL << 21U) - 1;
+  return ((static_cast<std::uint64_t>(x) & mask) << 42U) | ((static_cast<std::uint64_t>(y) & mask) << 21U) |
+         (static_cast<std::uint64_t>(z) & mask);
+}
+
+bool testAabbOverlap(const btBroadphaseProxy* proxy0, const btBroadphaseProxy* proxy1)
+{
+  return TestAabbAgainstAabb2(proxy0->m_aabbMin, proxy0->m_aabbMax, proxy1->m_aabbMin, proxy1->m_aabbMax);
+}
+}  // namespace
+
+HashGridProxy::HashGridProxy(const btVector3& aabb_min,
+                             const btVector3& aabb_max,
+                             void* user_ptr,
+                             int collision_filter_group,
+                             int collision_filter_mask)
+  : btBroadphaseProxy(aabb_min, aabb_max, user_ptr, collision_filter_group, collision_filter_mask)
+{
+}
+
+TesseractHashGridBroadphase::TesseractHashGridBroadphase(double cell_size, std::size_t max_cells_per_proxy)
+  : cell_size_(static_cast<btScalar>(cell_size))
+  , inv_cell_size_(static_cast<btScalar>(1.0 / cell_size))
+  , max_cells_per_proxy_(max_cells_per_proxy)
+  , pair_cache_(std::make_unique<btHashedOverlappingPairCache>())
+{
+  assert(cell_size > 0);
+}
+
+TesseractHashGridBroadphase::~TesseractHashGridBroadphase() = default;
+
+btBroadphaseProxy* TesseractHashGridBroadphase::createProxy(const btVector3& aabbMin,
+                                                            const btVector3& aabbMax,
+                                                            int /*shapeType*/,
+                                                            void* userPtr,
+                                                            int collisionFilterGroup,
+                                                            int collisionFilterMask,
+                                                            btDispatcher* /*dispatcher*/)
+{
+  auto proxy = std::make_unique<HashGridProxy>(aabbMin, aabbMax, userPtr, collisionFilterGroup, collisionFilterMask);
+  proxy->m_uniqueId = ++next_unique_id_;
+  proxy->index = proxies_.size();
+  proxy->moved = true;
+  addToGrid(proxy.get());
+  moved_proxies_.push_back(proxy.get());
+  proxies_.push_back(std::move(proxy));
+  return proxies_.back().get();
+}
+
+void TesseractHashGridBroadphase::destroyProxy(btBroadphaseProxy* proxy, btDispatcher* dispatcher)
+{
+  auto* grid_proxy = static_cast<HashGridProxy*>(proxy);
+  pair_cache_->removeOverlappingPairsContainingProxy(grid_proxy, dispatcher);
+  removeFromGrid(grid_proxy);
+
+  if (grid_proxy->moved)
+    moved_proxies_.erase(std::find(moved_proxies_.begin(), moved_proxies_.end(), grid_proxy));
+
+  std::size_t index = grid_proxy->index;
+  std::swap(proxies_[index], proxies_.back());
+  proxies_[index]->index = index;
+  proxies_.pop_back();
+}
+
+void TesseractHashGridBroadphase::setAabb(btBroadphaseProxy* proxy,
+                                          const btVector3& aabbMin,
+                                          const btVector3& aabbMax,
+                                          btDispatcher* /*dispatcher*/)
+{
+  auto* grid_proxy = static_cast<HashGridProxy*>(proxy);
+  grid_proxy->m_aabbMin = aabbMin;
+  grid_proxy->m_aabbMax = aabbMax;
+
+  std::array<int, 3> cell_min{};
+  std::array<int, 3> cell_max{};
+  std::size_t num_cells = getCellRange(aabbMin, aabbMax, cell_min, cell_max);
+  bool large = (num_cells > max_cells_per_proxy_);
+  if (large != grid_proxy->large || (!large && (cell_min != grid_proxy->cell_min || cell_max != grid_proxy->cell_max)))
+  {
+    removeFromGrid(grid_proxy);
+    addToGrid(grid_proxy);
+  }
+
+  if (!grid_proxy->moved)
+  {
+    grid_proxy->moved = true;
+    moved_proxies_.push_back(grid_proxy);
+  }
+}
+
+void TesseractHashGridBroadphase::getAabb(btBroadphaseProxy* proxy, btVector3& aabbMin, btVector3& aabbMax) const
+{
+  aabbMin = proxy->m_aabbMin;
+  aabbMax = proxy->m_aabbMax;
+}
+
+void TesseractHashGridBroadphase::rayTest(const btVector3& /*rayFrom*/,
+                                          const btVector3& /*rayTo*/,
+                                          btBroadphaseRayCallback& rayCallback,
+                                          const btVector3& /*aabbMin*/,
+                                          const btVector3& /*aabbMax*/)
+{
+  // Same as btSimpleBroadphase, the ray callback performs the ray AABB test
+  for (const auto& proxy : proxies_)
+    rayCallback.process(proxy.get());
+}
+
+void TesseractHashGridBroadphase::aabbTest(const btVector3& aabbMin,
+                                           const btVector3& aabbMax,
+                                           btBroadphaseAabbCallback& callback)
+{
+  forEachCandidate(aabbMin, aabbMax, [&aabbMin, &aabbMax, &callback](HashGridProxy* proxy) {
+    if (TestAabbAgainstAabb2(aabbMin, aabbMax, proxy->m_aabbMin, proxy->m_aabbMax))
+      callback.process(proxy);
+  });
+}
+
+void TesseractHashGridBroadphase::calculateOverlappingPairs(btDispatcher* dispatcher)
+{
+  if (moved_proxies_.empty())
+    return;
+
+  // Remove the pairs of the moved proxies which no longer overlap. The array is iterated backwards because a removed
+  // pair is replaced by the last pair.
+  btBroadphasePairArray& pairs = pair_cache_->getOverlappingPairArray();
+  for (int i = pairs.size() - 1; i >= 0; --i)
+  {
+    auto* proxy0 = static_cast<HashGridProxy*>(pairs[i].m_pProxy0);
+    auto* proxy1 = static_cast<HashGridProxy*>(pairs[i].m_pProxy1);
+    if ((proxy0->moved || proxy1->moved) && !testAabbOverlap(proxy0, proxy1))
+      pair_cache_->removeOverlappingPair(proxy0, proxy1, dispatcher);
+  }
+
+  // Add the new pairs of the moved proxies, the pair cache ignores pairs which already exist or are filtered out
+  for (HashGridProxy* proxy : moved_proxies_)
+  {
+    forEachCandidate(proxy->m_aabbMin, proxy->m_aabbMax, [this, proxy](HashGridProxy* other) {
+      if (other != proxy && testAabbOverlap(proxy, other))
+        pair_cache_->addOverlappingPair(proxy, other);
+    });
+  }
+
+  for (HashGridProxy* proxy : moved_proxies_)
+    proxy->moved = false;
+
+  moved_proxies_.clear();
+}
+
+btOverlappingPairCache* TesseractHashGridBroadphase::getOverlappingPairCache() { return pair_cache_.get(); }
+
+const btOverlappingPairCache* TesseractHashGridBroadphase::getOverlappingPairCache() const
+{
+  return pair_cache_.get();
+}
+
+void TesseractHashGridBroadphase::getBroadphaseAabb(btVector3& aabbMin, btVector3& aabbMax) const
+{
+  aabbMin.setValue(-BT_LARGE_FLOAT, -BT_LARGE_FLOAT, -BT_LARGE_FLOAT);
+  aabbMax.setValue(BT_LARGE_FLOAT, BT_LARGE_FLOAT, BT_LARGE_FLOAT);
+}
+
+void TesseractHashGridBroadphase::printStats() {}
+
+double TesseractHashGridBroadphase::getCellSize() const { return static_cast<double>(cell_size_); }
+
+std::size_t TesseractHashGridBroadphase::getMaxCellsPerProxy() const { return max_cells_per_proxy_; }
+
+std::size_t TesseractHashGridBroadphase::getCellRange(const btVector3& aabb_min,
+                                                      const btVector3& aabb_max,
+                                                      std::array<int, 3>& cell_min,
+                                                      std::array<int, 3>& cell_max) const
+{
+  std::size_t num_cells{ 1 };
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    cell_min[i] = getCellCoord(aabb_min[static_cast<int>(i)], inv_cell_size_);
+    cell_max[i] = getCellCoord(aabb_max[static_cast<int>(i)], inv_cell_size_);
+
+    // Stop counting once the limit is exceeded so large AABBs do not overflow the count
+    auto num_axis_cells = static_cast<std::size_t>(static_cast<std::int64_t>(cell_max[i]) - cell_min[i] + 1);
+    if (num_axis_cells > max_cells_per_proxy_ || num_cells * num_axis_cells > max_cells_per_proxy_)
+      num_cells = max_cells_per_proxy_ + 1;
+    else
+      num_cells *= num_axis_cells;
+  }
+  return num_cells;
+}
+
+void TesseractHashGridBroadphase::addToGrid(HashGridProxy* proxy)
+{
+  std::size_t num_cells = getCellRange(proxy->m_aabbMin, proxy->m_aabbMax, proxy->cell_min, proxy->cell_max);
+  proxy->large = (num_cells > max_cells_per_proxy_);
+  if (proxy->large)
+  {
+    large_proxies_.push_back(proxy);
+    return;
+  }
+
+  for (int x = proxy->cell_min[0]; x <= proxy->cell_max[0]; ++x)
+    for (int y = proxy->cell_min[1]; y <= proxy->cell_max[1]; ++y)
+      for (int z = proxy->cell_min[2]; z <= proxy->cell_max[2]; ++z)
+        cells_[getCellKey(x, y, z)].push_back(proxy);
+}
+
+void TesseractHashGridBroadphase::removeFromGrid(HashGridProxy* proxy)
+{
+  if (proxy->large)
+  {
+    large_proxies_.erase(std::find(large_proxies_.begin(), large_proxies_.end(), proxy));
+    return;
+  }
+
+  for (int x = proxy->cell_min[0]; x <= proxy->cell_max[0]; ++x)
+  {
+    for (int y = proxy->cell_min[1]; y <= proxy->cell_max[1]; ++y)
+    {
+      for (int z = proxy->cell_min[2]; z <= proxy->cell_max[2]; ++z)
+      {
+        auto it = cells_.find(getCellKey(x, y, z));
+        assert(it != cells_.end());
+        std::vector<HashGridProxy*>& cell = it->second;
+        auto proxy_it = std::find(cell.begin(), cell.end(), proxy);
+        assert(proxy_it != cell.end());
+        *proxy_it = cell.back();
+        cell.pop_back();
+        if (cell.empty())
+          cells_.erase(it);
+      }
+    }
+  }
+}
+
+template <typename Fn>
+void TesseractHashGridBroadphase::forEachCandidate(const btVector3& aabb_min, const btVector3& aabb_max, Fn&& fn)
+{
+  ++query_stamp_;
+  auto visit = [this, &fn](HashGridProxy* proxy) {
+    if (proxy->query_stamp == query_stamp_)
+      return;
+
+    proxy->query_stamp = query_stamp_;
+    fn(proxy);
+  };
+
+  std::array<int, 3> cell_min{};
+  std::array<int, 3> cell_max{};
+  if (getCellRange(aabb_min, aabb_max, cell_min, cell_max) > max_cells_per_proxy_)
+  {
+    // Visiting the cells would cost more than visiting every proxy
+    for (const auto& proxy : proxies_)
+      visit(proxy.get());
+
+    return;
+  }
+
+  for (int x = cell_min[0]; x <= cell_max[0]; ++x)
+  {
+    for (int y = cell_min[1]; y <= cell_max[1]; ++y)
+    {
+      for (int z = cell_min[2]; z <= cell_max[2]; ++z)
+      {
+        auto it = cells_.find(getCellKey(x, y, z));
+        if (it == cells_.end())
+          continue;
+
+        for (HashGridProxy* proxy : it->second)
+          visit(proxy);
+      }
+    }
+  }
+
+  for (HashGridProxy* proxy : large_proxies_)
+    visit(proxy);
+}
+
+}  // namespace tesseract_collision::tesseract_collision_bullet
@@ -79,6 +79,31 @@ bool isContactAllowed(const std::string& name1,
                       const IsContactAllowedFn& acm,
                       bool verbose = false);
 
+/**
+ * @brief Determine if contact is allowed between two objects using the link ids cached by the contact manager
+ * @details If cdata.compiled_acm is nullptr this falls back to the contact allowed function cdata.fn
+ * @param name1 The name of the first object
+ * @param link_id1 The allowed collision matrix link id of the first object
+ * @param name2 The name of the second object
+ * @param link_id2 The allowed collision matrix link id of the second object
+ * @param cdata The contact test data
+ * @param verbose If true print debug information
+ * @return True if contact is allowed between the two object, otherwise false.
+ */
+bool isContactAllowed(const std::string& name1,
+                      long link_id1,
+                      const std::string& name2,
+                      long link_id2,
+                      const ContactTestData& cdata,
+                      bool verbose = false);
+
+/**
+ * @brief Get the compiled allowed collision matrix queried by a contact allowed function
+ * @param fn The contact allowed function
+ * @return The compiled allowed collision matrix if fn is an AllowedCollisionMatrixFn, otherwise nullptr
+ */
+const tesseract_common::CompiledAllowedCollisionMatrix* getCompiledAllowedCollisionMatrix(const IsContactAllowedFn& fn);
+
 /**
  * @brief processResult Processes the ContactResult based on the information in the ContactTestData
  * @param cdata Information used to process the results
@@ -92,6 +117,83 @@ ContactResult* processResult(ContactTestData& cdata,
                              const std::pair<std::string, std::string>& key,
                              bool found);
 
+/**
+ * @brief processResult Processes the ContactResult based on the information in the ContactTestData
+ * @details If the contact test data provides a collision margin table and both collision object ids are valid the pair
+ * collision margin is looked up by id, otherwise it is looked up by name.
+ * @param cdata Information used to process the results
+ * @param contact Contacts from the collision checkers that will be processed
+ * @param key Link pair used as a key to look up pair specific settings
+ * @param found Specifies whether or not a collision has already been found
+ * @param object_id1 The collision margin table id of the first collision object, -1 if unknown
+ * @param object_id2 The collision margin table id of the second collision object, -1 if unknown
+ * @return Pointer to the ContactResult.
+ */
+ContactResult* processResult(ContactTestData& cdata,
+                             ContactResult& contact,
+                             const std::pair<std::string, std::string>& key,
+                             bool found,
+                             int object_id1,
+                             int object_id2);
+
+/**
+ * @brief Process a contact for a contact test storing compact contact results (ContactTestData::compact_res)
+ * @details The contact is stored if it is within the pair collision margin and allowed by the contact test type. This
+ * must not be used if the contact request provides an is_valid function, use processResult instead.
+ * @param cdata Information used to process the results
+ * @param contact The contact, with valid collision object ids
+ * @param name1 The name of the first collision object
+ * @param name2 The name of the second collision object
+ * @return True if the contact was stored, otherwise false
+ */
+bool processCompactResult(ContactTestData& cdata,
+                          const CompactContactResult& contact,
+                          const std::string& name1,
+                          const std::string& name2);
+
+/**
+ * @brief Process a contact for a contact test that only checks if any contact exists (ContactTestData::res and
+ * ContactTestData::compact_res are nullptr)
+ * @details No ContactResult is required. If the distance is within the pair collision margin the search is marked as
+ * done. This must not be used if the contact request provides an is_valid function, use processResult instead.
+ * @param cdata Information used to process the results
+ * @param distance The distance between the two collision objects
+ * @param name1 The name of the first collision object
+ * @param name2 The name of the second collision object
+ * @param object_id1 The collision margin table id of the first collision object, -1 if unknown
+ * @param object_id2 The collision margin table id of the second collision object, -1 if unknown
+ * @return True if the collision objects are in contact, otherwise false
+ */
+bool processAnyContact(ContactTestData& cdata,
+                       double distance,
+                       const std::string& name1,
+                       const std::string& name2,
+                       int object_id1,
+                       int object_id2);
+
+/**
+ * @brief Get the collision margin between two collision objects
+ * @details If the contact test data provides a collision margin table and both collision object ids are valid the pair
+ * collision margin is looked up by id, otherwise it is looked up by name.
+ * @param cdata Information used to process the results
+ * @param key Link pair used to look up the collision margin by name
+ * @param object_id1 The collision margin table id of the first collision object, -1 if unknown
+ * @param object_id2 The collision margin table id of the second collision object, -1 if unknown
+ * @return The pair collision margin
+ */
+double getPairCollisionMargin(const ContactTestData& cdata,
+                              const std::pair<std::string, std::string>& key,
+                              int object_id1,
+                              int object_id2);
+
+/**
+ * @brief Check if a LIMITED contact test has stored the number of contacts given by the contact limit
+ * @param cdata Information used to process the results
+ * @param num_contacts The number of stored contacts
+ * @return True if the contact test type is LIMITED with a positive contact limit that has been reached, otherwise false
+ */
+bool isContactLimitReached(const ContactTestData& cdata, std::size_t num_contacts);
+
 /**
  * @brief Apply scaling to the geometry coordinates.
  * @details Given a scaling factor s, and center c, a given vertice v is transformed according to s (v - c) + c.
@@ -111,6 +213,25 @@ void scaleVertices(tesseract_common::VectorVector3d& vertices,
  */
 void scaleVertices(tesseract_common::VectorVector3d& vertices, const Eigen::Vector3d& scale);
 
+/**
+ * @brief Apply the changed voxels to an octomap in place
+ * @details Only use this if the octomap is not shared with anything that may read it concurrently, like clones of a
+ * contact manager. Voxels outside of the octomap are ignored.
+ * @param octree The octomap to update
+ * @param delta The voxels that became occupied or free
+ */
+void applyOctreeDelta(octomap::OcTree& octree, const OctreeDelta& delta);
+
+/**
+ * @brief Apply the changed voxels to a copy of an octree
+ * @details The octree is not modified because it may be shared with the scene graph, the contact managers and their
+ * clones. The copy keeps the sub type and collision options of the octree. Voxels outside of the octree are ignored.
+ * @param octree The octree to copy
+ * @param delta The voxels that became occupied or free
+ * @return The octree with the changed voxels applied
+ */
+tesseract_geometry::Octree::Ptr applyOctreeDelta(const tesseract_geometry::Octree& octree, const OctreeDelta& delta);
+
 /**
  * @brief Write a simple ply file given vertices and faces
  * @param path The file path
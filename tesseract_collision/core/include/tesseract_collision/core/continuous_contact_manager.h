@@ -200,6 +200,53 @@ public:
   virtual void setCollisionObjectsTransform(const tesseract_common::TransformMap& pose1,
                                             const tesseract_common::TransformMap& pose2) = 0;
 
+  /**
+   * @brief Replace an octree shape of a collision object with an updated octree
+   * @details See DiscreteContactManager::updateCollisionObjectOctree
+   * @note The default implementation does nothing and returns false, so the collision object must be replaced.
+   * @param name The name of the object
+   * @param shape_index The index of the octree shape in the collision object
+   * @param octree The updated octree, which must have the same resolution and options as the current octree
+   * @param delta The voxels that changed between the current and the updated octree
+   * @return True if the collision object was updated, otherwise false
+   */
+  virtual bool updateCollisionObjectOctree(const std::string& name,
+                                           std::size_t shape_index,
+                                           const tesseract_geometry::Octree::ConstPtr& octree,
+                                           const OctreeDelta& delta);
+
+  /**
+   * @brief Set the link names which define the order of dense link transforms
+   *
+   * This is typically the link names of the state solver, so the link transforms of a dense scene state can be passed
+   * directly to setDenseCollisionObjectsTransform. Link names without a collision object are ignored.
+   *
+   * @note Managers should override this to resolve the collision objects once, so no name lookup is required when
+   * setting dense transforms. The overrides must call this base implementation.
+   *
+   * @param link_names The link names, the index of each name is the index of its transform
+   */
+  virtual void setDenseLinkNames(const std::vector<std::string>& link_names);
+
+  /**
+   * @brief Get the link names which define the order of dense link transforms
+   * @return A list of link names
+   */
+  virtual const std::vector<std::string>& getDenseLinkNames() const;
+
+  /**
+   * @brief Set the cast(moving) collision object's transforms from dense link transforms
+   *
+   * Only the active collision objects are updated, static collision objects are left unchanged.
+   *
+   * @note The default implementation looks up each active collision object by name, managers should override this.
+   *
+   * @param pose1 The link transforms at the start, must be the same size and order as the dense link names
+   * @param pose2 The link transforms at the end, must be the same size and order as the dense link names
+   */
+  virtual void setDenseCollisionObjectsTransform(const tesseract_common::VectorIsometry3d& pose1,
+                                                 const tesseract_common::VectorIsometry3d& pose2);
+
   /**
    * @brief Get all collision objects
    * @return A list of collision object names
@@ -266,11 +313,79 @@ public:
    */
   virtual void contactTest(ContactResultMap& collisions, const ContactRequest& request) = 0;
 
+  /**
+   * @brief Perform a contact test for all objects, storing compact contact results
+   *
+   * The compact contact results hold fewer fields per contact and keep their storage between contact tests, which
+   * reduces the cost of contact tests producing many contacts.
+   *
+   * @note The default implementation performs a contactTest and converts the results, but managers should override this
+   * to store the compact contact results directly.
+   *
+   * @param collisions The compact contact results, which are cleared first
+   * @param request The contact request data. The is_valid function is called with the full contact result.
+   */
+  virtual void contactTest(CompactContactResults& collisions, const ContactRequest& request);
+
+  /**
+   * @brief Clear contact results, keeping their storage for the following contact tests of this manager
+   *
+   * The entries of the contact results are moved into a pool owned by this manager and reused by the following
+   * contactTest calls instead of allocating new entries. Use this in place of ContactResultMap::clear when contact
+   * results are refilled in a loop.
+   *
+   * @param collisions The contact results data
+   */
+  virtual void clearContactResults(ContactResultMap& collisions);
+
+  /**
+   * @brief Check if any pair of objects is in contact
+   *
+   * This returns at the first contact found within the pair collision margin. No contact results are built or stored,
+   * so it is cheaper than contactTest when only a yes or no answer is needed, for example in feasibility checks.
+   *
+   * @note The default implementation performs a contactTest with ContactTestType::FIRST, but managers should override
+   * this to skip computing the contact results.
+   *
+   * @param request The contact request data. The contact test type and contact limit are ignored.
+   * @return True if any pair of objects is in contact, otherwise false
+   */
+  virtual bool anyContactTest(const ContactRequest& request);
+
   /**
    * @brief Applies settings in the config
    * @param config Settings to be applies
    */
   virtual void applyContactManagerConfig(const ContactManagerConfig& config);
+
+  /**
+   * @brief Enable or disable collecting statistics during contact tests
+   * @note Collection is disabled by default because the timing adds overhead to each contact test. The default
+   * implementation does nothing, contact managers which do not support statistics keep them disabled and empty.
+   * @param enabled True to collect statistics, otherwise false
+   */
+  virtual void setStatisticsEnabled(bool enabled);
+
+  /**
+   * @brief Check if statistics are collected during contact tests
+   * @return True if statistics are collected, false if disabled or not supported by the contact manager
+   */
+  virtual bool getStatisticsEnabled() const;
+
+  /**
+   * @brief Get the statistics accumulated since the last reset
+   * @return The contact test statistics
+   */
+  virtual const ContactTestStatistics& getStatistics() const;
+
+  /** @brief Reset the accumulated statistics */
+  virtual void resetStatistics();
+
+protected:
+  std::vector<std::string> dense_link_names_;    /**< @brief The link names defining the order of dense transforms */
+  bool statistics_enabled_{ false };             /**< @brief Indicate if statistics are collected */
+  ContactTestStatistics statistics_;             /**< @brief The statistics accumulated since the last reset */
+  ContactResultMapPool contact_result_map_pool_; /**< @brief The entries of cleared contact results */
 };
 
 }  // namespace tesseract_collision
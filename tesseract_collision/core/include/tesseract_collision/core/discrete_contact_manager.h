@@ -151,6 +151,58 @@ public:
    */
   virtual void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) = 0;
 
+  /**
+   * @brief Replace an octree shape of a collision object with an updated octree
+   *
+   * The caller applies the sensor update with applyOctreeDelta and passes the result along with the delta. The octree
+   * may be the current octree updated in place if the caller knows it is not shared with clones of the contact manager,
+   * otherwise it must be a copy. Only the parts of the collision shape that contain the changed voxels are rebuilt,
+   * which is much cheaper than removing and adding the collision object again. Clones of the contact manager are not
+   * affected.
+   *
+   * @note The default implementation does nothing and returns false, so the collision object must be replaced.
+   *
+   * @param name The name of the object
+   * @param shape_index The index of the octree shape in the collision object
+   * @param octree The updated octree, which must have the same resolution and options as the current octree
+   * @param delta The voxels that changed between the current and the updated octree
+   * @return True if the collision object was updated, otherwise false
+   */
+  virtual bool updateCollisionObjectOctree(const std::string& name,
+                                           std::size_t shape_index,
+                                           const tesseract_geometry::Octree::ConstPtr& octree,
+                                           const OctreeDelta& delta);
+
+  /**
+   * @brief Set the link names which define the order of dense link transforms
+   *
+   * This is typically the link names of the state solver, so the link transforms of a dense scene state can be passed
+   * directly to setDenseCollisionObjectsTransform. Link names without a collision object are ignored.
+   *
+   * @note Managers should override this to resolve the collision objects once, so no name lookup is required when
+   * setting dense transforms. The overrides must call this base implementation.
+   *
+   * @param link_names The link names, the index of each name is the index of its transform
+   */
+  virtual void setDenseLinkNames(const std::vector<std::string>& link_names);
+
+  /**
+   * @brief Get the link names which define the order of dense link transforms
+   * @return A list of link names
+   */
+  virtual const std::vector<std::string>& getDenseLinkNames() const;
+
+  /**
+   * @brief Set the active collision object's transforms from dense link transforms
+   *
+   * Only the active collision objects are updated, static collision objects are left unchanged.
+   *
+   * @note The default implementation looks up each active collision object by name, managers should override this.
+   *
+   * @param link_transforms The link transforms in world, must be the same size and order as the dense link names
+   */
+  virtual void setDenseCollisionObjectsTransform(const tesseract_common::VectorIsometry3d& link_transforms);
+
   /**
    * @brief Get all collision objects
    * @return A list of collision object names
@@ -217,11 +269,149 @@ public:
    */
   virtual void contactTest(ContactResultMap& collisions, const ContactRequest& request) = 0;
 
+  /**
+   * @brief Perform a contact test for all objects, storing compact contact results
+   *
+   * The compact contact results hold fewer fields per contact and keep their storage between contact tests, which
+   * reduces the cost of contact tests producing many contacts.
+   *
+   * @note The default implementation performs a contactTest and converts the results, but managers should override this
+   * to store the compact contact results directly.
+   *
+   * @param collisions The compact contact results, which are cleared first
+   * @param request The contact request data. The is_valid function is called with the full contact result.
+   */
+  virtual void contactTest(CompactContactResults& collisions, const ContactRequest& request);
+
+  /**
+   * @brief Clear contact results, keeping their storage for the following contact tests of this manager
+   *
+   * The entries of the contact results are moved into a pool owned by this manager and reused by the following
+   * contactTest calls instead of allocating new entries. Use this in place of ContactResultMap::clear when contact
+   * results are refilled in a loop.
+   *
+   * @param collisions The contact results data
+   */
+  virtual void clearContactResults(ContactResultMap& collisions);
+
+  /**
+   * @brief Check if any pair of objects is in contact
+   *
+   * This returns at the first contact found within the pair collision margin. No contact results are built or stored,
+   * so it is cheaper than contactTest when only a yes or no answer is needed, for example in feasibility checks.
+   *
+   * @note The default implementation performs a contactTest with ContactTestType::FIRST, but managers should override
+   * this to skip computing the contact results.
+   *
+   * @param request The contact request data. The contact test type and contact limit are ignored.
+   * @return True if any pair of objects is in contact, otherwise false
+   */
+  virtual bool anyContactTest(const ContactRequest& request);
+
+  /**
+   * @brief Perform a contact test for a batch of states
+   *
+   * For each state the named collision objects are moved to the provided poses and a contact test is performed. When
+   * finished the collision objects are left at the poses of the last state.
+   *
+   * @note The default implementation sets the transforms and calls contactTest for each state, but managers should
+   * override this to avoid the per state name lookup and virtual call overhead.
+   *
+   * @param collisions The contact results data for each state. It is resized to the number of states and cleared.
+   * @param names The names of the collision objects whose poses are provided in each state
+   * @param states The poses of the collision objects for each state, each must be the same length as names
+   * @param request The contact request data
+   */
+  virtual void contactTest(std::vector<ContactResultMap>& collisions,
+                           const std::vector<std::string>& names,
+                           const std::vector<tesseract_common::VectorIsometry3d>& states,
+                           const ContactRequest& request);
+
+  /**
+   * @brief Perform a contact test for a set of query objects
+   *
+   * For this call only the query objects take the place of the active collision objects, so every pair including at
+   * least one query object is checked. The active collision objects are left unchanged, which allows checking different
+   * groups of links against the same scene without switching the active collision objects between contact tests.
+   *
+   * @note The default implementation temporarily sets the active collision objects to the query objects, but managers
+   * should override this to avoid updating the collision object filters.
+   *
+   * @param collisions The contact results data
+   * @param query_objects The names of the query objects, names of unknown collision objects are ignored
+   * @param request The contact request data
+   */
+  virtual void contactTest(ContactResultMap& collisions,
+                           const std::vector<std::string>& query_objects,
+                           const ContactRequest& request);
+
+  /**
+   * @brief Perform a contact test between a set of points and the active collision objects
+   *
+   * The points are checked directly against the link geometry, so a raw point cloud from a sensor can be checked
+   * against the robot without first building an octree collision object. For each point within the contact distance of
+   * an enabled active collision object, the contact with the closest active collision object is reported.
+   *
+   * @note The default implementation adds the points as a collision object made of spheres with zero radius to a clone
+   * of the manager and performs a query contact test on the clone, so this manager is not modified and its statistics
+   * are not updated. Cloning copies every collision object, so managers should override this to check the points
+   * directly.
+   *
+   * @param results The closest contact of each point within the contact distance ordered by point index. It is cleared
+   * first.
+   * @param points The points in world coordinates
+   * @param contact_distance Points further than this distance from the active collision objects are ignored
+   */
+  virtual void pointContactTest(PointContactResultVector& results,
+                                const Eigen::Ref<const Eigen::Matrix3Xd>& points,
+                                double contact_distance);
+
+  /**
+   * @brief Perform a contact test between a set of points and the active collision objects
+   * @details See the pointContactTest overload taking a matrix of points.
+   * @param results The closest contact of each point within the contact distance ordered by point index. It is cleared
+   * first.
+   * @param points The points in world coordinates
+   * @param contact_distance Points further than this distance from the active collision objects are ignored
+   */
+  virtual void pointContactTest(PointContactResultVector& results,
+                                const tesseract_common::VectorVector3d& points,
+                                double contact_distance);
+
   /**
    * @brief Applies settings in the config
    * @param config Settings to be applies
    */
   virtual void applyContactManagerConfig(const ContactManagerConfig& config);
+
+  /**
+   * @brief Enable or disable collecting statistics during contact tests
+   * @note Collection is disabled by default because the timing adds overhead to each contact test. The default
+   * implementation does nothing, contact managers which do not support statistics keep them disabled and empty.
+   * @param enabled True to collect statistics, otherwise false
+   */
+  virtual void setStatisticsEnabled(bool enabled);
+
+  /**
+   * @brief Check if statistics are collected during contact tests
+   * @return True if statistics are collected, false if disabled or not supported by the contact manager
+   */
+  virtual bool getStatisticsEnabled() const;
+
+  /**
+   * @brief Get the statistics accumulated since the last reset
+   * @return The contact test statistics
+   */
+  virtual const ContactTestStatistics& getStatistics() const;
+
+  /** @brief Reset the accumulated statistics */
+  virtual void resetStatistics();
+
+protected:
+  std::vector<std::string> dense_link_names_;    /**< @brief The link names defining the order of dense transforms */
+  bool statistics_enabled_{ false };             /**< @brief Indicate if statistics are collected */
+  ContactTestStatistics statistics_;             /**< @brief The statistics accumulated since the last reset */
+  ContactResultMapPool contact_result_map_pool_; /**< @brief The entries of cleared contact results */
 };
 
 }  // namespace tesseract_collision
@@ -34,8 +34,12 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <memory>
 #include <map>
 #include <array>
+#include <chrono>
 #include <unordered_map>
 #include <functional>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
 #include <tesseract_geometry/geometries.h>
 #include <tesseract_common/types.h>
 #include <tesseract_common/collision_margin_data.h>
@@ -58,6 +62,22 @@ using PairsCollisionMarginData = tesseract_common::PairsCollisionMarginData;
  */
 using IsContactAllowedFn = std::function<bool(const std::string&, const std::string&)>;
 
+/**
+ * @brief An IsContactAllowedFn which queries an allowed collision matrix
+ * @details Contact managers recognize this function object, see getCompiledAllowedCollisionMatrix, and query the
+ * compiled allowed collision matrix with the link ids cached on their collision objects instead of the link names.
+ */
+struct AllowedCollisionMatrixFn
+{
+  AllowedCollisionMatrixFn() = default;
+  explicit AllowedCollisionMatrixFn(std::shared_ptr<const tesseract_common::AllowedCollisionMatrix> acm);
+
+  bool operator()(const std::string& link_name1, const std::string& link_name2) const;
+
+  /** @brief The allowed collision matrix */
+  std::shared_ptr<const tesseract_common::AllowedCollisionMatrix> acm;
+};
+
 enum class ContinuousCollisionType
 {
   CCType_None,
@@ -160,6 +180,13 @@ struct ContactRequest
   /** @brief This provides a user defined function approve/reject contact results */
   IsContactResultValidFn is_valid = nullptr;
 
+  /**
+   * @brief This enables seeding the narrowphase of each pair with the result of the previous contact test for the pair
+   * @details This reduces the narrowphase iterations when successive contact tests are performed in nearby
+   * configurations, like along a trajectory. It is ignored if the contact manager does not support it.
+   */
+  bool warm_start = false;
+
   ContactRequest(ContactTestType type = ContactTestType::ALL);
 };
 
@@ -167,6 +194,352 @@ std::size_t flattenMoveResults(ContactResultMap&& m, ContactResultVector& v);
 
 std::size_t flattenCopyResults(const ContactResultMap& m, ContactResultVector& v);
 
+/**
+ * @brief Keeps the entries of cleared contact result maps so they can be reused by the following contact tests
+ *
+ * Recycling a contact result map into the pool keeps each of its nodes along with the link name pair key and the
+ * storage of the contact result vector. When a contact for a new pair is stored, a pooled node is reused instead of
+ * allocating a new one. A node which held the same pair is preferred, so the link names are not copied again, otherwise
+ * the key strings of another node are overwritten in place. At most capacity entries are pooled, the remaining entries
+ * of a recycled map are freed.
+ */
+class ContactResultMapPool
+{
+public:
+  /** @brief The default maximum number of pooled entries */
+  static constexpr std::size_t DEFAULT_CAPACITY = 1024;
+
+  /**
+   * @brief Constructor
+   * @param capacity The maximum number of pooled entries
+   */
+  explicit ContactResultMapPool(std::size_t capacity = DEFAULT_CAPACITY);
+
+  /**
+   * @brief Clear a contact result map, moving its entries into the pool up to the capacity
+   * @param m The contact result map
+   */
+  void recycle(ContactResultMap& m);
+
+  /**
+   * @brief Insert an entry with an empty contact result vector into a contact result map, reusing a pooled entry
+   * @details The key must not already be in the contact result map
+   * @param m The contact result map
+   * @param key The link name pair
+   * @return The inserted entry
+   */
+  ContactResultMap::iterator insert(ContactResultMap& m, const std::pair<std::string, std::string>& key);
+
+  /** @brief The number of pooled entries */
+  std::size_t size() const;
+
+  /** @brief The maximum number of pooled entries */
+  std::size_t getCapacity() const;
+
+  /**
+   * @brief Set the maximum number of pooled entries, freeing the entries beyond it
+   * @param capacity The maximum number of pooled entries
+   */
+  void setCapacity(std::size_t capacity);
+
+  /** @brief Free the contact result vector storage of the pooled entries, keeping the entries */
+  void shrink();
+
+  /** @brief Free the pooled entries */
+  void clear();
+
+private:
+  /** @brief The pooled entries, all with an empty contact result vector */
+  ContactResultMap nodes_;
+
+  /** @brief The maximum number of pooled entries */
+  std::size_t capacity_;
+};
+
+/** @brief A contact stored in CompactContactResults */
+struct CompactContactResult
+{
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  /** @brief The distance between the two collision objects */
+  double distance{ std::numeric_limits<double>::max() };
+  /** @brief The ids of the two collision objects that are in contact */
+  std::array<int, 2> object_id{ -1, -1 };
+  /** @brief The two shapes that are in contact. Each collision object can be made up of multiple shapes */
+  std::array<int, 2> shape_id{ -1, -1 };
+  /** @brief Some shapes like octomap and mesh have subshape (boxes and triangles) */
+  std::array<int, 2> subshape_id{ -1, -1 };
+  /** @brief The normal vector to move the two objects out of contact in world coordinates, see ContactResult::normal */
+  Eigen::Vector3d normal{ Eigen::Vector3d::Zero() };
+  /** @brief The nearest point on both collision objects in world coordinates */
+  std::array<Eigen::Vector3d, 2> nearest_points{ Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero() };
+};
+
+/**
+ * @brief Contact results stored in a flat vector which keeps its storage between contact tests
+ *
+ * Each contact only stores the collision object ids, shape ids, distance, normal and nearest points in world
+ * coordinates, which is a fraction of the size of a ContactResult, and no map of link name pairs is built. The full
+ * ContactResult of a contact can be built on demand with getContactResult.
+ */
+class CompactContactResults
+{
+public:
+  using const_iterator = tesseract_common::AlignedVector<CompactContactResult>::const_iterator;
+
+  /** @brief Remove all contacts, keeping the allocated storage */
+  void clear();
+
+  /**
+   * @brief Reserve storage for a number of contacts
+   * @param capacity The number of contacts
+   */
+  void reserve(std::size_t capacity);
+
+  /** @brief The number of contacts */
+  std::size_t size() const;
+
+  /** @brief Check if there are no contacts */
+  bool empty() const;
+
+  const CompactContactResult& operator[](std::size_t index) const;
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  /**
+   * @brief Get the name of a collision object
+   * @param object_id The collision object id
+   * @return The collision object name
+   */
+  const std::string& getObjectName(int object_id) const;
+
+  /**
+   * @brief Build the full contact result of a contact
+   * @note Only the link names and the fields stored by the compact contact are set. The type ids, transforms, local
+   * nearest points and continuous collision data are left at their default values.
+   * @param index The index of the contact
+   * @return The contact result
+   */
+  ContactResult getContactResult(std::size_t index) const;
+
+  /**
+   * @brief Set the collision object names, which are indexed by collision object id
+   * @details This is called by the contact manager performing the contact test.
+   * @param object_names The collision object names
+   */
+  void setObjectNames(std::shared_ptr<const std::vector<std::string>> object_names);
+
+  /**
+   * @brief Add a contact following the rules of the contact test type for contacts between the same pair of objects
+   * @details ALL keeps every contact, CLOSEST keeps the contact with the smallest distance and FIRST and LIMITED keep
+   * the first contact. LIMITED does not store more contacts than the contact limit.
+   * @param contact The contact
+   * @param type The contact test type
+   * @param contact_limit The maximum number of contacts stored by LIMITED, zero for no limit
+   * @return True if the contact was stored, otherwise false
+   */
+  bool addContact(const CompactContactResult& contact, ContactTestType type, long contact_limit = 0);
+
+private:
+  /** @brief The contacts */
+  tesseract_common::AlignedVector<CompactContactResult> contacts_;
+  /** @brief The index of the contact stored for each object pair, used unless the contact test type is ALL */
+  std::unordered_map<std::uint64_t, std::size_t> pair_index_;
+  /** @brief The collision object names indexed by collision object id */
+  std::shared_ptr<const std::vector<std::string>> object_names_;
+};
+
+/**
+ * @brief Copy the contacts in a contact result map into compact contact results
+ * @param m The contact result map
+ * @param object_names The collision object names indexed by collision object id
+ * @param v The compact contact results, which are cleared first
+ * @return The number of contacts
+ */
+std::size_t flattenCompactResults(const ContactResultMap& m,
+                                  std::shared_ptr<const std::vector<std::string>> object_names,
+                                  CompactContactResults& v);
+
+/** @brief The closest contact between a point and the active collision objects, see pointContactTest */
+struct PointContactResult
+{
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  /** @brief The index of the point in the point set */
+  std::size_t point_index{ 0 };
+  /** @brief The distance between the point and the link, which is negative if the point is inside the link */
+  double distance{ std::numeric_limits<double>::max() };
+  /** @brief The link closest to the point */
+  std::string link_name;
+  /** @brief The shape of the link closest to the point. Each link can be made up of multiple shapes */
+  int shape_id{ -1 };
+  /** @brief Some shapes like octomap and mesh have subshape (boxes and triangles) */
+  int subshape_id{ -1 };
+  /** @brief The nearest point on the link in world coordinates */
+  Eigen::Vector3d nearest_point{ Eigen::Vector3d::Zero() };
+};
+
+using PointContactResultVector = tesseract_common::AlignedVector<PointContactResult>;
+
+/**
+ * @brief The voxels of an octree that changed, typically the result of integrating a sensor update
+ * @details The voxels are given by their centers in the frame of the octree. See applyOctreeDelta.
+ */
+struct OctreeDelta
+{
+  /** @brief The centers of the voxels that became occupied */
+  tesseract_common::VectorVector3d occupied;
+  /** @brief The centers of the voxels that became free */
+  tesseract_common::VectorVector3d free;
+};
+
+/**
+ * @brief The collision margin data compiled into a form indexed by collision object id
+ *
+ * The contact managers assign each collision object an id and rebuild the table when the collision margin data or the
+ * collision objects change, so the per pair margin lookup does not build or hash a pair of link names. Only the pair
+ * margins are stored, every other pair uses the default margin, so the table size does not depend on the number of
+ * collision objects.
+ */
+class CollisionMarginTable
+{
+public:
+  /**
+   * @brief Rebuild the table
+   * @details The id of a collision object is its position in object_names
+   * @param collision_margin_data The collision margin data
+   * @param object_names The collision object names ordered by id
+   */
+  void update(const CollisionMarginData& collision_margin_data, const std::vector<std::string>& object_names);
+
+  /**
+   * @brief Get the collision margin between two collision objects
+   * @param object_id1 The id of the first collision object
+   * @param object_id2 The id of the second collision object
+   * @return The pair collision margin, or the default margin if no pair margin was provided
+   */
+  double getPairCollisionMargin(int object_id1, int object_id2) const
+  {
+    assert(object_id1 >= 0 && object_id1 < num_objects_);
+    assert(object_id2 >= 0 && object_id2 < num_objects_);
+    if (pair_margins_.empty())
+      return default_collision_margin_;
+
+    auto it = pair_margins_.find(getPairKey(object_id1, object_id2));
+    return (it != pair_margins_.end()) ? it->second : default_collision_margin_;
+  }
+
+  /**
+   * @brief Get the largest collision margin in the table
+   * @return The max collision margin
+   */
+  double getMaxCollisionMargin() const { return max_collision_margin_; }
+
+  /**
+   * @brief Get the number of collision objects in the table
+   * @return The number of collision objects
+   */
+  int size() const { return num_objects_; }
+
+  /**
+   * @brief Get the collision object names the table was built for
+   * @return The collision object names ordered by id
+   */
+  const std::shared_ptr<const std::vector<std::string>>& getObjectNames() const { return object_names_; }
+
+private:
+  int num_objects_{ 0 };                  /**< @brief The number of collision objects */
+  double default_collision_margin_{ 0 };  /**< @brief The margin of pairs without a pair margin */
+  double max_collision_margin_{ 0 };      /**< @brief The largest collision margin */
+
+  /** @brief The pair margins keyed by the ordered pair of object ids */
+  std::unordered_map<std::uint64_t, double> pair_margins_;
+
+  std::shared_ptr<const std::vector<std::string>> object_names_; /**< @brief The collision object names ordered by id */
+
+  static std::uint64_t getPairKey(int object_id1, int object_id2)
+  {
+    auto low = static_cast<std::uint64_t>(static_cast<std::uint32_t>(std::min(object_id1, object_id2)));
+    auto high = static_cast<std::uint64_t>(static_cast<std::uint32_t>(std::max(object_id1, object_id2)));
+    return (high << 32U) | low;
+  }
+};
+
+/**
+ * @brief Statistics collected by a contact manager over its contact tests
+ * @details Collection is disabled by default and the values accumulate until cleared, see
+ * DiscreteContactManager::setStatisticsEnabled and ContinuousContactManager::setStatisticsEnabled.
+ */
+struct ContactTestStatistics
+{
+  /** @brief The number of contact tests performed */
+  std::size_t contact_tests{ 0 };
+
+  /** @brief The number of overlapping object pairs reported by the broadphase */
+  std::size_t broadphase_pairs{ 0 };
+
+  /**
+   * @brief The number of broadphase pairs skipped before the narrowphase
+   * @details A pair is skipped if either object is disabled, the collision filter excludes it or the IsContactAllowedFn
+   * allows it.
+   */
+  std::size_t rejected_pairs{ 0 };
+
+  /** @brief The number of geometry types, which is the size of each dimension of narrowphase_calls */
+  static constexpr std::size_t GEOMETRY_TYPE_COUNT = tesseract_geometry::GeometryType::POLYGON_MESH + 1;
+
+  /**
+   * @brief The number of narrowphase checks between primitive shapes, indexed by the geometry types of both shapes
+   * @details Each pair is counted once with the smaller geometry type as the first index, see addNarrowphaseCall.
+   */
+  std::array<std::array<std::size_t, GEOMETRY_TYPE_COUNT>, GEOMETRY_TYPE_COUNT> narrowphase_calls{};
+
+  /** @brief The total number of GJK iterations */
+  std::size_t gjk_iterations{ 0 };
+
+  /** @brief The number of GJK queries started from the separating axis cached by ContactRequest::warm_start */
+  std::size_t gjk_warm_starts{ 0 };
+
+  /** @brief The number of times the penetration depth solver (EPA) was run */
+  std::size_t penetration_depth_calls{ 0 };
+
+  /** @brief The number of contacts within the collision margin passed to the contact results */
+  std::size_t contacts{ 0 };
+
+  /** @brief The time spent outside the narrowphase, which includes the broadphase and pair filtering */
+  std::chrono::nanoseconds broadphase_time{ 0 };
+
+  /** @brief The time spent in the narrowphase, which includes processing the contact results */
+  std::chrono::nanoseconds narrowphase_time{ 0 };
+
+  /**
+   * @brief Count a narrowphase check between two primitive shapes
+   * @param type1 The geometry type of the first shape
+   * @param type2 The geometry type of the second shape
+   */
+  void addNarrowphaseCall(tesseract_geometry::GeometryType type1, tesseract_geometry::GeometryType type2)
+  {
+    if (type1 > type2)
+      std::swap(type1, type2);
+
+    ++narrowphase_calls[static_cast<std::size_t>(type1)][static_cast<std::size_t>(type2)];
+  }
+
+  /**
+   * @brief Get the number of narrowphase checks between two geometry types
+   * @param type1 The geometry type of the first shape
+   * @param type2 The geometry type of the second shape
+   * @return The number of narrowphase checks
+   */
+  std::size_t getNarrowphaseCalls(tesseract_geometry::GeometryType type1, tesseract_geometry::GeometryType type2) const;
+
+  /** @brief Get the total number of narrowphase checks between all geometry types */
+  std::size_t getNarrowphaseCalls() const;
+
+  /** @brief Reset all values to zero */
+  void clear();
+};
+
 /**
  * @brief This data is intended only to be used internal to the collision checkers as a container and should not
  *        be externally used by other libraries or packages.
@@ -188,17 +561,42 @@ struct ContactTestData
   /** @brief The current contact_distance threshold */
   CollisionMarginData collision_margin_data{ 0 };
 
+  /** @brief The collision margin data indexed by collision object id, if the contact manager provides one */
+  const CollisionMarginTable* collision_margin_table = nullptr;
+
   /** @brief The allowed collision function used to check if two links should be excluded from collision checking */
   IsContactAllowedFn fn = nullptr;
 
+  /**
+   * @brief The compiled allowed collision matrix queried by fn, if the contact manager provides one
+   * @details If not nullptr the contact manager has cached the link ids of its collision objects for this matrix, see
+   * isContactAllowed.
+   */
+  const tesseract_common::CompiledAllowedCollisionMatrix* compiled_acm = nullptr;
+
   /** @brief The type of contact request data */
   ContactRequest req;
 
-  /** @brief Distance query results information */
+  /**
+   * @brief Distance query results information
+   * @details If nullptr the contact test only checks if any contact exists, see processAnyContact.
+   */
   ContactResultMap* res = nullptr;
 
+  /** @brief The pool used to add new entries to res, if nullptr the entries are allocated */
+  ContactResultMapPool* res_pool = nullptr;
+
+  /**
+   * @brief Compact contact results information
+   * @details If not nullptr the contacts are stored here instead of in res, see processCompactResult.
+   */
+  CompactContactResults* compact_res = nullptr;
+
   /** @brief Indicate if search is finished */
   bool done = false;
+
+  /** @brief The statistics to update during the contact test, nullptr if statistics are not collected */
+  ContactTestStatistics* statistics = nullptr;
 };
 
 /**
@@ -287,6 +685,13 @@ struct CollisionCheckConfig
   CollisionEvaluatorType type{ CollisionEvaluatorType::DISCRETE };
   /** @brief Longest valid segment to use if type supports lvs. Default: 0.005*/
   double longest_valid_segment_length{ 0.005 };
+  /**
+   * @brief The number of threads used when checking a trajectory. Default: 1 (serial)
+   * @details When greater than one the trajectory segments are distributed across the calling thread and the workers of
+   * a thread pool shared by all trajectory checks. The calling thread uses the provided contact manager and state
+   * solver, every other worker that gets segments uses its own clones. The results are identical to the serial check.
+   */
+  std::size_t num_threads{ 1 };
 };
 }  // namespace tesseract_collision
 
@@ -0,0 +1,313 @@
+/**
+ * @file voxel_utils.h
+ * @brief Utilities for voxelizing collision shapes and approximating them by spheres
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, agent
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_CORE_VOXEL_UTILS_H
+#define TESSERACT_COLLISION_CORE_VOXEL_UTILS_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <Eigen/Geometry>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/types.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+/** @brief A large finite value used in place of infinity by the distance transform */
+static constexpr double DISTANCE_TRANSFORM_INF = 1e20;
+
+/** @brief A sphere approximating part of a collision object */
+struct CollisionSphere
+{
+  /** @brief The center of the sphere in the collision object frame */
+  Eigen::Vector3d center{ Eigen::Vector3d::Zero() };
+  /** @brief The radius of the sphere */
+  double radius{ 0 };
+  /** @brief The index of the collision object shape the sphere approximates */
+  int shape_id{ -1 };
+};
+using CollisionSpheres = std::vector<CollisionSphere>;
+
+/**
+ * @brief Check if a shape can be voxelized and approximated by spheres
+ * @details Planes are not supported because they are unbounded.
+ * @param shape The shape to check
+ * @return True if the shape is supported, otherwise false
+ */
+bool isVoxelizationSupported(const tesseract_geometry::Geometry& shape);
+
+/**
+ * @brief Get the exact signed distance from a point to a primitive shape
+ * @details Supported primitives are spheres, boxes, cylinders, capsules and cones.
+ * @param shape The primitive shape
+ * @param point The point in the shape frame
+ * @param distance The signed distance, negative inside the shape
+ * @return False if the shape is not a supported primitive, otherwise true
+ */
+bool getPrimitiveSignedDistance(const tesseract_geometry::Geometry& shape,
+                                const Eigen::Vector3d& point,
+                                double& distance);
+
+/**
+ * @brief Get the axis aligned bounding box of a shape
+ * @param shape The shape
+ * @param shape_pose The shape pose in the collision object frame
+ * @param aabb_min The minimum corner of the bounding box in the collision object frame
+ * @param aabb_max The maximum corner of the bounding box in the collision object frame
+ * @return False if the shape is not supported or empty, otherwise true
+ */
+bool getShapeAABB(const tesseract_geometry::Geometry& shape,
+                  const Eigen::Isometry3d& shape_pose,
+                  Eigen::Vector3d& aabb_min,
+                  Eigen::Vector3d& aabb_max);
+
+/**
+ * @brief Get the axis aligned bounding box of a set of shapes
+ * @param shapes The shapes
+ * @param shape_poses The shape poses in the collision object frame
+ * @param aabb_min The minimum corner of the bounding box in the collision object frame
+ * @param aabb_max The maximum corner of the bounding box in the collision object frame
+ * @return False if none of the shapes are supported or they are empty, otherwise true
+ */
+bool getShapesAABB(const CollisionShapesConst& shapes,
+                   const tesseract_common::VectorIsometry3d& shape_poses,
+                   Eigen::Vector3d& aabb_min,
+                   Eigen::Vector3d& aabb_max);
+
+/** @brief Get the closest point on a triangle, see Real-Time Collision Detection (Ericson) section 5.1.5 */
+Eigen::Vector3d closestPointOnTriangle(const Eigen::Vector3d& p,
+                                       const Eigen::Vector3d& a,
+                                       const Eigen::Vector3d& b,
+                                       const Eigen::Vector3d& c);
+
+/** @brief Get the signed distance to an octree leaf, the radii match the shapes created by the Bullet manager */
+double getOctreeLeafSignedDistance(tesseract_geometry::Octree::SubType sub_type,
+                                   double size,
+                                   const Eigen::Vector3d& point);
+
+/** @brief Get the radius of the sphere centered on an octree leaf that contains the leaf shape */
+double getOctreeLeafBoundingRadius(tesseract_geometry::Octree::SubType sub_type, double size);
+
+/** @brief Call fn(a, b, c) for every non degenerate triangle of a mesh, polygons are split into triangle fans */
+template <typename Fn>
+inline void forEachTriangle(const tesseract_geometry::PolygonMesh& mesh, const Eigen::Isometry3d& pose, Fn fn)
+{
+  const tesseract_common::VectorVector3d& vertices = *(mesh.getVertices());
+  const Eigen::VectorXi& faces = *(mesh.getFaces());
+  for (Eigen::Index i = 0; i < faces.size(); i += faces[i] + 1)
+  {
+    // Note: faces structure is number of vertices that represent the face followed by vertex indexes
+    Eigen::Vector3d a = pose * vertices[static_cast<std::size_t>(faces[i + 1])];
+    for (Eigen::Index j = 2; j < faces[i]; ++j)
+    {
+      Eigen::Vector3d b = pose * vertices[static_cast<std::size_t>(faces[i + j])];
+      Eigen::Vector3d c = pose * vertices[static_cast<std::size_t>(faces[i + j + 1])];
+      if ((b - a).cross(c - a).squaredNorm() > 0)
+        fn(a, b, c);
+    }
+  }
+}
+
+/**
+ * @brief Call fn(center, size) for every sub shape of an octree, the center is in the octree frame
+ * @details These are the same nodes the Bullet manager creates a child shape for.
+ */
+template <typename Fn>
+inline void forEachOccupiedLeaf(const tesseract_geometry::Octree& geom, Fn fn)
+{
+  const octomap::OcTree& octree = *(geom.getOctree());
+  geom.forEachSubShape([&](const octomap::OcTreeKey& key, unsigned depth) {
+    octomap::point3d center = octree.keyToCoord(key, depth);
+    fn(Eigen::Vector3d(center.x(), center.y(), center.z()), octree.getNodeSize(depth));
+  });
+}
+
+/** @brief Get the range of voxels whose centers are inside a box, the range is empty if lower > upper */
+void getVoxelRange(const Eigen::Vector3d& origin,
+                   double resolution,
+                   const Eigen::Vector3i& size,
+                   const Eigen::Vector3d& box_min,
+                   const Eigen::Vector3d& box_max,
+                   Eigen::Vector3i& lower,
+                   Eigen::Vector3i& upper);
+
+/** @brief Call fn(index, center) for every voxel whose center is inside a box */
+template <typename Fn>
+inline void forEachVoxel(const Eigen::Vector3d& origin,
+                         double resolution,
+                         const Eigen::Vector3i& size,
+                         const Eigen::Vector3d& box_min,
+                         const Eigen::Vector3d& box_max,
+                         Fn fn)
+{
+  Eigen::Vector3i lower;
+  Eigen::Vector3i upper;
+  getVoxelRange(origin, resolution, size, box_min, box_max, lower, upper);
+  for (int z = lower.z(); z <= upper.z(); ++z)
+  {
+    for (int y = lower.y(); y <= upper.y(); ++y)
+    {
+      for (int x = lower.x(); x <= upper.x(); ++x)
+      {
+        auto index = static_cast<std::size_t>(x + (size.x() * (y + (size.y() * z))));
+        fn(index, Eigen::Vector3d(origin + (resolution * Eigen::Vector3d(x, y, z))));
+      }
+    }
+  }
+}
+
+/** @brief Call fn(index, center) for every voxel of a grid */
+template <typename Fn>
+inline void forEachVoxel(const Eigen::Vector3d& origin, double resolution, const Eigen::Vector3i& size, Fn fn)
+{
+  std::size_t index = 0;
+  for (int z = 0; z < size.z(); ++z)
+  {
+    for (int y = 0; y < size.y(); ++y)
+    {
+      for (int x = 0; x < size.x(); ++x)
+        fn(index++, Eigen::Vector3d(origin + (resolution * Eigen::Vector3d(x, y, z))));
+    }
+  }
+}
+
+/**
+ * @brief Set every voxel with a center within a distance of a mesh surface to a value
+ * @param mesh The mesh
+ * @param pose The mesh pose in the grid frame
+ * @param origin The center of the first voxel
+ * @param resolution The edge length of a voxel
+ * @param size The number of voxels along each axis
+ * @param distance The distance from the surface
+ * @param voxels The voxel values indexed by the flat index
+ * @param value The value to assign
+ */
+template <typename T>
+inline void markMeshSurface(const tesseract_geometry::PolygonMesh& mesh,
+                            const Eigen::Isometry3d& pose,
+                            const Eigen::Vector3d& origin,
+                            double resolution,
+                            const Eigen::Vector3i& size,
+                            double distance,
+                            std::vector<T>& voxels,
+                            T value)
+{
+  const double threshold = distance * distance;
+  forEachTriangle(mesh, pose, [&](const Eigen::Vector3d& a, const Eigen::Vector3d& b, const Eigen::Vector3d& c) {
+    Eigen::Vector3d box_min = a.cwiseMin(b).cwiseMin(c) - Eigen::Vector3d::Constant(distance);
+    Eigen::Vector3d box_max = a.cwiseMax(b).cwiseMax(c) + Eigen::Vector3d::Constant(distance);
+    forEachVoxel(origin, resolution, size, box_min, box_max, [&](std::size_t index, const Eigen::Vector3d& center) {
+      if ((closestPointOnTriangle(center, a, b, c) - center).squaredNorm() <= threshold)
+        voxels[index] = value;
+    });
+  });
+}
+
+/**
+ * @brief Set every voxel with a center at a signed distance from an occupied octree leaf within a range to a value
+ * @param octree The octree
+ * @param pose The octree pose in the grid frame
+ * @param origin The center of the first voxel
+ * @param resolution The edge length of a voxel
+ * @param size The number of voxels along each axis
+ * @param min_distance The minimum signed distance from a leaf
+ * @param max_distance The maximum signed distance from a leaf, must not be negative
+ * @param voxels The voxel values indexed by the flat index
+ * @param value The value to assign
+ */
+template <typename T>
+inline void markOctreeLeaves(const tesseract_geometry::Octree& octree,
+                             const Eigen::Isometry3d& pose,
+                             const Eigen::Vector3d& origin,
+                             double resolution,
+                             const Eigen::Vector3i& size,
+                             double min_distance,
+                             double max_distance,
+                             std::vector<T>& voxels,
+                             T value)
+{
+  const Eigen::Isometry3d pose_inv = pose.inverse();
+  const tesseract_geometry::Octree::SubType sub_type = octree.getSubType();
+  forEachOccupiedLeaf(octree, [&](const Eigen::Vector3d& leaf_center, double leaf_size) {
+    Eigen::Vector3d extents =
+        Eigen::Vector3d::Constant(getOctreeLeafBoundingRadius(sub_type, leaf_size) + max_distance);
+    Eigen::Vector3d center = pose * leaf_center;
+    auto mark = [&](std::size_t index, const Eigen::Vector3d& p) {
+      double distance = getOctreeLeafSignedDistance(sub_type, leaf_size, (pose_inv * p) - leaf_center);
+      if (distance >= min_distance && distance <= max_distance)
+        voxels[index] = value;
+    };
+    forEachVoxel(origin, resolution, size, center - extents, center + extents, mark);
+  });
+}
+
+/**
+ * @brief Squared euclidean distance transform of a voxel grid
+ * @details This is the separable algorithm from Distance Transforms of Sampled Functions (Felzenszwalb and
+ * Huttenlocher), it is linear in the number of voxels.
+ * @param size The number of voxels along each axis
+ * @param f On input zero for the seed voxels and DISTANCE_TRANSFORM_INF otherwise, on output the squared distance in
+ * voxels to the closest seed
+ * @param closest If not nullptr, on input the index of each voxel and on output the index of the closest seed
+ */
+void distanceTransform(const Eigen::Vector3i& size, std::vector<double>& f, std::vector<std::size_t>* closest);
+
+/**
+ * @brief Flood fill the exterior of a voxel grid from its boundary
+ * @details The fill moves between face neighbors and stops at blocked voxels, so voxels that are not reached are
+ * enclosed by blocked voxels.
+ * @param size The number of voxels along each axis
+ * @param blocked Nonzero for the voxels the fill can not enter
+ * @return Nonzero for the exterior voxels
+ */
+std::vector<char> floodFillExterior(const Eigen::Vector3i& size, const std::vector<char>& blocked);
+
+/**
+ * @brief Approximate a collision object by spheres
+ * @details Sphere shapes are represented exactly. Every other shape is covered by the circumscribed spheres of the
+ * voxels near its surface, so each sphere extends at most sqrt(3) * resolution beyond the true surface and distances
+ * computed from the spheres are a conservative (lower) bound of the true distance.
+ *
+ * If fill_interior is true the inside of closed shapes is also covered. Starting from the deepest uncovered voxel, each
+ * interior voxel gets a sphere reaching the closest surface voxel center unless an earlier sphere already covers it.
+ * These extend at most half the voxel diagonal beyond the surface. Without them an object completely inside another
+ * object does not overlap any of its spheres. Open meshes have no interior.
+ * @param shapes The collision object shapes
+ * @param shape_poses The shape poses in the collision object frame
+ * @param resolution The edge length of the voxels used to place the spheres
+ * @param fill_interior Indicate if the inside of closed shapes should be covered
+ * @return The spheres in the collision object frame
+ */
+CollisionSpheres createCollisionSpheres(const CollisionShapesConst& shapes,
+                                        const tesseract_common::VectorIsometry3d& shape_poses,
+                                        double resolution,
+                                        bool fill_interior = false);
+
+}  // namespace tesseract_collision
+#endif  // TESSERACT_COLLISION_CORE_VOXEL_UTILS_H
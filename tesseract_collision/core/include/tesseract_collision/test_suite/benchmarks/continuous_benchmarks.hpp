@@ -0,0 +1,256 @@
+#ifndef TESSERACT_COLLISION_CONTINUOUS_BENCHMARKS_HPP
+#define TESSERACT_COLLISION_CONTINUOUS_BENCHMARKS_HPP
+
+#include <tesseract_collision/bullet/convex_hull_utils.h>
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+#include <Eigen/Eigen>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+/**
+ * @brief Contains the information necessary to run the benchmarks for continuous collision checking
+ *
+ * The first object is cast from pose1_start to pose1_end and the second object is static.
+ */
+struct ContinuousBenchmarkInfo
+{
+  ContinuousBenchmarkInfo(const ContinuousContactManager::ConstPtr& contact_manager,
+                          const tesseract_geometry::Geometry::ConstPtr& geom1,
+                          const Eigen::Isometry3d& pose1_start,
+                          const Eigen::Isometry3d& pose1_end,
+                          const tesseract_geometry::Geometry::ConstPtr& geom2,
+                          const Eigen::Isometry3d& pose2,
+                          ContactTestType contact_test_type)
+
+  {
+    contact_manager_ = contact_manager->clone();
+    geom1_.push_back(geom1->clone());
+    geom2_.push_back(geom2->clone());
+    obj1_start_pose = pose1_start;
+    obj1_end_pose = pose1_end;
+    obj2_pose = pose2;
+    contact_test_type_ = contact_test_type;
+  }
+  ContinuousContactManager::Ptr contact_manager_;
+  CollisionShapesConst geom1_;
+  Eigen::Isometry3d obj1_start_pose;
+  Eigen::Isometry3d obj1_end_pose;
+  CollisionShapesConst geom2_;
+  Eigen::Isometry3d obj2_pose;
+  ContactTestType contact_test_type_;
+};
+
+/** @brief Create a sphere of radius 0.25 as a primitive, convex mesh or detailed mesh */
+inline CollisionShapePtr CreateBenchmarkSphere(tesseract_geometry::GeometryType type)
+{
+  tesseract_common::VectorVector3d mesh_vertices;
+  Eigen::VectorXi mesh_faces;
+  loadSimplePlyFile(std::string(TESSERACT_SUPPORT_DIR) + "/meshes/sphere_p25m.ply", mesh_vertices, mesh_faces);
+
+  // This is required because convex hull cannot have multiple faces on the same plane.
+  auto ch_verticies = std::make_shared<tesseract_common::VectorVector3d>();
+  auto ch_faces = std::make_shared<Eigen::VectorXi>();
+  int ch_num_faces = createConvexHull(*ch_verticies, *ch_faces, mesh_vertices);
+
+  switch (type)
+  {
+    case tesseract_geometry::GeometryType::CONVEX_MESH:
+      return std::make_shared<tesseract_geometry::ConvexMesh>(ch_verticies, ch_faces, ch_num_faces);
+    case tesseract_geometry::GeometryType::MESH:
+      return std::make_shared<tesseract_geometry::Mesh>(ch_verticies, ch_faces, ch_num_faces);
+    case tesseract_geometry::GeometryType::SPHERE:
+      return std::make_shared<tesseract_geometry::Sphere>(0.25);
+    default:
+      throw(std::runtime_error("Invalid geometry type"));
+  }
+}
+
+/** @brief Benchmark that checks the clone method in continuous contact managers*/
+static void BM_CONTINUOUS_CLONE(benchmark::State& state, ContinuousBenchmarkInfo info, std::size_t num_obj)  // NOLINT
+{
+  std::vector<std::string> active_obj;
+  for (std::size_t ind = 0; ind < num_obj; ind++)
+  {
+    std::string name = "geom_" + std::to_string(ind);
+    active_obj.push_back(name);
+    info.contact_manager_->addCollisionObject(name, 0, info.geom1_, { Eigen::Isometry3d::Identity() });
+  }
+  info.contact_manager_->setActiveCollisionObjects(active_obj);
+  info.contact_manager_->setCollisionMarginData(CollisionMarginData(0.5));
+
+  ContinuousContactManager::Ptr clone;
+  for (auto _ : state)  // NOLINT
+  {
+    benchmark::DoNotOptimize(clone = info.contact_manager_->clone());
+  }
+};
+
+/** @brief Benchmark that checks the contactTest function in continuous contact managers*/
+static void BM_CONTINUOUS_CONTACT_TEST(benchmark::State& state, ContinuousBenchmarkInfo info)  // NOLINT
+{
+  info.contact_manager_->addCollisionObject(std::string("geom1"), 0, info.geom1_, { Eigen::Isometry3d::Identity() });
+  info.contact_manager_->addCollisionObject(std::string("geom2"), 0, info.geom2_, { Eigen::Isometry3d::Identity() });
+
+  info.contact_manager_->setActiveCollisionObjects({ "geom1" });
+  info.contact_manager_->setCollisionMarginData(CollisionMarginData(0.5));
+  info.contact_manager_->setCollisionObjectsTransform("geom1", info.obj1_start_pose, info.obj1_end_pose);
+  info.contact_manager_->setCollisionObjectsTransform("geom2", info.obj2_pose);
+
+  ContactResultMap result;
+  for (auto _ : state)  // NOLINT
+  {
+    result.clear();
+    info.contact_manager_->contactTest(result, ContactRequest(info.contact_test_type_));
+  }
+};
+
+/** @brief Benchmark that checks setting the cast transform and calling contactTest in continuous contact managers,
+ * which is the work done per segment when checking a trajectory*/
+static void BM_CONTINUOUS_SET_TRANSFORM_CONTACT_TEST(benchmark::State& state, ContinuousBenchmarkInfo info)  // NOLINT
+{
+  info.contact_manager_->addCollisionObject(std::string("geom1"), 0, info.geom1_, { Eigen::Isometry3d::Identity() });
+  info.contact_manager_->addCollisionObject(std::string("geom2"), 0, info.geom2_, { Eigen::Isometry3d::Identity() });
+
+  info.contact_manager_->setActiveCollisionObjects({ "geom1" });
+  info.contact_manager_->setCollisionMarginData(CollisionMarginData(0.5));
+  info.contact_manager_->setCollisionObjectsTransform("geom2", info.obj2_pose);
+
+  ContactResultMap result;
+  for (auto _ : state)  // NOLINT
+  {
+    result.clear();
+    info.contact_manager_->setCollisionObjectsTransform("geom1", info.obj1_start_pose, info.obj1_end_pose);
+    info.contact_manager_->contactTest(result, ContactRequest(info.contact_test_type_));
+  }
+};
+
+/** @brief Benchmark that checks collisions between a lot of objects. In this case it is a grid of spheres - each as its
+ * own link, every sphere is swept along x by the provided distance*/
+static void BM_LARGE_DATASET_CONTINUOUS_MULTILINK(benchmark::State& state,
+                                                  ContinuousContactManager::Ptr checker,  // NOLINT
+                                                  int edge_size,
+                                                  tesseract_geometry::GeometryType type,
+                                                  double sweep)
+{
+  CollisionShapePtr sphere = CreateBenchmarkSphere(type);
+
+  double delta = 0.55;
+
+  std::vector<std::string> link_names;
+  tesseract_common::TransformMap location1;
+  tesseract_common::TransformMap location2;
+  for (int x = 0; x < edge_size; ++x)
+  {
+    for (int y = 0; y < edge_size; ++y)
+    {
+      for (int z = 0; z < edge_size; ++z)
+      {
+        CollisionShapesConst obj3_shapes;
+        tesseract_common::VectorIsometry3d obj3_poses;
+        Eigen::Isometry3d sphere_pose;
+        sphere_pose.setIdentity();
+
+        obj3_shapes.push_back(CollisionShapePtr(sphere->clone()));
+        obj3_poses.push_back(sphere_pose);
+
+        link_names.push_back("sphere_link_" + std::to_string(x) + std::to_string(y) + std::to_string(z));
+
+        sphere_pose.translation() = Eigen::Vector3d(
+            static_cast<double>(x) * delta, static_cast<double>(y) * delta, static_cast<double>(z) * delta);
+        location1[link_names.back()] = sphere_pose;
+        sphere_pose.translation().x() += sweep;
+        location2[link_names.back()] = sphere_pose;
+        checker->addCollisionObject(link_names.back(), 0, obj3_shapes, obj3_poses);
+      }
+    }
+  }
+
+  // Check if they are in collision
+  checker->setActiveCollisionObjects(link_names);
+  checker->setCollisionMarginData(CollisionMarginData(0.1));
+  checker->setCollisionObjectsTransform(location1, location2);
+
+  ContactResultVector result_vector;
+
+  for (auto _ : state)  // NOLINT
+  {
+    ContactResultMap result;
+    result_vector.clear();
+    checker->contactTest(result, ContactTestType::ALL);
+    flattenMoveResults(std::move(result), result_vector);
+  }
+};
+
+/** @brief Benchmark that checks collisions between a lot of objects. In this case it is a static grid of spheres in one
+ * link and a single sphere in another link swept through the grid along x by the provided distance*/
+static void BM_LARGE_DATASET_CONTINUOUS_SINGLELINK(benchmark::State& state,
+                                                   ContinuousContactManager::Ptr checker,  // NOLINT
+                                                   int edge_size,
+                                                   tesseract_geometry::GeometryType type,
+                                                   double sweep)
+{
+  CollisionShapePtr sphere = CreateBenchmarkSphere(type);
+
+  // Add Grid of spheres
+  double delta = 0.55;
+
+  CollisionShapesConst obj3_shapes;
+  tesseract_common::VectorIsometry3d obj3_poses;
+  for (int x = 0; x < edge_size; ++x)
+  {
+    for (int y = 0; y < edge_size; ++y)
+    {
+      for (int z = 0; z < edge_size; ++z)
+      {
+        Eigen::Isometry3d sphere_pose;
+        sphere_pose.setIdentity();
+        sphere_pose.translation() = Eigen::Vector3d(
+            static_cast<double>(x) * delta, static_cast<double>(y) * delta, static_cast<double>(z) * delta);
+
+        obj3_shapes.push_back(CollisionShapePtr(sphere->clone()));
+        obj3_poses.push_back(sphere_pose);
+      }
+    }
+  }
+  checker->addCollisionObject("grid_link", 0, obj3_shapes, obj3_poses);
+
+  // Add Single Sphere Link
+  CollisionShapesConst single_shapes;
+  tesseract_common::VectorIsometry3d single_poses;
+  single_shapes.push_back(CollisionShapePtr(sphere->clone()));
+  single_poses.push_back(Eigen::Isometry3d::Identity());
+  checker->addCollisionObject("single_link", 0, single_shapes, single_poses);
+
+  Eigen::Isometry3d start_pose;
+  start_pose.setIdentity();
+  start_pose.translation() = Eigen::Vector3d(static_cast<double>(edge_size) / 2.0 * delta,
+                                             static_cast<double>(edge_size) / 2.0 * delta,
+                                             static_cast<double>(edge_size) / 2.0 * delta);
+  Eigen::Isometry3d end_pose = start_pose;
+  end_pose.translation().x() += sweep;
+
+  // Check if they are in collision
+  checker->setActiveCollisionObjects({ "single_link" });
+  checker->setCollisionMarginData(CollisionMarginData(0.1));
+  checker->setCollisionObjectsTransform("single_link", start_pose, end_pose);
+
+  ContactResultVector result_vector;
+
+  for (auto _ : state)  // NOLINT
+  {
+    ContactResultMap result;
+    result_vector.clear();
+    checker->contactTest(result, ContactTestType::ALL);
+    flattenMoveResults(std::move(result), result_vector);
+  }
+};
+
+}  // namespace test_suite
+}  // namespace tesseract_collision
+
+#endif
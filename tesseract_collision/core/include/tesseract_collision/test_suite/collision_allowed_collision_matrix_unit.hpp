@@ -0,0 +1,86 @@
+#ifndef TESSERACT_COLLISION_COLLISION_ALLOWED_COLLISION_MATRIX_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_ALLOWED_COLLISION_MATRIX_UNIT_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision::test_suite
+{
+namespace detail
+{
+inline void addAllowedCollisionMatrixCollisionObject(DiscreteContactManager& checker,
+                                                     const std::string& name,
+                                                     const Eigen::Vector3d& position)
+{
+  Eigen::Isometry3d box_pose;
+  box_pose.setIdentity();
+  box_pose.translation() = position;
+
+  CollisionShapesConst shapes;
+  tesseract_common::VectorIsometry3d poses;
+  shapes.push_back(std::make_shared<tesseract_geometry::Box>(1, 1, 1));
+  poses.push_back(Eigen::Isometry3d::Identity());
+  checker.addCollisionObject(name, 0, shapes, poses);
+  checker.setCollisionObjectsTransform(name, box_pose);
+}
+}  // namespace detail
+
+inline void runTest(DiscreteContactManager& checker)
+{
+  // The active box overlaps each of the other boxes, which do not overlap each other
+  detail::addAllowedCollisionMatrixCollisionObject(checker, "box_link", Eigen::Vector3d(0, 0, 0));
+  detail::addAllowedCollisionMatrixCollisionObject(checker, "box1_link", Eigen::Vector3d(0.8, 0, 0));
+  detail::addAllowedCollisionMatrixCollisionObject(checker, "box2_link", Eigen::Vector3d(-0.8, 0, 0));
+  checker.setActiveCollisionObjects({ "box_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  // The contact manager queries the compiled allowed collision matrix with the cached link ids
+  auto acm = std::make_shared<tesseract_common::AllowedCollisionMatrix>();
+  acm->addAllowedCollision("box_link", "box1_link", "adjacent");
+  checker.setIsContactAllowedFn(AllowedCollisionMatrixFn(acm));
+  EXPECT_EQ(getCompiledAllowedCollisionMatrix(checker.getIsContactAllowedFn()),
+            &acm->getCompiledAllowedCollisionMatrix());
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  ASSERT_EQ(result.size(), 1U);
+  EXPECT_TRUE(result.find(getObjectPairKey("box_link", "box2_link")) != result.end());
+
+  // Changing the allowed collision matrix changes the link ids, which are looked up again
+  acm->removeAllowedCollision("box_link", "box1_link");
+  acm->addAllowedCollision("box_link", "box2_link", "adjacent");
+  result.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  ASSERT_EQ(result.size(), 1U);
+  EXPECT_TRUE(result.find(getObjectPairKey("box_link", "box1_link")) != result.end());
+
+  // A collision object added later gets its link id
+  acm->addAllowedCollision("box_link", "box3_link", "adjacent");
+  detail::addAllowedCollisionMatrixCollisionObject(checker, "box3_link", Eigen::Vector3d(0, 0.8, 0));
+  result.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  ASSERT_EQ(result.size(), 1U);
+  EXPECT_TRUE(result.find(getObjectPairKey("box_link", "box1_link")) != result.end());
+
+  // A clone uses the same allowed collision matrix
+  DiscreteContactManager::UPtr cloned_checker = checker.clone();
+  result.clear();
+  cloned_checker->contactTest(result, ContactRequest(ContactTestType::ALL));
+  ASSERT_EQ(result.size(), 1U);
+  EXPECT_TRUE(result.find(getObjectPairKey("box_link", "box1_link")) != result.end());
+
+  // Any other contact allowed function is called with the link names
+  checker.setIsContactAllowedFn([](const std::string& s1, const std::string& s2) {
+    return getObjectPairKey(s1, s2) == getObjectPairKey("box_link", "box1_link");
+  });
+  EXPECT_EQ(getCompiledAllowedCollisionMatrix(checker.getIsContactAllowedFn()), nullptr);
+  result.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  ASSERT_EQ(result.size(), 2U);
+  EXPECT_TRUE(result.find(getObjectPairKey("box_link", "box2_link")) != result.end());
+  EXPECT_TRUE(result.find(getObjectPairKey("box_link", "box3_link")) != result.end());
+}
+}  // namespace tesseract_collision::test_suite
+
+#endif  // TESSERACT_COLLISION_COLLISION_ALLOWED_COLLISION_MATRIX_UNIT_HPP
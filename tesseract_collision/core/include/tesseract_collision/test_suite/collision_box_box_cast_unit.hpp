@@ -108,7 +108,13 @@ inline void addCollisionObjects(ContinuousContactManager& checker)
 }
 }  // namespace detail
 
-inline void runTest(ContinuousContactManager& checker)
+/**
+ * @brief Run the box box cast tests
+ * @param checker The contact manager to test
+ * @param interpolated_contact Indicate if the manager reports the contact between the shapes at a single time along the
+ * motion, like the FCL cast managers, instead of the contact with the convex hull of the swept shapes
+ */
+inline void runTest(ContinuousContactManager& checker, bool interpolated_contact = false)
 {
   // Add collision objects
   detail::addCollisionObjects(checker);
@@ -146,29 +152,55 @@ inline void runTest(ContinuousContactManager& checker)
     flattenMoveResults(std::move(result), result_vector);
 
     EXPECT_TRUE(!result_vector.empty());
-    EXPECT_NEAR(result_vector[0].distance, -0.2475, 0.001);
-    EXPECT_NEAR(result_vector[0].cc_time[0], -1.0, 0.001);
-    EXPECT_NEAR(result_vector[0].cc_time[1], 0.25, 0.001);
-    EXPECT_TRUE(result_vector[0].cc_type[0] == ContinuousCollisionType::CCType_None);
-    EXPECT_TRUE(result_vector[0].cc_type[1] == ContinuousCollisionType::CCType_Between);
-
-    EXPECT_NEAR(result_vector[0].nearest_points[0][0], -0.5, 0.001);
-    EXPECT_NEAR(result_vector[0].nearest_points[0][1], 0.5, 0.001);
-    EXPECT_NEAR(result_vector[0].nearest_points[0][2], 0.0, 0.001);
-
-    EXPECT_NEAR(result_vector[0].nearest_points[1][0], -0.325, 0.001);
-    EXPECT_NEAR(result_vector[0].nearest_points[1][1], 0.325, 0.001);
-    EXPECT_NEAR(result_vector[0].nearest_points[1][2], 0.0, 0.001);
-
-    Eigen::Vector3d p0 = result_vector[0].transform[1] * result_vector[0].nearest_points_local[1];
-    EXPECT_NEAR(p0[0], -1.275, 0.001);
-    EXPECT_NEAR(p0[1], -0.625, 0.001);
-    EXPECT_NEAR(p0[2], 0.0, 0.001);
-
-    Eigen::Vector3d p1 = result_vector[0].cc_transform[1] * result_vector[0].nearest_points_local[1];
-    EXPECT_NEAR(p1[0], 2.525, 0.001);
-    EXPECT_NEAR(p1[1], 3.175, 0.001);
-    EXPECT_NEAR(p1[2], 0.0, 0.001);
+    if (interpolated_contact)
+    {
+      // The deepest penetration is when the center of the moving box is closest to the corner of the static box
+      EXPECT_NEAR(result_vector[0].distance, -0.175, 0.001);
+      EXPECT_NEAR(result_vector[0].cc_time[0], -1.0, 0.001);
+      EXPECT_NEAR(result_vector[0].cc_time[1], 0.25, 0.001);
+      EXPECT_TRUE(result_vector[0].cc_type[0] == ContinuousCollisionType::CCType_None);
+      EXPECT_TRUE(result_vector[0].cc_type[1] == ContinuousCollisionType::CCType_Between);
+
+      EXPECT_TRUE(result_vector[0].transform[1].isApprox(start_pos, 1e-5));
+      EXPECT_TRUE(result_vector[0].cc_transform[1].isApprox(end_pos, 1e-5));
+
+      // The local nearest point of the moving box is relative to its pose at the time of contact
+      double cc_time = result_vector[0].cc_time[1];
+      Eigen::Isometry3d contact_pose = Eigen::Isometry3d::Identity();
+      contact_pose.translation() = ((1 - cc_time) * start_pos.translation()) + (cc_time * end_pos.translation());
+      Eigen::Vector3d p1 = contact_pose * result_vector[0].nearest_points_local[1];
+      EXPECT_NEAR(p1[0], result_vector[0].nearest_points[1][0], 0.001);
+      EXPECT_NEAR(p1[1], result_vector[0].nearest_points[1][1], 0.001);
+      EXPECT_NEAR(p1[2], result_vector[0].nearest_points[1][2], 0.001);
+
+      EXPECT_NEAR(result_vector[0].normal.norm(), 1.0, 0.001);
+    }
+    else
+    {
+      EXPECT_NEAR(result_vector[0].distance, -0.2475, 0.001);
+      EXPECT_NEAR(result_vector[0].cc_time[0], -1.0, 0.001);
+      EXPECT_NEAR(result_vector[0].cc_time[1], 0.25, 0.001);
+      EXPECT_TRUE(result_vector[0].cc_type[0] == ContinuousCollisionType::CCType_None);
+      EXPECT_TRUE(result_vector[0].cc_type[1] == ContinuousCollisionType::CCType_Between);
+
+      EXPECT_NEAR(result_vector[0].nearest_points[0][0], -0.5, 0.001);
+      EXPECT_NEAR(result_vector[0].nearest_points[0][1], 0.5, 0.001);
+      EXPECT_NEAR(result_vector[0].nearest_points[0][2], 0.0, 0.001);
+
+      EXPECT_NEAR(result_vector[0].nearest_points[1][0], -0.325, 0.001);
+      EXPECT_NEAR(result_vector[0].nearest_points[1][1], 0.325, 0.001);
+      EXPECT_NEAR(result_vector[0].nearest_points[1][2], 0.0, 0.001);
+
+      Eigen::Vector3d p0 = result_vector[0].transform[1] * result_vector[0].nearest_points_local[1];
+      EXPECT_NEAR(p0[0], -1.275, 0.001);
+      EXPECT_NEAR(p0[1], -0.625, 0.001);
+      EXPECT_NEAR(p0[2], 0.0, 0.001);
+
+      Eigen::Vector3d p1 = result_vector[0].cc_transform[1] * result_vector[0].nearest_points_local[1];
+      EXPECT_NEAR(p1[0], 2.525, 0.001);
+      EXPECT_NEAR(p1[1], 3.175, 0.001);
+      EXPECT_NEAR(p1[2], 0.0, 0.001);
+    }
   }
 }
 }  // namespace tesseract_collision::test_suite
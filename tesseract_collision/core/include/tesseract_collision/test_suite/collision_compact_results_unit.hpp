@@ -0,0 +1,137 @@
+#ifndef TESSERACT_COLLISION_COLLISION_COMPACT_RESULTS_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_COMPACT_RESULTS_UNIT_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision::test_suite
+{
+namespace detail
+{
+template <typename T>
+inline void addCompactResultsCollisionObjects(T& checker)
+{
+  // An active box overlapping two static boxes
+  std::vector<std::pair<std::string, double>> boxes = { { "box_link", 0 },
+                                                        { "box1_link", 0.8 },
+                                                        { "box2_link", -0.8 } };
+  for (const auto& box : boxes)
+  {
+    Eigen::Isometry3d box_pose;
+    box_pose.setIdentity();
+    box_pose.translation() = Eigen::Vector3d(box.second, 0, 0);
+
+    CollisionShapesConst shapes;
+    tesseract_common::VectorIsometry3d poses;
+    shapes.push_back(std::make_shared<tesseract_geometry::Box>(1, 1, 1));
+    poses.push_back(Eigen::Isometry3d::Identity());
+    checker.addCollisionObject(box.first, 0, shapes, poses);
+    checker.setCollisionObjectsTransform(box.first, box_pose);
+  }
+
+  checker.setActiveCollisionObjects({ "box_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+}
+
+/** @brief Check each compact contact has a matching contact in the contact result map */
+inline void checkCompactResults(const CompactContactResults& compact_results,
+                                const ContactResultMap& result_map,
+                                bool check_points)
+{
+  ContactResultVector results;
+  flattenCopyResults(result_map, results);
+  EXPECT_EQ(compact_results.size(), results.size());
+
+  for (std::size_t i = 0; i < compact_results.size(); ++i)
+  {
+    ContactResult compact_result = compact_results.getContactResult(i);
+    auto it = std::find_if(results.begin(), results.end(), [&compact_result](const ContactResult& result) {
+      return (result.link_names == compact_result.link_names && result.shape_id == compact_result.shape_id &&
+              result.subshape_id == compact_result.subshape_id &&
+              std::abs(result.distance - compact_result.distance) < 1e-6);
+    });
+    ASSERT_TRUE(it != results.end());
+
+    if (check_points)
+    {
+      EXPECT_TRUE(it->normal.isApprox(compact_result.normal, 1e-6));
+      EXPECT_TRUE(it->nearest_points[0].isApprox(compact_result.nearest_points[0], 1e-6));
+      EXPECT_TRUE(it->nearest_points[1].isApprox(compact_result.nearest_points[1], 1e-6));
+    }
+  }
+}
+}  // namespace detail
+
+inline void runTest(DiscreteContactManager& checker)
+{
+  detail::addCompactResultsCollisionObjects(checker);
+
+  CompactContactResults compact_results;
+  for (auto type : { ContactTestType::ALL, ContactTestType::CLOSEST, ContactTestType::FIRST })
+  {
+    ContactResultMap result_map;
+    checker.contactTest(result_map, ContactRequest(type));
+
+    checker.contactTest(compact_results, ContactRequest(type));
+    EXPECT_FALSE(compact_results.empty());
+    detail::checkCompactResults(compact_results, result_map, type != ContactTestType::FIRST);
+
+    // The results are cleared by each contact test
+    std::size_t num_contacts = compact_results.size();
+    checker.contactTest(compact_results, ContactRequest(type));
+    EXPECT_EQ(compact_results.size(), num_contacts);
+  }
+
+  // LIMITED stores the first contact of each pair until the contact limit is reached
+  ContactRequest limited_request(ContactTestType::LIMITED);
+  checker.contactTest(compact_results, limited_request);
+  EXPECT_EQ(compact_results.size(), 2U);
+
+  limited_request.contact_limit = 1;
+  checker.contactTest(compact_results, limited_request);
+  EXPECT_EQ(compact_results.size(), 1U);
+
+  // The contact result map follows the same limit
+  ContactResultMap limited_result_map;
+  checker.contactTest(limited_result_map, limited_request);
+  EXPECT_EQ(limited_result_map.size(), 1U);
+
+  // Contacts outside the collision margin are not stored
+  Eigen::Isometry3d box_pose;
+  box_pose.setIdentity();
+  box_pose.translation() = Eigen::Vector3d(0, 0, 2);
+  checker.setCollisionObjectsTransform("box_link", box_pose);
+  checker.contactTest(compact_results, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(compact_results.empty());
+}
+
+inline void runTest(ContinuousContactManager& checker)
+{
+  detail::addCompactResultsCollisionObjects(checker);
+
+  Eigen::Isometry3d start_pose, end_pose;
+  start_pose.setIdentity();
+  start_pose.translation() = Eigen::Vector3d(0, -2, 0);
+  end_pose.setIdentity();
+  end_pose.translation() = Eigen::Vector3d(0, 2, 0);
+  checker.setCollisionObjectsTransform("box_link", start_pose, end_pose);
+
+  CompactContactResults compact_results;
+  for (auto type : { ContactTestType::ALL, ContactTestType::CLOSEST, ContactTestType::FIRST })
+  {
+    ContactResultMap result_map;
+    checker.contactTest(result_map, ContactRequest(type));
+
+    checker.contactTest(compact_results, ContactRequest(type));
+    EXPECT_FALSE(compact_results.empty());
+    detail::checkCompactResults(compact_results, result_map, false);
+
+    // The cast object is always second
+    for (const auto& contact : compact_results)
+      EXPECT_EQ(compact_results.getObjectName(contact.object_id[1]), "box_link");
+  }
+}
+}  // namespace tesseract_collision::test_suite
+
+#endif  // TESSERACT_COLLISION_COLLISION_COMPACT_RESULTS_UNIT_HPP
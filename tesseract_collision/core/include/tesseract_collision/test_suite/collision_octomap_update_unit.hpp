@@ -0,0 +1,190 @@
+#ifndef TESSERACT_COLLISION_COLLISION_OCTOMAP_UPDATE_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_OCTOMAP_UPDATE_UNIT_HPP
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <octomap/octomap.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision::test_suite
+{
+namespace detail
+{
+inline std::shared_ptr<octomap::OcTree> addCollisionObjects(DiscreteContactManager& checker, bool use_compound)
+{
+  /////////////////////////////////////////////////////////////////
+  // Add an octomap with a 2x2x2 block of voxels, which gets pruned
+  // into a single node. If use_compound = true a box is added to
+  // the same link so the octree is a child of a compound shape.
+  /////////////////////////////////////////////////////////////////
+  auto ot = std::make_shared<octomap::OcTree>(0.1);
+  for (double x : { 0.05, 0.15 })
+    for (double y : { 0.05, 0.15 })
+      for (double z : { 0.05, 0.15 })
+        ot->updateNode(x, y, z, true);
+
+  CollisionShapesConst obj1_shapes;
+  tesseract_common::VectorIsometry3d obj1_poses;
+  obj1_shapes.push_back(std::make_shared<tesseract_geometry::Octree>(ot, tesseract_geometry::Octree::BOX));
+  obj1_poses.push_back(Eigen::Isometry3d::Identity());
+  if (use_compound)
+  {
+    obj1_shapes.push_back(std::make_shared<tesseract_geometry::Box>(0.1, 0.1, 0.1));
+    obj1_poses.push_back(Eigen::Isometry3d::Identity() * Eigen::Translation3d(-1, -1, -1));
+  }
+  checker.addCollisionObject("octomap_link", 0, obj1_shapes, obj1_poses);
+
+  CollisionShapesConst obj2_shapes;
+  tesseract_common::VectorIsometry3d obj2_poses;
+  obj2_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.02));
+  obj2_poses.push_back(Eigen::Isometry3d::Identity());
+  checker.addCollisionObject("sphere_link", 0, obj2_shapes, obj2_poses);
+
+  checker.setActiveCollisionObjects({ "sphere_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0));
+  return ot;
+}
+
+inline bool isInContact(DiscreteContactManager& checker, const Eigen::Vector3d& sphere_position)
+{
+  Eigen::Isometry3d sphere_pose = Eigen::Isometry3d::Identity();
+  sphere_pose.translation() = sphere_position;
+  checker.setCollisionObjectsTransform("sphere_link", sphere_pose);
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::FIRST));
+  return !result.empty();
+}
+
+inline bool isInContact(ContinuousContactManager& checker, const Eigen::Vector3d& start, const Eigen::Vector3d& end)
+{
+  Eigen::Isometry3d start_pose = Eigen::Isometry3d::Identity();
+  Eigen::Isometry3d end_pose = Eigen::Isometry3d::Identity();
+  start_pose.translation() = start;
+  end_pose.translation() = end;
+  checker.setCollisionObjectsTransform("sphere_link", start_pose, end_pose);
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::FIRST));
+  return !result.empty();
+}
+}  // namespace detail
+
+inline void runTest(DiscreteContactManager& checker, bool use_compound)
+{
+  std::shared_ptr<octomap::OcTree> ot = detail::addCollisionObjects(checker, use_compound);
+  DiscreteContactManager::UPtr cloned_checker = checker.clone();
+  const std::size_t num_leafs = ot->getNumLeafNodes();
+
+  const Eigen::Vector3d occupied_voxel(0.55, 0.05, 0.05);
+  const Eigen::Vector3d freed_voxel(0.05, 0.05, 0.05);
+  EXPECT_TRUE(detail::isInContact(checker, freed_voxel));
+  EXPECT_TRUE(detail::isInContact(checker, Eigen::Vector3d(0.15, 0.15, 0.15)));
+  EXPECT_FALSE(detail::isInContact(checker, occupied_voxel));
+
+  // Only octree shapes can be updated
+  auto octree = std::static_pointer_cast<const tesseract_geometry::Octree>(
+      checker.getCollisionObjectGeometries("octomap_link").front());
+  OctreeDelta delta;
+  delta.occupied.push_back(occupied_voxel);
+  tesseract_geometry::Octree::ConstPtr updated_octree = applyOctreeDelta(*octree, delta);
+  EXPECT_FALSE(checker.updateCollisionObjectOctree("unknown_link", 0, updated_octree, delta));
+  EXPECT_FALSE(checker.updateCollisionObjectOctree("sphere_link", 0, updated_octree, delta));
+
+  // Occupy a voxel in unknown space, the previous octree is not modified
+  EXPECT_TRUE(checker.updateCollisionObjectOctree("octomap_link", 0, updated_octree, delta));
+  EXPECT_EQ(ot->getNumLeafNodes(), num_leafs);
+  EXPECT_EQ(octree->getOctree(), ot);
+  EXPECT_EQ(checker.getCollisionObjectGeometries("octomap_link").front(), updated_octree);
+  EXPECT_TRUE(detail::isInContact(checker, occupied_voxel));
+  EXPECT_TRUE(detail::isInContact(checker, freed_voxel));
+
+  // The clone is not affected by the update
+  EXPECT_FALSE(detail::isInContact(*cloned_checker, occupied_voxel));
+  EXPECT_EQ(cloned_checker->getCollisionObjectGeometries("octomap_link").front(), octree);
+
+  // Free a voxel of the pruned block, the rest of the block must stay occupied
+  OctreeDelta free_delta;
+  free_delta.free.push_back(freed_voxel);
+  updated_octree = applyOctreeDelta(*updated_octree, free_delta);
+  EXPECT_TRUE(checker.updateCollisionObjectOctree("octomap_link", 0, updated_octree, free_delta));
+  EXPECT_FALSE(detail::isInContact(checker, freed_voxel));
+  EXPECT_TRUE(detail::isInContact(checker, Eigen::Vector3d(0.15, 0.15, 0.15)));
+  EXPECT_TRUE(detail::isInContact(checker, Eigen::Vector3d(0.05, 0.15, 0.05)));
+  EXPECT_TRUE(detail::isInContact(checker, occupied_voxel));
+
+  // The clone was created before the updates, so it reports the new voxels once it is updated with both deltas
+  OctreeDelta clone_delta;
+  clone_delta.occupied.push_back(occupied_voxel);
+  clone_delta.free.push_back(freed_voxel);
+  EXPECT_TRUE(cloned_checker->updateCollisionObjectOctree("octomap_link", 0, updated_octree, clone_delta));
+  EXPECT_TRUE(detail::isInContact(*cloned_checker, occupied_voxel));
+  EXPECT_FALSE(detail::isInContact(*cloned_checker, freed_voxel));
+  EXPECT_TRUE(detail::isInContact(*cloned_checker, Eigen::Vector3d(0.15, 0.05, 0.15)));
+
+  // Free every voxel
+  OctreeDelta free_all_delta;
+  free_all_delta.free.push_back(occupied_voxel);
+  for (double x : { 0.05, 0.15 })
+  {
+    for (double y : { 0.05, 0.15 })
+    {
+      for (double z : { 0.05, 0.15 })
+        free_all_delta.free.emplace_back(x, y, z);
+    }
+  }
+  updated_octree = applyOctreeDelta(*updated_octree, free_all_delta);
+  EXPECT_TRUE(checker.updateCollisionObjectOctree("octomap_link", 0, updated_octree, free_all_delta));
+  EXPECT_FALSE(detail::isInContact(checker, occupied_voxel));
+  EXPECT_FALSE(detail::isInContact(checker, Eigen::Vector3d(0.15, 0.15, 0.15)));
+  EXPECT_FALSE(detail::isInContact(checker, Eigen::Vector3d(0.1, 0.1, 0.1)));
+
+  // The clone still uses the octree of its last update
+  EXPECT_TRUE(detail::isInContact(*cloned_checker, occupied_voxel));
+  EXPECT_TRUE(detail::isInContact(*cloned_checker, Eigen::Vector3d(0.15, 0.15, 0.15)));
+}
+
+inline void runTest(ContinuousContactManager& checker)
+{
+  auto ot = std::make_shared<octomap::OcTree>(0.1);
+  ot->updateNode(0.05, 0.05, 0.05, true);
+  auto octree = std::make_shared<tesseract_geometry::Octree>(ot, tesseract_geometry::Octree::BOX);
+  checker.addCollisionObject("octomap_link", 0, { octree }, { Eigen::Isometry3d::Identity() });
+  checker.addCollisionObject(
+      "sphere_link", 0, { std::make_shared<tesseract_geometry::Sphere>(0.02) }, { Eigen::Isometry3d::Identity() });
+  checker.setActiveCollisionObjects({ "sphere_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0));
+  checker.setCollisionObjectsTransform("octomap_link", Eigen::Isometry3d::Identity());
+
+  // The sphere is swept through the voxel which becomes occupied
+  const Eigen::Vector3d occupied_voxel(0.55, 0.05, 0.05);
+  const Eigen::Vector3d start(0.55, -0.5, 0.05);
+  const Eigen::Vector3d end(0.55, 0.5, 0.05);
+  EXPECT_FALSE(detail::isInContact(checker, start, end));
+
+  OctreeDelta delta;
+  delta.occupied.push_back(occupied_voxel);
+  tesseract_geometry::Octree::ConstPtr updated_octree = applyOctreeDelta(*octree, delta);
+  EXPECT_FALSE(checker.updateCollisionObjectOctree("unknown_link", 0, updated_octree, delta));
+  EXPECT_FALSE(checker.updateCollisionObjectOctree("sphere_link", 0, updated_octree, delta));
+  EXPECT_TRUE(checker.updateCollisionObjectOctree("octomap_link", 0, updated_octree, delta));
+  EXPECT_EQ(checker.getCollisionObjectGeometries("octomap_link").front(), updated_octree);
+  EXPECT_TRUE(detail::isInContact(checker, start, end));
+
+  // The cast collision object of the octree includes the update once the link becomes active
+  checker.setActiveCollisionObjects({ "octomap_link", "sphere_link" });
+  checker.setCollisionObjectsTransform("octomap_link", Eigen::Isometry3d::Identity(), Eigen::Isometry3d::Identity());
+  EXPECT_TRUE(detail::isInContact(checker, start, end));
+
+  // Octrees of active links must be replaced
+  EXPECT_FALSE(checker.updateCollisionObjectOctree("octomap_link", 0, updated_octree, delta));
+}
+
+}  // namespace tesseract_collision::test_suite
+
+#endif  // TESSERACT_COLLISION_COLLISION_OCTOMAP_UPDATE_UNIT_HPP
@@ -0,0 +1,119 @@
+#ifndef TESSERACT_COLLISION_COLLISION_POINT_CONTACT_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_POINT_CONTACT_UNIT_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision::test_suite
+{
+namespace detail
+{
+inline void addPointContactCollisionObjects(DiscreteContactManager& checker)
+{
+  // Active box and sphere links next to each other and a static box
+  Eigen::Isometry3d pose;
+  pose.setIdentity();
+
+  CollisionShapesConst shapes;
+  tesseract_common::VectorIsometry3d poses;
+  shapes.push_back(std::make_shared<tesseract_geometry::Box>(1, 1, 1));
+  poses.push_back(Eigen::Isometry3d::Identity());
+  checker.addCollisionObject("box_link", 0, shapes, poses);
+  checker.setCollisionObjectsTransform("box_link", pose);
+
+  shapes.clear();
+  shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.25));
+  checker.addCollisionObject("sphere_link", 0, shapes, poses);
+  pose.translation() = Eigen::Vector3d(2, 0, 0);
+  checker.setCollisionObjectsTransform("sphere_link", pose);
+
+  shapes.clear();
+  shapes.push_back(std::make_shared<tesseract_geometry::Box>(1, 1, 1));
+  checker.addCollisionObject("static_box_link", 0, shapes, poses);
+  pose.translation() = Eigen::Vector3d(0, 3, 0);
+  checker.setCollisionObjectsTransform("static_box_link", pose);
+
+  checker.setActiveCollisionObjects({ "box_link", "sphere_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+}
+}  // namespace detail
+
+inline void runTest(DiscreteContactManager& checker)
+{
+  detail::addPointContactCollisionObjects(checker);
+
+  tesseract_common::VectorVector3d points;
+  points.emplace_back(0, 0, 0);    // Inside box_link
+  points.emplace_back(0.8, 0, 0);  // Closest to box_link
+  points.emplace_back(1.6, 0, 0);  // Closest to sphere_link
+  points.emplace_back(0, 2.8, 0);  // Inside static_box_link, which is not active
+  points.emplace_back(5, 5, 5);    // Far from every link
+
+  PointContactResultVector results;
+  checker.pointContactTest(results, points, 0.5);
+  ASSERT_EQ(results.size(), 3U);
+
+  EXPECT_EQ(results[0].point_index, 0U);
+  EXPECT_EQ(results[0].link_name, "box_link");
+  EXPECT_NEAR(results[0].distance, -0.5, 1e-4);
+
+  EXPECT_EQ(results[1].point_index, 1U);
+  EXPECT_EQ(results[1].link_name, "box_link");
+  EXPECT_EQ(results[1].shape_id, 0);
+  EXPECT_NEAR(results[1].distance, 0.3, 1e-4);
+  EXPECT_TRUE(results[1].nearest_point.isApprox(Eigen::Vector3d(0.5, 0, 0), 1e-4));
+
+  EXPECT_EQ(results[2].point_index, 2U);
+  EXPECT_EQ(results[2].link_name, "sphere_link");
+  EXPECT_NEAR(results[2].distance, 0.15, 1e-4);
+  EXPECT_TRUE(results[2].nearest_point.isApprox(Eigen::Vector3d(1.75, 0, 0), 1e-4));
+
+  // The points can also be provided as a matrix, which gives the same results
+  Eigen::Matrix3Xd point_matrix(3, static_cast<Eigen::Index>(points.size()));
+  for (std::size_t i = 0; i < points.size(); ++i)
+    point_matrix.col(static_cast<Eigen::Index>(i)) = points[i];
+
+  PointContactResultVector matrix_results;
+  checker.pointContactTest(matrix_results, point_matrix, 0.5);
+  ASSERT_EQ(matrix_results.size(), results.size());
+  for (std::size_t i = 0; i < results.size(); ++i)
+  {
+    EXPECT_EQ(matrix_results[i].point_index, results[i].point_index);
+    EXPECT_EQ(matrix_results[i].link_name, results[i].link_name);
+    EXPECT_NEAR(matrix_results[i].distance, results[i].distance, 1e-6);
+  }
+
+  // The collision objects, the active collision objects and the margins are left unchanged
+  EXPECT_EQ(checker.getCollisionObjects().size(), 3U);
+  ASSERT_EQ(checker.getActiveCollisionObjects().size(), 2U);
+  EXPECT_NEAR(checker.getCollisionMarginData().getMaxCollisionMargin(), 0.1, 1e-6);
+  EXPECT_TRUE(checker.getCollisionMarginData().getPairCollisionMargins().empty());
+
+  // The contact distance limits the reported points
+  checker.pointContactTest(results, points, 0.2);
+  ASSERT_EQ(results.size(), 2U);
+  EXPECT_EQ(results[0].point_index, 0U);
+  EXPECT_EQ(results[1].point_index, 2U);
+
+  // Disabled collision objects are ignored
+  checker.disableCollisionObject("sphere_link");
+  checker.pointContactTest(results, points, 0.5);
+  ASSERT_EQ(results.size(), 2U);
+  EXPECT_EQ(results[0].point_index, 0U);
+  EXPECT_EQ(results[1].point_index, 1U);
+  checker.enableCollisionObject("sphere_link");
+
+  // Only the active collision objects are checked
+  checker.setActiveCollisionObjects({ "sphere_link" });
+  checker.pointContactTest(results, points, 0.5);
+  ASSERT_EQ(results.size(), 1U);
+  EXPECT_EQ(results[0].point_index, 2U);
+  EXPECT_EQ(results[0].link_name, "sphere_link");
+
+  // An empty point set has no results
+  checker.pointContactTest(results, tesseract_common::VectorVector3d(), 0.5);
+  EXPECT_TRUE(results.empty());
+}
+}  // namespace tesseract_collision::test_suite
+
+#endif  // TESSERACT_COLLISION_COLLISION_POINT_CONTACT_UNIT_HPP
@@ -0,0 +1,105 @@
+#ifndef TESSERACT_COLLISION_COLLISION_QUERY_OBJECTS_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_QUERY_OBJECTS_UNIT_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision::test_suite
+{
+namespace detail
+{
+inline void addQueryObjectsCollisionObjects(DiscreteContactManager& checker)
+{
+  // Two pairs of overlapping boxes far apart from each other
+  std::vector<std::pair<std::string, double>> boxes = {
+    { "box_link", 0 }, { "box1_link", 0.8 }, { "box2_link", 5 }, { "box3_link", 5.8 }
+  };
+  for (const auto& box : boxes)
+  {
+    Eigen::Isometry3d box_pose;
+    box_pose.setIdentity();
+    box_pose.translation() = Eigen::Vector3d(box.second, 0, 0);
+
+    CollisionShapesConst shapes;
+    tesseract_common::VectorIsometry3d poses;
+    shapes.push_back(std::make_shared<tesseract_geometry::Box>(1, 1, 1));
+    poses.push_back(Eigen::Isometry3d::Identity());
+    checker.addCollisionObject(box.first, 0, shapes, poses);
+    checker.setCollisionObjectsTransform(box.first, box_pose);
+  }
+
+  checker.setActiveCollisionObjects({ "box_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+}
+}  // namespace detail
+
+inline void runTest(DiscreteContactManager& checker)
+{
+  detail::addQueryObjectsCollisionObjects(checker);
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  ASSERT_EQ(result.size(), 1U);
+  EXPECT_TRUE(result.find(getObjectPairKey("box_link", "box1_link")) != result.end());
+  ContactResultVector active_results;
+  flattenCopyResults(result, active_results);
+
+  // Only pairs including a query object are checked
+  result.clear();
+  checker.contactTest(result, { "box2_link" }, ContactRequest(ContactTestType::ALL));
+  ASSERT_EQ(result.size(), 1U);
+  EXPECT_TRUE(result.find(getObjectPairKey("box2_link", "box3_link")) != result.end());
+
+  // The active collision objects are left unchanged
+  ASSERT_EQ(checker.getActiveCollisionObjects().size(), 1U);
+  EXPECT_EQ(checker.getActiveCollisionObjects()[0], "box_link");
+  result.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  ASSERT_EQ(result.size(), 1U);
+  EXPECT_TRUE(result.find(getObjectPairKey("box_link", "box1_link")) != result.end());
+
+  // A pair of two query objects is only checked once and matches the contact test using the active collision objects
+  result.clear();
+  checker.contactTest(result, { "box_link", "box1_link", "box_link" }, ContactRequest(ContactTestType::ALL));
+  ASSERT_EQ(result.size(), 1U);
+  ContactResultVector query_results;
+  flattenCopyResults(result, query_results);
+  ASSERT_EQ(query_results.size(), active_results.size());
+  auto distance_less = [](const ContactResult& a, const ContactResult& b) { return a.distance < b.distance; };
+  std::sort(query_results.begin(), query_results.end(), distance_less);
+  std::sort(active_results.begin(), active_results.end(), distance_less);
+  for (std::size_t i = 0; i < query_results.size(); ++i)
+    EXPECT_NEAR(query_results[i].distance, active_results[i].distance, 1e-6);
+
+  // Every query object is checked
+  result.clear();
+  checker.contactTest(result, { "box1_link", "box3_link" }, ContactRequest(ContactTestType::ALL));
+  EXPECT_EQ(result.size(), 2U);
+
+  result.clear();
+  checker.contactTest(result, { "box1_link", "box3_link" }, ContactRequest(ContactTestType::FIRST));
+  EXPECT_EQ(result.size(), 1U);
+
+  // Unknown and disabled query objects are ignored
+  result.clear();
+  checker.contactTest(result, { "unknown_link" }, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(result.empty());
+
+  checker.disableCollisionObject("box3_link");
+  result.clear();
+  checker.contactTest(result, { "box2_link", "box3_link" }, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(result.empty());
+  checker.enableCollisionObject("box3_link");
+
+  // The allowed collision function is applied
+  checker.setIsContactAllowedFn([](const std::string& s1, const std::string& s2) {
+    return (s1 == "box2_link" && s2 == "box3_link") || (s1 == "box3_link" && s2 == "box2_link");
+  });
+  result.clear();
+  checker.contactTest(result, { "box2_link" }, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(result.empty());
+}
+}  // namespace tesseract_collision::test_suite
+
+#endif  // TESSERACT_COLLISION_COLLISION_QUERY_OBJECTS_UNIT_HPP
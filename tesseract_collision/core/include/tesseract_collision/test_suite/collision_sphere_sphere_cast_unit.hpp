@@ -288,6 +288,181 @@ inline void runTestPrimitive(ContinuousContactManager& checker)
   EXPECT_NEAR(result_vector[0].normal[2], idx[2] * 0.0, 0.001);
 }
 
+inline void checkPrimitiveInterpolated(const ContactResult& contact,
+                                       tesseract_common::TransformMap& location_start,
+                                       tesseract_common::TransformMap& location_end,
+                                       double distance,
+                                       double cc_time,
+                                       const Eigen::Vector3d& normal,
+                                       const Eigen::Vector3d& point,
+                                       const Eigen::Vector3d& sphere_point_local,
+                                       const Eigen::Vector3d& sphere1_point_local)
+{
+  // The contact is reported at the deepest penetration of the spheres along the motion
+  EXPECT_NEAR(contact.distance, distance, 0.0001);
+
+  std::vector<int> idx = { 0, 1, 1 };
+  if (contact.link_names[0] != "sphere_link")
+    idx = { 1, 0, -1 };
+
+  EXPECT_NEAR(contact.cc_time[static_cast<size_t>(idx[0])], cc_time, 0.001);
+  EXPECT_NEAR(contact.cc_time[static_cast<size_t>(idx[1])], cc_time, 0.001);
+
+  EXPECT_TRUE(contact.cc_type[static_cast<size_t>(idx[0])] == ContinuousCollisionType::CCType_Between);
+  EXPECT_TRUE(contact.cc_type[static_cast<size_t>(idx[1])] == ContinuousCollisionType::CCType_Between);
+
+  EXPECT_TRUE(contact.nearest_points[static_cast<size_t>(idx[0])].isApprox(point, 0.01));
+  EXPECT_TRUE(contact.nearest_points[static_cast<size_t>(idx[1])].isApprox(point, 0.01));
+  EXPECT_TRUE(contact.nearest_points_local[static_cast<size_t>(idx[0])].isApprox(sphere_point_local, 0.01));
+  EXPECT_TRUE(contact.nearest_points_local[static_cast<size_t>(idx[1])].isApprox(sphere1_point_local, 0.01));
+
+  EXPECT_TRUE(contact.transform[static_cast<size_t>(idx[0])].isApprox(location_start["sphere_link"], 0.0001));
+  EXPECT_TRUE(contact.transform[static_cast<size_t>(idx[1])].isApprox(location_start["sphere1_link"], 0.0001));
+  EXPECT_TRUE(contact.cc_transform[static_cast<size_t>(idx[0])].isApprox(location_end["sphere_link"], 0.0001));
+  EXPECT_TRUE(contact.cc_transform[static_cast<size_t>(idx[1])].isApprox(location_end["sphere1_link"], 0.0001));
+
+  EXPECT_TRUE(contact.normal.isApprox(idx[2] * normal, 0.01));
+}
+
+inline void runTestPrimitiveInterpolated(ContinuousContactManager& checker)
+{
+  ///////////////////////////////////////////////////
+  // Test when object is in collision at cc_time 0.5
+  ///////////////////////////////////////////////////
+  checker.setActiveCollisionObjects({ "sphere_link", "sphere1_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+  EXPECT_NEAR(checker.getCollisionMarginData().getMaxCollisionMargin(), 0.1, 1e-5);
+
+  tesseract_common::TransformMap location_start;
+  location_start["sphere_link"] = Eigen::Isometry3d::Identity();
+  location_start["sphere_link"].translation() = Eigen::Vector3d(-0.2, -1.0, 0);
+  location_start["sphere1_link"] = Eigen::Isometry3d::Identity();
+  location_start["sphere1_link"].translation() = Eigen::Vector3d(0.2, 0, -1.0);
+
+  tesseract_common::TransformMap location_end;
+  location_end["sphere_link"] = Eigen::Isometry3d::Identity();
+  location_end["sphere_link"].translation() = Eigen::Vector3d(-0.2, 1.0, 0);
+  location_end["sphere1_link"] = Eigen::Isometry3d::Identity();
+  location_end["sphere1_link"].translation() = Eigen::Vector3d(0.2, 0, 1.0);
+
+  checker.setCollisionObjectsTransform(location_start, location_end);
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+
+  ContactResultVector result_vector;
+  flattenMoveResults(std::move(result), result_vector);
+
+  ASSERT_EQ(result_vector.size(), 1);
+  checkPrimitiveInterpolated(result_vector[0],
+                             location_start,
+                             location_end,
+                             -0.1,
+                             0.5,
+                             Eigen::Vector3d(1.0, 0.0, 0.0),
+                             Eigen::Vector3d(0.0, 0.0, 0.0),
+                             Eigen::Vector3d(0.2, 0.0, 0.0),
+                             Eigen::Vector3d(-0.2, 0.0, 0.0));
+
+  ///////////////////////////////////////////////////
+  // Test when object is in collision at cc_time 0.44
+  ///////////////////////////////////////////////////
+  location_start["sphere_link"].translation() = Eigen::Vector3d(-0.2, -0.5, 0);
+  checker.setCollisionObjectsTransform(location_start, location_end);
+
+  result = ContactResultMap();
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+
+  result_vector = ContactResultVector();
+  flattenMoveResults(std::move(result), result_vector);
+
+  ASSERT_EQ(result_vector.size(), 1);
+  checkPrimitiveInterpolated(result_vector[0],
+                             location_start,
+                             location_end,
+                             -0.0528,
+                             0.44,
+                             Eigen::Vector3d(0.8944, -0.3578, -0.2683),
+                             Eigen::Vector3d(0.0, 0.08, -0.06),
+                             Eigen::Vector3d(0.2, -0.08, -0.06),
+                             Eigen::Vector3d(-0.2, 0.08, 0.06));
+}
+
+inline void runTestPrimitiveAnyContact(ContinuousContactManager& checker)
+{
+  checker.setActiveCollisionObjects({ "sphere_link", "sphere1_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  ///////////////////////////////////////////////////
+  // Test when object is in collision at cc_time 0.5
+  ///////////////////////////////////////////////////
+  tesseract_common::TransformMap location_start;
+  location_start["sphere_link"] = Eigen::Isometry3d::Identity();
+  location_start["sphere_link"].translation() = Eigen::Vector3d(-0.2, -1.0, 0);
+  location_start["sphere1_link"] = Eigen::Isometry3d::Identity();
+  location_start["sphere1_link"].translation() = Eigen::Vector3d(0.2, 0, -1.0);
+
+  tesseract_common::TransformMap location_end;
+  location_end["sphere_link"] = Eigen::Isometry3d::Identity();
+  location_end["sphere_link"].translation() = Eigen::Vector3d(-0.2, 1.0, 0);
+  location_end["sphere1_link"] = Eigen::Isometry3d::Identity();
+  location_end["sphere1_link"].translation() = Eigen::Vector3d(0.2, 0, 1.0);
+
+  checker.setCollisionObjectsTransform(location_start, location_end);
+  EXPECT_TRUE(checker.anyContactTest(ContactRequest(ContactTestType::FIRST)));
+
+  ///////////////////////////////////////////////////
+  // Test when the motions do not come within the contact distance
+  ///////////////////////////////////////////////////
+  location_end["sphere1_link"].translation() = Eigen::Vector3d(0.2, 0, -0.8);
+
+  checker.setCollisionObjectsTransform(location_start, location_end);
+  EXPECT_FALSE(checker.anyContactTest(ContactRequest(ContactTestType::FIRST)));
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::FIRST));
+  EXPECT_TRUE(result.empty());
+}
+
+inline void runTestPrimitiveDense(ContinuousContactManager& checker)
+{
+  checker.setActiveCollisionObjects({ "sphere_link", "sphere1_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  // Unknown links are allowed and are ignored
+  std::vector<std::string> dense_link_names = { "sphere1_link", "missing_link", "sphere_link" };
+  checker.setDenseLinkNames(dense_link_names);
+  EXPECT_EQ(checker.getDenseLinkNames(), dense_link_names);
+
+  // Set the start location
+  tesseract_common::VectorIsometry3d location_start(3, Eigen::Isometry3d::Identity());
+  location_start[2].translation() = Eigen::Vector3d(-0.2, -1.0, 0);
+  location_start[0].translation() = Eigen::Vector3d(0.2, 0, -1.0);
+
+  // Set the end location
+  tesseract_common::VectorIsometry3d location_end(3, Eigen::Isometry3d::Identity());
+  location_end[2].translation() = Eigen::Vector3d(-0.2, 1.0, 0);
+  location_end[0].translation() = Eigen::Vector3d(0.2, 0, 1.0);
+
+  checker.setDenseCollisionObjectsTransform(location_start, location_end);
+
+  // Perform collision check
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+
+  ContactResultVector result_vector;
+  flattenMoveResults(std::move(result), result_vector);
+
+  ASSERT_EQ(result_vector.size(), 1);
+  EXPECT_NEAR(result_vector[0].distance, -0.1, 0.0001);
+  EXPECT_NEAR(result_vector[0].cc_time[0], 0.5, 0.001);
+  EXPECT_NEAR(result_vector[0].cc_time[1], 0.5, 0.001);
+
+  // The dense link names should be carried over to the clone
+  ContinuousContactManager::UPtr cloned_checker = checker.clone();
+  EXPECT_EQ(cloned_checker->getDenseLinkNames(), dense_link_names);
+}
+
 inline void runTestConvex(ContinuousContactManager& checker)
 {
   ///////////////////////////////////////////////////
@@ -439,7 +614,14 @@ inline void runTestConvex(ContinuousContactManager& checker)
 }
 }  // namespace detail
 
-inline void runTest(ContinuousContactManager& checker, bool use_convex_mesh)
+/**
+ * @brief Run the sphere sphere cast tests
+ * @param checker The contact manager to test
+ * @param use_convex_mesh Indicate if the spheres should be added as convex meshes
+ * @param interpolated_contact Indicate if the manager reports the contact between the shapes at a single time along the
+ * motion, like the FCL cast managers, instead of the contact with the convex hull of the swept shapes
+ */
+inline void runTest(ContinuousContactManager& checker, bool use_convex_mesh, bool interpolated_contact = false)
 {
   // Add collision objects
   detail::addCollisionObjects(checker, use_convex_mesh);
@@ -447,7 +629,15 @@ inline void runTest(ContinuousContactManager& checker, bool use_convex_mesh)
   if (use_convex_mesh)
     detail::runTestConvex(checker);
   else
-    detail::runTestPrimitive(checker);
+  {
+    if (interpolated_contact)
+      detail::runTestPrimitiveInterpolated(checker);
+    else
+      detail::runTestPrimitive(checker);
+
+    detail::runTestPrimitiveAnyContact(checker);
+    detail::runTestPrimitiveDense(checker);
+  }
 }
 
 }  // namespace tesseract_collision::test_suite
@@ -1,6 +1,8 @@
 #ifndef TESSERACT_COLLISION_COLLISION_SPHERE_SPHERE_UNIT_HPP
 #define TESSERACT_COLLISION_COLLISION_SPHERE_SPHERE_UNIT_HPP
 
+#include <limits>
+
 #include <tesseract_collision/bullet/convex_hull_utils.h>
 #include <tesseract_collision/core/discrete_contact_manager.h>
 #include <tesseract_collision/core/common.h>
@@ -241,6 +243,138 @@ inline void runTestPrimitive(DiscreteContactManager& checker)
   EXPECT_NEAR(result_vector[0].normal[2], idx[2] * 0.0, 0.001);
 }
 
+inline void runTestPrimitiveAnyContact(DiscreteContactManager& checker)
+{
+  checker.setActiveCollisionObjects({ "sphere_link", "sphere1_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  //////////////////////////////////////
+  // Test when object is in collision
+  //////////////////////////////////////
+  tesseract_common::TransformMap location;
+  location["sphere_link"] = Eigen::Isometry3d::Identity();
+  location["sphere1_link"] = Eigen::Isometry3d::Identity();
+  location["sphere1_link"].translation()(0) = 0.2;
+  checker.setCollisionObjectsTransform(location);
+
+  EXPECT_TRUE(checker.anyContactTest(ContactRequest(ContactTestType::FIRST)));
+
+  ////////////////////////////////////////////////
+  // Test object is out side the contact distance
+  ////////////////////////////////////////////////
+  location["sphere1_link"].translation() = Eigen::Vector3d(1, 0, 0);
+  checker.setCollisionObjectsTransform("sphere1_link", location["sphere1_link"]);
+
+  EXPECT_FALSE(checker.anyContactTest(ContactRequest(ContactTestType::FIRST)));
+
+  /////////////////////////////////////////////
+  // Test object inside the pair contact distance
+  /////////////////////////////////////////////
+  checker.setPairCollisionMarginData("sphere_link", "sphere1_link", 0.52);
+  EXPECT_TRUE(checker.anyContactTest(ContactRequest(ContactTestType::FIRST)));
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::FIRST));
+  EXPECT_FALSE(result.empty());
+
+  /////////////////////////////////////////////
+  // Test the contact result validator is applied
+  /////////////////////////////////////////////
+  ContactRequest request(ContactTestType::FIRST);
+  request.is_valid = [](const ContactResult& contact) { return contact.distance < 0.4; };
+  EXPECT_FALSE(checker.anyContactTest(request));
+
+  request.is_valid = [](const ContactResult& contact) { return contact.distance < 0.6; };
+  EXPECT_TRUE(checker.anyContactTest(request));
+}
+
+inline void runTestPrimitiveBatch(DiscreteContactManager& checker)
+{
+  checker.setActiveCollisionObjects({ "sphere_link", "sphere1_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+  EXPECT_NEAR(checker.getCollisionMarginData().getMaxCollisionMargin(), 0.1, 1e-5);
+
+  std::vector<std::string> names = { "sphere_link", "sphere1_link" };
+  std::vector<tesseract_common::VectorIsometry3d> states(3);
+  states[0] = { Eigen::Isometry3d::Identity(), Eigen::Isometry3d::Identity() };
+  states[0][1].translation() = Eigen::Vector3d(0.2, 0, 0);
+  states[1] = { Eigen::Isometry3d::Identity(), Eigen::Isometry3d::Identity() };
+  states[1][1].translation() = Eigen::Vector3d(1, 0, 0);
+  states[2] = { Eigen::Isometry3d::Identity(), Eigen::Isometry3d::Identity() };
+  states[2][1].translation() = Eigen::Vector3d(0.55, 0, 0);
+
+  // Results should be cleared and resized to the number of states
+  std::vector<ContactResultMap> results(5);
+  checker.contactTest(results, names, states, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_EQ(results.size(), states.size());
+
+  ContactResultVector result_vector;
+  flattenCopyResults(results[0], result_vector);
+  EXPECT_EQ(result_vector.size(), 1);
+  EXPECT_NEAR(result_vector[0].distance, -0.30, 0.0001);
+
+  flattenCopyResults(results[1], result_vector);
+  EXPECT_TRUE(result_vector.empty());
+
+  flattenCopyResults(results[2], result_vector);
+  EXPECT_EQ(result_vector.size(), 1);
+  EXPECT_NEAR(result_vector[0].distance, 0.05, 0.0001);
+
+  // The batch results should match calling contactTest for each state
+  for (std::size_t i = 0; i < states.size(); ++i)
+  {
+    checker.setCollisionObjectsTransform(names, states[i]);
+
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+    ASSERT_EQ(result.size(), results[i].size());
+    for (const auto& pair : result)
+    {
+      auto it = results[i].find(pair.first);
+      ASSERT_TRUE(it != results[i].end());
+      ASSERT_EQ(pair.second.size(), it->second.size());
+      EXPECT_NEAR(pair.second.front().distance, it->second.front().distance, 1e-6);
+    }
+  }
+}
+
+inline void runTestPrimitiveDense(DiscreteContactManager& checker)
+{
+  checker.setActiveCollisionObjects({ "sphere1_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+  checker.setCollisionObjectsTransform("sphere_link", Eigen::Isometry3d::Identity());
+
+  // Unknown links are allowed and are ignored
+  std::vector<std::string> dense_link_names = { "sphere1_link", "missing_link", "sphere_link" };
+  checker.setDenseLinkNames(dense_link_names);
+  EXPECT_EQ(checker.getDenseLinkNames(), dense_link_names);
+
+  tesseract_common::VectorIsometry3d link_transforms(3, Eigen::Isometry3d::Identity());
+  link_transforms[0].translation() = Eigen::Vector3d(0.2, 0, 0);
+  link_transforms[2].translation() = Eigen::Vector3d(5, 0, 0);  // Static so it should not be updated
+
+  checker.setDenseCollisionObjectsTransform(link_transforms);
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+
+  ContactResultVector result_vector;
+  flattenCopyResults(result, result_vector);
+  ASSERT_EQ(result_vector.size(), 1);
+  EXPECT_NEAR(result_vector[0].distance, -0.30, 0.0001);
+
+  // The dense link names should be carried over to the clone
+  DiscreteContactManager::UPtr cloned_checker = checker.clone();
+  EXPECT_EQ(cloned_checker->getDenseLinkNames(), dense_link_names);
+
+  link_transforms[0].translation() = Eigen::Vector3d(1, 0, 0);
+  cloned_checker->setDenseCollisionObjectsTransform(link_transforms);
+
+  result.clear();
+  cloned_checker->contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_TRUE(result.empty());
+}
+
 inline void runTestConvex1(DiscreteContactManager& checker)
 {
   ///////////////////////////////////////////////////////////////////
@@ -411,11 +545,89 @@ inline void runTestConvex3(DiscreteContactManager& checker)
   EXPECT_LT(std::abs(std::acos((idx[2] * result_vector[0].normal).dot(Eigen::Vector3d(0, 1, 0)))), 0.4);
 }
 
+inline double runWarmStartContactTest(DiscreteContactManager& checker, const ContactRequest& request)
+{
+  ContactResultMap result;
+  checker.contactTest(result, request);
+  ContactResultVector result_vector;
+  flattenMoveResults(std::move(result), result_vector);
+  EXPECT_EQ(result_vector.size(), 1);
+  return result_vector.empty() ? std::numeric_limits<double>::max() : result_vector[0].distance;
+}
+
+inline void runTestConvexWarmStart(DiscreteContactManager& checker)
+{
+  checker.setActiveCollisionObjects({ "sphere_link", "sphere1_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.55));
+  checker.setStatisticsEnabled(true);
+
+  tesseract_common::TransformMap location;
+  location["sphere_link"] = Eigen::Isometry3d::Identity();
+  location["sphere1_link"] = Eigen::Isometry3d::Identity();
+
+  ContactRequest request(ContactTestType::CLOSEST);
+  ContactRequest warm_start_request(ContactTestType::CLOSEST);
+  warm_start_request.warm_start = true;
+
+  // Only managers that run GJK and report it use the warm start cache
+  location["sphere1_link"].translation()(0) = 1.0;
+  checker.setCollisionObjectsTransform(location);
+  checker.resetStatistics();
+  runWarmStartContactTest(checker, warm_start_request);
+  bool uses_gjk = checker.getStatisticsEnabled() && checker.getStatistics().gjk_iterations > 0;
+
+  // Warm starting must give the same results as starting from scratch, including after cloning
+  for (double x : { 1.0, 0.99, 0.2, 0.21, 1.0 })
+  {
+    location["sphere1_link"].translation()(0) = x;
+    checker.setCollisionObjectsTransform(location);
+
+    double distance = runWarmStartContactTest(checker, request);
+
+    for (int i = 0; i < 2; ++i)
+    {
+      checker.resetStatistics();
+      EXPECT_NEAR(runWarmStartContactTest(checker, warm_start_request), distance, 1e-4);
+      if (uses_gjk)
+        EXPECT_GT(checker.getStatistics().gjk_warm_starts, 0U);
+    }
+
+    // The clone assigns the same ids, so it keeps using the cache
+    DiscreteContactManager::UPtr cloned_checker = checker.clone();
+    cloned_checker->resetStatistics();
+    EXPECT_NEAR(runWarmStartContactTest(*cloned_checker, warm_start_request), distance, 1e-4);
+    if (uses_gjk)
+      EXPECT_GT(cloned_checker->getStatistics().gjk_warm_starts, 0U);
+  }
+
+  // Removing a collision object clears the cache, even if it is added back with the same id
+  CollisionShapesConst shapes = checker.getCollisionObjectGeometries("sphere1_link");
+  tesseract_common::VectorIsometry3d shape_poses = checker.getCollisionObjectGeometriesTransforms("sphere1_link");
+  double distance = runWarmStartContactTest(checker, request);
+
+  EXPECT_TRUE(checker.removeCollisionObject("sphere1_link"));
+  EXPECT_TRUE(checker.addCollisionObject("sphere1_link", 0, shapes, shape_poses));
+  checker.setActiveCollisionObjects({ "sphere_link", "sphere1_link" });
+  checker.setCollisionObjectsTransform(location);
+
+  checker.resetStatistics();
+  EXPECT_NEAR(runWarmStartContactTest(checker, warm_start_request), distance, 1e-4);
+  EXPECT_EQ(checker.getStatistics().gjk_warm_starts, 0U);
+
+  checker.resetStatistics();
+  EXPECT_NEAR(runWarmStartContactTest(checker, warm_start_request), distance, 1e-4);
+  if (uses_gjk)
+    EXPECT_GT(checker.getStatistics().gjk_warm_starts, 0U);
+
+  checker.setStatisticsEnabled(false);
+}
+
 inline void runTestConvex(DiscreteContactManager& checker)
 {
   runTestConvex1(checker);
   runTestConvex2(checker);
   runTestConvex3(checker);
+  runTestConvexWarmStart(checker);
 }
 }  // namespace detail
 
@@ -427,7 +639,12 @@ inline void runTest(DiscreteContactManager& checker, bool use_convex_mesh)
   if (use_convex_mesh)
     detail::runTestConvex(checker);
   else
+  {
     detail::runTestPrimitive(checker);
+    detail::runTestPrimitiveAnyContact(checker);
+    detail::runTestPrimitiveBatch(checker);
+    detail::runTestPrimitiveDense(checker);
+  }
 }
 }  // namespace tesseract_collision::test_suite
 
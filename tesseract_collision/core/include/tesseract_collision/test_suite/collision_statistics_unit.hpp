@@ -0,0 +1,161 @@
+#ifndef TESSERACT_COLLISION_COLLISION_STATISTICS_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_STATISTICS_UNIT_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision::test_suite
+{
+namespace detail
+{
+template <typename T>
+inline void addStatisticsCollisionObjects(T& checker)
+{
+  // An active sphere overlapping two static spheres, where contact with the second is allowed
+  std::vector<std::pair<std::string, double>> spheres = { { "sphere_link", 0 },
+                                                           { "sphere1_link", 0.3 },
+                                                           { "sphere2_link", -0.3 } };
+  for (const auto& sphere : spheres)
+  {
+    Eigen::Isometry3d sphere_pose;
+    sphere_pose.setIdentity();
+    sphere_pose.translation() = Eigen::Vector3d(sphere.second, 0, 0U);
+
+    CollisionShapesConst shapes;
+    tesseract_common::VectorIsometry3d poses;
+    shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.25));
+    poses.push_back(Eigen::Isometry3d::Identity());
+    checker.addCollisionObject(sphere.first, 0, shapes, poses);
+    checker.setCollisionObjectsTransform(sphere.first, sphere_pose);
+  }
+
+  checker.setActiveCollisionObjects({ "sphere_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+  checker.setIsContactAllowedFn([](const std::string& name1, const std::string& name2) {
+    return (name1 == "sphere2_link" || name2 == "sphere2_link");
+  });
+}
+
+inline void checkStatistics(const ContactTestStatistics& statistics, std::size_t contact_tests)
+{
+  EXPECT_EQ(statistics.contact_tests, contact_tests);
+  EXPECT_EQ(statistics.broadphase_pairs, 2 * contact_tests);
+  EXPECT_EQ(statistics.rejected_pairs, contact_tests);
+  EXPECT_GE(statistics.contacts, contact_tests);
+  EXPECT_EQ(statistics.getNarrowphaseCalls(), contact_tests);
+  EXPECT_EQ(statistics.getNarrowphaseCalls(tesseract_geometry::GeometryType::SPHERE,
+                                           tesseract_geometry::GeometryType::SPHERE),
+            contact_tests);
+}
+
+inline void checkEmptyStatistics(const ContactTestStatistics& statistics)
+{
+  EXPECT_EQ(statistics.contact_tests, 0U);
+  EXPECT_EQ(statistics.broadphase_pairs, 0U);
+  EXPECT_EQ(statistics.rejected_pairs, 0U);
+  EXPECT_EQ(statistics.contacts, 0U);
+  EXPECT_EQ(statistics.gjk_iterations, 0U);
+  EXPECT_EQ(statistics.gjk_warm_starts, 0U);
+  EXPECT_EQ(statistics.penetration_depth_calls, 0U);
+  EXPECT_EQ(statistics.getNarrowphaseCalls(), 0U);
+  EXPECT_EQ(statistics.broadphase_time.count(), 0);
+  EXPECT_EQ(statistics.narrowphase_time.count(), 0);
+}
+}  // namespace detail
+
+/**
+ * @brief Check a contact manager that does not collect statistics reports them as disabled and leaves them empty
+ * @param checker The contact manager
+ */
+template <typename T>
+inline void runUnsupportedTest(T& checker)
+{
+  detail::addStatisticsCollisionObjects(checker);
+
+  checker.setStatisticsEnabled(true);
+  EXPECT_FALSE(checker.getStatisticsEnabled());
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  detail::checkEmptyStatistics(checker.getStatistics());
+}
+
+inline void runTest(DiscreteContactManager& checker)
+{
+  detail::addStatisticsCollisionObjects(checker);
+
+  // Statistics are not collected by default
+  EXPECT_FALSE(checker.getStatisticsEnabled());
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  EXPECT_EQ(result.size(), 1U);
+  detail::checkEmptyStatistics(checker.getStatistics());
+
+  checker.setStatisticsEnabled(true);
+  EXPECT_TRUE(checker.getStatisticsEnabled());
+  for (std::size_t i = 1; i <= 2; ++i)
+  {
+    result.clear();
+    checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+    EXPECT_EQ(result.size(), 1U);
+    detail::checkStatistics(checker.getStatistics(), i);
+  }
+
+  // The clone collects statistics but starts from zero
+  DiscreteContactManager::UPtr cloned_checker = checker.clone();
+  EXPECT_TRUE(cloned_checker->getStatisticsEnabled());
+  detail::checkEmptyStatistics(cloned_checker->getStatistics());
+
+  checker.resetStatistics();
+  detail::checkEmptyStatistics(checker.getStatistics());
+
+  checker.setStatisticsEnabled(false);
+  result.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  detail::checkEmptyStatistics(checker.getStatistics());
+}
+
+inline void runTest(ContinuousContactManager& checker)
+{
+  detail::addStatisticsCollisionObjects(checker);
+
+  Eigen::Isometry3d start_pose, end_pose;
+  start_pose.setIdentity();
+  start_pose.translation() = Eigen::Vector3d(0, -0.5, 0U);
+  end_pose.setIdentity();
+  end_pose.translation() = Eigen::Vector3d(0, 0.5, 0U);
+  checker.setCollisionObjectsTransform("sphere_link", start_pose, end_pose);
+
+  // Statistics are not collected by default
+  EXPECT_FALSE(checker.getStatisticsEnabled());
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  EXPECT_EQ(result.size(), 1U);
+  detail::checkEmptyStatistics(checker.getStatistics());
+
+  checker.setStatisticsEnabled(true);
+  EXPECT_TRUE(checker.getStatisticsEnabled());
+  for (std::size_t i = 1; i <= 2; ++i)
+  {
+    result.clear();
+    checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+    EXPECT_EQ(result.size(), 1U);
+    detail::checkStatistics(checker.getStatistics(), i);
+  }
+
+  // The clone collects statistics but starts from zero
+  ContinuousContactManager::UPtr cloned_checker = checker.clone();
+  EXPECT_TRUE(cloned_checker->getStatisticsEnabled());
+  detail::checkEmptyStatistics(cloned_checker->getStatistics());
+
+  checker.resetStatistics();
+  detail::checkEmptyStatistics(checker.getStatistics());
+
+  checker.setStatisticsEnabled(false);
+  result.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  detail::checkEmptyStatistics(checker.getStatistics());
+}
+}  // namespace tesseract_collision::test_suite
+
+#endif  // TESSERACT_COLLISION_COLLISION_STATISTICS_UNIT_HPP
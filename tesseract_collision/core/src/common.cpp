@@ -31,6 +31,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <fstream>
 #include <iostream>
 #include <iomanip>
+#include <typeinfo>
 #include <boost/algorithm/string.hpp>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
@@ -109,21 +110,187 @@ bool isContactAllowed(const std::string& name1, const std::string& name2, const
   return false;
 }
 
+bool isContactAllowed(const std::string& name1,
+                      long link_id1,
+                      const std::string& name2,
+                      long link_id2,
+                      const ContactTestData& cdata,
+                      bool verbose)
+{
+  if (cdata.compiled_acm == nullptr)
+    return isContactAllowed(name1, name2, cdata.fn, verbose);
+
+  // do not distance check geoms part of the same object / link / attached body
+  if (name1 == name2)
+    return true;
+
+  if (cdata.compiled_acm->isCollisionAllowed(link_id1, link_id2))
+  {
+    if (verbose)
+    {
+      CONSOLE_BRIDGE_logError(
+          "Collision between '%s' and '%s' is allowed. No contacts are computed.", name1.c_str(), name2.c_str());
+    }
+    return true;
+  }
+
+  if (verbose)
+  {
+    CONSOLE_BRIDGE_logError("Actually checking collisions between %s and %s", name1.c_str(), name2.c_str());
+  }
+
+  return false;
+}
+
+const tesseract_common::CompiledAllowedCollisionMatrix* getCompiledAllowedCollisionMatrix(const IsContactAllowedFn& fn)
+{
+  const auto* acm_fn = fn.target<AllowedCollisionMatrixFn>();
+  if (acm_fn == nullptr || acm_fn->acm == nullptr)
+    return nullptr;
+
+  // A derived allowed collision matrix may override isCollisionAllowed, which the compiled form does not reflect
+  if (typeid(*acm_fn->acm) != typeid(tesseract_common::AllowedCollisionMatrix))
+    return nullptr;
+
+  return &acm_fn->acm->getCompiledAllowedCollisionMatrix();
+}
+
+bool isContactLimitReached(const ContactTestData& cdata, std::size_t num_contacts)
+{
+  return (cdata.req.type == ContactTestType::LIMITED && cdata.req.contact_limit > 0 &&
+          num_contacts >= static_cast<std::size_t>(cdata.req.contact_limit));
+}
+
 ContactResult* processResult(ContactTestData& cdata,
                              ContactResult& contact,
                              const std::pair<std::string, std::string>& key,
                              bool found)
+{
+  return processResult(cdata, contact, key, found, -1, -1);
+}
+
+bool processAnyContact(ContactTestData& cdata,
+                       double distance,
+                       const std::string& name1,
+                       const std::string& name2,
+                       int object_id1,
+                       int object_id2)
+{
+  assert(cdata.res == nullptr && cdata.compact_res == nullptr);
+  assert(!cdata.req.is_valid);
+  if (cdata.req.calculate_distance || cdata.req.calculate_penetration)
+  {
+    const CollisionMarginTable* table = cdata.collision_margin_table;
+    double margin{ 0 };
+    if (table != nullptr && object_id1 >= 0 && object_id1 < table->size() && object_id2 >= 0 &&
+        object_id2 < table->size())
+      margin = table->getPairCollisionMargin(object_id1, object_id2);
+    else
+      margin = cdata.collision_margin_data.getPairCollisionMargin(name1, name2);
+
+    if (distance > margin)
+      return false;
+  }
+
+  if (cdata.statistics != nullptr)
+    ++cdata.statistics->contacts;
+
+  cdata.done = true;
+  return true;
+}
+
+bool processCompactResult(ContactTestData& cdata,
+                          const CompactContactResult& contact,
+                          const std::string& name1,
+                          const std::string& name2)
+{
+  assert(cdata.compact_res != nullptr);
+  assert(!cdata.req.is_valid);
+  if (cdata.req.calculate_distance || cdata.req.calculate_penetration)
+  {
+    const CollisionMarginTable* table = cdata.collision_margin_table;
+    double margin{ 0 };
+    if (table != nullptr && contact.object_id[0] < table->size() && contact.object_id[1] < table->size())
+      margin = table->getPairCollisionMargin(contact.object_id[0], contact.object_id[1]);
+    else
+      margin = cdata.collision_margin_data.getPairCollisionMargin(name1, name2);
+
+    if (contact.distance > margin)
+      return false;
+  }
+
+  if (cdata.statistics != nullptr)
+    ++cdata.statistics->contacts;
+
+  if (!cdata.compact_res->addContact(contact, cdata.req.type, cdata.req.contact_limit))
+    return false;
+
+  if (cdata.req.type == ContactTestType::FIRST || isContactLimitReached(cdata, cdata.compact_res->size()))
+    cdata.done = true;
+
+  return true;
+}
+
+double getPairCollisionMargin(const ContactTestData& cdata,
+                              const std::pair<std::string, std::string>& key,
+                              int object_id1,
+                              int object_id2)
+{
+  const CollisionMarginTable* table = cdata.collision_margin_table;
+  if (table != nullptr && object_id1 >= 0 && object_id1 < table->size() && object_id2 >= 0 &&
+      object_id2 < table->size())
+    return table->getPairCollisionMargin(object_id1, object_id2);
+
+  return cdata.collision_margin_data.getPairCollisionMargin(key.first, key.second);
+}
+
+ContactResult* processResult(ContactTestData& cdata,
+                             ContactResult& contact,
+                             const std::pair<std::string, std::string>& key,
+                             bool found,
+                             int object_id1,
+                             int object_id2)
 {
   if (cdata.req.is_valid && !cdata.req.is_valid(contact))
     return nullptr;
 
   if ((cdata.req.calculate_distance || cdata.req.calculate_penetration) &&
-      (contact.distance > cdata.collision_margin_data.getPairCollisionMargin(key.first, key.second)))
+      (contact.distance > getPairCollisionMargin(cdata, key, object_id1, object_id2)))
     return nullptr;
 
+  if (cdata.statistics != nullptr)
+    ++cdata.statistics->contacts;
+
+  // Storing compact contact results, so the contact is converted and no ContactResult is returned
+  if (cdata.compact_res != nullptr)
+  {
+    assert(object_id1 >= 0 && object_id2 >= 0);
+    CompactContactResult compact_contact;
+    compact_contact.distance = contact.distance;
+    compact_contact.object_id = { object_id1, object_id2 };
+    compact_contact.shape_id = contact.shape_id;
+    compact_contact.subshape_id = contact.subshape_id;
+    compact_contact.normal = contact.normal;
+    compact_contact.nearest_points = contact.nearest_points;
+    if (cdata.compact_res->addContact(compact_contact, cdata.req.type, cdata.req.contact_limit) &&
+        (cdata.req.type == ContactTestType::FIRST || isContactLimitReached(cdata, cdata.compact_res->size())))
+      cdata.done = true;
+
+    return nullptr;
+  }
+
+  // Only checking if any contact exists, so nothing is stored
+  if (cdata.res == nullptr)
+  {
+    cdata.done = true;
+    return nullptr;
+  }
+
   if (!found)
   {
-    ContactResultVector data;
+    auto it = (cdata.res_pool != nullptr) ? cdata.res_pool->insert(*cdata.res, key) :
+                                            cdata.res->emplace(key, ContactResultVector()).first;
+    ContactResultVector& data = it->second;
     if (cdata.req.type == ContactTestType::FIRST)
     {
       data.emplace_back(contact);
@@ -131,11 +298,15 @@ ContactResult* processResult(ContactTestData& cdata,
     }
     else
     {
-      data.reserve(100);  // TODO: Need better way to initialize this
+      // Vectors reused from the pool keep their storage
       data.emplace_back(contact);
+
+      // LIMITED only stores the first contact of each pair, so there is one contact per entry
+      if (isContactLimitReached(cdata, cdata.res->size()))
+        cdata.done = true;
     }
 
-    return &(cdata.res->insert(std::make_pair(key, data)).first->second.back());
+    return &(data.back());
   }
 
   assert(cdata.req.type != ContactTestType::FIRST);
@@ -183,6 +354,23 @@ void scaleVertices(tesseract_common::VectorVector3d& vertices, const Eigen::Vect
   scaleVertices(vertices, center, scale);
 }
 
+void applyOctreeDelta(octomap::OcTree& octree, const OctreeDelta& delta)
+{
+  for (const auto& voxel : delta.occupied)
+    octree.setNodeValue(voxel.x(), voxel.y(), voxel.z(), octree.getClampingThresMaxLog());
+
+  for (const auto& voxel : delta.free)
+    octree.setNodeValue(voxel.x(), voxel.y(), voxel.z(), octree.getClampingThresMinLog());
+}
+
+tesseract_geometry::Octree::Ptr applyOctreeDelta(const tesseract_geometry::Octree& octree, const OctreeDelta& delta)
+{
+  auto ot = std::make_shared<octomap::OcTree>(*octree.getOctree());
+  applyOctreeDelta(*ot, delta);
+  return std::make_shared<tesseract_geometry::Octree>(
+      ot, octree.getSubType(), octree.getMergeOccupiedNodes(), octree.getMaxCollisionDepth());
+}
+
 bool writeSimplePlyFile(const std::string& path,
                         const tesseract_common::VectorVector3d& vertices,
                         const std::vector<Eigen::Vector3i>& vectices_color,
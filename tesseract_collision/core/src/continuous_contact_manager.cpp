@@ -24,6 +24,11 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_collision/core/discrete_contact_manager.h>
 #include <tesseract_collision/core/utils.h>
 
@@ -35,4 +40,66 @@ void ContinuousContactManager::applyContactManagerConfig(const ContactManagerCon
   applyIsContactAllowedFnOverride(*this, config.acm, config.acm_override_type);
   applyModifyObjectEnabled(*this, config.modify_object_enabled);
 }
+
+bool ContinuousContactManager::updateCollisionObjectOctree(const std::string& /*name*/,
+                                                           std::size_t /*shape_index*/,
+                                                           const tesseract_geometry::Octree::ConstPtr& /*octree*/,
+                                                           const OctreeDelta& /*delta*/)
+{
+  return false;
+}
+
+void ContinuousContactManager::setDenseLinkNames(const std::vector<std::string>& link_names)
+{
+  dense_link_names_ = link_names;
+}
+
+const std::vector<std::string>& ContinuousContactManager::getDenseLinkNames() const { return dense_link_names_; }
+
+void ContinuousContactManager::setDenseCollisionObjectsTransform(const tesseract_common::VectorIsometry3d& pose1,
+                                                                 const tesseract_common::VectorIsometry3d& pose2)
+{
+  assert(pose1.size() == dense_link_names_.size());
+  assert(pose2.size() == dense_link_names_.size());
+  for (const auto& link_name : getActiveCollisionObjects())
+  {
+    auto it = std::find(dense_link_names_.begin(), dense_link_names_.end(), link_name);
+    if (it != dense_link_names_.end())
+    {
+      auto idx = static_cast<std::size_t>(it - dense_link_names_.begin());
+      setCollisionObjectsTransform(link_name, pose1[idx], pose2[idx]);
+    }
+  }
+}
+
+void ContinuousContactManager::contactTest(CompactContactResults& collisions, const ContactRequest& request)
+{
+  ContactResultMap results;
+  contactTest(results, request);
+  flattenCompactResults(results, std::make_shared<const std::vector<std::string>>(getCollisionObjects()), collisions);
+  clearContactResults(results);
+}
+
+void ContinuousContactManager::clearContactResults(ContactResultMap& collisions)
+{
+  contact_result_map_pool_.recycle(collisions);
+}
+
+bool ContinuousContactManager::anyContactTest(const ContactRequest& request)
+{
+  ContactRequest first_request(request);
+  first_request.type = ContactTestType::FIRST;
+
+  ContactResultMap collisions;
+  contactTest(collisions, first_request);
+  return !collisions.empty();
+}
+
+void ContinuousContactManager::setStatisticsEnabled(bool /*enabled*/) {}
+
+bool ContinuousContactManager::getStatisticsEnabled() const { return statistics_enabled_; }
+
+const ContactTestStatistics& ContinuousContactManager::getStatistics() const { return statistics_; }
+
+void ContinuousContactManager::resetStatistics() { statistics_.clear(); }
 }  // namespace tesseract_collision
@@ -24,15 +24,194 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <utility>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_collision/core/discrete_contact_manager.h>
 #include <tesseract_collision/core/utils.h>
+#include <tesseract_geometry/impl/sphere.h>
 
 namespace tesseract_collision
 {
+namespace
+{
+/** @brief Calls a function when it goes out of scope, so the contact manager state is restored if a test throws */
+template <typename Fn>
+class ScopeExit
+{
+public:
+  explicit ScopeExit(Fn fn) : fn_(std::move(fn)) {}
+  ~ScopeExit() { fn_(); }
+  ScopeExit(const ScopeExit&) = delete;
+  ScopeExit& operator=(const ScopeExit&) = delete;
+  ScopeExit(ScopeExit&&) = delete;
+  ScopeExit& operator=(ScopeExit&&) = delete;
+
+private:
+  Fn fn_;
+};
+}  // namespace
+
 void DiscreteContactManager::applyContactManagerConfig(const ContactManagerConfig& config)
 {
   setCollisionMarginData(config.margin_data, config.margin_data_override_type);
   applyIsContactAllowedFnOverride(*this, config.acm, config.acm_override_type);
   applyModifyObjectEnabled(*this, config.modify_object_enabled);
 }
+
+void DiscreteContactManager::setDenseLinkNames(const std::vector<std::string>& link_names)
+{
+  dense_link_names_ = link_names;
+}
+
+const std::vector<std::string>& DiscreteContactManager::getDenseLinkNames() const { return dense_link_names_; }
+
+void DiscreteContactManager::setDenseCollisionObjectsTransform(
+    const tesseract_common::VectorIsometry3d& link_transforms)
+{
+  assert(link_transforms.size() == dense_link_names_.size());
+  for (const auto& link_name : getActiveCollisionObjects())
+  {
+    auto it = std::find(dense_link_names_.begin(), dense_link_names_.end(), link_name);
+    if (it != dense_link_names_.end())
+      setCollisionObjectsTransform(link_name,
+                                   link_transforms[static_cast<std::size_t>(it - dense_link_names_.begin())]);
+  }
+}
+
+void DiscreteContactManager::contactTest(std::vector<ContactResultMap>& collisions,
+                                         const std::vector<std::string>& names,
+                                         const std::vector<tesseract_common::VectorIsometry3d>& states,
+                                         const ContactRequest& request)
+{
+  collisions.resize(states.size());
+  for (std::size_t i = 0; i < states.size(); ++i)
+  {
+    assert(states[i].size() == names.size());
+    setCollisionObjectsTransform(names, states[i]);
+
+    clearContactResults(collisions[i]);
+    contactTest(collisions[i], request);
+  }
+}
+
+void DiscreteContactManager::contactTest(ContactResultMap& collisions,
+                                         const std::vector<std::string>& query_objects,
+                                         const ContactRequest& request)
+{
+  std::vector<std::string> active = getActiveCollisionObjects();
+  ScopeExit restore_active([this, &active]() { setActiveCollisionObjects(active); });
+  setActiveCollisionObjects(query_objects);
+  contactTest(collisions, request);
+}
+
+void DiscreteContactManager::pointContactTest(PointContactResultVector& results,
+                                              const Eigen::Ref<const Eigen::Matrix3Xd>& points,
+                                              double contact_distance)
+{
+  results.clear();
+  if (points.cols() == 0)
+    return;
+
+  const std::string point_object_name = "__tesseract_point_contact_test__";
+  auto point_shape = std::make_shared<tesseract_geometry::Sphere>(0.0);
+  CollisionShapesConst shapes(static_cast<std::size_t>(points.cols()), point_shape);
+  tesseract_common::VectorIsometry3d shape_poses(shapes.size(), Eigen::Isometry3d::Identity());
+  for (std::size_t i = 0; i < shape_poses.size(); ++i)
+    shape_poses[i].translation() = points.col(static_cast<Eigen::Index>(i));
+
+  // The points are added to a clone so the collision objects and margins of this manager are left unchanged
+  DiscreteContactManager::UPtr manager = clone();
+  if (!manager->addCollisionObject(point_object_name, 0, shapes, shape_poses))
+    return;
+
+  // Each point shape is checked using the contact distance as the margin
+  ContactResultMap collisions;
+  manager->setCollisionMarginData(CollisionMarginData(contact_distance));
+  manager->contactTest(collisions, std::vector<std::string>{ point_object_name }, ContactRequest(ContactTestType::ALL));
+
+  const std::vector<std::string>& active = getActiveCollisionObjects();
+  PointContactResultVector closest(shapes.size());
+  for (const auto& pair : collisions)
+  {
+    for (const auto& contact : pair.second)
+    {
+      std::size_t point = (contact.link_names[0] == point_object_name) ? 0 : 1;
+      std::size_t link = 1 - point;
+      if (std::find(active.begin(), active.end(), contact.link_names[link]) == active.end())
+        continue;
+
+      PointContactResult& result = closest[static_cast<std::size_t>(contact.shape_id[point])];
+      if (contact.distance >= result.distance)
+        continue;
+
+      result.distance = contact.distance;
+      result.link_name = contact.link_names[link];
+      result.shape_id = contact.shape_id[link];
+      result.subshape_id = contact.subshape_id[link];
+      result.nearest_point = contact.nearest_points[link];
+    }
+  }
+  manager->clearContactResults(collisions);
+
+  for (std::size_t i = 0; i < closest.size(); ++i)
+  {
+    if (closest[i].link_name.empty())
+      continue;
+
+    closest[i].point_index = i;
+    results.push_back(closest[i]);
+  }
+}
+
+void DiscreteContactManager::pointContactTest(PointContactResultVector& results,
+                                              const tesseract_common::VectorVector3d& points,
+                                              double contact_distance)
+{
+  Eigen::Map<const Eigen::Matrix3Xd> point_matrix(
+      points.empty() ? nullptr : points.front().data(), 3, static_cast<Eigen::Index>(points.size()));
+  pointContactTest(results, point_matrix, contact_distance);
+}
+
+void DiscreteContactManager::contactTest(CompactContactResults& collisions, const ContactRequest& request)
+{
+  ContactResultMap results;
+  contactTest(results, request);
+  flattenCompactResults(results, std::make_shared<const std::vector<std::string>>(getCollisionObjects()), collisions);
+  clearContactResults(results);
+}
+
+void DiscreteContactManager::clearContactResults(ContactResultMap& collisions)
+{
+  contact_result_map_pool_.recycle(collisions);
+}
+
+bool DiscreteContactManager::anyContactTest(const ContactRequest& request)
+{
+  ContactRequest first_request(request);
+  first_request.type = ContactTestType::FIRST;
+
+  ContactResultMap collisions;
+  contactTest(collisions, first_request);
+  return !collisions.empty();
+}
+
+bool DiscreteContactManager::updateCollisionObjectOctree(const std::string& /*name*/,
+                                                         std::size_t /*shape_index*/,
+                                                         const tesseract_geometry::Octree::ConstPtr& /*octree*/,
+                                                         const OctreeDelta& /*delta*/)
+{
+  return false;
+}
+
+void DiscreteContactManager::setStatisticsEnabled(bool /*enabled*/) {}
+
+bool DiscreteContactManager::getStatisticsEnabled() const { return statistics_enabled_; }
+
+const ContactTestStatistics& DiscreteContactManager::getStatistics() const { return statistics_; }
+
+void DiscreteContactManager::resetStatistics() { statistics_.clear(); }
 }  // namespace tesseract_collision
@@ -24,6 +24,12 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <iterator>
+#include <numeric>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_collision/core/types.h>
 
 namespace tesseract_collision
@@ -77,6 +83,230 @@ std::size_t flattenCopyResults(const ContactResultMap& m, ContactResultVector& v
   return v.size();
 }
 
+ContactResultMapPool::ContactResultMapPool(std::size_t capacity) : capacity_(capacity) {}
+
+void ContactResultMapPool::recycle(ContactResultMap& m)
+{
+  while (!m.empty() && nodes_.size() < capacity_)
+  {
+    ContactResultMap::node_type node = m.extract(m.begin());
+    node.mapped().clear();
+    // If the pool already holds this pair the node is dropped
+    nodes_.insert(std::move(node));
+  }
+  m.clear();
+}
+
+ContactResultMap::iterator ContactResultMapPool::insert(ContactResultMap& m,
+                                                        const std::pair<std::string, std::string>& key)
+{
+  assert(m.find(key) == m.end());
+  if (nodes_.empty())
+    return m.emplace(key, ContactResultVector()).first;
+
+  auto it = nodes_.find(key);
+  if (it != nodes_.end())
+    return m.insert(nodes_.extract(it)).position;
+
+  ContactResultMap::node_type node = nodes_.extract(nodes_.begin());
+  node.key() = key;
+  return m.insert(std::move(node)).position;
+}
+
+std::size_t ContactResultMapPool::size() const { return nodes_.size(); }
+
+std::size_t ContactResultMapPool::getCapacity() const { return capacity_; }
+
+void ContactResultMapPool::setCapacity(std::size_t capacity)
+{
+  capacity_ = capacity;
+  while (nodes_.size() > capacity_)
+    nodes_.erase(std::prev(nodes_.end()));
+}
+
+void ContactResultMapPool::shrink()
+{
+  for (auto& node : nodes_)
+    node.second.shrink_to_fit();
+}
+
+void ContactResultMapPool::clear() { nodes_.clear(); }
+
+void CompactContactResults::clear()
+{
+  contacts_.clear();
+  pair_index_.clear();
+}
+
+void CompactContactResults::reserve(std::size_t capacity) { contacts_.reserve(capacity); }
+
+std::size_t CompactContactResults::size() const { return contacts_.size(); }
+
+bool CompactContactResults::empty() const { return contacts_.empty(); }
+
+const CompactContactResult& CompactContactResults::operator[](std::size_t index) const { return contacts_[index]; }
+
+CompactContactResults::const_iterator CompactContactResults::begin() const { return contacts_.begin(); }
+
+CompactContactResults::const_iterator CompactContactResults::end() const { return contacts_.end(); }
+
+const std::string& CompactContactResults::getObjectName(int object_id) const
+{
+  return object_names_->at(static_cast<std::size_t>(object_id));
+}
+
+ContactResult CompactContactResults::getContactResult(std::size_t index) const
+{
+  const CompactContactResult& contact = contacts_.at(index);
+
+  ContactResult result;
+  result.distance = contact.distance;
+  result.link_names[0] = getObjectName(contact.object_id[0]);
+  result.link_names[1] = getObjectName(contact.object_id[1]);
+  result.shape_id = contact.shape_id;
+  result.subshape_id = contact.subshape_id;
+  result.normal = contact.normal;
+  result.nearest_points = contact.nearest_points;
+  return result;
+}
+
+void CompactContactResults::setObjectNames(std::shared_ptr<const std::vector<std::string>> object_names)
+{
+  object_names_ = std::move(object_names);
+}
+
+bool CompactContactResults::addContact(const CompactContactResult& contact, ContactTestType type, long contact_limit)
+{
+  if (type == ContactTestType::ALL)
+  {
+    contacts_.push_back(contact);
+    return true;
+  }
+
+  if (type == ContactTestType::LIMITED && contact_limit > 0 &&
+      contacts_.size() >= static_cast<std::size_t>(contact_limit))
+    return false;
+
+  auto id1 = static_cast<std::uint32_t>(std::min(contact.object_id[0], contact.object_id[1]));
+  auto id2 = static_cast<std::uint32_t>(std::max(contact.object_id[0], contact.object_id[1]));
+  auto it = pair_index_.try_emplace((static_cast<std::uint64_t>(id1) << 32U) | id2, contacts_.size());
+  if (it.second)
+  {
+    contacts_.push_back(contact);
+    return true;
+  }
+
+  if (type == ContactTestType::CLOSEST && contact.distance < contacts_[it.first->second].distance)
+  {
+    contacts_[it.first->second] = contact;
+    return true;
+  }
+
+  return false;
+}
+
+std::size_t flattenCompactResults(const ContactResultMap& m,
+                                  std::shared_ptr<const std::vector<std::string>> object_names,
+                                  CompactContactResults& v)
+{
+  v.clear();
+
+  std::unordered_map<std::string, int> object_ids;
+  object_ids.reserve(object_names->size());
+  for (std::size_t i = 0; i < object_names->size(); ++i)
+    object_ids[(*object_names)[i]] = static_cast<int>(i);
+
+  for (const auto& mv : m)
+  {
+    for (const auto& result : mv.second)
+    {
+      CompactContactResult contact;
+      contact.distance = result.distance;
+      contact.object_id[0] = object_ids.at(result.link_names[0]);
+      contact.object_id[1] = object_ids.at(result.link_names[1]);
+      contact.shape_id = result.shape_id;
+      contact.subshape_id = result.subshape_id;
+      contact.normal = result.normal;
+      contact.nearest_points = result.nearest_points;
+      v.addContact(contact, ContactTestType::ALL);
+    }
+  }
+
+  v.setObjectNames(std::move(object_names));
+  return v.size();
+}
+
+void CollisionMarginTable::update(const CollisionMarginData& collision_margin_data,
+                                  const std::vector<std::string>& object_names)
+{
+  num_objects_ = static_cast<int>(object_names.size());
+  object_names_ = std::make_shared<const std::vector<std::string>>(object_names);
+  default_collision_margin_ = collision_margin_data.getDefaultCollisionMargin();
+  max_collision_margin_ = collision_margin_data.getMaxCollisionMargin();
+  pair_margins_.clear();
+
+  const PairsCollisionMarginData& pair_margins = collision_margin_data.getPairCollisionMargins();
+  if (pair_margins.empty())
+    return;
+
+  std::unordered_map<std::string, int> object_ids;
+  object_ids.reserve(object_names.size());
+  for (std::size_t i = 0; i < object_names.size(); ++i)
+    object_ids[object_names[i]] = static_cast<int>(i);
+
+  for (const auto& pair_margin : pair_margins)
+  {
+    auto it1 = object_ids.find(pair_margin.first.first);
+    auto it2 = object_ids.find(pair_margin.first.second);
+    if (it1 == object_ids.end() || it2 == object_ids.end())
+      continue;
+
+    pair_margins_[getPairKey(it1->second, it2->second)] = pair_margin.second;
+  }
+}
+
+std::size_t ContactTestStatistics::getNarrowphaseCalls(tesseract_geometry::GeometryType type1,
+                                                      tesseract_geometry::GeometryType type2) const
+{
+  if (type1 > type2)
+    std::swap(type1, type2);
+
+  return narrowphase_calls[static_cast<std::size_t>(type1)][static_cast<std::size_t>(type2)];
+}
+
+std::size_t ContactTestStatistics::getNarrowphaseCalls() const
+{
+  std::size_t calls{ 0 };
+  for (const auto& row : narrowphase_calls)
+    calls = std::accumulate(row.begin(), row.end(), calls);
+
+  return calls;
+}
+
+void ContactTestStatistics::clear()
+{
+  contact_tests = 0;
+  broadphase_pairs = 0;
+  rejected_pairs = 0;
+  narrowphase_calls = {};
+  gjk_iterations = 0;
+  gjk_warm_starts = 0;
+  penetration_depth_calls = 0;
+  contacts = 0;
+  broadphase_time = std::chrono::nanoseconds(0);
+  narrowphase_time = std::chrono::nanoseconds(0);
+}
+
+AllowedCollisionMatrixFn::AllowedCollisionMatrixFn(std::shared_ptr<const tesseract_common::AllowedCollisionMatrix> acm)
+  : acm(std::move(acm))
+{
+}
+
+bool AllowedCollisionMatrixFn::operator()(const std::string& link_name1, const std::string& link_name2) const
+{
+  return acm->isCollisionAllowed(link_name1, link_name2);
+}
+
 ContactTestData::ContactTestData(const std::vector<std::string>& active,
                                  CollisionMarginData collision_margin_data,
                                  IsContactAllowedFn fn,
@@ -0,0 +1,631 @@
+/**
+ * @file voxel_utils.cpp
+ * @brief Utilities for voxelizing collision shapes and approximating them by spheres
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, agent
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/voxel_utils.h>
+
+namespace tesseract_collision
+{
+static double boxSignedDistance(const Eigen::Vector3d& half_extents, const Eigen::Vector3d& point)
+{
+  Eigen::Vector3d q = point.cwiseAbs() - half_extents;
+  return q.cwiseMax(0.0).norm() + std::min(q.maxCoeff(), 0.0);
+}
+
+static double cylinderSignedDistance(double radius, double half_length, const Eigen::Vector3d& point)
+{
+  Eigen::Vector2d q(point.head<2>().norm() - radius, std::abs(point.z()) - half_length);
+  return q.cwiseMax(0.0).norm() + std::min(q.maxCoeff(), 0.0);
+}
+
+static double capsuleSignedDistance(double radius, double half_length, const Eigen::Vector3d& point)
+{
+  Eigen::Vector3d q(point.x(), point.y(), point.z() - std::clamp(point.z(), -half_length, half_length));
+  return q.norm() - radius;
+}
+
+static double coneSignedDistance(double radius, double half_length, const Eigen::Vector3d& point)
+{
+  // The cone is symmetric about its axis, so the distance is the distance to its triangular cross section in the plane
+  // containing the axis and the point. The apex is at +z like FCL and Bullet.
+  const std::array<Eigen::Vector2d, 3> vertices{ Eigen::Vector2d(-radius, -half_length),
+                                                 Eigen::Vector2d(radius, -half_length),
+                                                 Eigen::Vector2d(0, half_length) };
+  Eigen::Vector2d q(point.head<2>().norm(), point.z());
+
+  double distance = std::numeric_limits<double>::max();
+  bool inside = true;
+  for (std::size_t i = 0; i < vertices.size(); ++i)
+  {
+    const Eigen::Vector2d& a = vertices[i];
+    Eigen::Vector2d e = vertices[(i + 1) % vertices.size()] - a;
+    Eigen::Vector2d w = q - a;
+    double t = std::clamp(w.dot(e) / e.squaredNorm(), 0.0, 1.0);
+    distance = std::min(distance, (w - (t * e)).norm());
+
+    // The vertices are counter clockwise so the point is inside if it is left of every edge
+    if (((e.x() * w.y()) - (e.y() * w.x())) < 0)
+      inside = false;
+  }
+
+  return (inside) ? -distance : distance;
+}
+
+Eigen::Vector3d closestPointOnTriangle(const Eigen::Vector3d& p,
+                                       const Eigen::Vector3d& a,
+                                       const Eigen::Vector3d& b,
+                                       const Eigen::Vector3d& c)
+{
+  Eigen::Vector3d ab = b - a;
+  Eigen::Vector3d ac = c - a;
+  Eigen::Vector3d ap = p - a;
+  double d1 = ab.dot(ap);
+  double d2 = ac.dot(ap);
+  if (d1 <= 0 && d2 <= 0)
+    return a;
+
+  Eigen::Vector3d bp = p - b;
+  double d3 = ab.dot(bp);
+  double d4 = ac.dot(bp);
+  if (d3 >= 0 && d4 <= d3)
+    return b;
+
+  double vc = (d1 * d4) - (d3 * d2);
+  if (vc <= 0 && d1 >= 0 && d3 <= 0)
+    return a + ((d1 / (d1 - d3)) * ab);
+
+  Eigen::Vector3d cp = p - c;
+  double d5 = ab.dot(cp);
+  double d6 = ac.dot(cp);
+  if (d6 >= 0 && d5 <= d6)
+    return c;
+
+  double vb = (d5 * d2) - (d1 * d6);
+  if (vb <= 0 && d2 >= 0 && d6 <= 0)
+    return a + ((d2 / (d2 - d6)) * ac);
+
+  double va = (d3 * d6) - (d5 * d4);
+  if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0)
+    return b + (((d4 - d3) / ((d4 - d3) + (d5 - d6))) * (c - b));
+
+  double denom = 1.0 / (va + vb + vc);
+  return a + (ab * (vb * denom)) + (ac * (vc * denom));
+}
+
+double getOctreeLeafSignedDistance(tesseract_geometry::Octree::SubType sub_type,
+                                   double size,
+                                   const Eigen::Vector3d& point)
+{
+  switch (sub_type)
+  {
+    case tesseract_geometry::Octree::SubType::SPHERE_INSIDE:
+      return point.norm() - (size / 2.0);
+    case tesseract_geometry::Octree::SubType::SPHERE_OUTSIDE:
+      return point.norm() - std::sqrt(2 * ((size / 2) * (size / 2)));
+    default:
+      return boxSignedDistance(Eigen::Vector3d::Constant(size / 2.0), point);
+  }
+}
+
+double getOctreeLeafBoundingRadius(tesseract_geometry::Octree::SubType sub_type, double size)
+{
+  switch (sub_type)
+  {
+    case tesseract_geometry::Octree::SubType::SPHERE_INSIDE:
+      return size / 2.0;
+    case tesseract_geometry::Octree::SubType::SPHERE_OUTSIDE:
+      return std::sqrt(2 * ((size / 2) * (size / 2)));
+    default:
+      return std::sqrt(3.0) * (size / 2.0);
+  }
+}
+
+void getVoxelRange(const Eigen::Vector3d& origin,
+                   double resolution,
+                   const Eigen::Vector3i& size,
+                   const Eigen::Vector3d& box_min,
+                   const Eigen::Vector3d& box_max,
+                   Eigen::Vector3i& lower,
+                   Eigen::Vector3i& upper)
+{
+  for (Eigen::Index k = 0; k < 3; ++k)
+  {
+    // Note: The tolerance keeps voxel centers that lie on the box boundary
+    lower[k] = std::max(0, static_cast<int>(std::ceil(((box_min[k] - origin[k]) / resolution) - 1e-9)));
+    upper[k] = std::min(size[k] - 1, static_cast<int>(std::floor(((box_max[k] - origin[k]) / resolution) + 1e-9)));
+  }
+}
+
+void distanceTransform(const Eigen::Vector3i& size, std::vector<double>& f, std::vector<std::size_t>* closest)
+{
+  const std::array<std::size_t, 3> strides{ 1,
+                                            static_cast<std::size_t>(size.x()),
+                                            static_cast<std::size_t>(size.x()) * static_cast<std::size_t>(size.y()) };
+  const auto max_n = static_cast<std::size_t>(size.maxCoeff());
+  std::vector<double> line_f(max_n);
+  std::vector<std::size_t> line_closest(max_n);
+  std::vector<int> v(max_n);
+  std::vector<double> z(max_n + 1);
+
+  for (Eigen::Index axis = 0; axis < 3; ++axis)
+  {
+    const Eigen::Index axis1 = (axis + 1) % 3;
+    const Eigen::Index axis2 = (axis + 2) % 3;
+    const int n = size[axis];
+    const std::size_t stride = strides[static_cast<std::size_t>(axis)];
+    for (int i2 = 0; i2 < size[axis2]; ++i2)
+    {
+      for (int i1 = 0; i1 < size[axis1]; ++i1)
+      {
+        const std::size_t start = (static_cast<std::size_t>(i1) * strides[static_cast<std::size_t>(axis1)]) +
+                                  (static_cast<std::size_t>(i2) * strides[static_cast<std::size_t>(axis2)]);
+        for (int q = 0; q < n; ++q)
+        {
+          const std::size_t index = start + (static_cast<std::size_t>(q) * stride);
+          line_f[static_cast<std::size_t>(q)] = f[index];
+          if (closest != nullptr)
+            line_closest[static_cast<std::size_t>(q)] = (*closest)[index];
+        }
+
+        // Compute the lower envelope of the parabolas rooted at each voxel
+        auto intersect = [&line_f](int q, int p) {
+          return ((line_f[static_cast<std::size_t>(q)] + (q * q)) - (line_f[static_cast<std::size_t>(p)] + (p * p))) /
+                 (2.0 * (q - p));
+        };
+
+        std::size_t k = 0;
+        v[0] = 0;
+        z[0] = -DISTANCE_TRANSFORM_INF;
+        z[1] = DISTANCE_TRANSFORM_INF;
+        for (int q = 1; q < n; ++q)
+        {
+          double s = intersect(q, v[k]);
+          while (s <= z[k])
+          {
+            --k;
+            s = intersect(q, v[k]);
+          }
+          ++k;
+          v[k] = q;
+          z[k] = s;
+          z[k + 1] = DISTANCE_TRANSFORM_INF;
+        }
+
+        // Sample the lower envelope
+        k = 0;
+        for (int q = 0; q < n; ++q)
+        {
+          while (z[k + 1] < q)
+            ++k;
+
+          const auto p = static_cast<std::size_t>(v[k]);
+          const std::size_t index = start + (static_cast<std::size_t>(q) * stride);
+          const double diff = q - v[k];
+          f[index] = (diff * diff) + line_f[p];
+          if (closest != nullptr)
+            (*closest)[index] = line_closest[p];
+        }
+      }
+    }
+  }
+}
+
+std::vector<char> floodFillExterior(const Eigen::Vector3i& size, const std::vector<char>& blocked)
+{
+  const auto sx = static_cast<std::size_t>(size.x());
+  const auto sxy = static_cast<std::size_t>(size.x()) * static_cast<std::size_t>(size.y());
+  std::vector<char> exterior(blocked.size(), 0);
+  std::vector<std::size_t> stack;
+  auto visit = [&](std::size_t index) {
+    if (exterior[index] == 0 && blocked[index] == 0)
+    {
+      exterior[index] = 1;
+      stack.push_back(index);
+    }
+  };
+
+  for (int z = 0; z < size.z(); ++z)
+  {
+    for (int y = 0; y < size.y(); ++y)
+    {
+      for (int x = 0; x < size.x(); ++x)
+      {
+        if (x == 0 || y == 0 || z == 0 || x == size.x() - 1 || y == size.y() - 1 || z == size.z() - 1)
+          visit(static_cast<std::size_t>(x) + (sx * static_cast<std::size_t>(y)) + (sxy * static_cast<std::size_t>(z)));
+      }
+    }
+  }
+
+  while (!stack.empty())
+  {
+    std::size_t index = stack.back();
+    stack.pop_back();
+
+    auto x = static_cast<int>(index % sx);
+    auto y = static_cast<int>((index / sx) % static_cast<std::size_t>(size.y()));
+    auto z = static_cast<int>(index / sxy);
+    if (x > 0)
+      visit(index - 1);
+    if (x < size.x() - 1)
+      visit(index + 1);
+    if (y > 0)
+      visit(index - sx);
+    if (y < size.y() - 1)
+      visit(index + sx);
+    if (z > 0)
+      visit(index - sxy);
+    if (z < size.z() - 1)
+      visit(index + sxy);
+  }
+
+  return exterior;
+}
+
+bool getShapeAABB(const tesseract_geometry::Geometry& shape,
+                  const Eigen::Isometry3d& shape_pose,
+                  Eigen::Vector3d& aabb_min,
+                  Eigen::Vector3d& aabb_max)
+{
+  Eigen::Vector3d half_extents;
+  switch (shape.getType())
+  {
+    case tesseract_geometry::GeometryType::SPHERE:
+    {
+      half_extents.setConstant(static_cast<const tesseract_geometry::Sphere&>(shape).getRadius());
+      break;
+    }
+    case tesseract_geometry::GeometryType::BOX:
+    {
+      const auto& box = static_cast<const tesseract_geometry::Box&>(shape);
+      half_extents = Eigen::Vector3d(box.getX(), box.getY(), box.getZ()) / 2.0;
+      break;
+    }
+    case tesseract_geometry::GeometryType::CYLINDER:
+    {
+      const auto& cylinder = static_cast<const tesseract_geometry::Cylinder&>(shape);
+      half_extents = Eigen::Vector3d(cylinder.getRadius(), cylinder.getRadius(), cylinder.getLength() / 2.0);
+      break;
+    }
+    case tesseract_geometry::GeometryType::CAPSULE:
+    {
+      const auto& capsule = static_cast<const tesseract_geometry::Capsule&>(shape);
+      half_extents = Eigen::Vector3d(
+          capsule.getRadius(), capsule.getRadius(), (capsule.getLength() / 2.0) + capsule.getRadius());
+      break;
+    }
+    case tesseract_geometry::GeometryType::CONE:
+    {
+      const auto& cone = static_cast<const tesseract_geometry::Cone&>(shape);
+      half_extents = Eigen::Vector3d(cone.getRadius(), cone.getRadius(), cone.getLength() / 2.0);
+      break;
+    }
+    case tesseract_geometry::GeometryType::MESH:
+    case tesseract_geometry::GeometryType::CONVEX_MESH:
+    case tesseract_geometry::GeometryType::SDF_MESH:
+    case tesseract_geometry::GeometryType::POLYGON_MESH:
+    {
+      const auto& mesh = static_cast<const tesseract_geometry::PolygonMesh&>(shape);
+      if (mesh.getVertices() == nullptr || mesh.getVertices()->empty())
+        return false;
+
+      aabb_min.setConstant(std::numeric_limits<double>::max());
+      aabb_max.setConstant(-std::numeric_limits<double>::max());
+      for (const auto& vertex : *(mesh.getVertices()))
+      {
+        Eigen::Vector3d v = shape_pose * vertex;
+        aabb_min = aabb_min.cwiseMin(v);
+        aabb_max = aabb_max.cwiseMax(v);
+      }
+      return true;
+    }
+    case tesseract_geometry::GeometryType::OCTREE:
+    {
+      const auto& octree = static_cast<const tesseract_geometry::Octree&>(shape);
+      bool found{ false };
+      aabb_min.setConstant(std::numeric_limits<double>::max());
+      aabb_max.setConstant(-std::numeric_limits<double>::max());
+      forEachOccupiedLeaf(octree, [&](const Eigen::Vector3d& center, double size) {
+        Eigen::Vector3d radius = Eigen::Vector3d::Constant(getOctreeLeafBoundingRadius(octree.getSubType(), size));
+        aabb_min = aabb_min.cwiseMin(shape_pose * center - radius);
+        aabb_max = aabb_max.cwiseMax(shape_pose * center + radius);
+        found = true;
+      });
+      return found;
+    }
+    default:
+      return false;
+  }
+
+  Eigen::Vector3d extents = shape_pose.linear().cwiseAbs() * half_extents;
+  aabb_min = shape_pose.translation() - extents;
+  aabb_max = shape_pose.translation() + extents;
+  return true;
+}
+
+bool isVoxelizationSupported(const tesseract_geometry::Geometry& shape)
+{
+  switch (shape.getType())
+  {
+    case tesseract_geometry::GeometryType::SPHERE:
+    case tesseract_geometry::GeometryType::BOX:
+    case tesseract_geometry::GeometryType::CYLINDER:
+    case tesseract_geometry::GeometryType::CAPSULE:
+    case tesseract_geometry::GeometryType::CONE:
+    case tesseract_geometry::GeometryType::MESH:
+    case tesseract_geometry::GeometryType::CONVEX_MESH:
+    case tesseract_geometry::GeometryType::SDF_MESH:
+    case tesseract_geometry::GeometryType::POLYGON_MESH:
+    case tesseract_geometry::GeometryType::OCTREE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool getPrimitiveSignedDistance(const tesseract_geometry::Geometry& shape,
+                                const Eigen::Vector3d& point,
+                                double& distance)
+{
+  switch (shape.getType())
+  {
+    case tesseract_geometry::GeometryType::SPHERE:
+    {
+      distance = point.norm() - static_cast<const tesseract_geometry::Sphere&>(shape).getRadius();
+      return true;
+    }
+    case tesseract_geometry::GeometryType::BOX:
+    {
+      const auto& box = static_cast<const tesseract_geometry::Box&>(shape);
+      distance = boxSignedDistance(Eigen::Vector3d(box.getX(), box.getY(), box.getZ()) / 2.0, point);
+      return true;
+    }
+    case tesseract_geometry::GeometryType::CYLINDER:
+    {
+      const auto& cylinder = static_cast<const tesseract_geometry::Cylinder&>(shape);
+      distance = cylinderSignedDistance(cylinder.getRadius(), cylinder.getLength() / 2.0, point);
+      return true;
+    }
+    case tesseract_geometry::GeometryType::CAPSULE:
+    {
+      const auto& capsule = static_cast<const tesseract_geometry::Capsule&>(shape);
+      distance = capsuleSignedDistance(capsule.getRadius(), capsule.getLength() / 2.0, point);
+      return true;
+    }
+    case tesseract_geometry::GeometryType::CONE:
+    {
+      const auto& cone = static_cast<const tesseract_geometry::Cone&>(shape);
+      distance = coneSignedDistance(cone.getRadius(), cone.getLength() / 2.0, point);
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+bool getShapesAABB(const CollisionShapesConst& shapes,
+                   const tesseract_common::VectorIsometry3d& shape_poses,
+                   Eigen::Vector3d& aabb_min,
+                   Eigen::Vector3d& aabb_max)
+{
+  assert(shapes.size() == shape_poses.size());
+  bool found{ false };
+  aabb_min.setConstant(std::numeric_limits<double>::max());
+  aabb_max.setConstant(-std::numeric_limits<double>::max());
+  for (std::size_t i = 0; i < shapes.size(); ++i)
+  {
+    Eigen::Vector3d shape_min;
+    Eigen::Vector3d shape_max;
+    if (getShapeAABB(*shapes[i], shape_poses[i], shape_min, shape_max))
+    {
+      aabb_min = aabb_min.cwiseMin(shape_min);
+      aabb_max = aabb_max.cwiseMax(shape_max);
+      found = true;
+    }
+  }
+
+  return found;
+}
+/**
+ * @brief Cover the inside of a closed shape by spheres
+ * @param spheres The spheres are appended to this
+ * @param origin The center of the first voxel
+ * @param resolution The edge length of a voxel
+ * @param size The number of voxels along each axis
+ * @param near_surface Nonzero for the voxels covered by the surface spheres
+ * @param shape_id The index of the shape
+ */
+static void addInteriorSpheres(CollisionSpheres& spheres,
+                               const Eigen::Vector3d& origin,
+                               double resolution,
+                               const Eigen::Vector3i& size,
+                               const std::vector<char>& near_surface,
+                               int shape_id)
+{
+  // The surface voxels separate the inside of closed shapes from the exterior
+  const std::vector<char> exterior = floodFillExterior(size, near_surface);
+
+  std::vector<double> depth(near_surface.size());
+  std::vector<std::size_t> interior;
+  for (std::size_t i = 0; i < near_surface.size(); ++i)
+  {
+    depth[i] = (near_surface[i] != 0) ? 0 : DISTANCE_TRANSFORM_INF;
+    if (near_surface[i] == 0 && exterior[i] == 0)
+      interior.push_back(i);
+  }
+
+  if (interior.empty())
+    return;
+
+  distanceTransform(size, depth, nullptr);
+
+  // A sphere reaching the closest surface voxel center extends at most half the voxel diagonal beyond the surface. It
+  // covers the cell of every voxel with a center this much inside its radius.
+  const double voxel_radius = (std::sqrt(3.0) * resolution) / 2.0;
+  std::stable_sort(interior.begin(), interior.end(), [&depth](std::size_t a, std::size_t b) {
+    return depth[a] > depth[b];
+  });
+
+  const auto sx = static_cast<std::size_t>(size.x());
+  const auto sxy = static_cast<std::size_t>(size.x()) * static_cast<std::size_t>(size.y());
+  std::vector<char> covered(near_surface.size(), 0);
+  for (std::size_t index : interior)
+  {
+    if (covered[index] != 0)
+      continue;
+
+    const Eigen::Vector3d center =
+        origin + (resolution * Eigen::Vector3d(static_cast<double>(index % sx),
+                                               static_cast<double>((index / sx) % static_cast<std::size_t>(size.y())),
+                                               static_cast<double>(index / sxy)));
+
+    CollisionSphere sphere;
+    sphere.center = center;
+    sphere.radius = resolution * std::sqrt(depth[index]);
+    sphere.shape_id = shape_id;
+    spheres.push_back(sphere);
+
+    const double cover_radius = sphere.radius - voxel_radius;
+    const double threshold = cover_radius * cover_radius;
+    const Eigen::Vector3d extents = Eigen::Vector3d::Constant(cover_radius);
+    auto cover = [&](std::size_t i, const Eigen::Vector3d& p) {
+      if ((p - center).squaredNorm() <= threshold)
+        covered[i] = 1;
+    };
+    forEachVoxel(origin, resolution, size, center - extents, center + extents, cover);
+  }
+}
+
+CollisionSpheres createCollisionSpheres(const CollisionShapesConst& shapes,
+                                        const tesseract_common::VectorIsometry3d& shape_poses,
+                                        double resolution,
+                                        bool fill_interior)
+{
+  assert(shapes.size() == shape_poses.size());
+  CollisionSpheres spheres;
+  if (resolution <= 0)
+    return spheres;
+
+  // The circumscribed sphere of a voxel
+  const double radius = (std::sqrt(3.0) * resolution) / 2.0;
+  for (std::size_t i = 0; i < shapes.size(); ++i)
+  {
+    const tesseract_geometry::Geometry& shape = *shapes[i];
+    const Eigen::Isometry3d& shape_pose = shape_poses[i];
+    const Eigen::Isometry3d shape_pose_inv = shape_pose.inverse();
+    const auto shape_id = static_cast<int>(i);
+
+    if (shape.getType() == tesseract_geometry::GeometryType::SPHERE)
+    {
+      CollisionSphere sphere;
+      sphere.center = shape_pose.translation();
+      sphere.radius = static_cast<const tesseract_geometry::Sphere&>(shape).getRadius();
+      sphere.shape_id = shape_id;
+      spheres.push_back(sphere);
+      continue;
+    }
+
+    Eigen::Vector3d aabb_min;
+    Eigen::Vector3d aabb_max;
+    if (!getShapeAABB(shape, shape_pose, aabb_min, aabb_max))
+      continue;
+
+    // Every point of the surface is inside a voxel with a center within the circumscribed radius of the surface, so
+    // the spheres of these voxels cover the whole surface. The grid is padded by one voxel so the exterior flood fill
+    // can start from its boundary.
+    const Eigen::Vector3d origin = aabb_min - Eigen::Vector3d::Constant(resolution);
+    Eigen::Vector3i size;
+    for (Eigen::Index k = 0; k < 3; ++k)
+      size[k] = static_cast<int>(std::ceil((aabb_max[k] - aabb_min[k]) / resolution)) + 3;
+
+    const std::size_t count =
+        static_cast<std::size_t>(size.x()) * static_cast<std::size_t>(size.y()) * static_cast<std::size_t>(size.z());
+    std::vector<char> near_surface(count, 0);
+    switch (shape.getType())
+    {
+      case tesseract_geometry::GeometryType::BOX:
+      case tesseract_geometry::GeometryType::CYLINDER:
+      case tesseract_geometry::GeometryType::CAPSULE:
+      case tesseract_geometry::GeometryType::CONE:
+      {
+        forEachVoxel(origin, resolution, size, [&](std::size_t index, const Eigen::Vector3d& center) {
+          double distance{ 0 };
+          getPrimitiveSignedDistance(shape, shape_pose_inv * center, distance);
+          if (std::abs(distance) <= radius)
+            near_surface[index] = 1;
+        });
+        break;
+      }
+      case tesseract_geometry::GeometryType::MESH:
+      case tesseract_geometry::GeometryType::CONVEX_MESH:
+      case tesseract_geometry::GeometryType::SDF_MESH:
+      case tesseract_geometry::GeometryType::POLYGON_MESH:
+      {
+        const auto& mesh = static_cast<const tesseract_geometry::PolygonMesh&>(shape);
+        markMeshSurface(mesh, shape_pose, origin, resolution, size, radius, near_surface, char(1));
+        break;
+      }
+      case tesseract_geometry::GeometryType::OCTREE:
+      {
+        // Note: The faces shared by neighboring leaves are covered too
+        const auto& octree = static_cast<const tesseract_geometry::Octree&>(shape);
+        markOctreeLeaves(octree, shape_pose, origin, resolution, size, -radius, radius, near_surface, char(1));
+        break;
+      }
+      default:
+      {
+        CONSOLE_BRIDGE_logError("This geometric shape type (%d) is not supported by the sphere approximation",
+                                static_cast<int>(shape.getType()));
+        break;
+      }
+    }
+
+    forEachVoxel(origin, resolution, size, [&](std::size_t index, const Eigen::Vector3d& center) {
+      if (near_surface[index] != 0)
+      {
+        CollisionSphere sphere;
+        sphere.center = center;
+        sphere.radius = radius;
+        sphere.shape_id = shape_id;
+        spheres.push_back(sphere);
+      }
+    });
+
+    if (fill_interior)
+      addInteriorSpheres(spheres, origin, resolution, size, near_surface, shape_id);
+  }
+
+  return spheres;
+}
+
+}  // namespace tesseract_collision
@@ -0,0 +1,238 @@
+/**
+ * @file fcl_cast_managers.h
+ * @brief Tesseract FCL continuous contact checker implementation.
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, agent
+ *
+ * @par License
+ * Software License Agreement (BSD)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TESSERACT_COLLISION_FCL_CAST_MANAGERS_H
+#define TESSERACT_COLLISION_FCL_CAST_MANAGERS_H
+
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_collision/fcl/fcl_utils.h>
+
+namespace tesseract_collision::tesseract_collision_fcl
+{
+/**
+ * @brief A FCL implementation of the continuous contact manager
+ *
+ * The active collision objects move from their start to their end transform, the broadphase uses the AABB containing
+ * both transforms and the narrowphase checks for collision using FCL's conservative advancement. Colliding objects are
+ * reported at their deepest penetration after the time of contact, and objects within the collision margin at their
+ * closest approach along the motion.
+ *
+ * The results differ from the Bullet cast managers in the following ways:
+ *  - Bullet measures the distance to the convex hull swept by each object, while this manager measures the distance
+ *    between the objects at a single time along the motion. The reported distances differ and both objects share the
+ *    same cc_time.
+ *  - The motion is searched with a golden section search, which only finds the minimum distance when it is unique,
+ *    as for convex objects that only translate. Large rotations of non convex objects may report a shallower contact.
+ *  - FCL only supports signed distance for some shapes, so the penetration depth of meshes and octrees is that of the
+ *    deepest narrowphase contact and both nearest points are the contact point.
+ *  - Conservative advancement is not supported for octrees, so their motion is sampled to check for collision.
+ */
+class FCLCastBVHManager : public ContinuousContactManager
+{
+public:
+  using Ptr = std::shared_ptr<FCLCastBVHManager>;
+  using ConstPtr = std::shared_ptr<const FCLCastBVHManager>;
+  using UPtr = std::unique_ptr<FCLCastBVHManager>;
+  using ConstUPtr = std::unique_ptr<const FCLCastBVHManager>;
+
+  FCLCastBVHManager(std::string name = "FCLCastBVHManager");
+  ~FCLCastBVHManager() override = default;
+  FCLCastBVHManager(const FCLCastBVHManager&) = delete;
+  FCLCastBVHManager& operator=(const FCLCastBVHManager&) = delete;
+  FCLCastBVHManager(FCLCastBVHManager&&) = delete;
+  FCLCastBVHManager& operator=(FCLCastBVHManager&&) = delete;
+
+  std::string getName() const override final;
+
+  ContinuousContactManager::UPtr clone() const override final;
+
+  bool addCollisionObject(const std::string& name,
+                          const int& mask_id,
+                          const CollisionShapesConst& shapes,
+                          const tesseract_common::VectorIsometry3d& shape_poses,
+                          bool enabled = true) override final;
+
+  const CollisionShapesConst& getCollisionObjectGeometries(const std::string& name) const override final;
+
+  const tesseract_common::VectorIsometry3d&
+  getCollisionObjectGeometriesTransforms(const std::string& name) const override final;
+
+  bool hasCollisionObject(const std::string& name) const override final;
+
+  bool removeCollisionObject(const std::string& name) override final;
+
+  bool enableCollisionObject(const std::string& name) override final;
+
+  bool disableCollisionObject(const std::string& name) override final;
+
+  bool isCollisionObjectEnabled(const std::string& name) const override final;
+
+  void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override final;
+
+  void setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                    const tesseract_common::VectorIsometry3d& poses) override final;
+
+  void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override final;
+
+  void setCollisionObjectsTransform(const std::string& name,
+                                    const Eigen::Isometry3d& pose1,
+                                    const Eigen::Isometry3d& pose2) override final;
+
+  void setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                    const tesseract_common::VectorIsometry3d& pose1,
+                                    const tesseract_common::VectorIsometry3d& pose2) override final;
+
+  void setCollisionObjectsTransform(const tesseract_common::TransformMap& pose1,
+                                    const tesseract_common::TransformMap& pose2) override final;
+
+  void setDenseLinkNames(const std::vector<std::string>& link_names) override final;
+
+  void setDenseCollisionObjectsTransform(const tesseract_common::VectorIsometry3d& pose1,
+                                         const tesseract_common::VectorIsometry3d& pose2) override final;
+
+  const std::vector<std::string>& getCollisionObjects() const override final;
+
+  void setActiveCollisionObjects(const std::vector<std::string>& names) override final;
+
+  const std::vector<std::string>& getActiveCollisionObjects() const override final;
+
+  void setCollisionMarginData(
+      CollisionMarginData collision_margin_data,
+      CollisionMarginOverrideType override_type = CollisionMarginOverrideType::REPLACE) override final;
+
+  void setDefaultCollisionMarginData(double default_collision_margin) override final;
+
+  void setPairCollisionMarginData(const std::string& name1,
+                                  const std::string& name2,
+                                  double collision_margin) override final;
+
+  const CollisionMarginData& getCollisionMarginData() const override final;
+
+  void setIsContactAllowedFn(IsContactAllowedFn fn) override final;
+
+  IsContactAllowedFn getIsContactAllowedFn() const override final;
+
+  using ContinuousContactManager::contactTest;
+
+  void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
+
+  bool anyContactTest(const ContactRequest& request) override final;
+
+  /**
+   * @brief Add a fcl collision object to the manager
+   * @param cow The tesseract fcl collision object
+   */
+  void addCollisionObject(const COW::Ptr& cow);
+
+private:
+  std::string name_;
+
+  /** @brief Broad-phase Collision Manager for static collision objects */
+  std::unique_ptr<fcl::BroadPhaseCollisionManagerd> static_manager_;
+
+  /** @brief Broad-phase Collision Manager for active collision objects */
+  std::unique_ptr<fcl::BroadPhaseCollisionManagerd> dynamic_manager_;
+
+  Link2COW link2cow_;               /**< @brief A map of all (static and active) collision objects being managed */
+  std::vector<std::string> active_; /**< @brief A list of the active collision objects */
+  std::vector<std::string> collision_objects_; /**< @brief A list of the collision objects */
+  CollisionMarginData collision_margin_data_;  /**< @brief The contact distance threshold */
+  IsContactAllowedFn fn_;                      /**< @brief The is allowed collision function */
+  std::size_t fcl_co_count_{ 0 };              /**< @brief The number fcl collision objects */
+
+  /** @brief This is used to store static collision objects to update */
+  std::vector<CollisionObjectRawPtr> static_update_;
+
+  /** @brief This is used to store dynamic collision objects to update */
+  std::vector<CollisionObjectRawPtr> dynamic_update_;
+
+  /** @brief The collision objects ordered by the dense link names, nullptr if the link is not managed */
+  std::vector<COW::Ptr> dense_cows_;
+
+  /** @brief The collision margin data indexed by the collision object ids */
+  CollisionMarginTable collision_margin_table_;
+
+  /** @brief Indicates the collision objects changed since the collision margin table was last updated */
+  bool collision_margin_table_dirty_{ false };
+
+  /** @brief The link id revision of the allowed collision matrix the link ids of the collision objects were set for */
+  std::size_t allowed_collision_link_id_revision_{ 0 };
+
+  /** @brief Indicates the collision objects changed since their allowed collision matrix link ids were last set */
+  bool allowed_collision_link_ids_dirty_{ true };
+
+  /** @brief This function will update internal data when margin data has changed */
+  void onCollisionMarginDataChanged();
+
+  /** @brief This function will assign the collision object ids and rebuild the collision margin table */
+  void updateCollisionMarginTable();
+
+  /**
+   * @brief This function will set the allowed collision matrix link ids of the collision objects if they changed
+   * @return The compiled allowed collision matrix queried by the contact allowed function, nullptr if there is none
+   */
+  const tesseract_common::CompiledAllowedCollisionMatrix* updateAllowedCollisionLinkIds();
+
+  /** @brief Resolve the dense link names to collision objects */
+  void updateDenseCollisionObjects();
+
+  /**
+   * @brief Set a collision object's start and end transforms and queue it for the broadphase update
+   * @param cow The collision object
+   * @param pose1 The start transformation in world
+   * @param pose2 The end transformation in world
+   */
+  void setCastCollisionObjectsTransform(const COW::Ptr& cow,
+                                        const Eigen::Isometry3d& pose1,
+                                        const Eigen::Isometry3d& pose2);
+
+  /** @brief Apply the queued collision object updates to the broadphase, this re-balances the trees once */
+  void updateBroadphase();
+
+  /**
+   * @brief Run the broadphase and narrowphase for the current collision object transforms
+   * @param cdata The contact test data to populate
+   */
+  void contactTest(ContactTestData& cdata);
+};
+
+}  // namespace tesseract_collision::tesseract_collision_fcl
+#endif  // TESSERACT_COLLISION_FCL_CAST_MANAGERS_H
@@ -72,8 +72,24 @@ public:
    */
   void updateAABB();
 
+  /**
+   * @brief Update the internal AABB to contain the object at both its current transform and the end transform.
+   *
+   * This is used for continuous collision checking, after setting the collision objects start transform this must be
+   * called with the end transform.
+   * @param end_tf The transform of the object at the end of the motion.
+   */
+  void updateAABB(const fcl::Transform3<double>& end_tf);
+
 protected:
   double contact_distance_{ 0 }; /**< @brief The contact distance threshold. */
+
+  /**
+   * @brief Calculate the AABB of the object at the provided transform, expanded by the contact distance
+   * @param tf The transform of the object
+   * @return The AABB in world space
+   */
+  fcl::AABB<double> calculateAABB(const fcl::Transform3<double>& tf) const;
 };
 
 }  // namespace tesseract_collision::tesseract_collision_fcl
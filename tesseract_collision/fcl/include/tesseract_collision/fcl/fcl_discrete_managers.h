@@ -95,6 +95,15 @@ public:
 
   void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override final;
 
+  bool updateCollisionObjectOctree(const std::string& name,
+                                   std::size_t shape_index,
+                                   const tesseract_geometry::Octree::ConstPtr& octree,
+                                   const OctreeDelta& delta) override final;
+
+  void setDenseLinkNames(const std::vector<std::string>& link_names) override final;
+
+  void setDenseCollisionObjectsTransform(const tesseract_common::VectorIsometry3d& link_transforms) override final;
+
   const std::vector<std::string>& getCollisionObjects() const override final;
 
   void setActiveCollisionObjects(const std::vector<std::string>& names) override final;
@@ -117,8 +126,17 @@ public:
 
   IsContactAllowedFn getIsContactAllowedFn() const override final;
 
+  using DiscreteContactManager::contactTest;
+
   void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
 
+  bool anyContactTest(const ContactRequest& request) override final;
+
+  void contactTest(std::vector<ContactResultMap>& collisions,
+                   const std::vector<std::string>& names,
+                   const std::vector<tesseract_common::VectorIsometry3d>& states,
+                   const ContactRequest& request) override final;
+
   /**
    * @brief Add a fcl collision object to the manager
    * @param cow The tesseract fcl collision object
@@ -147,8 +165,41 @@ private:
   /** @brief This is used to store dynamic collision objects to update */
   std::vector<CollisionObjectRawPtr> dynamic_update_;
 
+  /** @brief The collision objects ordered by the dense link names, nullptr if the link is not managed */
+  std::vector<COW::Ptr> dense_cows_;
+
+  /** @brief The collision margin data indexed by the collision object ids */
+  CollisionMarginTable collision_margin_table_;
+
+  /** @brief Indicates the collision objects changed since the collision margin table was last updated */
+  bool collision_margin_table_dirty_{ false };
+
+  /** @brief The link id revision of the allowed collision matrix the link ids of the collision objects were set for */
+  std::size_t allowed_collision_link_id_revision_{ 0 };
+
+  /** @brief Indicates the collision objects changed since their allowed collision matrix link ids were last set */
+  bool allowed_collision_link_ids_dirty_{ true };
+
   /** @brief This function will update internal data when margin data has changed */
   void onCollisionMarginDataChanged();
+
+  /** @brief This function will assign the collision object ids and rebuild the collision margin table */
+  void updateCollisionMarginTable();
+
+  /**
+   * @brief This function will set the allowed collision matrix link ids of the collision objects if they changed
+   * @return The compiled allowed collision matrix queried by the contact allowed function, nullptr if there is none
+   */
+  const tesseract_common::CompiledAllowedCollisionMatrix* updateAllowedCollisionLinkIds();
+
+  /** @brief Resolve the dense link names to collision objects */
+  void updateDenseCollisionObjects();
+
+  /**
+   * @brief Run the broadphase and narrowphase for the current collision object transforms
+   * @param cdata The contact test data to populate
+   */
+  void contactTest(ContactTestData& cdata);
 };
 
 }  // namespace tesseract_collision::tesseract_collision_fcl
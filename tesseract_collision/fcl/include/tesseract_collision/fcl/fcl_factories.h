@@ -36,6 +36,12 @@ public:
   DiscreteContactManager::UPtr create(const std::string& name, const YAML::Node& config) const override final;
 };
 
+class FCLCastBVHManagerFactory : public ContinuousContactManagerFactory
+{
+public:
+  ContinuousContactManager::UPtr create(const std::string& name, const YAML::Node& config) const override final;
+};
+
 TESSERACT_PLUGIN_ANCHOR_DECL(FCLFactoriesAnchor)
 
 }  // namespace tesseract_collision::tesseract_collision_fcl
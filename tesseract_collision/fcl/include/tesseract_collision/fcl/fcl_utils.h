@@ -47,6 +47,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <fcl/broadphase/broadphase_dynamic_AABB_tree-inl.h>
 #include <fcl/narrowphase/collision-inl.h>
 #include <fcl/narrowphase/distance-inl.h>
+#include <fcl/narrowphase/continuous_collision-inl.h>
 #include <memory>
 #include <set>
 #include <console_bridge/console.h>
@@ -93,6 +94,12 @@ public:
   short int m_collisionFilterMask{ CollisionFilterGroups::StaticFilter | CollisionFilterGroups::KinematicFilter };
   bool m_enabled{ true };
 
+  /** @brief The id of the collision object in the contact manager's collision margin table, -1 if not assigned */
+  int m_collisionObjectId{ -1 };
+
+  /** @brief The link id of the collision object in the compiled allowed collision matrix, see ContactTestData */
+  long m_allowedCollisionLinkId{ -1 };
+
   const std::string& getName() const { return name_; }
   const int& getTypeID() const { return type_id_; }
   /** \brief Check if two objects point to the same source object */
@@ -114,6 +121,7 @@ public:
   void setCollisionObjectsTransform(const Eigen::Isometry3d& pose)
   {
     world_pose_ = pose;
+    world_pose_end_ = pose;
     for (unsigned i = 0; i < collision_objects_.size(); ++i)
     {
       CollisionObjectPtr& co = collision_objects_[i];
@@ -122,6 +130,26 @@ public:
     }
   }
 
+  /**
+   * @brief Set the collision objects transforms at the start and end of a motion
+   *
+   * The collision objects are placed at the start transform and their AABB contains them at both transforms.
+   *
+   * @param pose1 The start transformation in world
+   * @param pose2 The end transformation in world
+   */
+  void setCollisionObjectsTransform(const Eigen::Isometry3d& pose1, const Eigen::Isometry3d& pose2)
+  {
+    world_pose_ = pose1;
+    world_pose_end_ = pose2;
+    for (unsigned i = 0; i < collision_objects_.size(); ++i)
+    {
+      CollisionObjectPtr& co = collision_objects_[i];
+      co->setTransform(pose1 * shape_poses_[i]);
+      co->updateAABB(pose2 * shape_poses_[i]);
+    }
+  }
+
   void setContactDistanceThreshold(double contact_distance)
   {
     contact_distance_ = contact_distance;
@@ -131,6 +159,7 @@ public:
 
   double getContactDistanceThreshold() const { return contact_distance_; }
   const Eigen::Isometry3d& getCollisionObjectsTransform() const { return world_pose_; }
+  const Eigen::Isometry3d& getCollisionObjectsTransformEnd() const { return world_pose_end_; }
   const std::vector<CollisionObjectPtr>& getCollisionObjects() const { return collision_objects_; }
   std::vector<CollisionObjectPtr>& getCollisionObjects() { return collision_objects_; }
   const std::vector<CollisionObjectRawPtr>& getCollisionObjectsRaw() const { return collision_objects_raw_; }
@@ -158,6 +187,8 @@ public:
       clone_cow->collision_objects_raw_.push_back(collObj.get());
     }
 
+    clone_cow->world_pose_ = world_pose_;
+    clone_cow->world_pose_end_ = world_pose_end_;
     clone_cow->m_collisionFilterGroup = m_collisionFilterGroup;
     clone_cow->m_collisionFilterMask = m_collisionFilterMask;
     clone_cow->m_enabled = m_enabled;
@@ -175,6 +206,7 @@ protected:
   std::string name_;                                              // name of the collision object
   int type_id_{ -1 };                                             // user defined type id
   Eigen::Isometry3d world_pose_{ Eigen::Isometry3d::Identity() }; /**< @brief Collision Object World Transformation */
+  Eigen::Isometry3d world_pose_end_{ Eigen::Isometry3d::Identity() }; /**< @brief World Transformation at motion end */
   CollisionShapesConst shapes_;
   tesseract_common::VectorIsometry3d shape_poses_;
   std::vector<CollisionGeometryPtr> collision_geometries_;
@@ -274,5 +306,105 @@ bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, voi
 
 bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data);
 
+/**
+ * @brief Get the contact normal pointing from the first to the second geometry
+ *
+ * When the geometries are separated the normal is the direction between the nearest points. At the time of contact
+ * the nearest points coincide, so the normal is taken from the narrowphase contact instead. If the geometries only
+ * touch within the advancement tolerance and no contact is found, the direction between the nearest points at the start
+ * of the motion is used.
+ * @param geom1 The first collision geometry
+ * @param tf1 The transform of the first geometry at the time of contact
+ * @param tf1_beg The transform of the first geometry at the start of the motion
+ * @param geom2 The second collision geometry
+ * @param tf2 The transform of the second geometry at the time of contact
+ * @param tf2_beg The transform of the second geometry at the start of the motion
+ * @param result The distance result at the time of contact
+ * @return The unit contact normal
+ */
+Eigen::Vector3d getCastContactNormal(const fcl::CollisionGeometryd* geom1,
+                                     const fcl::Transform3d& tf1,
+                                     const fcl::Transform3d& tf1_beg,
+                                     const fcl::CollisionGeometryd* geom2,
+                                     const fcl::Transform3d& tf2,
+                                     const fcl::Transform3d& tf2_beg,
+                                     const fcl::DistanceResultd& result);
+
+/**
+ * @brief Calculate the signed distance between two geometries
+ *
+ * FCL does not support signed distance for every pair of geometries, so when the geometries overlap the penetration
+ * depth of the deepest narrowphase contact is used and both nearest points are set to the contact point.
+ * @param geom1 The first collision geometry
+ * @param tf1 The transform of the first geometry
+ * @param geom2 The second collision geometry
+ * @param tf2 The transform of the second geometry
+ * @param result The distance result with the nearest points in world coordinates
+ * @return The signed distance, which is negative when the geometries overlap
+ */
+double getSignedDistance(const fcl::CollisionGeometryd* geom1,
+                         const fcl::Transform3d& tf1,
+                         const fcl::CollisionGeometryd* geom2,
+                         const fcl::Transform3d& tf2,
+                         fcl::DistanceResultd& result);
+
+/**
+ * @brief Get the maximum distance any point of a geometry travels along FCL's linear interpolated motion
+ *
+ * The signed distance between two moving geometries changes by at most the sum of their motion bounds over the
+ * motion, which is the bound used by conservative advancement.
+ * @param geom The collision geometry
+ * @param tf_beg The transform of the geometry at the start of the motion
+ * @param tf_end The transform of the geometry at the end of the motion
+ * @return The motion bound
+ */
+double getCastMotionBound(const fcl::CollisionGeometryd* geom,
+                          const fcl::Transform3d& tf_beg,
+                          const fcl::Transform3d& tf_end);
+
+/**
+ * @brief Search for the minimum signed distance between two geometries along FCL's linear interpolated motion
+ *
+ * A golden section search is used, which finds the minimum when the distance only has a single minimum over the
+ * searched times. This is the case for convex geometries that only translate.
+ * @param geom1 The first collision geometry
+ * @param tf1_beg The transform of the first geometry at the start of the motion
+ * @param tf1_end The transform of the first geometry at the end of the motion
+ * @param geom2 The second collision geometry
+ * @param tf2_beg The transform of the second geometry at the start of the motion
+ * @param tf2_end The transform of the second geometry at the end of the motion
+ * @param t_lower The first time of the motion to search
+ * @param t_upper The last time of the motion to search
+ * @param toc The time of the minimum distance
+ * @param tf1 The transform of the first geometry at the time of the minimum distance
+ * @param tf2 The transform of the second geometry at the time of the minimum distance
+ * @param result The distance result at the time of the minimum distance
+ * @param tolerance The time tolerance of the search
+ * @return The minimum signed distance
+ */
+double getCastMinimumDistance(const fcl::CollisionGeometryd* geom1,
+                              const fcl::Transform3d& tf1_beg,
+                              const fcl::Transform3d& tf1_end,
+                              const fcl::CollisionGeometryd* geom2,
+                              const fcl::Transform3d& tf2_beg,
+                              const fcl::Transform3d& tf2_end,
+                              double t_lower,
+                              double t_upper,
+                              double& toc,
+                              fcl::Transform3d& tf1,
+                              fcl::Transform3d& tf2,
+                              fcl::DistanceResultd& result,
+                              double tolerance = 1e-4);
+
+/**
+ * @brief Continuous collision callback used by the cast contact managers
+ *
+ * Active collision objects move from their start to their end transform while static collision objects do not move.
+ * Whether the objects collide is checked with FCL's conservative advancement. When they collide, the contact is
+ * reported at the deepest penetration after the time of contact. Otherwise, if the motion bound allows the objects to
+ * come within the collision margin, the contact is reported at their closest approach along the motion.
+ */
+bool castCollisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data);
+
 }  // namespace tesseract_collision::tesseract_collision_fcl
 #endif  // TESSERACT_COLLISION_FCL_UTILS_H
@@ -0,0 +1,461 @@
+/**
+ * @file fcl_cast_managers.cpp
+ * @brief Tesseract FCL continuous contact checker implementation.
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, agent
+ *
+ * @par License
+ * Software License Agreement (BSD)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <tesseract_collision/fcl/fcl_cast_managers.h>
+
+namespace tesseract_collision::tesseract_collision_fcl
+{
+static const CollisionShapesConst EMPTY_COLLISION_SHAPES_CONST;
+static const tesseract_common::VectorIsometry3d EMPTY_COLLISION_SHAPES_TRANSFORMS;
+
+FCLCastBVHManager::FCLCastBVHManager(std::string name) : name_(std::move(name))
+{
+  static_manager_ = std::make_unique<fcl::DynamicAABBTreeCollisionManagerd>();
+  dynamic_manager_ = std::make_unique<fcl::DynamicAABBTreeCollisionManagerd>();
+  collision_margin_data_ = CollisionMarginData(0);
+}
+
+std::string FCLCastBVHManager::getName() const { return name_; }
+
+ContinuousContactManager::UPtr FCLCastBVHManager::clone() const
+{
+  auto manager = std::make_unique<FCLCastBVHManager>();
+
+  for (const auto& cow : link2cow_)
+    manager->addCollisionObject(cow.second->clone());
+
+  manager->setActiveCollisionObjects(active_);
+  manager->setCollisionMarginData(collision_margin_data_);
+  manager->setIsContactAllowedFn(fn_);
+  manager->setDenseLinkNames(dense_link_names_);
+
+  return manager;
+}
+
+bool FCLCastBVHManager::addCollisionObject(const std::string& name,
+                                           const int& mask_id,
+                                           const CollisionShapesConst& shapes,
+                                           const tesseract_common::VectorIsometry3d& shape_poses,
+                                           bool enabled)
+{
+  if (link2cow_.find(name) != link2cow_.end())
+    removeCollisionObject(name);
+
+  COW::Ptr new_cow = createFCLCollisionObject(name, mask_id, shapes, shape_poses, enabled);
+  if (new_cow != nullptr)
+  {
+    addCollisionObject(new_cow);
+    return true;
+  }
+
+  return false;
+}
+
+const CollisionShapesConst& FCLCastBVHManager::getCollisionObjectGeometries(const std::string& name) const
+{
+  auto cow = link2cow_.find(name);
+  return (link2cow_.find(name) != link2cow_.end()) ? cow->second->getCollisionGeometries() :
+                                                     EMPTY_COLLISION_SHAPES_CONST;
+}
+
+const tesseract_common::VectorIsometry3d&
+FCLCastBVHManager::getCollisionObjectGeometriesTransforms(const std::string& name) const
+{
+  auto cow = link2cow_.find(name);
+  return (link2cow_.find(name) != link2cow_.end()) ? cow->second->getCollisionGeometriesTransforms() :
+                                                     EMPTY_COLLISION_SHAPES_TRANSFORMS;
+}
+
+bool FCLCastBVHManager::hasCollisionObject(const std::string& name) const
+{
+  return (link2cow_.find(name) != link2cow_.end());
+}
+
+bool FCLCastBVHManager::removeCollisionObject(const std::string& name)
+{
+  auto it = link2cow_.find(name);
+  if (it != link2cow_.end())
+  {
+    std::vector<CollisionObjectPtr>& objects = it->second->getCollisionObjects();
+    fcl_co_count_ -= objects.size();
+    for (auto& co : objects)
+    {
+      static_manager_->unregisterObject(co.get());
+      dynamic_manager_->unregisterObject(co.get());
+    }
+
+    collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
+    link2cow_.erase(name);
+    collision_margin_table_dirty_ = true;
+    updateDenseCollisionObjects();
+    return true;
+  }
+  return false;
+}
+
+bool FCLCastBVHManager::enableCollisionObject(const std::string& name)
+{
+  auto it = link2cow_.find(name);
+  if (it != link2cow_.end())
+  {
+    it->second->m_enabled = true;
+    return true;
+  }
+  return false;
+}
+
+bool FCLCastBVHManager::disableCollisionObject(const std::string& name)
+{
+  auto it = link2cow_.find(name);
+  if (it != link2cow_.end())
+  {
+    it->second->m_enabled = false;
+    return true;
+  }
+  return false;
+}
+
+bool FCLCastBVHManager::isCollisionObjectEnabled(const std::string& name) const
+{
+  auto it = link2cow_.find(name);
+  if (it != link2cow_.end())
+    return it->second->m_enabled;
+
+  return false;
+}
+
+void FCLCastBVHManager::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
+{
+  setCollisionObjectsTransform(name, pose, pose);
+}
+
+void FCLCastBVHManager::setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                                     const tesseract_common::VectorIsometry3d& poses)
+{
+  setCollisionObjectsTransform(names, poses, poses);
+}
+
+void FCLCastBVHManager::setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms)
+{
+  setCollisionObjectsTransform(transforms, transforms);
+}
+
+void FCLCastBVHManager::setCollisionObjectsTransform(const std::string& name,
+                                                     const Eigen::Isometry3d& pose1,
+                                                     const Eigen::Isometry3d& pose2)
+{
+  auto it = link2cow_.find(name);
+  if (it != link2cow_.end())
+  {
+    static_update_.clear();
+    dynamic_update_.clear();
+    setCastCollisionObjectsTransform(it->second, pose1, pose2);
+    updateBroadphase();
+  }
+}
+
+void FCLCastBVHManager::setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                                     const tesseract_common::VectorIsometry3d& pose1,
+                                                     const tesseract_common::VectorIsometry3d& pose2)
+{
+  assert(names.size() == pose1.size());
+  assert(names.size() == pose2.size());
+  static_update_.clear();
+  dynamic_update_.clear();
+  for (auto i = 0U; i < names.size(); ++i)
+  {
+    auto it = link2cow_.find(names[i]);
+    if (it != link2cow_.end())
+      setCastCollisionObjectsTransform(it->second, pose1[i], pose2[i]);
+  }
+
+  updateBroadphase();
+}
+
+void FCLCastBVHManager::setCollisionObjectsTransform(const tesseract_common::TransformMap& pose1,
+                                                     const tesseract_common::TransformMap& pose2)
+{
+  assert(pose1.size() == pose2.size());
+  static_update_.clear();
+  dynamic_update_.clear();
+  auto it1 = pose1.begin();
+  auto it2 = pose2.begin();
+  while (it1 != pose1.end())
+  {
+    assert(it1->first == it2->first);
+    auto it = link2cow_.find(it1->first);
+    if (it != link2cow_.end())
+      setCastCollisionObjectsTransform(it->second, it1->second, it2->second);
+
+    std::advance(it1, 1);
+    std::advance(it2, 1);
+  }
+
+  updateBroadphase();
+}
+
+void FCLCastBVHManager::setDenseLinkNames(const std::vector<std::string>& link_names)
+{
+  ContinuousContactManager::setDenseLinkNames(link_names);
+  updateDenseCollisionObjects();
+}
+
+void FCLCastBVHManager::setDenseCollisionObjectsTransform(const tesseract_common::VectorIsometry3d& pose1,
+                                                          const tesseract_common::VectorIsometry3d& pose2)
+{
+  assert(pose1.size() == dense_cows_.size());
+  assert(pose2.size() == dense_cows_.size());
+  static_update_.clear();
+  dynamic_update_.clear();
+  for (std::size_t i = 0; i < dense_cows_.size(); ++i)
+  {
+    const COW::Ptr& cow = dense_cows_[i];
+    if (cow == nullptr || cow->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
+      continue;
+
+    setCastCollisionObjectsTransform(cow, pose1[i], pose2[i]);
+  }
+
+  updateBroadphase();
+}
+
+const std::vector<std::string>& FCLCastBVHManager::getCollisionObjects() const { return collision_objects_; }
+
+void FCLCastBVHManager::setActiveCollisionObjects(const std::vector<std::string>& names)
+{
+  active_ = names;
+
+  for (auto& co : link2cow_)
+  {
+    updateCollisionObjectFilters(active_, co.second, static_manager_, dynamic_manager_);
+
+    // Static collision objects do not move
+    if (co.second->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
+      co.second->setCollisionObjectsTransform(co.second->getCollisionObjectsTransform());
+  }
+
+  // This causes a refit on the bvh tree.
+  dynamic_manager_->update();
+  static_manager_->update();
+}
+
+const std::vector<std::string>& FCLCastBVHManager::getActiveCollisionObjects() const { return active_; }
+
+void FCLCastBVHManager::setCollisionMarginData(CollisionMarginData collision_margin_data,
+                                               CollisionMarginOverrideType override_type)
+{
+  collision_margin_data_.apply(collision_margin_data, override_type);
+  onCollisionMarginDataChanged();
+}
+
+void FCLCastBVHManager::setDefaultCollisionMarginData(double default_collision_margin)
+{
+  collision_margin_data_.setDefaultCollisionMargin(default_collision_margin);
+  onCollisionMarginDataChanged();
+}
+
+void FCLCastBVHManager::setPairCollisionMarginData(const std::string& name1,
+                                                   const std::string& name2,
+                                                   double collision_margin)
+{
+  collision_margin_data_.setPairCollisionMargin(name1, name2, collision_margin);
+  onCollisionMarginDataChanged();
+}
+
+const CollisionMarginData& FCLCastBVHManager::getCollisionMarginData() const { return collision_margin_data_; }
+void FCLCastBVHManager::setIsContactAllowedFn(IsContactAllowedFn fn) { fn_ = fn; }
+IsContactAllowedFn FCLCastBVHManager::getIsContactAllowedFn() const { return fn_; }
+
+void FCLCastBVHManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
+{
+  ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions);
+  cdata.res_pool = &contact_result_map_pool_;
+  contactTest(cdata);
+}
+
+bool FCLCastBVHManager::anyContactTest(const ContactRequest& request)
+{
+  ContactTestData cdata;
+  cdata.active = &active_;
+  cdata.collision_margin_data = collision_margin_data_;
+  cdata.fn = fn_;
+  cdata.req = request;
+  contactTest(cdata);
+  return cdata.done;
+}
+
+void FCLCastBVHManager::contactTest(ContactTestData& cdata)
+{
+  if (collision_margin_table_dirty_)
+    updateCollisionMarginTable();
+
+  cdata.collision_margin_table = &collision_margin_table_;
+  cdata.compiled_acm = updateAllowedCollisionLinkIds();
+
+  if (!static_manager_->empty())
+    static_manager_->collide(dynamic_manager_.get(), &cdata, &castCollisionCallback);
+
+  if (!cdata.done && !dynamic_manager_->empty())
+    dynamic_manager_->collide(&cdata, &castCollisionCallback);
+}
+
+void FCLCastBVHManager::addCollisionObject(const COW::Ptr& cow)
+{
+  std::size_t cnt = cow->getCollisionObjectsRaw().size();
+  fcl_co_count_ += cnt;
+  static_update_.reserve(fcl_co_count_);
+  dynamic_update_.reserve(fcl_co_count_);
+  link2cow_[cow->getName()] = cow;
+  collision_objects_.push_back(cow->getName());
+
+  cow->setContactDistanceThreshold(collision_margin_data_.getMaxCollisionMargin() / 2.0);
+
+  std::vector<CollisionObjectPtr>& objects = cow->getCollisionObjects();
+  if (cow->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
+  {
+    // If static add to static manager
+    for (auto& co : objects)
+      static_manager_->registerObject(co.get());
+  }
+  else
+  {
+    for (auto& co : objects)
+      dynamic_manager_->registerObject(co.get());
+  }
+
+  // If active links is not empty update filters to replace the active links list
+  if (!active_.empty())
+    updateCollisionObjectFilters(active_, cow, static_manager_, dynamic_manager_);
+
+  // This causes a refit on the bvh tree.
+  dynamic_manager_->update();
+  static_manager_->update();
+
+  collision_margin_table_dirty_ = true;
+  allowed_collision_link_ids_dirty_ = true;
+  updateDenseCollisionObjects();
+}
+
+void FCLCastBVHManager::onCollisionMarginDataChanged()
+{
+  updateCollisionMarginTable();
+
+  static_update_.clear();
+  dynamic_update_.clear();
+
+  for (auto& cow : link2cow_)
+  {
+    cow.second->setContactDistanceThreshold(collision_margin_data_.getMaxCollisionMargin() / 2.0);
+
+    // Restore the AABB containing the start and end transforms
+    setCastCollisionObjectsTransform(
+        cow.second, cow.second->getCollisionObjectsTransform(), cow.second->getCollisionObjectsTransformEnd());
+  }
+
+  updateBroadphase();
+}
+
+void FCLCastBVHManager::updateCollisionMarginTable()
+{
+  collision_margin_table_.update(collision_margin_data_, collision_objects_);
+  for (std::size_t i = 0; i < collision_objects_.size(); ++i)
+    link2cow_.at(collision_objects_[i])->m_collisionObjectId = static_cast<int>(i);
+
+  collision_margin_table_dirty_ = false;
+}
+
+void FCLCastBVHManager::updateDenseCollisionObjects()
+{
+  dense_cows_.clear();
+  dense_cows_.reserve(dense_link_names_.size());
+  for (const auto& link_name : dense_link_names_)
+  {
+    auto it = link2cow_.find(link_name);
+    dense_cows_.push_back((it != link2cow_.end()) ? it->second : nullptr);
+  }
+}
+
+void FCLCastBVHManager::setCastCollisionObjectsTransform(const COW::Ptr& cow,
+                                                         const Eigen::Isometry3d& pose1,
+                                                         const Eigen::Isometry3d& pose2)
+{
+  std::vector<CollisionObjectRawPtr>& co = cow->getCollisionObjectsRaw();
+  if (cow->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
+  {
+    // Static collision objects do not move
+    cow->setCollisionObjectsTransform(pose1);
+    static_update_.insert(static_update_.end(), co.begin(), co.end());
+  }
+  else
+  {
+    cow->setCollisionObjectsTransform(pose1, pose2);
+    dynamic_update_.insert(dynamic_update_.end(), co.begin(), co.end());
+  }
+}
+
+void FCLCastBVHManager::updateBroadphase()
+{
+  // This is because FCL supports batch update which only re-balances the tree once
+  if (!static_update_.empty())
+    static_manager_->update(static_update_);
+
+  if (!dynamic_update_.empty())
+    dynamic_manager_->update(dynamic_update_);
+}
+
+const tesseract_common::CompiledAllowedCollisionMatrix* FCLCastBVHManager::updateAllowedCollisionLinkIds()
+{
+  const tesseract_common::CompiledAllowedCollisionMatrix* compiled_acm = getCompiledAllowedCollisionMatrix(fn_);
+  if (compiled_acm == nullptr)
+    return nullptr;
+
+  const std::size_t revision = compiled_acm->getLinkIdRevision();
+  if (!allowed_collision_link_ids_dirty_ && revision == allowed_collision_link_id_revision_)
+    return compiled_acm;
+
+  for (const auto& cow : link2cow_)
+    cow.second->m_allowedCollisionLinkId = compiled_acm->getLinkId(cow.first);
+
+  allowed_collision_link_id_revision_ = revision;
+  allowed_collision_link_ids_dirty_ = false;
+  return compiled_acm;
+}
+}  // namespace tesseract_collision::tesseract_collision_fcl
@@ -54,22 +54,32 @@ void FCLCollisionObjectWrapper::setContactDistanceThreshold(double contact_dista
 
 double FCLCollisionObjectWrapper::getContactDistanceThreshold() const { return contact_distance_; }
 
-void FCLCollisionObjectWrapper::updateAABB()
+void FCLCollisionObjectWrapper::updateAABB() { aabb = calculateAABB(t); }
+
+void FCLCollisionObjectWrapper::updateAABB(const fcl::Transform3<double>& end_tf)
+{
+  aabb = calculateAABB(t);
+  aabb += calculateAABB(end_tf);
+}
+
+fcl::AABB<double> FCLCollisionObjectWrapper::calculateAABB(const fcl::Transform3<double>& tf) const
 {
-  if (t.linear().isIdentity())
+  fcl::AABB<double> tf_aabb;
+  if (tf.linear().isIdentity())
   {
-    aabb = translate(cgeom->aabb_local, t.translation());
+    tf_aabb = translate(cgeom->aabb_local, tf.translation());
     fcl::Vector3<double> delta = fcl::Vector3<double>::Constant(contact_distance_);
-    aabb.min_ -= delta;
-    aabb.max_ += delta;
+    tf_aabb.min_ -= delta;
+    tf_aabb.max_ += delta;
   }
   else
   {
-    fcl::Vector3<double> center = t * cgeom->aabb_center;
+    fcl::Vector3<double> center = tf * cgeom->aabb_center;
     fcl::Vector3<double> delta = fcl::Vector3<double>::Constant(cgeom->aabb_radius + contact_distance_);
-    aabb.min_ = center - delta;
-    aabb.max_ = center + delta;
+    tf_aabb.min_ = center - delta;
+    tf_aabb.max_ = center + delta;
   }
+  return tf_aabb;
 }
 
 }  // namespace tesseract_collision::tesseract_collision_fcl
@@ -65,6 +65,7 @@ DiscreteContactManager::UPtr FCLDiscreteBVHManager::clone() const
   manager->setActiveCollisionObjects(active_);
   manager->setCollisionMarginData(collision_margin_data_);
   manager->setIsContactAllowedFn(fn_);
+  manager->setDenseLinkNames(dense_link_names_);
 
   return manager;
 }
@@ -123,6 +124,8 @@ bool FCLDiscreteBVHManager::removeCollisionObject(const std::string& name)
 
     collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
     link2cow_.erase(name);
+    collision_margin_table_dirty_ = true;
+    updateDenseCollisionObjects();
     return true;
   }
   return false;
@@ -257,6 +260,68 @@ void FCLDiscreteBVHManager::setCollisionObjectsTransform(const tesseract_common:
     dynamic_manager_->update(dynamic_update_);
 }
 
+bool FCLDiscreteBVHManager::updateCollisionObjectOctree(const std::string& name,
+                                                        std::size_t shape_index,
+                                                        const tesseract_geometry::Octree::ConstPtr& octree,
+                                                        const OctreeDelta& /*delta*/)
+{
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end() || octree == nullptr)
+    return false;
+
+  const CollisionShapesConst& shapes = it->second->getCollisionGeometries();
+  if (shape_index >= shapes.size() || shapes[shape_index]->getType() != tesseract_geometry::GeometryType::OCTREE)
+    return false;
+
+  // The fcl octree traverses the octree directly without copying it, so replacing the collision object only creates
+  // the fcl collision objects of the shapes. The previous octree is still used by clones.
+  CollisionShapesConst new_shapes(shapes);
+  new_shapes[shape_index] = octree;
+
+  COW::Ptr cow = it->second;
+  COW::Ptr new_cow = createFCLCollisionObject(
+      name, cow->getTypeID(), new_shapes, cow->getCollisionGeometriesTransforms(), cow->m_enabled);
+  if (new_cow == nullptr)
+    return false;
+
+  new_cow->setCollisionObjectsTransform(cow->getCollisionObjectsTransform());
+  removeCollisionObject(name);
+  addCollisionObject(new_cow);
+  return true;
+}
+
+void FCLDiscreteBVHManager::setDenseLinkNames(const std::vector<std::string>& link_names)
+{
+  DiscreteContactManager::setDenseLinkNames(link_names);
+  updateDenseCollisionObjects();
+}
+
+void FCLDiscreteBVHManager::setDenseCollisionObjectsTransform(const tesseract_common::VectorIsometry3d& link_transforms)
+{
+  assert(link_transforms.size() == dense_cows_.size());
+  dynamic_update_.clear();
+  for (std::size_t i = 0; i < dense_cows_.size(); ++i)
+  {
+    const COW::Ptr& cow = dense_cows_[i];
+    if (cow == nullptr || cow->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
+      continue;
+
+    const Eigen::Isometry3d& cur_tf = cow->getCollisionObjectsTransform();
+    // Note: If the transform has not changed do not updated to prevent unnecessary re-balancing of the BVH tree
+    if (!cur_tf.translation().isApprox(link_transforms[i].translation(), 1e-8) ||
+        !cur_tf.rotation().isApprox(link_transforms[i].rotation(), 1e-8))
+    {
+      cow->setCollisionObjectsTransform(link_transforms[i]);
+      std::vector<CollisionObjectRawPtr>& co = cow->getCollisionObjectsRaw();
+      dynamic_update_.insert(dynamic_update_.end(), co.begin(), co.end());
+    }
+  }
+
+  // This is because FCL supports batch update which only re-balances the tree once
+  if (!dynamic_update_.empty())
+    dynamic_manager_->update(dynamic_update_);
+}
+
 const std::vector<std::string>& FCLDiscreteBVHManager::getCollisionObjects() const { return collision_objects_; }
 
 void FCLDiscreteBVHManager::setActiveCollisionObjects(const std::vector<std::string>& names)
@@ -328,7 +393,93 @@ void selfCollisionContactTest(ContactTestData& cdata,
 void FCLDiscreteBVHManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
   ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions);
-  if (collision_margin_data_.getMaxCollisionMargin() > 0 && request.calculate_distance)
+  cdata.res_pool = &contact_result_map_pool_;
+  contactTest(cdata);
+}
+
+bool FCLDiscreteBVHManager::anyContactTest(const ContactRequest& request)
+{
+  ContactTestData cdata;
+  cdata.active = &active_;
+  cdata.collision_margin_data = collision_margin_data_;
+  cdata.fn = fn_;
+  cdata.req = request;
+  contactTest(cdata);
+  return cdata.done;
+}
+
+void FCLDiscreteBVHManager::contactTest(std::vector<ContactResultMap>& collisions,
+                                        const std::vector<std::string>& names,
+                                        const std::vector<tesseract_common::VectorIsometry3d>& states,
+                                        const ContactRequest& request)
+{
+  // Look up the collision objects once for the whole batch
+  std::vector<COW::Ptr> cows;
+  cows.reserve(names.size());
+  for (const auto& name : names)
+  {
+    auto it = link2cow_.find(name);
+    if (it != link2cow_.end())
+      cows.push_back(it->second);
+    else
+      cows.push_back(nullptr);
+  }
+
+  collisions.resize(states.size());
+  if (states.empty())
+    return;
+
+  ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions.front());
+  cdata.res_pool = &contact_result_map_pool_;
+  for (std::size_t i = 0; i < states.size(); ++i)
+  {
+    const tesseract_common::VectorIsometry3d& poses = states[i];
+    assert(poses.size() == cows.size());
+
+    static_update_.clear();
+    dynamic_update_.clear();
+    for (std::size_t j = 0; j < cows.size(); ++j)
+    {
+      const COW::Ptr& cow = cows[j];
+      if (cow == nullptr)
+        continue;
+
+      const Eigen::Isometry3d& cur_tf = cow->getCollisionObjectsTransform();
+      // Note: If the transform has not changed do not updated to prevent unnecessary re-balancing of the BVH tree
+      if (!cur_tf.translation().isApprox(poses[j].translation(), 1e-8) ||
+          !cur_tf.rotation().isApprox(poses[j].rotation(), 1e-8))
+      {
+        cow->setCollisionObjectsTransform(poses[j]);
+        std::vector<CollisionObjectRawPtr>& co = cow->getCollisionObjectsRaw();
+        if (cow->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
+          static_update_.insert(static_update_.end(), co.begin(), co.end());
+        else
+          dynamic_update_.insert(dynamic_update_.end(), co.begin(), co.end());
+      }
+    }
+
+    if (!static_update_.empty())
+      static_manager_->update(static_update_);
+
+    if (!dynamic_update_.empty())
+      dynamic_manager_->update(dynamic_update_);
+
+    clearContactResults(collisions[i]);
+    cdata.res = &collisions[i];
+    cdata.done = false;
+    contactTest(cdata);
+  }
+}
+
+void FCLDiscreteBVHManager::contactTest(ContactTestData& cdata)
+{
+  if (collision_margin_table_dirty_)
+    updateCollisionMarginTable();
+
+  cdata.collision_margin_table = &collision_margin_table_;
+  cdata.compiled_acm = updateAllowedCollisionLinkIds();
+
+  if (collision_margin_data_.getMaxCollisionMargin() > 0 && cdata.req.calculate_distance)
   {
     // TODO: Should the order be flipped?
     if (!static_manager_->empty())
@@ -379,10 +530,16 @@ void FCLDiscreteBVHManager::addCollisionObject(const COW::Ptr& cow)
   // This causes a refit on the bvh tree.
   dynamic_manager_->update();
   static_manager_->update();
+
+  collision_margin_table_dirty_ = true;
+  allowed_collision_link_ids_dirty_ = true;
+  updateDenseCollisionObjects();
 }
 
 void FCLDiscreteBVHManager::onCollisionMarginDataChanged()
 {
+  updateCollisionMarginTable();
+
   static_update_.clear();
   dynamic_update_.clear();
 
@@ -406,4 +563,42 @@ void FCLDiscreteBVHManager::onCollisionMarginDataChanged()
   if (!dynamic_update_.empty())
     dynamic_manager_->update(dynamic_update_);
 }
+
+void FCLDiscreteBVHManager::updateDenseCollisionObjects()
+{
+  dense_cows_.clear();
+  dense_cows_.reserve(dense_link_names_.size());
+  for (const auto& link_name : dense_link_names_)
+  {
+    auto it = link2cow_.find(link_name);
+    dense_cows_.push_back((it != link2cow_.end()) ? it->second : nullptr);
+  }
+}
+
+void FCLDiscreteBVHManager::updateCollisionMarginTable()
+{
+  collision_margin_table_.update(collision_margin_data_, collision_objects_);
+  for (std::size_t i = 0; i < collision_objects_.size(); ++i)
+    link2cow_.at(collision_objects_[i])->m_collisionObjectId = static_cast<int>(i);
+
+  collision_margin_table_dirty_ = false;
+}
+
+const tesseract_common::CompiledAllowedCollisionMatrix* FCLDiscreteBVHManager::updateAllowedCollisionLinkIds()
+{
+  const tesseract_common::CompiledAllowedCollisionMatrix* compiled_acm = getCompiledAllowedCollisionMatrix(fn_);
+  if (compiled_acm == nullptr)
+    return nullptr;
+
+  const std::size_t revision = compiled_acm->getLinkIdRevision();
+  if (!allowed_collision_link_ids_dirty_ && revision == allowed_collision_link_id_revision_)
+    return compiled_acm;
+
+  for (const auto& cow : link2cow_)
+    cow.second->m_allowedCollisionLinkId = compiled_acm->getLinkId(cow.first);
+
+  allowed_collision_link_id_revision_ = revision;
+  allowed_collision_link_ids_dirty_ = false;
+  return compiled_acm;
+}
 }  // namespace tesseract_collision::tesseract_collision_fcl
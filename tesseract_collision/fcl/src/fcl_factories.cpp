@@ -26,6 +26,7 @@
 
 #include <tesseract_collision/fcl/fcl_factories.h>
 #include <tesseract_collision/fcl/fcl_discrete_managers.h>
+#include <tesseract_collision/fcl/fcl_cast_managers.h>
 
 namespace tesseract_collision::tesseract_collision_fcl
 {
@@ -35,6 +36,12 @@ DiscreteContactManager::UPtr FCLDiscreteBVHManagerFactory::create(const std::str
   return std::make_unique<FCLDiscreteBVHManager>(name);
 }
 
+ContinuousContactManager::UPtr FCLCastBVHManagerFactory::create(const std::string& name,
+                                                                const YAML::Node& /*config*/) const
+{
+  return std::make_unique<FCLCastBVHManager>(name);
+}
+
 TESSERACT_PLUGIN_ANCHOR_IMPL(FCLFactoriesAnchor)
 
 }  // namespace tesseract_collision::tesseract_collision_fcl
@@ -42,3 +49,6 @@ TESSERACT_PLUGIN_ANCHOR_IMPL(FCLFactoriesAnchor)
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 TESSERACT_ADD_DISCRETE_MANAGER_PLUGIN(tesseract_collision::tesseract_collision_fcl::FCLDiscreteBVHManagerFactory,
                                       FCLDiscreteBVHManagerFactory);
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+TESSERACT_ADD_CONTINUOUS_MANAGER_PLUGIN(tesseract_collision::tesseract_collision_fcl::FCLCastBVHManagerFactory,
+                                        FCLCastBVHManagerFactory);
@@ -49,6 +49,9 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <fcl/geometry/shape/cone-inl.h>
 #include <fcl/geometry/shape/capsule-inl.h>
 #include <fcl/geometry/octree/octree-inl.h>
+#include <fcl/math/motion/interp_motion.h>
+#include <cmath>
+#include <limits>
 #include <memory>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -212,7 +215,12 @@ bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, voi
   bool needs_collision = cd1->m_enabled && cd2->m_enabled &&
                          (cd1->m_collisionFilterGroup & cd2->m_collisionFilterMask) &&  // NOLINT
                          (cd2->m_collisionFilterGroup & cd1->m_collisionFilterMask) &&  // NOLINT
-                         !isContactAllowed(cd1->getName(), cd2->getName(), cdata->fn, false);
+                         !isContactAllowed(cd1->getName(),
+                                           cd1->m_allowedCollisionLinkId,
+                                           cd2->getName(),
+                                           cd2->m_allowedCollisionLinkId,
+                                           *cdata,
+                                           false);
 
   assert(std::find(cdata->active->begin(), cdata->active->end(), cd1->getName()) != cdata->active->end() ||
          std::find(cdata->active->begin(), cdata->active->end(), cd2->getName()) != cdata->active->end());
@@ -222,13 +230,21 @@ bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, voi
 
   std::size_t num_contacts = (cdata->req.contact_limit > 0) ? static_cast<std::size_t>(cdata->req.contact_limit) :
                                                               std::numeric_limits<std::size_t>::max();
-  if (cdata->req.type == ContactTestType::FIRST)
+  // Only checking if any contact exists so the contact result is not needed
+  bool any_contact = (cdata->res == nullptr && !cdata->req.is_valid);
+  if (any_contact || cdata->req.type == ContactTestType::FIRST)
     num_contacts = 1;
 
   fcl::CollisionResultd col_result;
   fcl::collide(o1, o2, fcl::CollisionRequestd(num_contacts, cdata->req.calculate_penetration, 1, false), col_result);
 
-  if (col_result.isCollision())
+  if (any_contact && col_result.isCollision())
+  {
+    double distance = (col_result.numContacts() > 0) ? -1.0 * col_result.getContact(0).penetration_depth : 0;
+    processAnyContact(
+        *cdata, distance, cd1->getName(), cd2->getName(), cd1->m_collisionObjectId, cd2->m_collisionObjectId);
+  }
+  else if (col_result.isCollision())
   {
     const Eigen::Isometry3d& tf1 = cd1->getCollisionObjectsTransform();
     const Eigen::Isometry3d& tf2 = cd2->getCollisionObjectsTransform();
@@ -257,10 +273,9 @@ bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, voi
       contact.normal = fcl_contact.normal;
 
       ObjectPairKey pc = getObjectPairKey(cd1->getName(), cd2->getName());
-      const auto& it = cdata->res->find(pc);
-      bool found = (it != cdata->res->end());
+      bool found = (cdata->res != nullptr && cdata->res->find(pc) != cdata->res->end());
 
-      processResult(*cdata, contact, pc, found);
+      processResult(*cdata, contact, pc, found, cd1->m_collisionObjectId, cd2->m_collisionObjectId);
     }
   }
 
@@ -281,7 +296,12 @@ bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void
   bool needs_collision = cd1->m_enabled && cd2->m_enabled &&
                          (cd1->m_collisionFilterGroup & cd2->m_collisionFilterMask) &&  // NOLINT
                          (cd2->m_collisionFilterGroup & cd1->m_collisionFilterMask) &&  // NOLINT
-                         !isContactAllowed(cd1->getName(), cd2->getName(), cdata->fn, false);
+                         !isContactAllowed(cd1->getName(),
+                                           cd1->m_allowedCollisionLinkId,
+                                           cd2->getName(),
+                                           cd2->m_allowedCollisionLinkId,
+                                           *cdata,
+                                           false);
 
   assert(std::find(cdata->active->begin(), cdata->active->end(), cd1->getName()) != cdata->active->end() ||
          std::find(cdata->active->begin(), cdata->active->end(), cd2->getName()) != cdata->active->end());
@@ -289,11 +309,18 @@ bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void
   if (!needs_collision)
     return false;
 
+  // Only checking if any contact exists so the nearest points are not needed
+  bool any_contact = (cdata->res == nullptr && !cdata->req.is_valid);
+
   fcl::DistanceResultd fcl_result;
-  fcl::DistanceRequestd fcl_request(true, true);
+  fcl::DistanceRequestd fcl_request(!any_contact, true);
   double d = fcl::distance(o1, o2, fcl_request, fcl_result);
 
-  if (d < cdata->collision_margin_data.getMaxCollisionMargin())
+  if (any_contact)
+  {
+    processAnyContact(*cdata, d, cd1->getName(), cd2->getName(), cd1->m_collisionObjectId, cd2->m_collisionObjectId);
+  }
+  else if (d < cdata->collision_margin_data.getMaxCollisionMargin())
   {
     const Eigen::Isometry3d& tf1 = cd1->getCollisionObjectsTransform();
     const Eigen::Isometry3d& tf2 = cd2->getCollisionObjectsTransform();
@@ -322,12 +349,313 @@ bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void
     assert(!std::isnan(contact.nearest_points[0](0)));
 
     ObjectPairKey pc = getObjectPairKey(cd1->getName(), cd2->getName());
-    const auto& it = cdata->res->find(pc);
-    bool found = (it != cdata->res->end());
+    bool found = (cdata->res != nullptr && cdata->res->find(pc) != cdata->res->end());
+
+    processResult(*cdata, contact, pc, found, cd1->m_collisionObjectId, cd2->m_collisionObjectId);
+  }
+
+  return cdata->done;
+}
+
+Eigen::Vector3d getCastContactNormal(const fcl::CollisionGeometryd* geom1,
+                                     const fcl::Transform3d& tf1,
+                                     const fcl::Transform3d& tf1_beg,
+                                     const fcl::CollisionGeometryd* geom2,
+                                     const fcl::Transform3d& tf2,
+                                     const fcl::Transform3d& tf2_beg,
+                                     const fcl::DistanceResultd& result)
+{
+  Eigen::Vector3d diff = result.nearest_points[1] - result.nearest_points[0];
+  if (std::abs(result.min_distance) > std::numeric_limits<double>::epsilon() &&
+      diff.norm() > std::numeric_limits<double>::epsilon())
+    return (result.min_distance * diff).normalized();
+
+  fcl::CollisionResultd col_result;
+  fcl::collide(geom1, tf1, geom2, tf2, fcl::CollisionRequestd(1, true), col_result);
+  if (col_result.numContacts() > 0)
+    return col_result.getContact(0).normal.normalized();
+
+  fcl::DistanceResultd beg_result;
+  fcl::distance(geom1, tf1_beg, geom2, tf2_beg, fcl::DistanceRequestd(true, true), beg_result);
+  diff = beg_result.nearest_points[1] - beg_result.nearest_points[0];
+  if (beg_result.min_distance > 0 && diff.norm() > std::numeric_limits<double>::epsilon())
+    return diff.normalized();
+
+  // The geometries overlap for the whole motion, so fall back to the direction between the geometry origins
+  return (tf2.translation() - tf1.translation()).normalized();
+}
+
+double getSignedDistance(const fcl::CollisionGeometryd* geom1,
+                         const fcl::Transform3d& tf1,
+                         const fcl::CollisionGeometryd* geom2,
+                         const fcl::Transform3d& tf2,
+                         fcl::DistanceResultd& result)
+{
+  result.clear();
+  fcl::distance(geom1, tf1, geom2, tf2, fcl::DistanceRequestd(true, true), result);
+  if (result.min_distance > 0)
+    return result.min_distance;
+
+  // Signed distance is not supported for every pair of geometries, so use the deepest contact of the overlap
+  fcl::CollisionResultd col_result;
+  fcl::collide(
+      geom1, tf1, geom2, tf2, fcl::CollisionRequestd(std::numeric_limits<std::size_t>::max(), true), col_result);
+  if (col_result.numContacts() == 0)
+    return result.min_distance;
+
+  const fcl::Contactd* deepest = &col_result.getContact(0);
+  for (std::size_t i = 1; i < col_result.numContacts(); ++i)
+  {
+    if (col_result.getContact(i).penetration_depth > deepest->penetration_depth)
+      deepest = &col_result.getContact(i);
+  }
+
+  result.min_distance = -1.0 * deepest->penetration_depth;
+  result.nearest_points[0] = deepest->pos;
+  result.nearest_points[1] = deepest->pos;
+  result.b1 = deepest->b1;
+  result.b2 = deepest->b2;
+  return result.min_distance;
+}
+
+double getCastMotionBound(const fcl::CollisionGeometryd* geom,
+                          const fcl::Transform3d& tf_beg,
+                          const fcl::Transform3d& tf_end)
+{
+  // The linear motion rotates about the geometry origin, so the farthest point of the bounding sphere moves the most
+  Eigen::AngleAxisd rotation(tf_end.linear() * tf_beg.linear().transpose());
+  double radius = geom->aabb_center.norm() + geom->aabb_radius;
+  return (tf_end.translation() - tf_beg.translation()).norm() + (std::abs(rotation.angle()) * radius);
+}
+
+double getCastMinimumDistance(const fcl::CollisionGeometryd* geom1,
+                              const fcl::Transform3d& tf1_beg,
+                              const fcl::Transform3d& tf1_end,
+                              const fcl::CollisionGeometryd* geom2,
+                              const fcl::Transform3d& tf2_beg,
+                              const fcl::Transform3d& tf2_end,
+                              double t_lower,
+                              double t_upper,
+                              double& toc,
+                              fcl::Transform3d& tf1,
+                              fcl::Transform3d& tf2,
+                              fcl::DistanceResultd& result,
+                              double tolerance)
+{
+  fcl::InterpMotiond motion1(tf1_beg, tf1_end);
+  fcl::InterpMotiond motion2(tf2_beg, tf2_end);
+  double min_distance = std::numeric_limits<double>::max();
+
+  auto evaluate = [&](double t) {
+    fcl::Transform3d t_tf1;
+    fcl::Transform3d t_tf2;
+    motion1.integrate(t);
+    motion1.getCurrentTransform(t_tf1);
+    motion2.integrate(t);
+    motion2.getCurrentTransform(t_tf2);
+
+    fcl::DistanceResultd t_result;
+    double distance = getSignedDistance(geom1, t_tf1, geom2, t_tf2, t_result);
+    if (distance < min_distance)
+    {
+      min_distance = distance;
+      toc = t;
+      tf1 = t_tf1;
+      tf2 = t_tf2;
+      result = t_result;
+    }
+    return distance;
+  };
+
+  // Golden section search which converges to the minimum when the distance along the motion has a single minimum
+  const double inv_phi = 0.5 * (std::sqrt(5.0) - 1.0);
+  double a = t_lower;
+  double b = t_upper;
+  evaluate(a);
+  evaluate(b);
+
+  double c = b - (inv_phi * (b - a));
+  double d = a + (inv_phi * (b - a));
+  double distance_c = evaluate(c);
+  double distance_d = evaluate(d);
+  while ((b - a) > tolerance)
+  {
+    if (distance_c < distance_d)
+    {
+      b = d;
+      d = c;
+      distance_d = distance_c;
+      c = b - (inv_phi * (b - a));
+      distance_c = evaluate(c);
+    }
+    else
+    {
+      a = c;
+      c = d;
+      distance_c = distance_d;
+      d = a + (inv_phi * (b - a));
+      distance_d = evaluate(d);
+    }
+  }
+
+  return min_distance;
+}
+
+bool castCollisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data)
+{
+  auto* cdata = reinterpret_cast<ContactTestData*>(data);  // NOLINT
+
+  if (cdata->done)
+    return true;
+
+  const auto* cd1 = static_cast<const CollisionObjectWrapper*>(o1->getUserData());
+  const auto* cd2 = static_cast<const CollisionObjectWrapper*>(o2->getUserData());
+  assert(cd1->getName() != cd2->getName());
+
+  bool needs_collision = cd1->m_enabled && cd2->m_enabled &&
+                         (cd1->m_collisionFilterGroup & cd2->m_collisionFilterMask) &&  // NOLINT
+                         (cd2->m_collisionFilterGroup & cd1->m_collisionFilterMask) &&  // NOLINT
+                         !isContactAllowed(cd1->getName(),
+                                           cd1->m_allowedCollisionLinkId,
+                                           cd2->getName(),
+                                           cd2->m_allowedCollisionLinkId,
+                                           *cdata,
+                                           false);
+
+  assert(std::find(cdata->active->begin(), cdata->active->end(), cd1->getName()) != cdata->active->end() ||
+         std::find(cdata->active->begin(), cdata->active->end(), cd2->getName()) != cdata->active->end());
+
+  if (!needs_collision)
+    return false;
+
+  const fcl::CollisionGeometryd* geom1 = o1->collisionGeometry().get();
+  const fcl::CollisionGeometryd* geom2 = o2->collisionGeometry().get();
+  int shape_id1 = cd1->getShapeIndex(o1);
+  int shape_id2 = cd2->getShapeIndex(o2);
+  const Eigen::Isometry3d& shape_pose1 = cd1->getCollisionGeometriesTransforms()[static_cast<std::size_t>(shape_id1)];
+  const Eigen::Isometry3d& shape_pose2 = cd2->getCollisionGeometriesTransforms()[static_cast<std::size_t>(shape_id2)];
+
+  // Static collision objects have the same start and end transform
+  const fcl::Transform3d& tf1_beg = o1->getTransform();
+  const fcl::Transform3d& tf2_beg = o2->getTransform();
+  fcl::Transform3d tf1_end = cd1->getCollisionObjectsTransformEnd() * shape_pose1;
+  fcl::Transform3d tf2_end = cd2->getCollisionObjectsTransformEnd() * shape_pose2;
+
+  // Conservative advancement is not supported for octrees, so the motion is sampled instead
+  fcl::ContinuousCollisionRequestd ccd_request;
+  ccd_request.ccd_motion_type = fcl::CCDM_LINEAR;
+  if (o1->getObjectType() == fcl::OT_OCTREE || o2->getObjectType() == fcl::OT_OCTREE)
+    ccd_request.ccd_solver_type = fcl::CCDC_NAIVE;
+  else
+    ccd_request.ccd_solver_type = fcl::CCDC_CONSERVATIVE_ADVANCEMENT;
+
+  fcl::ContinuousCollisionResultd ccd_result;
+  fcl::continuousCollide(geom1, tf1_beg, tf1_end, geom2, tf2_beg, tf2_end, ccd_request, ccd_result);
+
+  // When the objects do not collide, the distance can only drop below the margin if the bound on the motion allows it
+  double max_margin = cdata->collision_margin_data.getMaxCollisionMargin();
+  bool check_distance = (!ccd_result.is_collide && cdata->req.calculate_distance && max_margin > 0);
+  double distance_beg{ 0 };
+  double distance_end{ 0 };
+  if (check_distance)
+  {
+    fcl::DistanceResultd fcl_result_beg;
+    fcl::DistanceResultd fcl_result_end;
+    distance_beg = getSignedDistance(geom1, tf1_beg, geom2, tf2_beg, fcl_result_beg);
+    distance_end = getSignedDistance(geom1, tf1_end, geom2, tf2_end, fcl_result_end);
+    double motion_bound = getCastMotionBound(geom1, tf1_beg, tf1_end) + getCastMotionBound(geom2, tf2_beg, tf2_end);
+    check_distance = (0.5 * (distance_beg + distance_end - motion_bound) < max_margin);
+  }
+
+  if (!ccd_result.is_collide && !check_distance)
+    return cdata->done;
+
+  // Only checking if any contact exists so the nearest points and continuous data are not needed
+  if (cdata->res == nullptr && !cdata->req.is_valid)
+  {
+    double distance{ 0 };
+    if (!ccd_result.is_collide)
+    {
+      double toc{ 0 };
+      fcl::Transform3d contact_tf1;
+      fcl::Transform3d contact_tf2;
+      fcl::DistanceResultd fcl_result;
+      distance = getCastMinimumDistance(
+          geom1, tf1_beg, tf1_end, geom2, tf2_beg, tf2_end, 0, 1, toc, contact_tf1, contact_tf2, fcl_result);
+    }
 
-    processResult(*cdata, contact, pc, found);
+    processAnyContact(
+        *cdata, distance, cd1->getName(), cd2->getName(), cd1->m_collisionObjectId, cd2->m_collisionObjectId);
+    return cdata->done;
   }
 
+  // Search the motion for the minimum distance. When the objects collide this is the deepest penetration after the
+  // time of contact, otherwise it is the closest approach of the objects.
+  double toc{ 0 };
+  fcl::Transform3d contact_tf1;
+  fcl::Transform3d contact_tf2;
+  fcl::DistanceResultd fcl_result;
+  double t_lower = (ccd_result.is_collide) ? ccd_result.time_of_contact : 0;
+  getCastMinimumDistance(
+      geom1, tf1_beg, tf1_end, geom2, tf2_beg, tf2_end, t_lower, 1, toc, contact_tf1, contact_tf2, fcl_result);
+
+  // The objects are at least touching at the time of contact
+  if (ccd_result.is_collide)
+    fcl_result.min_distance = std::min(fcl_result.min_distance, 0.0);
+
+  assert(!std::isnan(fcl_result.nearest_points[0](0)));
+
+  ContinuousCollisionType cc_type = ContinuousCollisionType::CCType_Between;
+  if (toc <= 0)
+    cc_type = ContinuousCollisionType::CCType_Time0;
+  else if (toc >= 1)
+    cc_type = ContinuousCollisionType::CCType_Time1;
+
+  // If only one of the objects is moving it is stored second to match the bullet cast managers
+  bool cast1 = (cd1->m_collisionFilterGroup == CollisionFilterGroups::KinematicFilter);
+  bool cast2 = (cd2->m_collisionFilterGroup == CollisionFilterGroups::KinematicFilter);
+  std::size_t i1 = (cast1 && !cast2) ? 1 : 0;
+  std::size_t i2 = 1 - i1;
+
+  ContactResult contact;
+  contact.link_names[i1] = cd1->getName();
+  contact.link_names[i2] = cd2->getName();
+  contact.shape_id[i1] = shape_id1;
+  contact.shape_id[i2] = shape_id2;
+  contact.subshape_id[i1] = static_cast<int>(fcl_result.b1);
+  contact.subshape_id[i2] = static_cast<int>(fcl_result.b2);
+  contact.nearest_points[i1] = fcl_result.nearest_points[0];
+  contact.nearest_points[i2] = fcl_result.nearest_points[1];
+  contact.nearest_points_local[i1] = shape_pose1 * (contact_tf1.inverse() * fcl_result.nearest_points[0]);
+  contact.nearest_points_local[i2] = shape_pose2 * (contact_tf2.inverse() * fcl_result.nearest_points[1]);
+  contact.transform[i1] = cd1->getCollisionObjectsTransform();
+  contact.transform[i2] = cd2->getCollisionObjectsTransform();
+  contact.type_id[i1] = cd1->getTypeID();
+  contact.type_id[i2] = cd2->getTypeID();
+  contact.distance = fcl_result.min_distance;
+  contact.normal = getCastContactNormal(geom1, contact_tf1, tf1_beg, geom2, contact_tf2, tf2_beg, fcl_result);
+  if (i1 == 1)
+    contact.normal *= -1;
+
+  if (cast1)
+  {
+    contact.cc_time[i1] = toc;
+    contact.cc_type[i1] = cc_type;
+    contact.cc_transform[i1] = cd1->getCollisionObjectsTransformEnd();
+  }
+
+  if (cast2)
+  {
+    contact.cc_time[i2] = toc;
+    contact.cc_type[i2] = cc_type;
+    contact.cc_transform[i2] = cd2->getCollisionObjectsTransformEnd();
+  }
+
+  ObjectPairKey pc = getObjectPairKey(cd1->getName(), cd2->getName());
+  bool found = (cdata->res != nullptr && cdata->res->find(pc) != cdata->res->end());
+
+  processResult(*cdata, contact, pc, found, cd1->m_collisionObjectId, cd2->m_collisionObjectId);
+
   return cdata->done;
 }
 
@@ -0,0 +1,245 @@
+/**
+ * @file sdf_discrete_manager.h
+ * @brief Discrete contact manager using signed distance fields
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, agent
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_SDF_SDF_DISCRETE_MANAGER_H
+#define TESSERACT_COLLISION_SDF_SDF_DISCRETE_MANAGER_H
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/sdf/sdf_utils.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+/**
+ * @brief A discrete contact manager that answers distance queries from precomputed signed distance fields
+ * @details Every collision object gets a signed distance field in its own frame and every active collision object is
+ * approximated by spheres covering its surface. A pair is checked by looking up the distance field of one object at
+ * the sphere centers of the active object, so dense meshes cost the same as primitives once the field is built.
+ *
+ * Both are built when the object is added, so adding objects is expensive and contact tests do not modify the objects.
+ * Moving an object only changes the transform used for the lookup. Pairs of active objects use the distance field of
+ * the object added first.
+ *
+ * The reported distance is at most the sphere approximation error (sqrt(3) * sphere resolution) smaller than the true
+ * distance, plus about one voxel of distance field error for meshes and octrees. Contacts provide a single point on
+ * each object, the shape id of both objects and no sub shape id.
+ */
+class SDFDiscreteManager : public DiscreteContactManager
+{
+public:
+  using Ptr = std::shared_ptr<SDFDiscreteManager>;
+  using ConstPtr = std::shared_ptr<const SDFDiscreteManager>;
+  using UPtr = std::unique_ptr<SDFDiscreteManager>;
+  using ConstUPtr = std::unique_ptr<const SDFDiscreteManager>;
+
+  /**
+   * @brief Constructor
+   * @param name The name of the contact manager
+   * @param resolution The voxel size of the signed distance fields
+   * @param padding The distance the signed distance fields extend beyond the geometry
+   * @param sphere_resolution The voxel size used to place the spheres approximating the active objects
+   */
+  SDFDiscreteManager(std::string name = "SDFDiscreteManager",
+                     double resolution = 0.02,
+                     double padding = 0.25,
+                     double sphere_resolution = 0.02);
+  ~SDFDiscreteManager() override = default;
+  SDFDiscreteManager(const SDFDiscreteManager&) = delete;
+  SDFDiscreteManager& operator=(const SDFDiscreteManager&) = delete;
+  SDFDiscreteManager(SDFDiscreteManager&&) = delete;
+  SDFDiscreteManager& operator=(SDFDiscreteManager&&) = delete;
+
+  std::string getName() const override final;
+
+  DiscreteContactManager::UPtr clone() const override final;
+
+  bool addCollisionObject(const std::string& name,
+                          const int& mask_id,
+                          const CollisionShapesConst& shapes,
+                          const tesseract_common::VectorIsometry3d& shape_poses,
+                          bool enabled = true) override final;
+
+  const CollisionShapesConst& getCollisionObjectGeometries(const std::string& name) const override final;
+
+  const tesseract_common::VectorIsometry3d&
+  getCollisionObjectGeometriesTransforms(const std::string& name) const override final;
+
+  bool hasCollisionObject(const std::string& name) const override final;
+
+  bool removeCollisionObject(const std::string& name) override final;
+
+  bool enableCollisionObject(const std::string& name) override final;
+
+  bool disableCollisionObject(const std::string& name) override final;
+
+  bool isCollisionObjectEnabled(const std::string& name) const override final;
+
+  void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override final;
+
+  void setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                    const tesseract_common::VectorIsometry3d& poses) override final;
+
+  void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override final;
+
+  const std::vector<std::string>& getCollisionObjects() const override final;
+
+  void setActiveCollisionObjects(const std::vector<std::string>& names) override final;
+
+  const std::vector<std::string>& getActiveCollisionObjects() const override final;
+
+  void setCollisionMarginData(
+      CollisionMarginData collision_margin_data,
+      CollisionMarginOverrideType override_type = CollisionMarginOverrideType::REPLACE) override final;
+
+  void setDefaultCollisionMarginData(double default_collision_margin) override final;
+
+  void setPairCollisionMarginData(const std::string& name1,
+                                  const std::string& name2,
+                                  double collision_margin) override final;
+
+  const CollisionMarginData& getCollisionMarginData() const override final;
+
+  void setIsContactAllowedFn(IsContactAllowedFn fn) override final;
+
+  IsContactAllowedFn getIsContactAllowedFn() const override final;
+
+  using DiscreteContactManager::contactTest;
+
+  void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
+
+  bool anyContactTest(const ContactRequest& request) override final;
+
+  /** @brief Get the voxel size of the signed distance fields */
+  double getResolution() const;
+
+  /** @brief Get the distance the signed distance fields extend beyond the geometry */
+  double getPadding() const;
+
+  /** @brief Get the voxel size used to place the spheres approximating the active objects */
+  double getSphereResolution() const;
+
+private:
+  /** @brief A collision object with its signed distance field and sphere approximation */
+  struct CollisionObject
+  {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    using Ptr = std::shared_ptr<CollisionObject>;
+
+    std::string name;
+    int type_id{ 0 };
+    CollisionShapesConst shapes;
+    tesseract_common::VectorIsometry3d shape_poses;
+    Eigen::Isometry3d world_pose{ Eigen::Isometry3d::Identity() };
+    bool enabled{ true };
+    bool active{ true };
+
+    /** @brief The id of the collision object in the collision margin table */
+    int id{ -1 };
+
+    /** @brief The link id in the compiled allowed collision matrix, see ContactTestData */
+    long acm_id{ -1 };
+
+    /** @brief The signed distance field in the collision object frame */
+    SignedDistanceField::ConstPtr sdf;
+
+    /** @brief The spheres approximating the surface in the collision object frame */
+    std::shared_ptr<const CollisionSpheres> spheres;
+
+    /** @brief The center of a sphere containing all spheres in the collision object frame */
+    Eigen::Vector3d spheres_center{ Eigen::Vector3d::Zero() };
+
+    /** @brief The radius of a sphere containing all spheres */
+    double spheres_radius{ 0 };
+  };
+
+  std::string name_;
+  double resolution_;
+  double padding_;
+  double sphere_resolution_;
+
+  std::map<std::string, CollisionObject::Ptr> link2obj_; /**< @brief A map of all collision objects being managed */
+  std::vector<CollisionObject::Ptr> objects_;  /**< @brief The collision objects ordered like collision_objects_ */
+  std::vector<std::string> active_;            /**< @brief A list of the active collision objects */
+  std::vector<std::string> collision_objects_; /**< @brief A list of the collision objects */
+  CollisionMarginData collision_margin_data_;  /**< @brief The contact distance threshold */
+  IsContactAllowedFn fn_;                      /**< @brief The is allowed collision function */
+
+  /** @brief The collision margin data indexed by the collision object ids */
+  CollisionMarginTable collision_margin_table_;
+
+  /** @brief Indicates the collision objects changed since the collision margin table was last updated */
+  bool collision_margin_table_dirty_{ false };
+
+  /** @brief The link id revision of the allowed collision matrix the link ids of the collision objects were set for */
+  std::size_t allowed_collision_link_id_revision_{ 0 };
+
+  /** @brief Indicates the collision objects changed since their allowed collision matrix link ids were last set */
+  bool allowed_collision_link_ids_dirty_{ true };
+
+  /** @brief The index of the closest sphere of each shape, reused between pair checks */
+  std::vector<std::size_t> closest_spheres_;
+
+  /** @brief The distance of the closest sphere of each shape, reused between pair checks */
+  std::vector<double> closest_distances_;
+
+  /** @brief Add a collision object to the manager */
+  void addCollisionObject(const CollisionObject::Ptr& obj);
+
+  /** @brief This function will assign the collision object ids and rebuild the collision margin table */
+  void updateCollisionMarginTable();
+
+  /**
+   * @brief This function will set the allowed collision matrix link ids of the collision objects if they changed
+   * @return The compiled allowed collision matrix queried by the contact allowed function, nullptr if there is none
+   */
+  const tesseract_common::CompiledAllowedCollisionMatrix* updateAllowedCollisionLinkIds();
+
+  /** @brief Build the sphere approximation of a collision object if it does not exist */
+  void updateSpheres(CollisionObject& obj) const;
+
+  /** @brief Build the signed distance field of a collision object if it does not exist */
+  void updateSignedDistanceField(CollisionObject& obj) const;
+
+  /**
+   * @brief Check the spheres of one collision object against the signed distance field of another
+   * @param cdata The contact test data to populate
+   * @param sphere_obj The active collision object providing the spheres
+   * @param sdf_obj The collision object providing the signed distance field
+   * @param margin The pair collision margin
+   */
+  void contactTest(ContactTestData& cdata,
+                   const CollisionObject& sphere_obj,
+                   const CollisionObject& sdf_obj,
+                   double margin);
+
+  /**
+   * @brief Check all pairs for the current collision object transforms
+   * @param cdata The contact test data to populate
+   */
+  void contactTest(ContactTestData& cdata);
+};
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
+#endif  // TESSERACT_COLLISION_SDF_SDF_DISCRETE_MANAGER_H
@@ -0,0 +1,57 @@
+/**
+ * @file sdf_utils.h
+ * @brief Utilities for building signed distance fields of collision objects
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, agent
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_SDF_SDF_UTILS_H
+#define TESSERACT_COLLISION_SDF_SDF_UTILS_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <Eigen/Geometry>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/types.h>
+#include <tesseract_collision/core/voxel_utils.h>
+#include <tesseract_collision/sdf/signed_distance_field.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+/**
+ * @brief Create the signed distance field of a collision object
+ * @details Primitive shapes are sampled exactly. Meshes and octrees are voxelized and converted with a euclidean
+ * distance transform, so their distances are accurate to about one voxel. Closed meshes are filled, open meshes are
+ * treated as thin surfaces.
+ * @param shapes The collision object shapes
+ * @param shape_poses The shape poses in the collision object frame
+ * @param resolution The edge length of a voxel
+ * @param padding The distance the field extends beyond the shapes, at least one voxel is always added
+ * @return The signed distance field in the collision object frame, nullptr if no shape is supported
+ */
+SignedDistanceField::Ptr createSignedDistanceField(const CollisionShapesConst& shapes,
+                                                   const tesseract_common::VectorIsometry3d& shape_poses,
+                                                   double resolution,
+                                                   double padding);
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
+#endif  // TESSERACT_COLLISION_SDF_SDF_UTILS_H
@@ -0,0 +1,140 @@
+/**
+ * @file signed_distance_field.h
+ * @brief A voxelized signed distance field
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, agent
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_SDF_SIGNED_DISTANCE_FIELD_H
+#define TESSERACT_COLLISION_SDF_SIGNED_DISTANCE_FIELD_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <Eigen/Core>
+#include <limits>
+#include <memory>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+/**
+ * @brief A regular grid of signed distances sampled at the voxel centers
+ * @details Distances are negative inside the geometry and positive outside. Values between the voxel centers are
+ * recovered by trilinear interpolation. Each voxel also stores the index of the closest shape of the collision object
+ * the field was built from, so contacts can report the shape id.
+ */
+class SignedDistanceField
+{
+public:
+  using Ptr = std::shared_ptr<SignedDistanceField>;
+  using ConstPtr = std::shared_ptr<const SignedDistanceField>;
+
+  SignedDistanceField() = default;
+
+  /**
+   * @brief Create a distance field with every voxel set to the same distance
+   * @param origin The center of the first voxel
+   * @param resolution The edge length of a voxel
+   * @param size The number of voxels along each axis, must be at least two
+   * @param distance The initial distance of every voxel
+   */
+  SignedDistanceField(const Eigen::Vector3d& origin,
+                      double resolution,
+                      const Eigen::Vector3i& size,
+                      double distance = std::numeric_limits<double>::max());
+
+  /** @brief Get the center of the first voxel */
+  const Eigen::Vector3d& getOrigin() const;
+
+  /** @brief Get the edge length of a voxel */
+  double getResolution() const;
+
+  /** @brief Get the number of voxels along each axis */
+  const Eigen::Vector3i& getSize() const;
+
+  /** @brief Get the total number of voxels */
+  std::size_t getVoxelCount() const;
+
+  /** @brief Get the center of the last voxel */
+  Eigen::Vector3d getMaxBound() const;
+
+  /**
+   * @brief Get the flat index of a voxel
+   * @param x The voxel index along the x axis
+   * @param y The voxel index along the y axis
+   * @param z The voxel index along the z axis
+   * @return The flat index
+   */
+  std::size_t getIndex(int x, int y, int z) const;
+
+  /**
+   * @brief Get the center of a voxel
+   * @param x The voxel index along the x axis
+   * @param y The voxel index along the y axis
+   * @param z The voxel index along the z axis
+   * @return The voxel center
+   */
+  Eigen::Vector3d getVoxelCenter(int x, int y, int z) const;
+
+  /** @brief Get the distances of all voxels indexed by the flat index */
+  std::vector<double>& getDistances();
+  const std::vector<double>& getDistances() const;
+
+  /** @brief Get the closest shape index of all voxels indexed by the flat index */
+  std::vector<int>& getShapeIds();
+  const std::vector<int>& getShapeIds() const;
+
+  /**
+   * @brief Get the distance from a point to the box spanned by the voxel centers
+   * @param point The point in the frame of the distance field
+   * @return The distance, zero if the point is inside the box
+   */
+  double getDistanceToBounds(const Eigen::Vector3d& point) const;
+
+  /**
+   * @brief Get the signed distance at a point
+   * @details Points outside the grid are projected onto it and the projection distance is added.
+   * @param point The point in the frame of the distance field
+   * @return The interpolated signed distance
+   */
+  double getDistance(const Eigen::Vector3d& point) const;
+
+  /**
+   * @brief Get the signed distance and its gradient at a point
+   * @details Points outside the grid are projected onto it and the projection distance is added.
+   * @param point The point in the frame of the distance field
+   * @param gradient The gradient of the distance, it points away from the geometry and is not normalized
+   * @param shape_id The index of the closest shape
+   * @return The interpolated signed distance
+   */
+  double getDistance(const Eigen::Vector3d& point, Eigen::Vector3d& gradient, int& shape_id) const;
+
+private:
+  Eigen::Vector3d origin_{ Eigen::Vector3d::Zero() }; /**< @brief The center of the first voxel */
+  double resolution_{ 0 };                             /**< @brief The edge length of a voxel */
+  Eigen::Vector3i size_{ Eigen::Vector3i::Zero() };    /**< @brief The number of voxels along each axis */
+  std::vector<double> distances_;                      /**< @brief The signed distance at each voxel center */
+  std::vector<int> shape_ids_;                         /**< @brief The closest shape index of each voxel */
+};
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
+#endif  // TESSERACT_COLLISION_SDF_SIGNED_DISTANCE_FIELD_H
@@ -0,0 +1,454 @@
+/**
+ * @file sdf_discrete_manager.cpp
+ * @brief Discrete contact manager using signed distance fields
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, agent
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <limits>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/sdf/sdf_discrete_manager.h>
+#include <tesseract_collision/core/common.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+static const CollisionShapesConst EMPTY_COLLISION_SHAPES_CONST;
+static const tesseract_common::VectorIsometry3d EMPTY_COLLISION_SHAPES_TRANSFORMS;
+
+SDFDiscreteManager::SDFDiscreteManager(std::string name, double resolution, double padding, double sphere_resolution)
+  : name_(std::move(name)), resolution_(resolution), padding_(padding), sphere_resolution_(sphere_resolution)
+{
+  assert(resolution_ > 0);
+  assert(sphere_resolution_ > 0);
+  collision_margin_data_ = CollisionMarginData(0);
+}
+
+std::string SDFDiscreteManager::getName() const { return name_; }
+
+DiscreteContactManager::UPtr SDFDiscreteManager::clone() const
+{
+  auto manager = std::make_unique<SDFDiscreteManager>(name_, resolution_, padding_, sphere_resolution_);
+
+  // The distance fields and spheres are immutable so they are shared with the clone
+  for (const auto& obj : objects_)
+    manager->addCollisionObject(std::make_shared<CollisionObject>(*obj));
+
+  manager->setActiveCollisionObjects(active_);
+  manager->setCollisionMarginData(collision_margin_data_);
+  manager->setIsContactAllowedFn(fn_);
+  manager->setDenseLinkNames(dense_link_names_);
+
+  return manager;
+}
+
+bool SDFDiscreteManager::addCollisionObject(const std::string& name,
+                                            const int& mask_id,
+                                            const CollisionShapesConst& shapes,
+                                            const tesseract_common::VectorIsometry3d& shape_poses,
+                                            bool enabled)
+{
+  if (link2obj_.find(name) != link2obj_.end())
+    removeCollisionObject(name);
+
+  // dont add object that does not have geometry
+  if (shapes.empty() || shape_poses.empty() || (shapes.size() != shape_poses.size()))
+  {
+    CONSOLE_BRIDGE_logDebug("ignoring link %s", name.c_str());
+    return false;
+  }
+
+  for (const auto& shape : shapes)
+  {
+    if (!isVoxelizationSupported(*shape))
+    {
+      CONSOLE_BRIDGE_logError("This geometric shape type (%d) is not supported using SDF yet",
+                              static_cast<int>(shape->getType()));
+      return false;
+    }
+  }
+
+  auto obj = std::make_shared<CollisionObject>();
+  obj->name = name;
+  obj->type_id = mask_id;
+  obj->shapes = shapes;
+  obj->shape_poses = shape_poses;
+  obj->enabled = enabled;
+  addCollisionObject(obj);
+  return true;
+}
+
+const CollisionShapesConst& SDFDiscreteManager::getCollisionObjectGeometries(const std::string& name) const
+{
+  auto it = link2obj_.find(name);
+  return (it != link2obj_.end()) ? it->second->shapes : EMPTY_COLLISION_SHAPES_CONST;
+}
+
+const tesseract_common::VectorIsometry3d&
+SDFDiscreteManager::getCollisionObjectGeometriesTransforms(const std::string& name) const
+{
+  auto it = link2obj_.find(name);
+  return (it != link2obj_.end()) ? it->second->shape_poses : EMPTY_COLLISION_SHAPES_TRANSFORMS;
+}
+
+bool SDFDiscreteManager::hasCollisionObject(const std::string& name) const
+{
+  return (link2obj_.find(name) != link2obj_.end());
+}
+
+bool SDFDiscreteManager::removeCollisionObject(const std::string& name)
+{
+  auto it = link2obj_.find(name);
+  if (it != link2obj_.end())
+  {
+    objects_.erase(std::find(objects_.begin(), objects_.end(), it->second));
+    collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
+    link2obj_.erase(it);
+    collision_margin_table_dirty_ = true;
+    return true;
+  }
+  return false;
+}
+
+bool SDFDiscreteManager::enableCollisionObject(const std::string& name)
+{
+  auto it = link2obj_.find(name);
+  if (it != link2obj_.end())
+  {
+    it->second->enabled = true;
+    return true;
+  }
+  return false;
+}
+
+bool SDFDiscreteManager::disableCollisionObject(const std::string& name)
+{
+  auto it = link2obj_.find(name);
+  if (it != link2obj_.end())
+  {
+    it->second->enabled = false;
+    return true;
+  }
+  return false;
+}
+
+bool SDFDiscreteManager::isCollisionObjectEnabled(const std::string& name) const
+{
+  auto it = link2obj_.find(name);
+  if (it != link2obj_.end())
+    return it->second->enabled;
+
+  return false;
+}
+
+void SDFDiscreteManager::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
+{
+  auto it = link2obj_.find(name);
+  if (it != link2obj_.end())
+    it->second->world_pose = pose;
+}
+
+void SDFDiscreteManager::setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                                      const tesseract_common::VectorIsometry3d& poses)
+{
+  assert(names.size() == poses.size());
+  for (auto i = 0U; i < names.size(); ++i)
+    setCollisionObjectsTransform(names[i], poses[i]);
+}
+
+void SDFDiscreteManager::setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms)
+{
+  for (const auto& transform : transforms)
+    setCollisionObjectsTransform(transform.first, transform.second);
+}
+
+const std::vector<std::string>& SDFDiscreteManager::getCollisionObjects() const { return collision_objects_; }
+
+void SDFDiscreteManager::setActiveCollisionObjects(const std::vector<std::string>& names)
+{
+  active_ = names;
+
+  for (auto& obj : objects_)
+    obj->active = isLinkActive(active_, obj->name);
+}
+
+const std::vector<std::string>& SDFDiscreteManager::getActiveCollisionObjects() const { return active_; }
+
+void SDFDiscreteManager::setCollisionMarginData(CollisionMarginData collision_margin_data,
+                                                CollisionMarginOverrideType override_type)
+{
+  collision_margin_data_.apply(collision_margin_data, override_type);
+  updateCollisionMarginTable();
+}
+
+void SDFDiscreteManager::setDefaultCollisionMarginData(double default_collision_margin)
+{
+  collision_margin_data_.setDefaultCollisionMargin(default_collision_margin);
+  updateCollisionMarginTable();
+}
+
+void SDFDiscreteManager::setPairCollisionMarginData(const std::string& name1,
+                                                    const std::string& name2,
+                                                    double collision_margin)
+{
+  collision_margin_data_.setPairCollisionMargin(name1, name2, collision_margin);
+  updateCollisionMarginTable();
+}
+
+const CollisionMarginData& SDFDiscreteManager::getCollisionMarginData() const { return collision_margin_data_; }
+void SDFDiscreteManager::setIsContactAllowedFn(IsContactAllowedFn fn) { fn_ = fn; }
+IsContactAllowedFn SDFDiscreteManager::getIsContactAllowedFn() const { return fn_; }
+
+void SDFDiscreteManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
+{
+  ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions);
+  cdata.res_pool = &contact_result_map_pool_;
+  contactTest(cdata);
+}
+
+bool SDFDiscreteManager::anyContactTest(const ContactRequest& request)
+{
+  ContactTestData cdata;
+  cdata.active = &active_;
+  cdata.collision_margin_data = collision_margin_data_;
+  cdata.fn = fn_;
+  cdata.req = request;
+  contactTest(cdata);
+  return cdata.done;
+}
+
+double SDFDiscreteManager::getResolution() const { return resolution_; }
+
+double SDFDiscreteManager::getPadding() const { return padding_; }
+
+double SDFDiscreteManager::getSphereResolution() const { return sphere_resolution_; }
+
+void SDFDiscreteManager::addCollisionObject(const CollisionObject::Ptr& obj)
+{
+  // Any object may become active or be checked against an active object, so both are built up front
+  updateSpheres(*obj);
+  updateSignedDistanceField(*obj);
+
+  obj->active = isLinkActive(active_, obj->name);
+  link2obj_[obj->name] = obj;
+  objects_.push_back(obj);
+  collision_objects_.push_back(obj->name);
+  collision_margin_table_dirty_ = true;
+  allowed_collision_link_ids_dirty_ = true;
+}
+
+void SDFDiscreteManager::updateCollisionMarginTable()
+{
+  collision_margin_table_.update(collision_margin_data_, collision_objects_);
+  for (std::size_t i = 0; i < objects_.size(); ++i)
+    objects_[i]->id = static_cast<int>(i);
+
+  collision_margin_table_dirty_ = false;
+}
+
+void SDFDiscreteManager::updateSpheres(CollisionObject& obj) const
+{
+  if (obj.spheres != nullptr)
+    return;
+
+  auto spheres = std::make_shared<CollisionSpheres>(
+      createCollisionSpheres(obj.shapes, obj.shape_poses, sphere_resolution_));
+
+  // Bound all spheres by a single sphere used to skip pairs that are far apart
+  obj.spheres_center.setZero();
+  obj.spheres_radius = 0;
+  if (!spheres->empty())
+  {
+    Eigen::Vector3d aabb_min = Eigen::Vector3d::Constant(std::numeric_limits<double>::max());
+    Eigen::Vector3d aabb_max = Eigen::Vector3d::Constant(-std::numeric_limits<double>::max());
+    for (const auto& sphere : *spheres)
+    {
+      aabb_min = aabb_min.cwiseMin(sphere.center);
+      aabb_max = aabb_max.cwiseMax(sphere.center);
+    }
+
+    obj.spheres_center = (aabb_min + aabb_max) / 2.0;
+    for (const auto& sphere : *spheres)
+      obj.spheres_radius = std::max(obj.spheres_radius, (sphere.center - obj.spheres_center).norm() + sphere.radius);
+  }
+
+  obj.spheres = spheres;
+}
+
+void SDFDiscreteManager::updateSignedDistanceField(CollisionObject& obj) const
+{
+  if (obj.sdf == nullptr)
+    obj.sdf = createSignedDistanceField(obj.shapes, obj.shape_poses, resolution_, padding_);
+}
+
+void SDFDiscreteManager::contactTest(ContactTestData& cdata)
+{
+  if (collision_margin_table_dirty_)
+    updateCollisionMarginTable();
+
+  cdata.collision_margin_table = &collision_margin_table_;
+  cdata.compiled_acm = updateAllowedCollisionLinkIds();
+
+  for (std::size_t i = 0; i < objects_.size(); ++i)
+  {
+    const CollisionObject& obj1 = *objects_[i];
+    if (!obj1.enabled || !obj1.active)
+      continue;
+
+    for (std::size_t j = 0; j < objects_.size(); ++j)
+    {
+      const CollisionObject& obj2 = *objects_[j];
+
+      // Pairs of active objects are only checked once
+      if (i == j || !obj2.enabled || (obj2.active && j < i))
+        continue;
+
+      if (isContactAllowed(obj1.name, obj1.acm_id, obj2.name, obj2.acm_id, cdata, false))
+        continue;
+
+      // Pairs of active objects use the distance field of the object added first
+      const CollisionObject& sphere_obj = (obj2.active) ? obj2 : obj1;
+      const CollisionObject& sdf_obj = (obj2.active) ? obj1 : obj2;
+      if (sdf_obj.sdf == nullptr || sphere_obj.spheres->empty())
+        continue;
+
+      double margin = collision_margin_table_.getPairCollisionMargin(obj1.id, obj2.id);
+      contactTest(cdata, sphere_obj, sdf_obj, margin);
+      if (cdata.done)
+        return;
+    }
+  }
+}
+
+void SDFDiscreteManager::contactTest(ContactTestData& cdata,
+                                     const CollisionObject& sphere_obj,
+                                     const CollisionObject& sdf_obj,
+                                     double margin)
+{
+  const SignedDistanceField& sdf = *sdf_obj.sdf;
+  const CollisionSpheres& spheres = *sphere_obj.spheres;
+
+  // The transform from the sphere object frame to the distance field frame
+  const Eigen::Isometry3d sdf_obj_inv = sdf_obj.world_pose.inverse();
+  const Eigen::Isometry3d tf = sdf_obj_inv * sphere_obj.world_pose;
+
+  // The geometry is inside the grid, so nothing is within the margin if the bounding sphere is far enough from the grid
+  if (sdf.getDistanceToBounds(tf * sphere_obj.spheres_center) > sphere_obj.spheres_radius + margin)
+    return;
+
+  // Only checking if any contact exists so the contact result is not needed
+  const bool any_contact = (cdata.res == nullptr && !cdata.req.is_valid);
+  const std::size_t none = spheres.size();
+  closest_spheres_.assign(sphere_obj.shapes.size(), none);
+  closest_distances_.assign(sphere_obj.shapes.size(), std::numeric_limits<double>::max());
+  for (std::size_t i = 0; i < spheres.size(); ++i)
+  {
+    const CollisionSphere& sphere = spheres[i];
+    Eigen::Vector3d center = tf * sphere.center;
+    if (sdf.getDistanceToBounds(center) > sphere.radius + margin)
+      continue;
+
+    double distance = sdf.getDistance(center) - sphere.radius;
+    if (distance > margin)
+      continue;
+
+    if (any_contact)
+    {
+      processAnyContact(cdata, distance, sphere_obj.name, sdf_obj.name, sphere_obj.id, sdf_obj.id);
+      return;
+    }
+
+    auto shape_index = static_cast<std::size_t>(sphere.shape_id);
+    if (distance < closest_distances_[shape_index])
+    {
+      closest_distances_[shape_index] = distance;
+      closest_spheres_[shape_index] = i;
+    }
+  }
+
+  // The contact is reported in the order of the pair key
+  ObjectPairKey key = getObjectPairKey(sphere_obj.name, sdf_obj.name);
+  const std::size_t s = (key.first == sphere_obj.name) ? 0 : 1;
+  const std::size_t d = 1 - s;
+  const Eigen::Isometry3d sphere_obj_inv = sphere_obj.world_pose.inverse();
+  for (std::size_t closest_sphere : closest_spheres_)
+  {
+    if (closest_sphere == none)
+      continue;
+
+    const CollisionSphere& sphere = spheres[closest_sphere];
+    Eigen::Vector3d gradient;
+    int shape_id{ -1 };
+    double center_distance = sdf.getDistance(tf * sphere.center, gradient, shape_id);
+
+    // The direction to move the sphere object away from the distance field object
+    Eigen::Vector3d direction = sdf_obj.world_pose.linear() * gradient;
+    double norm = direction.norm();
+    direction = (norm > 0) ? Eigen::Vector3d(direction / norm) : Eigen::Vector3d::UnitZ();
+
+    Eigen::Vector3d center = sphere_obj.world_pose * sphere.center;
+    ContactResult contact;
+    contact.link_names[s] = sphere_obj.name;
+    contact.link_names[d] = sdf_obj.name;
+    contact.shape_id[s] = sphere.shape_id;
+    contact.shape_id[d] = shape_id;
+    contact.type_id[s] = sphere_obj.type_id;
+    contact.type_id[d] = sdf_obj.type_id;
+    contact.nearest_points[s] = center - (sphere.radius * direction);
+    contact.nearest_points[d] = center - (center_distance * direction);
+    contact.nearest_points_local[s] = sphere_obj_inv * contact.nearest_points[s];
+    contact.nearest_points_local[d] = sdf_obj_inv * contact.nearest_points[d];
+    contact.transform[s] = sphere_obj.world_pose;
+    contact.transform[d] = sdf_obj.world_pose;
+    contact.distance = center_distance - sphere.radius;
+
+    // The normal points from link_names[0] to link_names[1]
+    contact.normal = (s == 1) ? direction : Eigen::Vector3d(-direction);
+
+    bool found = (cdata.res != nullptr && cdata.res->find(key) != cdata.res->end());
+    processResult(cdata, contact, key, found, sphere_obj.id, sdf_obj.id);
+    if (cdata.done)
+      return;
+  }
+}
+
+const tesseract_common::CompiledAllowedCollisionMatrix* SDFDiscreteManager::updateAllowedCollisionLinkIds()
+{
+  const tesseract_common::CompiledAllowedCollisionMatrix* compiled_acm = getCompiledAllowedCollisionMatrix(fn_);
+  if (compiled_acm == nullptr)
+    return nullptr;
+
+  const std::size_t revision = compiled_acm->getLinkIdRevision();
+  if (!allowed_collision_link_ids_dirty_ && revision == allowed_collision_link_id_revision_)
+    return compiled_acm;
+
+  for (const auto& obj : objects_)
+    obj->acm_id = compiled_acm->getLinkId(obj->name);
+
+  allowed_collision_link_id_revision_ = revision;
+  allowed_collision_link_ids_dirty_ = false;
+  return compiled_acm;
+}
+}  // namespace tesseract_collision::tesseract_collision_sdf
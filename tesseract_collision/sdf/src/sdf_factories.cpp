@@ -0,0 +1,80 @@
+/**
+ * @file sdf_factories.cpp
+ * @brief Factories for loading the SDF contact managers as plugins
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, agent
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <yaml-cpp/yaml.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/sdf/sdf_factories.h>
+#include <tesseract_collision/sdf/sdf_discrete_manager.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+DiscreteContactManager::UPtr SDFDiscreteManagerFactory::create(const std::string& name,
+                                                               const YAML::Node& config) const
+{
+  double resolution{ 0.02 };
+  double padding{ 0.25 };
+  double sphere_resolution{ 0.02 };
+
+  try
+  {
+    if (YAML::Node n = config["resolution"])
+      resolution = n.as<double>();
+
+    if (YAML::Node n = config["padding"])
+      padding = n.as<double>();
+
+    if (YAML::Node n = config["sphere_resolution"])
+      sphere_resolution = n.as<double>();
+
+    if (resolution <= 0)
+      throw std::runtime_error("SDFDiscreteManagerFactory, 'resolution' must be greater than zero");
+
+    if (padding < 0)
+      throw std::runtime_error("SDFDiscreteManagerFactory, 'padding' must not be negative");
+
+    if (sphere_resolution <= 0)
+      throw std::runtime_error("SDFDiscreteManagerFactory, 'sphere_resolution' must be greater than zero");
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("SDFDiscreteManagerFactory: Failed to parse yaml config data! Details: %s", e.what());
+    return nullptr;
+  }
+
+  return std::make_unique<SDFDiscreteManager>(name, resolution, padding, sphere_resolution);
+}
+
+TESSERACT_PLUGIN_ANCHOR_IMPL(SDFFactoriesAnchor)
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+TESSERACT_ADD_DISCRETE_MANAGER_PLUGIN(tesseract_collision::tesseract_collision_sdf::SDFDiscreteManagerFactory,
+                                      SDFDiscreteManagerFactory);
@@ -0,0 +1,173 @@
+/**
+ * @file sdf_utils.cpp
+ * @brief Utilities for building signed distance fields of collision objects
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, agent
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <algorithm>
+#include <cmath>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/sdf/sdf_utils.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+/**
+ * @brief Add the distances of voxelized geometry to a signed distance field
+ * @param sdf The signed distance field, a distance is only replaced if the new distance is smaller
+ * @param occupied The shape id of each voxel occupied by a mesh surface or an octree leaf, -1 if not occupied
+ */
+static void addOccupiedDistances(SignedDistanceField& sdf, const std::vector<int>& occupied)
+{
+  const Eigen::Vector3i& size = sdf.getSize();
+  const std::size_t count = sdf.getVoxelCount();
+
+  // Voxels that are not reached from the boundary of the grid are inside closed surfaces
+  std::vector<char> blocked(count, 0);
+  for (std::size_t i = 0; i < count; ++i)
+    blocked[i] = (occupied[i] >= 0) ? 1 : 0;
+
+  const std::vector<char> exterior = floodFillExterior(size, blocked);
+
+  std::vector<double> to_occupied(count);
+  std::vector<double> to_exterior(count);
+  std::vector<std::size_t> closest(count);
+  bool has_occupied{ false };
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    has_occupied = has_occupied || (occupied[i] >= 0);
+    to_occupied[i] = (occupied[i] >= 0) ? 0 : DISTANCE_TRANSFORM_INF;
+    to_exterior[i] = (exterior[i] != 0) ? 0 : DISTANCE_TRANSFORM_INF;
+    closest[i] = i;
+  }
+
+  if (!has_occupied)
+    return;
+
+  distanceTransform(size, to_occupied, &closest);
+  distanceTransform(size, to_exterior, nullptr);
+
+  // The surface is assumed to be half way between the occupied voxels and their free neighbors
+  const double resolution = sdf.getResolution();
+  const double half_resolution = resolution / 2.0;
+  std::vector<double>& distances = sdf.getDistances();
+  std::vector<int>& shape_ids = sdf.getShapeIds();
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    double distance = (exterior[i] != 0) ? (resolution * std::sqrt(to_occupied[i])) - half_resolution :
+                                           half_resolution - (resolution * std::sqrt(to_exterior[i]));
+    if (distance < distances[i])
+    {
+      distances[i] = distance;
+      shape_ids[i] = occupied[closest[i]];
+    }
+  }
+}
+
+SignedDistanceField::Ptr createSignedDistanceField(const CollisionShapesConst& shapes,
+                                                   const tesseract_common::VectorIsometry3d& shape_poses,
+                                                   double resolution,
+                                                   double padding)
+{
+  Eigen::Vector3d aabb_min;
+  Eigen::Vector3d aabb_max;
+  if (resolution <= 0 || !getShapesAABB(shapes, shape_poses, aabb_min, aabb_max))
+    return nullptr;
+
+  // At least one voxel of padding is required so the exterior flood fill can start from the grid boundary
+  padding = std::max(padding, resolution);
+  Eigen::Vector3d origin = aabb_min - Eigen::Vector3d::Constant(padding);
+  Eigen::Vector3d extents = (aabb_max - aabb_min) + Eigen::Vector3d::Constant(2 * padding);
+  Eigen::Vector3i size;
+  for (Eigen::Index k = 0; k < 3; ++k)
+    size[k] = std::max(2, static_cast<int>(std::ceil(extents[k] / resolution)) + 1);
+
+  auto sdf = std::make_shared<SignedDistanceField>(origin, resolution, size);
+  std::vector<double>& distances = sdf->getDistances();
+  std::vector<int>& shape_ids = sdf->getShapeIds();
+
+  // The shape id of the voxels occupied by mesh surfaces and octree leaves, -1 if not occupied
+  std::vector<int> occupied(sdf->getVoxelCount(), -1);
+  const double half_resolution = resolution / 2.0;
+
+  for (std::size_t i = 0; i < shapes.size(); ++i)
+  {
+    const tesseract_geometry::Geometry& shape = *shapes[i];
+    const Eigen::Isometry3d& shape_pose = shape_poses[i];
+    const Eigen::Isometry3d shape_pose_inv = shape_pose.inverse();
+    const auto shape_id = static_cast<int>(i);
+    switch (shape.getType())
+    {
+      case tesseract_geometry::GeometryType::SPHERE:
+      case tesseract_geometry::GeometryType::BOX:
+      case tesseract_geometry::GeometryType::CYLINDER:
+      case tesseract_geometry::GeometryType::CAPSULE:
+      case tesseract_geometry::GeometryType::CONE:
+      {
+        // Primitives have an exact signed distance so they are sampled over the whole grid
+        forEachVoxel(origin, resolution, size, [&](std::size_t index, const Eigen::Vector3d& center) {
+          double distance{ 0 };
+          getPrimitiveSignedDistance(shape, shape_pose_inv * center, distance);
+          if (distance < distances[index])
+          {
+            distances[index] = distance;
+            shape_ids[index] = shape_id;
+          }
+        });
+        break;
+      }
+      case tesseract_geometry::GeometryType::MESH:
+      case tesseract_geometry::GeometryType::CONVEX_MESH:
+      case tesseract_geometry::GeometryType::SDF_MESH:
+      case tesseract_geometry::GeometryType::POLYGON_MESH:
+      {
+        // Mark the voxels with a center within half a voxel of a triangle. These form a wall without gaps between face
+        // neighbors, so the exterior flood fill cannot enter closed meshes.
+        const auto& mesh = static_cast<const tesseract_geometry::PolygonMesh&>(shape);
+        markMeshSurface(mesh, shape_pose, origin, resolution, size, half_resolution, occupied, shape_id);
+        break;
+      }
+      case tesseract_geometry::GeometryType::OCTREE:
+      {
+        const auto& octree = static_cast<const tesseract_geometry::Octree&>(shape);
+        markOctreeLeaves(octree, shape_pose, origin, resolution, size, -DISTANCE_TRANSFORM_INF, 0, occupied, shape_id);
+        break;
+      }
+      default:
+      {
+        CONSOLE_BRIDGE_logError("This geometric shape type (%d) is not supported by the signed distance field",
+                                static_cast<int>(shape.getType()));
+        break;
+      }
+    }
+  }
+
+  addOccupiedDistances(*sdf, occupied);
+
+  return sdf;
+}
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
@@ -0,0 +1,170 @@
+/**
+ * @file signed_distance_field.cpp
+ * @brief A voxelized signed distance field
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, agent
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cassert>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/sdf/signed_distance_field.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+SignedDistanceField::SignedDistanceField(const Eigen::Vector3d& origin,
+                                         double resolution,
+                                         const Eigen::Vector3i& size,
+                                         double distance)
+  : origin_(origin), resolution_(resolution), size_(size)
+{
+  assert(resolution > 0);
+  assert(size.minCoeff() >= 2);
+  distances_.assign(getVoxelCount(), distance);
+  shape_ids_.assign(getVoxelCount(), -1);
+}
+
+const Eigen::Vector3d& SignedDistanceField::getOrigin() const { return origin_; }
+
+double SignedDistanceField::getResolution() const { return resolution_; }
+
+const Eigen::Vector3i& SignedDistanceField::getSize() const { return size_; }
+
+std::size_t SignedDistanceField::getVoxelCount() const
+{
+  return static_cast<std::size_t>(size_.x()) * static_cast<std::size_t>(size_.y()) *
+         static_cast<std::size_t>(size_.z());
+}
+
+Eigen::Vector3d SignedDistanceField::getMaxBound() const
+{
+  return origin_ + (resolution_ * (size_ - Eigen::Vector3i::Ones()).cast<double>());
+}
+
+std::size_t SignedDistanceField::getIndex(int x, int y, int z) const
+{
+  assert(x >= 0 && x < size_.x() && y >= 0 && y < size_.y() && z >= 0 && z < size_.z());
+  return static_cast<std::size_t>(x + (size_.x() * (y + (size_.y() * z))));
+}
+
+Eigen::Vector3d SignedDistanceField::getVoxelCenter(int x, int y, int z) const
+{
+  return origin_ + (resolution_ * Eigen::Vector3d(x, y, z));
+}
+
+std::vector<double>& SignedDistanceField::getDistances() { return distances_; }
+const std::vector<double>& SignedDistanceField::getDistances() const { return distances_; }
+
+std::vector<int>& SignedDistanceField::getShapeIds() { return shape_ids_; }
+const std::vector<int>& SignedDistanceField::getShapeIds() const { return shape_ids_; }
+
+double SignedDistanceField::getDistanceToBounds(const Eigen::Vector3d& point) const
+{
+  return (point - point.cwiseMax(origin_).cwiseMin(getMaxBound())).norm();
+}
+
+double SignedDistanceField::getDistance(const Eigen::Vector3d& point) const
+{
+  assert(!distances_.empty());
+  Eigen::Vector3d clamped = point.cwiseMax(origin_).cwiseMin(getMaxBound());
+  Eigen::Vector3d g = (clamped - origin_) / resolution_;
+  Eigen::Vector3i i0;
+  Eigen::Vector3d t;
+  for (Eigen::Index k = 0; k < 3; ++k)
+  {
+    i0[k] = std::min(static_cast<int>(g[k]), size_[k] - 2);
+    t[k] = g[k] - i0[k];
+  }
+
+  const auto sy = static_cast<std::size_t>(size_.x());
+  const auto sz = static_cast<std::size_t>(size_.x()) * static_cast<std::size_t>(size_.y());
+  const double* c = &distances_[getIndex(i0.x(), i0.y(), i0.z())];
+
+  double c00 = c[0] + (t.x() * (c[1] - c[0]));
+  double c10 = c[sy] + (t.x() * (c[sy + 1] - c[sy]));
+  double c01 = c[sz] + (t.x() * (c[sz + 1] - c[sz]));
+  double c11 = c[sz + sy] + (t.x() * (c[sz + sy + 1] - c[sz + sy]));
+  double c0 = c00 + (t.y() * (c10 - c00));
+  double c1 = c01 + (t.y() * (c11 - c01));
+
+  return c0 + (t.z() * (c1 - c0)) + (point - clamped).norm();
+}
+
+double SignedDistanceField::getDistance(const Eigen::Vector3d& point, Eigen::Vector3d& gradient, int& shape_id) const
+{
+  assert(!distances_.empty());
+  Eigen::Vector3d clamped = point.cwiseMax(origin_).cwiseMin(getMaxBound());
+  Eigen::Vector3d g = (clamped - origin_) / resolution_;
+  Eigen::Vector3i i0;
+  Eigen::Vector3d t;
+  for (Eigen::Index k = 0; k < 3; ++k)
+  {
+    i0[k] = std::min(static_cast<int>(g[k]), size_[k] - 2);
+    t[k] = g[k] - i0[k];
+  }
+
+  const auto sy = static_cast<std::size_t>(size_.x());
+  const auto sz = static_cast<std::size_t>(size_.x()) * static_cast<std::size_t>(size_.y());
+  const std::size_t index = getIndex(i0.x(), i0.y(), i0.z());
+  const double* c = &distances_[index];
+
+  double c00 = c[0] + (t.x() * (c[1] - c[0]));
+  double c10 = c[sy] + (t.x() * (c[sy + 1] - c[sy]));
+  double c01 = c[sz] + (t.x() * (c[sz + 1] - c[sz]));
+  double c11 = c[sz + sy] + (t.x() * (c[sz + sy + 1] - c[sz + sy]));
+  double c0 = c00 + (t.y() * (c10 - c00));
+  double c1 = c01 + (t.y() * (c11 - c01));
+  double distance = c0 + (t.z() * (c1 - c0));
+
+  // Partial derivatives of the trilinear interpolation
+  gradient.x() = (((1 - t.y()) * (1 - t.z()) * (c[1] - c[0])) + (t.y() * (1 - t.z()) * (c[sy + 1] - c[sy])) +
+                  ((1 - t.y()) * t.z() * (c[sz + 1] - c[sz])) + (t.y() * t.z() * (c[sz + sy + 1] - c[sz + sy]))) /
+                 resolution_;
+  gradient.y() = (((1 - t.z()) * (c10 - c00)) + (t.z() * (c11 - c01))) / resolution_;
+  gradient.z() = (c1 - c0) / resolution_;
+
+  // The shape id is taken from the closest voxel center
+  std::size_t nearest = index;
+  if (t.x() > 0.5)
+    nearest += 1;
+  if (t.y() > 0.5)
+    nearest += sy;
+  if (t.z() > 0.5)
+    nearest += sz;
+  shape_id = shape_ids_[nearest];
+
+  // Outside of the grid the distance grows with the distance to the grid
+  Eigen::Vector3d offset = point - clamped;
+  double outside = offset.norm();
+  if (outside > 0)
+  {
+    distance += outside;
+    gradient = offset / outside;
+  }
+
+  return distance;
+}
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
@@ -0,0 +1,159 @@
+/**
+ * @file sphere_tree.h
+ * @brief A bounding volume hierarchy of spheres
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, agent
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_SPHERE_TREE_SPHERE_TREE_H
+#define TESSERACT_COLLISION_SPHERE_TREE_SPHERE_TREE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <Eigen/Geometry>
+#include <memory>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/types.h>
+#include <tesseract_collision/core/voxel_utils.h>
+
+namespace tesseract_collision::tesseract_collision_sphere_tree
+{
+/**
+ * @brief A binary tree of bounding spheres over a set of leaf spheres
+ * @details Each node bounds a contiguous range of leaf spheres. The leaf spheres are reordered so the range of every
+ * node is contiguous and are stored as a structure of arrays, so the distances between two leaf ranges can be computed
+ * in a tight loop the compiler can vectorize.
+ */
+class SphereTree
+{
+public:
+  using Ptr = std::shared_ptr<SphereTree>;
+  using ConstPtr = std::shared_ptr<const SphereTree>;
+
+  /** @brief A node of the tree */
+  struct Node
+  {
+    /** @brief The center of the bounding sphere */
+    Eigen::Vector3d center{ Eigen::Vector3d::Zero() };
+    /** @brief The radius of the bounding sphere */
+    double radius{ 0 };
+    /** @brief The index of the first leaf sphere */
+    std::size_t begin{ 0 };
+    /** @brief One past the index of the last leaf sphere */
+    std::size_t end{ 0 };
+    /** @brief The index of the first child node, -1 for a leaf node */
+    int left{ -1 };
+    /** @brief The index of the second child node, -1 for a leaf node */
+    int right{ -1 };
+  };
+
+  SphereTree() = default;
+
+  /**
+   * @brief Build the tree
+   * @param spheres The leaf spheres
+   * @param leaf_size The maximum number of leaf spheres in a leaf node
+   */
+  SphereTree(const CollisionSpheres& spheres, std::size_t leaf_size = 8);
+
+  /** @brief Get the nodes, the root is the first node. This is empty if there are no leaf spheres. */
+  const std::vector<Node>& getNodes() const;
+
+  /** @brief Get the number of leaf spheres */
+  std::size_t size() const;
+
+  /** @brief Get the x coordinates of the leaf sphere centers */
+  const std::vector<double>& getX() const;
+
+  /** @brief Get the y coordinates of the leaf sphere centers */
+  const std::vector<double>& getY() const;
+
+  /** @brief Get the z coordinates of the leaf sphere centers */
+  const std::vector<double>& getZ() const;
+
+  /** @brief Get the radii of the leaf spheres */
+  const std::vector<double>& getRadii() const;
+
+  /** @brief Get the shape index of the leaf spheres */
+  const std::vector<int>& getShapeIds() const;
+
+private:
+  std::vector<Node> nodes_;
+  std::vector<double> x_;
+  std::vector<double> y_;
+  std::vector<double> z_;
+  std::vector<double> radii_;
+  std::vector<int> shape_ids_;
+
+  /** @brief Recursively build the node bounding a range of the sphere order and return its index */
+  int build(const CollisionSpheres& spheres,
+            std::vector<std::size_t>& order,
+            std::size_t begin,
+            std::size_t end,
+            std::size_t leaf_size);
+};
+
+/**
+ * @brief The sphere centers of a sphere tree transformed into another frame
+ * @details This is kept per collision object so the tree itself is immutable and shared between clones.
+ */
+struct TransformedSphereTree
+{
+  /** @brief The node centers ordered like the tree nodes */
+  tesseract_common::VectorVector3d node_centers;
+  /** @brief The x coordinates of the leaf sphere centers */
+  std::vector<double> x;
+  /** @brief The y coordinates of the leaf sphere centers */
+  std::vector<double> y;
+  /** @brief The z coordinates of the leaf sphere centers */
+  std::vector<double> z;
+
+  /**
+   * @brief Transform the sphere centers of a tree
+   * @param tree The sphere tree
+   * @param pose The transform applied to the sphere centers
+   */
+  void update(const SphereTree& tree, const Eigen::Isometry3d& pose);
+};
+
+/**
+ * @brief Approximate a collision object by at most a given number of spheres
+ * @details The inside of closed shapes is covered too, so an object completely inside another object still overlaps
+ * its spheres. The voxel size used to place the spheres is increased until the limit is met. Every sphere extends at
+ * most the returned bound beyond the true surface, so the distance between two sphere approximations is never larger
+ * than the true distance and at most the sum of both bounds smaller.
+ * @param spheres The spheres in the collision object frame
+ * @param shapes The collision object shapes
+ * @param shape_poses The shape poses in the collision object frame
+ * @param resolution The smallest voxel size used to place the spheres
+ * @param max_spheres The maximum number of spheres, zero for no limit
+ * @return The conservative bound, zero if all shapes are spheres
+ */
+double createCollisionSpheres(CollisionSpheres& spheres,
+                              const CollisionShapesConst& shapes,
+                              const tesseract_common::VectorIsometry3d& shape_poses,
+                              double resolution,
+                              std::size_t max_spheres);
+
+}  // namespace tesseract_collision::tesseract_collision_sphere_tree
+#endif  // TESSERACT_COLLISION_SPHERE_TREE_SPHERE_TREE_H
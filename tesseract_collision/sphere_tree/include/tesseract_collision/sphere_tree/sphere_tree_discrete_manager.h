@@ -0,0 +1,258 @@
+/**
+ * @file sphere_tree_discrete_manager.h
+ * @brief Discrete contact manager using sphere tree approximations
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, agent
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_SPHERE_TREE_SPHERE_TREE_DISCRETE_MANAGER_H
+#define TESSERACT_COLLISION_SPHERE_TREE_SPHERE_TREE_DISCRETE_MANAGER_H
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/sphere_tree/sphere_tree.h>
+
+namespace tesseract_collision::tesseract_collision_sphere_tree
+{
+/**
+ * @brief A discrete contact manager that approximates every collision object by a tree of spheres
+ * @details Each collision object, including the inside of closed shapes, is covered by spheres when it is added, which
+ * are organized in a bounding sphere hierarchy. A pair is checked by traversing both hierarchies and computing the
+ * sphere to sphere distances of the leaf nodes that are within the collision margin.
+ *
+ * The approximation is conservative. The reported distance is never larger than the true distance and at most the sum
+ * of the conservative bounds of both objects smaller, see getConservativeBound. This makes it suitable as a fast first
+ * stage rejecting states that are clearly free before an exact check. The accuracy is controlled by the resolution and
+ * the maximum number of spheres per collision object.
+ *
+ * Contacts provide a single point on each object, the shape id of both objects and no sub shape id. One contact is
+ * reported for each pair of shapes.
+ */
+class SphereTreeDiscreteManager : public DiscreteContactManager
+{
+public:
+  using Ptr = std::shared_ptr<SphereTreeDiscreteManager>;
+  using ConstPtr = std::shared_ptr<const SphereTreeDiscreteManager>;
+  using UPtr = std::unique_ptr<SphereTreeDiscreteManager>;
+  using ConstUPtr = std::unique_ptr<const SphereTreeDiscreteManager>;
+
+  /**
+   * @brief Constructor
+   * @param name The name of the contact manager
+   * @param resolution The smallest voxel size used to place the spheres
+   * @param max_spheres The maximum number of spheres per collision object, zero for no limit
+   */
+  SphereTreeDiscreteManager(std::string name = "SphereTreeDiscreteManager",
+                            double resolution = 0.02,
+                            std::size_t max_spheres = 0);
+  ~SphereTreeDiscreteManager() override = default;
+  SphereTreeDiscreteManager(const SphereTreeDiscreteManager&) = delete;
+  SphereTreeDiscreteManager& operator=(const SphereTreeDiscreteManager&) = delete;
+  SphereTreeDiscreteManager(SphereTreeDiscreteManager&&) = delete;
+  SphereTreeDiscreteManager& operator=(SphereTreeDiscreteManager&&) = delete;
+
+  std::string getName() const override final;
+
+  DiscreteContactManager::UPtr clone() const override final;
+
+  bool addCollisionObject(const std::string& name,
+                          const int& mask_id,
+                          const CollisionShapesConst& shapes,
+                          const tesseract_common::VectorIsometry3d& shape_poses,
+                          bool enabled = true) override final;
+
+  const CollisionShapesConst& getCollisionObjectGeometries(const std::string& name) const override final;
+
+  const tesseract_common::VectorIsometry3d&
+  getCollisionObjectGeometriesTransforms(const std::string& name) const override final;
+
+  bool hasCollisionObject(const std::string& name) const override final;
+
+  bool removeCollisionObject(const std::string& name) override final;
+
+  bool enableCollisionObject(const std::string& name) override final;
+
+  bool disableCollisionObject(const std::string& name) override final;
+
+  bool isCollisionObjectEnabled(const std::string& name) const override final;
+
+  void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override final;
+
+  void setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                    const tesseract_common::VectorIsometry3d& poses) override final;
+
+  void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override final;
+
+  const std::vector<std::string>& getCollisionObjects() const override final;
+
+  void setActiveCollisionObjects(const std::vector<std::string>& names) override final;
+
+  const std::vector<std::string>& getActiveCollisionObjects() const override final;
+
+  void setCollisionMarginData(
+      CollisionMarginData collision_margin_data,
+      CollisionMarginOverrideType override_type = CollisionMarginOverrideType::REPLACE) override final;
+
+  void setDefaultCollisionMarginData(double default_collision_margin) override final;
+
+  void setPairCollisionMarginData(const std::string& name1,
+                                  const std::string& name2,
+                                  double collision_margin) override final;
+
+  const CollisionMarginData& getCollisionMarginData() const override final;
+
+  void setIsContactAllowedFn(IsContactAllowedFn fn) override final;
+
+  IsContactAllowedFn getIsContactAllowedFn() const override final;
+
+  using DiscreteContactManager::contactTest;
+
+  void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
+
+  bool anyContactTest(const ContactRequest& request) override final;
+
+  /** @brief Get the smallest voxel size used to place the spheres */
+  double getResolution() const;
+
+  /** @brief Get the maximum number of spheres per collision object, zero for no limit */
+  std::size_t getMaxSpheres() const;
+
+  /**
+   * @brief Get the conservative bound of a collision object
+   * @details This is the largest distance the spheres extend beyond the surface of the collision object. Adding the
+   * bounds of both objects to the collision margin guarantees no contact within the margin is missed by the sphere
+   * approximation.
+   * @param name The name of the collision object
+   * @return The conservative bound, zero if the collision object does not exist or only contains sphere shapes
+   */
+  double getConservativeBound(const std::string& name) const;
+
+  /**
+   * @brief Get the number of spheres approximating a collision object
+   * @param name The name of the collision object
+   * @return The number of spheres, zero if the collision object does not exist
+   */
+  std::size_t getSphereCount(const std::string& name) const;
+
+private:
+  /** @brief A collision object with its sphere tree */
+  struct CollisionObject
+  {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    using Ptr = std::shared_ptr<CollisionObject>;
+
+    std::string name;
+    int type_id{ 0 };
+    CollisionShapesConst shapes;
+    tesseract_common::VectorIsometry3d shape_poses;
+    Eigen::Isometry3d world_pose{ Eigen::Isometry3d::Identity() };
+    bool enabled{ true };
+    bool active{ true };
+
+    /** @brief The id of the collision object in the collision margin table */
+    int id{ -1 };
+
+    /** @brief The link id in the compiled allowed collision matrix, see ContactTestData */
+    long acm_id{ -1 };
+
+    /** @brief The sphere tree in the collision object frame, shared with clones */
+    SphereTree::ConstPtr tree;
+
+    /** @brief The largest distance the spheres extend beyond the surface */
+    double bound{ 0 };
+
+    /** @brief The sphere tree in the world frame */
+    TransformedSphereTree world_tree;
+
+    /** @brief Indicates the world pose changed since the world sphere tree was last updated */
+    bool world_tree_dirty{ true };
+  };
+
+  /** @brief The closest pair of leaf spheres found for a pair of shapes */
+  struct ShapePairContact
+  {
+    double distance{ std::numeric_limits<double>::max() };
+    std::size_t sphere1{ 0 };
+    std::size_t sphere2{ 0 };
+  };
+
+  std::string name_;
+  double resolution_;
+  std::size_t max_spheres_;
+
+  std::map<std::string, CollisionObject::Ptr> link2obj_; /**< @brief A map of all collision objects being managed */
+  std::vector<CollisionObject::Ptr> objects_;  /**< @brief The collision objects ordered like collision_objects_ */
+  std::vector<std::string> active_;            /**< @brief A list of the active collision objects */
+  std::vector<std::string> collision_objects_; /**< @brief A list of the collision objects */
+  CollisionMarginData collision_margin_data_;  /**< @brief The contact distance threshold */
+  IsContactAllowedFn fn_;                      /**< @brief The is allowed collision function */
+
+  /** @brief The collision margin data indexed by the collision object ids */
+  CollisionMarginTable collision_margin_table_;
+
+  /** @brief Indicates the collision objects changed since the collision margin table was last updated */
+  bool collision_margin_table_dirty_{ false };
+
+  /** @brief The link id revision of the allowed collision matrix the link ids of the collision objects were set for */
+  std::size_t allowed_collision_link_id_revision_{ 0 };
+
+  /** @brief Indicates the collision objects changed since their allowed collision matrix link ids were last set */
+  bool allowed_collision_link_ids_dirty_{ true };
+
+  /** @brief The node pairs left to visit, reused between pair checks */
+  std::vector<std::pair<int, int>> node_stack_;
+
+  /** @brief The squared leaf sphere center distances, reused between pair checks */
+  std::vector<double> squared_distances_;
+
+  /** @brief The closest pair of leaf spheres of each pair of shapes, reused between pair checks */
+  std::vector<ShapePairContact> shape_pair_contacts_;
+
+  /** @brief Add a collision object to the manager */
+  void addCollisionObject(const CollisionObject::Ptr& obj);
+
+  /** @brief This function will assign the collision object ids and rebuild the collision margin table */
+  void updateCollisionMarginTable();
+
+  /**
+   * @brief This function will set the allowed collision matrix link ids of the collision objects if they changed
+   * @return The compiled allowed collision matrix queried by the contact allowed function, nullptr if there is none
+   */
+  const tesseract_common::CompiledAllowedCollisionMatrix* updateAllowedCollisionLinkIds();
+
+  /**
+   * @brief Check the sphere trees of two collision objects
+   * @param cdata The contact test data to populate
+   * @param obj1 The first collision object
+   * @param obj2 The second collision object
+   * @param margin The pair collision margin
+   */
+  void contactTest(ContactTestData& cdata, CollisionObject& obj1, CollisionObject& obj2, double margin);
+
+  /**
+   * @brief Check all pairs for the current collision object transforms
+   * @param cdata The contact test data to populate
+   */
+  void contactTest(ContactTestData& cdata);
+};
+
+}  // namespace tesseract_collision::tesseract_collision_sphere_tree
+#endif  // TESSERACT_COLLISION_SPHERE_TREE_SPHERE_TREE_DISCRETE_MANAGER_H
@@ -0,0 +1,184 @@
+/**
+ * @file sphere_tree.cpp
+ * @brief A bounding volume hierarchy of spheres
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, agent
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/sphere_tree/sphere_tree.h>
+
+namespace tesseract_collision::tesseract_collision_sphere_tree
+{
+SphereTree::SphereTree(const CollisionSpheres& spheres, std::size_t leaf_size)
+{
+  assert(leaf_size > 0);
+  if (spheres.empty())
+    return;
+
+  std::vector<std::size_t> order(spheres.size());
+  std::iota(order.begin(), order.end(), 0);
+  nodes_.reserve((2 * ((spheres.size() + leaf_size - 1) / leaf_size)) + 1);
+  build(spheres, order, 0, spheres.size(), std::max(leaf_size, std::size_t(1)));
+
+  x_.reserve(spheres.size());
+  y_.reserve(spheres.size());
+  z_.reserve(spheres.size());
+  radii_.reserve(spheres.size());
+  shape_ids_.reserve(spheres.size());
+  for (std::size_t i : order)
+  {
+    const CollisionSphere& sphere = spheres[i];
+    x_.push_back(sphere.center.x());
+    y_.push_back(sphere.center.y());
+    z_.push_back(sphere.center.z());
+    radii_.push_back(sphere.radius);
+    shape_ids_.push_back(sphere.shape_id);
+  }
+}
+
+const std::vector<SphereTree::Node>& SphereTree::getNodes() const { return nodes_; }
+
+std::size_t SphereTree::size() const { return radii_.size(); }
+
+const std::vector<double>& SphereTree::getX() const { return x_; }
+
+const std::vector<double>& SphereTree::getY() const { return y_; }
+
+const std::vector<double>& SphereTree::getZ() const { return z_; }
+
+const std::vector<double>& SphereTree::getRadii() const { return radii_; }
+
+const std::vector<int>& SphereTree::getShapeIds() const { return shape_ids_; }
+
+int SphereTree::build(const CollisionSpheres& spheres,
+                      std::vector<std::size_t>& order,
+                      std::size_t begin,
+                      std::size_t end,
+                      std::size_t leaf_size)
+{
+  Eigen::Vector3d aabb_min = Eigen::Vector3d::Constant(std::numeric_limits<double>::max());
+  Eigen::Vector3d aabb_max = Eigen::Vector3d::Constant(-std::numeric_limits<double>::max());
+  for (std::size_t i = begin; i < end; ++i)
+  {
+    aabb_min = aabb_min.cwiseMin(spheres[order[i]].center);
+    aabb_max = aabb_max.cwiseMax(spheres[order[i]].center);
+  }
+
+  auto index = static_cast<int>(nodes_.size());
+  nodes_.emplace_back();
+
+  Node node;
+  node.center = (aabb_min + aabb_max) / 2.0;
+  node.begin = begin;
+  node.end = end;
+  for (std::size_t i = begin; i < end; ++i)
+  {
+    const CollisionSphere& sphere = spheres[order[i]];
+    node.radius = std::max(node.radius, (sphere.center - node.center).norm() + sphere.radius);
+  }
+
+  if (end - begin > leaf_size)
+  {
+    // Split at the median along the longest axis of the sphere centers
+    Eigen::Index axis{ 0 };
+    (aabb_max - aabb_min).maxCoeff(&axis);
+    std::size_t middle = begin + ((end - begin) / 2);
+    auto first = order.begin() + static_cast<std::ptrdiff_t>(begin);
+    std::nth_element(first,
+                     order.begin() + static_cast<std::ptrdiff_t>(middle),
+                     order.begin() + static_cast<std::ptrdiff_t>(end),
+                     [&spheres, axis](std::size_t a, std::size_t b) {
+                       return spheres[a].center[axis] < spheres[b].center[axis];
+                     });
+
+    node.left = build(spheres, order, begin, middle, leaf_size);
+    node.right = build(spheres, order, middle, end, leaf_size);
+  }
+
+  nodes_[static_cast<std::size_t>(index)] = node;
+  return index;
+}
+
+void TransformedSphereTree::update(const SphereTree& tree, const Eigen::Isometry3d& pose)
+{
+  const std::vector<SphereTree::Node>& nodes = tree.getNodes();
+  node_centers.resize(nodes.size());
+  for (std::size_t i = 0; i < nodes.size(); ++i)
+    node_centers[i] = pose * nodes[i].center;
+
+  const std::vector<double>& tx = tree.getX();
+  const std::vector<double>& ty = tree.getY();
+  const std::vector<double>& tz = tree.getZ();
+  const Eigen::Matrix3d& r = pose.linear();
+  const Eigen::Vector3d& t = pose.translation();
+  x.resize(tree.size());
+  y.resize(tree.size());
+  z.resize(tree.size());
+  for (std::size_t i = 0; i < tree.size(); ++i)
+  {
+    x[i] = (r(0, 0) * tx[i]) + (r(0, 1) * ty[i]) + (r(0, 2) * tz[i]) + t.x();
+    y[i] = (r(1, 0) * tx[i]) + (r(1, 1) * ty[i]) + (r(1, 2) * tz[i]) + t.y();
+    z[i] = (r(2, 0) * tx[i]) + (r(2, 1) * ty[i]) + (r(2, 2) * tz[i]) + t.z();
+  }
+}
+
+double createCollisionSpheres(CollisionSpheres& spheres,
+                              const CollisionShapesConst& shapes,
+                              const tesseract_common::VectorIsometry3d& shape_poses,
+                              double resolution,
+                              std::size_t max_spheres)
+{
+  assert(resolution > 0);
+  spheres = tesseract_collision::createCollisionSpheres(shapes, shape_poses, resolution, true);
+
+  // Coarser voxels give fewer spheres. Stop once the number no longer decreases, sphere shapes and very coarse voxels
+  // can not be reduced further.
+  while (max_spheres > 0 && spheres.size() > max_spheres)
+  {
+    double scale = std::sqrt(static_cast<double>(spheres.size()) / static_cast<double>(max_spheres));
+    double coarse_resolution = resolution * std::max(scale, 1.1);
+    CollisionSpheres coarse_spheres =
+        tesseract_collision::createCollisionSpheres(shapes, shape_poses, coarse_resolution, true);
+    if (coarse_spheres.size() >= spheres.size())
+      break;
+
+    resolution = coarse_resolution;
+    spheres = std::move(coarse_spheres);
+  }
+
+  // Sphere shapes are represented exactly
+  bool exact = std::all_of(shapes.begin(), shapes.end(), [](const CollisionShapeConstPtr& shape) {
+    return shape->getType() == tesseract_geometry::GeometryType::SPHERE;
+  });
+
+  return (exact) ? 0 : std::sqrt(3.0) * resolution;
+}
+
+}  // namespace tesseract_collision::tesseract_collision_sphere_tree
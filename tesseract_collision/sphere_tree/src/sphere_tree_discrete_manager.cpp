@@ -0,0 +1,508 @@
+/**
+ * @file sphere_tree_discrete_manager.cpp
+ * @brief Discrete contact manager using sphere tree approximations
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, agent
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <cmath>
+#include <limits>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/sphere_tree/sphere_tree_discrete_manager.h>
+#include <tesseract_collision/core/common.h>
+
+namespace tesseract_collision::tesseract_collision_sphere_tree
+{
+static const CollisionShapesConst EMPTY_COLLISION_SHAPES_CONST;
+static const tesseract_common::VectorIsometry3d EMPTY_COLLISION_SHAPES_TRANSFORMS;
+
+/**
+ * @brief Compute the squared distances from a point to a range of points
+ * @details This is kept free of branches and function calls so the compiler vectorizes it.
+ */
+static void squaredDistances(double x,
+                             double y,
+                             double z,
+                             const double* xs,
+                             const double* ys,
+                             const double* zs,
+                             std::size_t count,
+                             double* squared_distances)
+{
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    double dx = xs[i] - x;
+    double dy = ys[i] - y;
+    double dz = zs[i] - z;
+    squared_distances[i] = (dx * dx) + (dy * dy) + (dz * dz);
+  }
+}
+
+SphereTreeDiscreteManager::SphereTreeDiscreteManager(std::string name, double resolution, std::size_t max_spheres)
+  : name_(std::move(name)), resolution_(resolution), max_spheres_(max_spheres)
+{
+  assert(resolution_ > 0);
+  collision_margin_data_ = CollisionMarginData(0);
+}
+
+std::string SphereTreeDiscreteManager::getName() const { return name_; }
+
+DiscreteContactManager::UPtr SphereTreeDiscreteManager::clone() const
+{
+  auto manager = std::make_unique<SphereTreeDiscreteManager>(name_, resolution_, max_spheres_);
+
+  // The sphere trees are immutable so they are shared with the clone
+  for (const auto& obj : objects_)
+    manager->addCollisionObject(std::make_shared<CollisionObject>(*obj));
+
+  manager->setActiveCollisionObjects(active_);
+  manager->setCollisionMarginData(collision_margin_data_);
+  manager->setIsContactAllowedFn(fn_);
+  manager->setDenseLinkNames(dense_link_names_);
+
+  return manager;
+}
+
+bool SphereTreeDiscreteManager::addCollisionObject(const std::string& name,
+                                                   const int& mask_id,
+                                                   const CollisionShapesConst& shapes,
+                                                   const tesseract_common::VectorIsometry3d& shape_poses,
+                                                   bool enabled)
+{
+  if (link2obj_.find(name) != link2obj_.end())
+    removeCollisionObject(name);
+
+  // dont add object that does not have geometry
+  if (shapes.empty() || shape_poses.empty() || (shapes.size() != shape_poses.size()))
+  {
+    CONSOLE_BRIDGE_logDebug("ignoring link %s", name.c_str());
+    return false;
+  }
+
+  for (const auto& shape : shapes)
+  {
+    if (!isVoxelizationSupported(*shape))
+    {
+      CONSOLE_BRIDGE_logError("This geometric shape type (%d) is not supported using sphere trees yet",
+                              static_cast<int>(shape->getType()));
+      return false;
+    }
+  }
+
+  CollisionSpheres spheres;
+  double bound = createCollisionSpheres(spheres, shapes, shape_poses, resolution_, max_spheres_);
+  if (spheres.empty())
+  {
+    CONSOLE_BRIDGE_logError("Failed to create the sphere tree of link %s, it has no surface", name.c_str());
+    return false;
+  }
+
+  auto obj = std::make_shared<CollisionObject>();
+  obj->name = name;
+  obj->type_id = mask_id;
+  obj->shapes = shapes;
+  obj->shape_poses = shape_poses;
+  obj->enabled = enabled;
+  obj->tree = std::make_shared<const SphereTree>(spheres);
+  obj->bound = bound;
+  addCollisionObject(obj);
+  return true;
+}
+
+const CollisionShapesConst& SphereTreeDiscreteManager::getCollisionObjectGeometries(const std::string& name) const
+{
+  auto it = link2obj_.find(name);
+  return (it != link2obj_.end()) ? it->second->shapes : EMPTY_COLLISION_SHAPES_CONST;
+}
+
+const tesseract_common::VectorIsometry3d&
+SphereTreeDiscreteManager::getCollisionObjectGeometriesTransforms(const std::string& name) const
+{
+  auto it = link2obj_.find(name);
+  return (it != link2obj_.end()) ? it->second->shape_poses : EMPTY_COLLISION_SHAPES_TRANSFORMS;
+}
+
+bool SphereTreeDiscreteManager::hasCollisionObject(const std::string& name) const
+{
+  return (link2obj_.find(name) != link2obj_.end());
+}
+
+bool SphereTreeDiscreteManager::removeCollisionObject(const std::string& name)
+{
+  auto it = link2obj_.find(name);
+  if (it != link2obj_.end())
+  {
+    objects_.erase(std::find(objects_.begin(), objects_.end(), it->second));
+    collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
+    link2obj_.erase(it);
+    collision_margin_table_dirty_ = true;
+    return true;
+  }
+  return false;
+}
+
+bool SphereTreeDiscreteManager::enableCollisionObject(const std::string& name)
+{
+  auto it = link2obj_.find(name);
+  if (it != link2obj_.end())
+  {
+    it->second->enabled = true;
+    return true;
+  }
+  return false;
+}
+
+bool SphereTreeDiscreteManager::disableCollisionObject(const std::string& name)
+{
+  auto it = link2obj_.find(name);
+  if (it != link2obj_.end())
+  {
+    it->second->enabled = false;
+    return true;
+  }
+  return false;
+}
+
+bool SphereTreeDiscreteManager::isCollisionObjectEnabled(const std::string& name) const
+{
+  auto it = link2obj_.find(name);
+  if (it != link2obj_.end())
+    return it->second->enabled;
+
+  return false;
+}
+
+void SphereTreeDiscreteManager::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
+{
+  auto it = link2obj_.find(name);
+  if (it != link2obj_.end())
+  {
+    it->second->world_pose = pose;
+    it->second->world_tree_dirty = true;
+  }
+}
+
+void SphereTreeDiscreteManager::setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                                             const tesseract_common::VectorIsometry3d& poses)
+{
+  assert(names.size() == poses.size());
+  for (auto i = 0U; i < names.size(); ++i)
+    setCollisionObjectsTransform(names[i], poses[i]);
+}
+
+void SphereTreeDiscreteManager::setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms)
+{
+  for (const auto& transform : transforms)
+    setCollisionObjectsTransform(transform.first, transform.second);
+}
+
+const std::vector<std::string>& SphereTreeDiscreteManager::getCollisionObjects() const { return collision_objects_; }
+
+void SphereTreeDiscreteManager::setActiveCollisionObjects(const std::vector<std::string>& names)
+{
+  active_ = names;
+
+  for (auto& obj : objects_)
+    obj->active = isLinkActive(active_, obj->name);
+}
+
+const std::vector<std::string>& SphereTreeDiscreteManager::getActiveCollisionObjects() const { return active_; }
+
+void SphereTreeDiscreteManager::setCollisionMarginData(CollisionMarginData collision_margin_data,
+                                                       CollisionMarginOverrideType override_type)
+{
+  collision_margin_data_.apply(collision_margin_data, override_type);
+  updateCollisionMarginTable();
+}
+
+void SphereTreeDiscreteManager::setDefaultCollisionMarginData(double default_collision_margin)
+{
+  collision_margin_data_.setDefaultCollisionMargin(default_collision_margin);
+  updateCollisionMarginTable();
+}
+
+void SphereTreeDiscreteManager::setPairCollisionMarginData(const std::string& name1,
+                                                           const std::string& name2,
+                                                           double collision_margin)
+{
+  collision_margin_data_.setPairCollisionMargin(name1, name2, collision_margin);
+  updateCollisionMarginTable();
+}
+
+const CollisionMarginData& SphereTreeDiscreteManager::getCollisionMarginData() const { return collision_margin_data_; }
+void SphereTreeDiscreteManager::setIsContactAllowedFn(IsContactAllowedFn fn) { fn_ = fn; }
+IsContactAllowedFn SphereTreeDiscreteManager::getIsContactAllowedFn() const { return fn_; }
+
+void SphereTreeDiscreteManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
+{
+  ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions);
+  cdata.res_pool = &contact_result_map_pool_;
+  contactTest(cdata);
+}
+
+bool SphereTreeDiscreteManager::anyContactTest(const ContactRequest& request)
+{
+  ContactTestData cdata;
+  cdata.active = &active_;
+  cdata.collision_margin_data = collision_margin_data_;
+  cdata.fn = fn_;
+  cdata.req = request;
+  contactTest(cdata);
+  return cdata.done;
+}
+
+double SphereTreeDiscreteManager::getResolution() const { return resolution_; }
+
+std::size_t SphereTreeDiscreteManager::getMaxSpheres() const { return max_spheres_; }
+
+double SphereTreeDiscreteManager::getConservativeBound(const std::string& name) const
+{
+  auto it = link2obj_.find(name);
+  return (it != link2obj_.end()) ? it->second->bound : 0;
+}
+
+std::size_t SphereTreeDiscreteManager::getSphereCount(const std::string& name) const
+{
+  auto it = link2obj_.find(name);
+  return (it != link2obj_.end()) ? it->second->tree->size() : 0;
+}
+
+void SphereTreeDiscreteManager::addCollisionObject(const CollisionObject::Ptr& obj)
+{
+  obj->active = isLinkActive(active_, obj->name);
+  link2obj_[obj->name] = obj;
+  objects_.push_back(obj);
+  collision_objects_.push_back(obj->name);
+  collision_margin_table_dirty_ = true;
+  allowed_collision_link_ids_dirty_ = true;
+}
+
+void SphereTreeDiscreteManager::updateCollisionMarginTable()
+{
+  collision_margin_table_.update(collision_margin_data_, collision_objects_);
+  for (std::size_t i = 0; i < objects_.size(); ++i)
+    objects_[i]->id = static_cast<int>(i);
+
+  collision_margin_table_dirty_ = false;
+}
+
+void SphereTreeDiscreteManager::contactTest(ContactTestData& cdata)
+{
+  if (collision_margin_table_dirty_)
+    updateCollisionMarginTable();
+
+  cdata.collision_margin_table = &collision_margin_table_;
+  cdata.compiled_acm = updateAllowedCollisionLinkIds();
+
+  for (std::size_t i = 0; i < objects_.size(); ++i)
+  {
+    CollisionObject& obj1 = *objects_[i];
+    if (!obj1.enabled || !obj1.active)
+      continue;
+
+    for (std::size_t j = 0; j < objects_.size(); ++j)
+    {
+      CollisionObject& obj2 = *objects_[j];
+
+      // Pairs of active objects are only checked once
+      if (i == j || !obj2.enabled || (obj2.active && j < i))
+        continue;
+
+      if (isContactAllowed(obj1.name, obj1.acm_id, obj2.name, obj2.acm_id, cdata, false))
+        continue;
+
+      double margin = collision_margin_table_.getPairCollisionMargin(obj1.id, obj2.id);
+      contactTest(cdata, obj1, obj2, margin);
+      if (cdata.done)
+        return;
+    }
+  }
+}
+
+void SphereTreeDiscreteManager::contactTest(ContactTestData& cdata,
+                                            CollisionObject& obj1,
+                                            CollisionObject& obj2,
+                                            double margin)
+{
+  for (CollisionObject* obj : { &obj1, &obj2 })
+  {
+    if (obj->world_tree_dirty)
+    {
+      obj->world_tree.update(*obj->tree, obj->world_pose);
+      obj->world_tree_dirty = false;
+    }
+  }
+
+  const SphereTree& tree1 = *obj1.tree;
+  const SphereTree& tree2 = *obj2.tree;
+  const TransformedSphereTree& world_tree1 = obj1.world_tree;
+  const TransformedSphereTree& world_tree2 = obj2.world_tree;
+  const std::vector<SphereTree::Node>& nodes1 = tree1.getNodes();
+  const std::vector<SphereTree::Node>& nodes2 = tree2.getNodes();
+
+  // Only checking if any contact exists so the contact result is not needed
+  const bool any_contact = (cdata.res == nullptr && !cdata.req.is_valid);
+  const std::size_t shape_count2 = obj2.shapes.size();
+  shape_pair_contacts_.assign(obj1.shapes.size() * shape_count2, ShapePairContact());
+
+  node_stack_.clear();
+  node_stack_.emplace_back(0, 0);
+  while (!node_stack_.empty())
+  {
+    auto [n1, n2] = node_stack_.back();
+    node_stack_.pop_back();
+
+    auto i1 = static_cast<std::size_t>(n1);
+    auto i2 = static_cast<std::size_t>(n2);
+    const SphereTree::Node& node1 = nodes1[i1];
+    const SphereTree::Node& node2 = nodes2[i2];
+    double center_distance = (world_tree1.node_centers[i1] - world_tree2.node_centers[i2]).norm();
+    if (center_distance - node1.radius - node2.radius > margin)
+      continue;
+
+    // Descend into the larger node first so both trees are refined evenly
+    bool leaf1 = (node1.left < 0);
+    bool leaf2 = (node2.left < 0);
+    if (!leaf1 && (leaf2 || node1.radius >= node2.radius))
+    {
+      node_stack_.emplace_back(node1.left, n2);
+      node_stack_.emplace_back(node1.right, n2);
+      continue;
+    }
+
+    if (!leaf2)
+    {
+      node_stack_.emplace_back(n1, node2.left);
+      node_stack_.emplace_back(n1, node2.right);
+      continue;
+    }
+
+    // Both nodes are leaves, compute the sphere distances
+    const std::size_t count2 = node2.end - node2.begin;
+    squared_distances_.resize(count2);
+    for (std::size_t s1 = node1.begin; s1 < node1.end; ++s1)
+    {
+      const double radius1 = tree1.getRadii()[s1];
+      squaredDistances(world_tree1.x[s1],
+                       world_tree1.y[s1],
+                       world_tree1.z[s1],
+                       world_tree2.x.data() + node2.begin,
+                       world_tree2.y.data() + node2.begin,
+                       world_tree2.z.data() + node2.begin,
+                       count2,
+                       squared_distances_.data());
+
+      for (std::size_t k = 0; k < count2; ++k)
+      {
+        const std::size_t s2 = node2.begin + k;
+        const double reach = margin + radius1 + tree2.getRadii()[s2];
+        if (reach < 0 || squared_distances_[k] > reach * reach)
+          continue;
+
+        double distance = std::sqrt(squared_distances_[k]) - radius1 - tree2.getRadii()[s2];
+        if (any_contact)
+        {
+          processAnyContact(cdata, distance, obj1.name, obj2.name, obj1.id, obj2.id);
+          return;
+        }
+
+        auto shape_id1 = static_cast<std::size_t>(tree1.getShapeIds()[s1]);
+        auto shape_id2 = static_cast<std::size_t>(tree2.getShapeIds()[s2]);
+        ShapePairContact& contact = shape_pair_contacts_[(shape_id1 * shape_count2) + shape_id2];
+        if (distance < contact.distance)
+        {
+          contact.distance = distance;
+          contact.sphere1 = s1;
+          contact.sphere2 = s2;
+        }
+      }
+    }
+  }
+
+  // The contact is reported in the order of the pair key
+  ObjectPairKey key = getObjectPairKey(obj1.name, obj2.name);
+  const std::size_t i1 = (key.first == obj1.name) ? 0 : 1;
+  const std::size_t i2 = 1 - i1;
+  const Eigen::Isometry3d obj1_inv = obj1.world_pose.inverse();
+  const Eigen::Isometry3d obj2_inv = obj2.world_pose.inverse();
+  for (const ShapePairContact& shape_pair_contact : shape_pair_contacts_)
+  {
+    if (shape_pair_contact.distance == std::numeric_limits<double>::max())
+      continue;
+
+    const std::size_t s1 = shape_pair_contact.sphere1;
+    const std::size_t s2 = shape_pair_contact.sphere2;
+    Eigen::Vector3d center1(world_tree1.x[s1], world_tree1.y[s1], world_tree1.z[s1]);
+    Eigen::Vector3d center2(world_tree2.x[s2], world_tree2.y[s2], world_tree2.z[s2]);
+
+    // The direction to move the second object away from the first object
+    Eigen::Vector3d direction = center2 - center1;
+    double norm = direction.norm();
+    direction = (norm > 0) ? Eigen::Vector3d(direction / norm) : Eigen::Vector3d::UnitZ();
+
+    ContactResult contact;
+    contact.link_names[i1] = obj1.name;
+    contact.link_names[i2] = obj2.name;
+    contact.shape_id[i1] = tree1.getShapeIds()[s1];
+    contact.shape_id[i2] = tree2.getShapeIds()[s2];
+    contact.type_id[i1] = obj1.type_id;
+    contact.type_id[i2] = obj2.type_id;
+    contact.nearest_points[i1] = center1 + (tree1.getRadii()[s1] * direction);
+    contact.nearest_points[i2] = center2 - (tree2.getRadii()[s2] * direction);
+    contact.nearest_points_local[i1] = obj1_inv * contact.nearest_points[i1];
+    contact.nearest_points_local[i2] = obj2_inv * contact.nearest_points[i2];
+    contact.transform[i1] = obj1.world_pose;
+    contact.transform[i2] = obj2.world_pose;
+    contact.distance = shape_pair_contact.distance;
+
+    // The normal points from link_names[0] to link_names[1]
+    contact.normal = (i1 == 0) ? direction : Eigen::Vector3d(-direction);
+
+    bool found = (cdata.res != nullptr && cdata.res->find(key) != cdata.res->end());
+    processResult(cdata, contact, key, found, obj1.id, obj2.id);
+    if (cdata.done)
+      return;
+  }
+}
+
+const tesseract_common::CompiledAllowedCollisionMatrix* SphereTreeDiscreteManager::updateAllowedCollisionLinkIds()
+{
+  const tesseract_common::CompiledAllowedCollisionMatrix* compiled_acm = getCompiledAllowedCollisionMatrix(fn_);
+  if (compiled_acm == nullptr)
+    return nullptr;
+
+  const std::size_t revision = compiled_acm->getLinkIdRevision();
+  if (!allowed_collision_link_ids_dirty_ && revision == allowed_collision_link_id_revision_)
+    return compiled_acm;
+
+  for (const auto& obj : objects_)
+    obj->acm_id = compiled_acm->getLinkId(obj->name);
+
+  allowed_collision_link_id_revision_ = revision;
+  allowed_collision_link_ids_dirty_ = false;
+  return compiled_acm;
+}
+}  // namespace tesseract_collision::tesseract_collision_sphere_tree
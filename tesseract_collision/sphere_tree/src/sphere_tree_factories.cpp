@@ -0,0 +1,72 @@
+/**
+ * @file sphere_tree_factories.cpp
+ * @brief Factories for loading the sphere tree contact managers as plugins
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, agent
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <yaml-cpp/yaml.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/sphere_tree/sphere_tree_factories.h>
+#include <tesseract_collision/sphere_tree/sphere_tree_discrete_manager.h>
+
+namespace tesseract_collision::tesseract_collision_sphere_tree
+{
+DiscreteContactManager::UPtr SphereTreeDiscreteManagerFactory::create(const std::string& name,
+                                                                      const YAML::Node& config) const
+{
+  double resolution{ 0.02 };
+  std::size_t max_spheres{ 0 };
+
+  try
+  {
+    if (YAML::Node n = config["resolution"])
+      resolution = n.as<double>();
+
+    if (YAML::Node n = config["max_spheres"])
+      max_spheres = n.as<std::size_t>();
+
+    if (resolution <= 0)
+      throw std::runtime_error("SphereTreeDiscreteManagerFactory, 'resolution' must be greater than zero");
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("SphereTreeDiscreteManagerFactory: Failed to parse yaml config data! Details: %s",
+                            e.what());
+    return nullptr;
+  }
+
+  return std::make_unique<SphereTreeDiscreteManager>(name, resolution, max_spheres);
+}
+
+TESSERACT_PLUGIN_ANCHOR_IMPL(SphereTreeFactoriesAnchor)
+
+}  // namespace tesseract_collision::tesseract_collision_sphere_tree
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+TESSERACT_ADD_DISCRETE_MANAGER_PLUGIN(
+    tesseract_collision::tesseract_collision_sphere_tree::SphereTreeDiscreteManagerFactory,
+    SphereTreeDiscreteManagerFactory);
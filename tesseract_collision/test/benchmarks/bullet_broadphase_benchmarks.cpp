@@ -0,0 +1,185 @@
+#include <benchmark/benchmark.h>
+#include <Eigen/Eigen>
+#include <array>
+
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/bullet/bullet_cast_bvh_manager.h>
+#include <tesseract_geometry/impl/box.h>
+
+using namespace tesseract_collision;
+using namespace tesseract_collision::tesseract_collision_bullet;
+
+static const std::vector<std::string> GRIPPER_LINKS = { "gripper_palm", "gripper_finger_left", "gripper_finger_right" };
+
+/** @brief Get the broadphase config sized for the bin picking scene */
+BulletBroadphaseConfig getBroadphaseConfig(BulletBroadphaseType type)
+{
+  BulletBroadphaseConfig config;
+  config.type = type;
+  config.world_min = Eigen::Vector3d(-1, -1, -1);
+  config.world_max = Eigen::Vector3d(1, 1, 2);
+  config.cell_size = 0.1;
+  return config;
+}
+
+/** @brief Get the name of the i-th part in the bin */
+std::string getPartName(int i) { return "part_" + std::to_string(i); }
+
+/** @brief Get the pose of the i-th part, the parts are stacked in layers filling a 1.0m x 0.6m bin */
+Eigen::Isometry3d getPartPose(int i)
+{
+  const int num_x = 25;
+  const int num_y = 15;
+  const double spacing = 0.04;
+
+  Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+  pose.translation() = Eigen::Vector3d(-0.5 + spacing * (i % num_x),
+                                       -0.3 + spacing * ((i / num_x) % num_y),
+                                       0.015 + spacing * (i / (num_x * num_y)));
+  return pose;
+}
+
+/** @brief Get the poses of the gripper links for a waypoint of an approach over the bin */
+tesseract_common::TransformMap getGripperPoses(int waypoint)
+{
+  Eigen::Isometry3d palm = Eigen::Isometry3d::Identity();
+  palm.translation() = Eigen::Vector3d(-0.4 + 0.8 * (waypoint % 8) / 7.0, -0.2 + 0.4 * (waypoint / 8) / 7.0, 0.5);
+
+  tesseract_common::TransformMap poses;
+  poses[GRIPPER_LINKS[0]] = palm;
+  poses[GRIPPER_LINKS[1]] = palm * Eigen::Translation3d(0, 0.04, -0.065);
+  poses[GRIPPER_LINKS[2]] = palm * Eigen::Translation3d(0, -0.04, -0.065);
+  return poses;
+}
+
+/** @brief Add the parts and the gripper to the contact manager */
+template <typename ManagerType>
+void addBinPickingScene(ManagerType& checker, int num_parts, bool parts_active)
+{
+  CollisionShapesConst part_shapes = { std::make_shared<tesseract_geometry::Box>(0.03, 0.03, 0.03) };
+  tesseract_common::VectorIsometry3d shape_poses = { Eigen::Isometry3d::Identity() };
+
+  std::vector<std::string> active_links = GRIPPER_LINKS;
+  tesseract_common::TransformMap part_poses;
+  for (int i = 0; i < num_parts; ++i)
+  {
+    checker.addCollisionObject(getPartName(i), 0, part_shapes, shape_poses);
+    part_poses[getPartName(i)] = getPartPose(i);
+    if (parts_active)
+      active_links.push_back(getPartName(i));
+  }
+
+  CollisionShapesConst palm_shapes = { std::make_shared<tesseract_geometry::Box>(0.1, 0.1, 0.05) };
+  CollisionShapesConst finger_shapes = { std::make_shared<tesseract_geometry::Box>(0.02, 0.02, 0.08) };
+  checker.addCollisionObject(GRIPPER_LINKS[0], 0, palm_shapes, shape_poses);
+  checker.addCollisionObject(GRIPPER_LINKS[1], 0, finger_shapes, shape_poses);
+  checker.addCollisionObject(GRIPPER_LINKS[2], 0, finger_shapes, shape_poses);
+
+  checker.setActiveCollisionObjects(active_links);
+  checker.setCollisionMarginData(CollisionMarginData(0.01));
+  checker.setCollisionObjectsTransform(part_poses);
+}
+
+/** @brief Benchmark that moves the gripper over a bin of static parts */
+static void BM_BIN_PICKING_DISCRETE(benchmark::State& state, BulletBroadphaseConfig config, int num_parts)
+{
+  BulletDiscreteBVHManager checker("BulletDiscreteBVHManager", config);
+  addBinPickingScene(checker, num_parts, false);
+
+  ContactResultMap result;
+  int waypoint = 0;
+  for (auto _ : state)  // NOLINT
+  {
+    checker.setCollisionObjectsTransform(getGripperPoses(waypoint));
+    result.clear();
+    checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+    waypoint = (waypoint + 1) % 64;
+  }
+}
+
+/** @brief Benchmark that moves every part in the bin, as when the parts are tracked by a perception system */
+static void BM_BIN_PICKING_DISCRETE_PARTS_ACTIVE(benchmark::State& state, BulletBroadphaseConfig config, int num_parts)
+{
+  BulletDiscreteBVHManager checker("BulletDiscreteBVHManager", config);
+  addBinPickingScene(checker, num_parts, true);
+
+  std::array<tesseract_common::TransformMap, 2> part_poses;
+  for (int i = 0; i < num_parts; ++i)
+  {
+    part_poses[0][getPartName(i)] = getPartPose(i);
+    part_poses[1][getPartName(i)] = getPartPose(i) * Eigen::Translation3d(0.002, 0.002, 0);
+  }
+
+  ContactResultMap result;
+  int waypoint = 0;
+  for (auto _ : state)  // NOLINT
+  {
+    checker.setCollisionObjectsTransform(part_poses[static_cast<std::size_t>(waypoint % 2)]);
+    checker.setCollisionObjectsTransform(getGripperPoses(waypoint));
+    result.clear();
+    checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+    waypoint = (waypoint + 1) % 64;
+  }
+}
+
+/** @brief Benchmark that casts the gripper between waypoints over a bin of static parts */
+static void BM_BIN_PICKING_CAST(benchmark::State& state, BulletBroadphaseConfig config, int num_parts)
+{
+  BulletCastBVHManager checker("BulletCastBVHManager", config);
+  addBinPickingScene(checker, num_parts, false);
+
+  ContactResultMap result;
+  int waypoint = 0;
+  for (auto _ : state)  // NOLINT
+  {
+    checker.setCollisionObjectsTransform(getGripperPoses(waypoint), getGripperPoses(waypoint + 1));
+    result.clear();
+    checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+    waypoint = (waypoint + 1) % 63;
+  }
+}
+
+int main(int argc, char** argv)
+{
+  std::function<void(benchmark::State&, BulletBroadphaseConfig, int)> BM_BIN_PICKING_DISCRETE_FUNC =
+      BM_BIN_PICKING_DISCRETE;
+  std::function<void(benchmark::State&, BulletBroadphaseConfig, int)> BM_BIN_PICKING_DISCRETE_PARTS_ACTIVE_FUNC =
+      BM_BIN_PICKING_DISCRETE_PARTS_ACTIVE;
+  std::function<void(benchmark::State&, BulletBroadphaseConfig, int)> BM_BIN_PICKING_CAST_FUNC = BM_BIN_PICKING_CAST;
+
+  std::vector<BulletBroadphaseType> broadphase_types = { BulletBroadphaseType::DBVT,
+                                                         BulletBroadphaseType::SWEEP_AND_PRUNE,
+                                                         BulletBroadphaseType::HASH_GRID };
+
+  std::vector<int> num_parts = { 250, 1000 };
+  if (std::string(BENCHMARK_ARGS) != "CI_ONLY")
+    num_parts.insert(num_parts.end(), { 2000, 4000 });
+
+  for (const auto& broadphase_type : broadphase_types)
+  {
+    BulletBroadphaseConfig config = getBroadphaseConfig(broadphase_type);
+    for (const auto& num_part : num_parts)
+    {
+      std::string suffix = BulletBroadphaseTypeStrings[static_cast<std::size_t>(broadphase_type)] + "_PARTS_" +
+                           std::to_string(num_part);
+
+      std::string name = "BM_BIN_PICKING_DISCRETE_" + suffix;
+      benchmark::RegisterBenchmark(name.c_str(), BM_BIN_PICKING_DISCRETE_FUNC, config, num_part)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+
+      name = "BM_BIN_PICKING_DISCRETE_PARTS_ACTIVE_" + suffix;
+      benchmark::RegisterBenchmark(name.c_str(), BM_BIN_PICKING_DISCRETE_PARTS_ACTIVE_FUNC, config, num_part)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+
+      name = "BM_BIN_PICKING_CAST_" + suffix;
+      benchmark::RegisterBenchmark(name.c_str(), BM_BIN_PICKING_CAST_FUNC, config, num_part)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
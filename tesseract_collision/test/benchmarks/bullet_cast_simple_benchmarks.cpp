@@ -0,0 +1,205 @@
+#include <benchmark/benchmark.h>
+#include <Eigen/Eigen>
+
+#include <tesseract_collision/test_suite/benchmarks/continuous_benchmarks.hpp>
+#include <tesseract_collision/test_suite/benchmarks/benchmark_utils.hpp>
+#include <tesseract_collision/bullet/bullet_cast_simple_manager.h>
+
+using namespace tesseract_collision;
+using namespace test_suite;
+using namespace tesseract_geometry;
+
+int main(int argc, char** argv)
+{
+  const tesseract_collision_bullet::BulletCastSimpleManager::ConstPtr checker =
+      std::make_shared<tesseract_collision_bullet::BulletCastSimpleManager>();
+
+  //////////////////////////////////////
+  // Clone
+  //////////////////////////////////////
+
+  {
+    std::vector<int> num_links = { 0, 2, 4, 8, 16, 32, 64, 128, 256, 512 };
+    std::function<void(benchmark::State&, ContinuousBenchmarkInfo, int)> BM_CLONE_FUNC = BM_CONTINUOUS_CLONE;
+    for (const auto& num_link : num_links)
+    {
+      std::string name = "BM_CLONE_" + checker->getName() + "_ACTIVE_OBJ_" + std::to_string(num_link);
+      benchmark::RegisterBenchmark(name.c_str(),
+                                   BM_CLONE_FUNC,
+                                   ContinuousBenchmarkInfo(checker,
+                                                           CreateUnitPrimative(GeometryType::BOX),
+                                                           Eigen::Isometry3d::Identity(),
+                                                           Eigen::Isometry3d::Identity(),
+                                                           CreateUnitPrimative(GeometryType::BOX),
+                                                           Eigen::Isometry3d::Identity(),
+                                                           ContactTestType::ALL),
+                                   num_link)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+  }
+
+  //////////////////////////////////////
+  // contactTest
+  //////////////////////////////////////
+  std::function<void(benchmark::State&, ContinuousBenchmarkInfo)> BM_CONTACT_TEST_FUNC = BM_CONTINUOUS_CONTACT_TEST;
+
+  // Make vector of all shapes to try
+  std::vector<tesseract_geometry::GeometryType> geometry_types = {
+    GeometryType::BOX, GeometryType::CONE, GeometryType::SPHERE, GeometryType::CAPSULE, GeometryType::CYLINDER
+  };
+
+  std::vector<ContactTestType> test_types = {
+    ContactTestType::ALL, ContactTestType::FIRST, ContactTestType::CLOSEST, ContactTestType::LIMITED
+  };
+
+  // The first object is swept along x past the second object, which is offset along y
+  Eigen::Isometry3d start_tf = Eigen::Isometry3d::Identity();
+  start_tf.translation() = Eigen::Vector3d(-1, 0, 0);
+  Eigen::Isometry3d end_tf = Eigen::Isometry3d::Identity();
+  end_tf.translation() = Eigen::Vector3d(1, 0, 0);
+
+  // 0: In collision, 1: Not in collision within contact threshold, 2: Not in collision outside contact threshold
+  std::vector<double> offsets = { 0.0001, 1.1, 3 };
+  for (std::size_t i = 0; i < offsets.size(); ++i)
+  {
+    for (const auto& test_type : test_types)
+    {
+      // Loop over all primitive combinations
+      for (const auto& type1 : geometry_types)
+      {
+        for (const auto& type2 : geometry_types)
+        {
+          auto tf = Eigen::Isometry3d::Identity();
+          std::string name = "BM_CONTACT_TEST_" + std::to_string(i) + "_" + checker->getName() + "_" +
+                             ContactTestTypeStrings[static_cast<std::size_t>(test_type)] + "_" +
+                             GeometryTypeStrings[type1] + "_" + GeometryTypeStrings[type2];
+          benchmark::RegisterBenchmark(name.c_str(),
+                                       BM_CONTACT_TEST_FUNC,
+                                       ContinuousBenchmarkInfo(checker,
+                                                               CreateUnitPrimative(type1),
+                                                               start_tf,
+                                                               end_tf,
+                                                               CreateUnitPrimative(type2),
+                                                               tf.translate(Eigen::Vector3d(0, offsets[i], 0)),
+                                                               test_type))
+              ->UseRealTime()
+              ->Unit(benchmark::TimeUnit::kMicrosecond);
+        }
+      }
+    }
+  }
+
+  // Convex meshes
+  for (std::size_t i = 0; i < offsets.size(); ++i)
+  {
+    for (const auto& test_type : test_types)
+    {
+      auto tf = Eigen::Isometry3d::Identity();
+      std::string name = "BM_CONTACT_TEST_" + std::to_string(i) + "_" + checker->getName() + "_" +
+                         ContactTestTypeStrings[static_cast<std::size_t>(test_type)] + "_" +
+                         GeometryTypeStrings[GeometryType::CONVEX_MESH] + "_" +
+                         GeometryTypeStrings[GeometryType::CONVEX_MESH];
+      benchmark::RegisterBenchmark(name.c_str(),
+                                   BM_CONTACT_TEST_FUNC,
+                                   ContinuousBenchmarkInfo(checker,
+                                                           CreateBenchmarkSphere(GeometryType::CONVEX_MESH),
+                                                           start_tf,
+                                                           end_tf,
+                                                           CreateBenchmarkSphere(GeometryType::CONVEX_MESH),
+                                                           tf.translate(Eigen::Vector3d(0, offsets[i] / 2.0, 0)),
+                                                           test_type))
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+  }
+
+  //////////////////////////////////////
+  // Swept motions of varying length
+  //////////////////////////////////////
+  {
+    std::function<void(benchmark::State&, ContinuousBenchmarkInfo)> BM_SET_TRANSFORM_CONTACT_TEST_FUNC =
+        BM_CONTINUOUS_SET_TRANSFORM_CONTACT_TEST;
+    std::vector<double> sweeps = { 0, 0.01, 0.1, 0.5, 1, 2, 4, 8 };
+    std::vector<tesseract_geometry::GeometryType> sweep_types = { GeometryType::BOX, GeometryType::SPHERE };
+
+    for (const auto& type : sweep_types)
+    {
+      for (const auto& sweep : sweeps)
+      {
+        Eigen::Isometry3d sweep_start_tf = Eigen::Isometry3d::Identity();
+        sweep_start_tf.translation() = Eigen::Vector3d(-sweep / 2.0, 0, 0);
+        Eigen::Isometry3d sweep_end_tf = Eigen::Isometry3d::Identity();
+        sweep_end_tf.translation() = Eigen::Vector3d(sweep / 2.0, 0, 0);
+        auto tf = Eigen::Isometry3d::Identity();
+        std::string name = "BM_SWEEP_CONTACT_TEST_" + checker->getName() + "_" + GeometryTypeStrings[type] +
+                           "_LENGTH_" + std::to_string(sweep);
+        benchmark::RegisterBenchmark(name.c_str(),
+                                     BM_SET_TRANSFORM_CONTACT_TEST_FUNC,
+                                     ContinuousBenchmarkInfo(checker,
+                                                             CreateUnitPrimative(type),
+                                                             sweep_start_tf,
+                                                             sweep_end_tf,
+                                                             CreateUnitPrimative(type),
+                                                             tf.translate(Eigen::Vector3d(0, 1.1, 0)),
+                                                             ContactTestType::ALL))
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMicrosecond);
+      }
+    }
+  }
+
+  //////////////////////////////////////
+  // Large Dataset contactTest
+  //////////////////////////////////////
+  if (std::string(BENCHMARK_ARGS) != "CI_ONLY")
+  {
+    std::vector<int> edge_sizes = { 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    std::vector<std::pair<std::string, tesseract_geometry::GeometryType>> dataset_types = {
+      { "CONVEX_MESH", tesseract_geometry::GeometryType::CONVEX_MESH },
+      { "PRIMATIVE", tesseract_geometry::GeometryType::SPHERE }
+    };
+    std::vector<double> sweeps = { 0.1, 1.0 };
+
+    std::function<void(benchmark::State&, ContinuousContactManager::Ptr, int, tesseract_geometry::GeometryType, double)>
+        BM_LARGE_DATASET_MULTILINK_FUNC = BM_LARGE_DATASET_CONTINUOUS_MULTILINK;
+    for (const auto& dataset_type : dataset_types)
+    {
+      for (const auto& sweep : sweeps)
+      {
+        for (const auto& edge_size : edge_sizes)
+        {
+          ContinuousContactManager::Ptr clone = checker->clone();
+          std::string name = "BM_LARGE_DATASET_MULTILINK_" + checker->getName() + "_" + dataset_type.first +
+                             "_SWEEP_" + std::to_string(sweep) + "_EDGE_SIZE_" + std::to_string(edge_size);
+          benchmark::RegisterBenchmark(
+              name.c_str(), BM_LARGE_DATASET_MULTILINK_FUNC, clone, edge_size, dataset_type.second, sweep)
+              ->UseRealTime()
+              ->Unit(benchmark::TimeUnit::kMillisecond);
+        }
+      }
+    }
+
+    std::function<void(benchmark::State&, ContinuousContactManager::Ptr, int, tesseract_geometry::GeometryType, double)>
+        BM_LARGE_DATASET_SINGLELINK_FUNC = BM_LARGE_DATASET_CONTINUOUS_SINGLELINK;
+    for (const auto& dataset_type : dataset_types)
+    {
+      for (const auto& sweep : sweeps)
+      {
+        for (const auto& edge_size : edge_sizes)
+        {
+          ContinuousContactManager::Ptr clone = checker->clone();
+          std::string name = "BM_LARGE_DATASET_SINGLELINK_" + checker->getName() + "_" + dataset_type.first +
+                             "_SWEEP_" + std::to_string(sweep) + "_EDGE_SIZE_" + std::to_string(edge_size);
+          benchmark::RegisterBenchmark(
+              name.c_str(), BM_LARGE_DATASET_SINGLELINK_FUNC, clone, edge_size, dataset_type.second, sweep)
+              ->UseRealTime()
+              ->Unit(benchmark::TimeUnit::kMillisecond);
+        }
+      }
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -5,6 +5,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/bullet/bullet_cast_simple_manager.h>
 #include <tesseract_collision/bullet/bullet_cast_bvh_manager.h>
+#include <tesseract_collision/fcl/fcl_cast_managers.h>
 #include <tesseract_collision/test_suite/collision_box_box_cast_unit.hpp>
 
 using namespace tesseract_collision;
@@ -21,6 +22,28 @@ TEST(TesseractCollisionUnit, BulletCastBVHCollisionBoxBoxUnit)  // NOLINT
   test_suite::runTest(checker);
 }
 
+TEST(TesseractCollisionUnit, BulletCastBVHSweepAndPruneCollisionBoxBoxUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletBroadphaseConfig config;
+  config.type = tesseract_collision_bullet::BulletBroadphaseType::SWEEP_AND_PRUNE;
+  tesseract_collision_bullet::BulletCastBVHManager checker("BulletCastBVHManager", config);
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, BulletCastBVHHashGridCollisionBoxBoxUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletBroadphaseConfig config;
+  config.type = tesseract_collision_bullet::BulletBroadphaseType::HASH_GRID;
+  tesseract_collision_bullet::BulletCastBVHManager checker("BulletCastBVHManager", config);
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, FCLCastBVHCollisionBoxBoxUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLCastBVHManager checker;
+  test_suite::runTest(checker, true);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -34,6 +34,22 @@ TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionBoxBoxConvexHullUnit)  //
   test_suite::runTest(checker, true);
 }
 
+TEST(TesseractCollisionUnit, BulletDiscreteBVHSweepAndPruneCollisionBoxBoxUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletBroadphaseConfig config;
+  config.type = tesseract_collision_bullet::BulletBroadphaseType::SWEEP_AND_PRUNE;
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker("BulletDiscreteBVHManager", config);
+  test_suite::runTest(checker, false);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHHashGridCollisionBoxBoxUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletBroadphaseConfig config;
+  config.type = tesseract_collision_bullet::BulletBroadphaseType::HASH_GRID;
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker("BulletDiscreteBVHManager", config);
+  test_suite::runTest(checker, false);
+}
+
 TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionBoxBoxUnit)  // NOLINT
 {
   tesseract_collision_fcl::FCLDiscreteBVHManager checker;
@@ -0,0 +1,65 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/test_suite/collision_compact_results_unit.hpp>
+#include <tesseract_collision/bullet/bullet_discrete_simple_manager.h>
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/bullet/bullet_cast_simple_manager.h>
+#include <tesseract_collision/bullet/bullet_cast_bvh_manager.h>
+#include <tesseract_collision/fcl/fcl_discrete_managers.h>
+
+using namespace tesseract_collision;
+
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionCompactResultsUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionCompactResultsUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionCompactResultsUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLDiscreteBVHManager checker;
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, BulletContinuousSimpleCollisionCompactResultsUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletCastSimpleManager checker;
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, BulletContinuousBVHCollisionCompactResultsUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletCastBVHManager checker;
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionBaseOverloadsUnit)  // NOLINT
+{
+  // The base class overloads which are not overridden must be callable on the derived manager type
+  tesseract_collision_fcl::FCLDiscreteBVHManager checker;
+  test_suite::detail::addCompactResultsCollisionObjects(checker);
+
+  CompactContactResults compact_results;
+  checker.contactTest(compact_results, ContactRequest(ContactTestType::ALL));
+  EXPECT_EQ(compact_results.size(), 2);
+
+  ContactResultMap result_map;
+  checker.contactTest(result_map, std::vector<std::string>{ "box_link" }, ContactRequest(ContactTestType::ALL));
+  EXPECT_EQ(result_map.size(), 2);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
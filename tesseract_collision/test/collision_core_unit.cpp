@@ -62,6 +62,49 @@ TEST(TesseractCoreUnit, isContactAllowedUnit)  // NOLINT
   EXPECT_TRUE(tesseract_collision::isContactAllowed("base_link", "link_1", acm, true));
 }
 
+TEST(TesseractCoreUnit, isContactAllowedLinkIdsUnit)  // NOLINT
+{
+  auto acm = std::make_shared<tesseract_common::AllowedCollisionMatrix>();
+  acm->addAllowedCollision("base_link", "link_1", "adjacent");
+
+  tesseract_collision::ContactTestData cdata;
+  cdata.fn = tesseract_collision::AllowedCollisionMatrixFn(acm);
+  EXPECT_TRUE(cdata.fn("link_1", "base_link"));
+  EXPECT_FALSE(cdata.fn("link_2", "base_link"));
+
+  // Without a compiled allowed collision matrix the contact allowed function is used
+  EXPECT_TRUE(tesseract_collision::isContactAllowed("base_link", -1, "link_1", -1, cdata, false));
+  EXPECT_FALSE(tesseract_collision::isContactAllowed("base_link", -1, "link_2", -1, cdata, false));
+
+  // With a compiled allowed collision matrix only the link ids are used
+  cdata.compiled_acm = tesseract_collision::getCompiledAllowedCollisionMatrix(cdata.fn);
+  ASSERT_EQ(cdata.compiled_acm, &acm->getCompiledAllowedCollisionMatrix());
+  const long base_id = cdata.compiled_acm->getLinkId("base_link");
+  const long link_1_id = cdata.compiled_acm->getLinkId("link_1");
+  EXPECT_TRUE(tesseract_collision::isContactAllowed("base_link", base_id, "link_1", link_1_id, cdata, true));
+  EXPECT_FALSE(tesseract_collision::isContactAllowed("base_link", base_id, "link_1", -1, cdata, false));
+  EXPECT_FALSE(tesseract_collision::isContactAllowed("base_link", base_id, "link_2", -1, cdata, false));
+  EXPECT_TRUE(tesseract_collision::isContactAllowed("link_2", -1, "link_2", -1, cdata, false));
+
+  // Other contact allowed functions and derived allowed collision matrices do not provide a compiled form
+  class DerivedAllowedCollisionMatrix : public tesseract_common::AllowedCollisionMatrix
+  {
+  public:
+    bool isCollisionAllowed(const std::string& /*link_name1*/, const std::string& /*link_name2*/) const override
+    {
+      return true;
+    }
+  };
+
+  EXPECT_EQ(tesseract_collision::getCompiledAllowedCollisionMatrix(nullptr), nullptr);
+  EXPECT_EQ(tesseract_collision::getCompiledAllowedCollisionMatrix(
+                [](const std::string& /*s1*/, const std::string& /*s2*/) { return false; }),
+            nullptr);
+  EXPECT_EQ(tesseract_collision::getCompiledAllowedCollisionMatrix(
+                tesseract_collision::AllowedCollisionMatrixFn(std::make_shared<DerivedAllowedCollisionMatrix>())),
+            nullptr);
+}
+
 TEST(TesseractCoreUnit, scaleVerticesUnit)  // NOLINT
 {
   tesseract_common::VectorVector3d base_vertices{};
@@ -195,6 +238,183 @@ TEST(TesseractCoreUnit, CollisionCheckConfigUnit)  // NOLINT
   EXPECT_NEAR(config.contact_manager_config.margin_data.getDefaultCollisionMargin(), 5, 1e-6);
   EXPECT_EQ(config.type, tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE);
   EXPECT_NEAR(config.longest_valid_segment_length, 0.5, 1e-6);
+  EXPECT_EQ(config.num_threads, 1);
+}
+
+TEST(TesseractCoreUnit, CollisionMarginTableUnit)  // NOLINT
+{
+  std::vector<std::string> object_names{ "link_1", "link_2", "link_3" };
+
+  tesseract_collision::CollisionMarginData margin_data(0.1);
+  margin_data.setPairCollisionMargin("link_3", "link_1", 0.5);
+  margin_data.setPairCollisionMargin("link_2", "unknown_link", 0.8);
+
+  tesseract_collision::CollisionMarginTable table;
+  EXPECT_EQ(table.size(), 0);
+
+  table.update(margin_data, object_names);
+  EXPECT_EQ(table.size(), 3);
+  EXPECT_NEAR(table.getMaxCollisionMargin(), margin_data.getMaxCollisionMargin(), 1e-6);
+  EXPECT_NEAR(table.getPairCollisionMargin(0, 2), 0.5, 1e-6);
+  EXPECT_NEAR(table.getPairCollisionMargin(2, 0), 0.5, 1e-6);
+  EXPECT_NEAR(table.getPairCollisionMargin(0, 1), 0.1, 1e-6);
+  EXPECT_NEAR(table.getPairCollisionMargin(1, 2), 0.1, 1e-6);
+  EXPECT_NEAR(table.getPairCollisionMargin(1, 1), 0.1, 1e-6);
+
+  // The contact test data falls back to the lookup by name when an id is not assigned
+  tesseract_collision::ContactTestData cdata;
+  cdata.collision_margin_data = margin_data;
+  cdata.collision_margin_table = &table;
+  auto key = tesseract_collision::getObjectPairKey("link_1", "link_3");
+  EXPECT_NEAR(tesseract_collision::getPairCollisionMargin(cdata, key, 0, 2), 0.5, 1e-6);
+  EXPECT_NEAR(tesseract_collision::getPairCollisionMargin(cdata, key, -1, 2), 0.5, 1e-6);
+  EXPECT_NEAR(tesseract_collision::getPairCollisionMargin(cdata, key, 0, 5), 0.5, 1e-6);
+
+  margin_data.setDefaultCollisionMargin(0.2);
+  table.update(margin_data, { "link_3", "link_1" });
+  EXPECT_EQ(table.size(), 2);
+  EXPECT_NEAR(table.getPairCollisionMargin(0, 1), 0.5, 1e-6);
+  EXPECT_NEAR(table.getPairCollisionMargin(0, 0), 0.2, 1e-6);
+
+  // The table only stores the pair margins, so a large number of collision objects is cheap to index
+  std::vector<std::string> many_object_names;
+  for (int i = 0; i < 100000; ++i)
+    many_object_names.push_back("object_" + std::to_string(i));
+
+  margin_data.setPairCollisionMargin("object_99999", "object_0", 0.7);
+  table.update(margin_data, many_object_names);
+  EXPECT_EQ(table.size(), 100000);
+  EXPECT_NEAR(table.getPairCollisionMargin(0, 99999), 0.7, 1e-6);
+  EXPECT_NEAR(table.getPairCollisionMargin(99999, 0), 0.7, 1e-6);
+  EXPECT_NEAR(table.getPairCollisionMargin(99998, 99999), 0.2, 1e-6);
+  EXPECT_EQ(table.getObjectNames()->size(), 100000);
+}
+
+TEST(TesseractCoreUnit, CompactContactResultsUnit)  // NOLINT
+{
+  using tesseract_collision::CompactContactResult;
+  using tesseract_collision::ContactTestType;
+
+  auto object_names = std::make_shared<const std::vector<std::string>>(std::vector<std::string>{ "link_1", "link_2" });
+
+  CompactContactResult contact;
+  contact.object_id = { 0, 1 };
+  contact.shape_id = { 0, 2 };
+  contact.subshape_id = { -1, 3 };
+  contact.distance = 0.1;
+  contact.normal = Eigen::Vector3d::UnitX();
+  contact.nearest_points = { Eigen::Vector3d(1, 0, 0), Eigen::Vector3d(2, 0, 0) };
+
+  CompactContactResult closer_contact = contact;
+  closer_contact.object_id = { 1, 0 };
+  closer_contact.distance = -0.1;
+
+  tesseract_collision::CompactContactResults results;
+  results.setObjectNames(object_names);
+  EXPECT_TRUE(results.empty());
+
+  // ALL keeps every contact
+  EXPECT_TRUE(results.addContact(contact, ContactTestType::ALL));
+  EXPECT_TRUE(results.addContact(closer_contact, ContactTestType::ALL));
+  EXPECT_EQ(results.size(), 2U);
+
+  // CLOSEST keeps the contact with the smallest distance for each pair, regardless of the object order
+  results.clear();
+  EXPECT_TRUE(results.empty());
+  EXPECT_TRUE(results.addContact(contact, ContactTestType::CLOSEST));
+  EXPECT_TRUE(results.addContact(closer_contact, ContactTestType::CLOSEST));
+  EXPECT_FALSE(results.addContact(contact, ContactTestType::CLOSEST));
+  EXPECT_EQ(results.size(), 1U);
+  EXPECT_NEAR(results[0].distance, -0.1, 1e-6);
+
+  // LIMITED keeps the first contact for each pair
+  results.clear();
+  EXPECT_TRUE(results.addContact(contact, ContactTestType::LIMITED));
+  EXPECT_FALSE(results.addContact(closer_contact, ContactTestType::LIMITED));
+  EXPECT_EQ(results.size(), 1U);
+  EXPECT_NEAR(results[0].distance, 0.1, 1e-6);
+
+  // LIMITED does not store more contacts than the contact limit
+  CompactContactResult other_contact = contact;
+  other_contact.object_id = { 0, 2 };
+  EXPECT_FALSE(results.addContact(other_contact, ContactTestType::LIMITED, 1));
+  EXPECT_EQ(results.size(), 1U);
+
+  tesseract_collision::ContactResult full = results.getContactResult(0);
+  EXPECT_EQ(full.link_names[0], "link_1");
+  EXPECT_EQ(full.link_names[1], "link_2");
+  EXPECT_EQ(full.shape_id[1], 2);
+  EXPECT_EQ(full.subshape_id[1], 3);
+  EXPECT_NEAR(full.distance, 0.1, 1e-6);
+  EXPECT_TRUE(full.normal.isApprox(Eigen::Vector3d::UnitX(), 1e-6));
+  EXPECT_TRUE(full.nearest_points[1].isApprox(Eigen::Vector3d(2, 0, 0), 1e-6));
+
+  // Convert a contact result map
+  tesseract_collision::ContactResultMap result_map;
+  result_map[tesseract_collision::getObjectPairKey("link_1", "link_2")].push_back(full);
+  result_map[tesseract_collision::getObjectPairKey("link_1", "link_2")].push_back(full);
+  EXPECT_EQ(tesseract_collision::flattenCompactResults(result_map, object_names, results), 2U);
+  EXPECT_EQ(results.getObjectName(results[1].object_id[1]), "link_2");
+}
+
+TEST(TesseractCoreUnit, ContactResultMapPoolUnit)  // NOLINT
+{
+  using tesseract_collision::ContactResultMap;
+  using tesseract_collision::getObjectPairKey;
+
+  tesseract_collision::ContactResultMapPool pool;
+  ContactResultMap results;
+
+  // Without pooled entries a new entry is allocated
+  auto it = pool.insert(results, getObjectPairKey("link_1", "link_2"));
+  it->second.reserve(10);
+  it->second.emplace_back();
+  pool.insert(results, getObjectPairKey("link_3", "link_4"))->second.emplace_back();
+  EXPECT_EQ(results.size(), 2U);
+  EXPECT_EQ(pool.size(), 0U);
+
+  // Recycling moves the entries into the pool
+  pool.recycle(results);
+  EXPECT_TRUE(results.empty());
+  EXPECT_EQ(pool.size(), 2U);
+
+  // An entry with the same key is reused with its storage and an empty vector
+  it = pool.insert(results, getObjectPairKey("link_1", "link_2"));
+  EXPECT_TRUE(it->first == getObjectPairKey("link_1", "link_2"));
+  EXPECT_TRUE(it->second.empty());
+  EXPECT_GE(it->second.capacity(), 10U);
+  EXPECT_EQ(pool.size(), 1U);
+
+  // Otherwise another entry is reused with the new key
+  it = pool.insert(results, getObjectPairKey("link_5", "link_6"));
+  EXPECT_TRUE(it->first == getObjectPairKey("link_5", "link_6"));
+  EXPECT_TRUE(it->second.empty());
+  EXPECT_EQ(pool.size(), 0U);
+  EXPECT_EQ(results.size(), 2U);
+  EXPECT_TRUE(results.find(getObjectPairKey("link_1", "link_2")) != results.end());
+
+  // Shrinking frees the contact result storage but keeps the entries
+  pool.recycle(results);
+  EXPECT_EQ(pool.size(), 2U);
+  pool.shrink();
+  EXPECT_EQ(pool.size(), 2U);
+  it = pool.insert(results, getObjectPairKey("link_1", "link_2"));
+  EXPECT_EQ(it->second.capacity(), 0U);
+  pool.recycle(results);
+
+  pool.clear();
+  EXPECT_EQ(pool.size(), 0U);
+
+  // Entries beyond the capacity are freed
+  EXPECT_EQ(pool.getCapacity(), tesseract_collision::ContactResultMapPool::DEFAULT_CAPACITY);
+  pool.setCapacity(2);
+  for (const auto& name : { "link_1", "link_3", "link_5" })
+    pool.insert(results, getObjectPairKey(name, "link_7"));
+  pool.recycle(results);
+  EXPECT_TRUE(results.empty());
+  EXPECT_EQ(pool.size(), 2U);
+  pool.setCapacity(1);
+  EXPECT_EQ(pool.size(), 1U);
 }
 
 int main(int argc, char** argv)
@@ -34,6 +34,22 @@ TEST(TesseractCollisionLargeDataSetUnit, BulletDiscreteBVHCollisionLargeDataSetU
   test_suite::runTest(checker);
 }
 
+TEST(TesseractCollisionLargeDataSetUnit, BulletDiscreteBVHSweepAndPruneCollisionLargeDataSetUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletBroadphaseConfig config;
+  config.type = tesseract_collision_bullet::BulletBroadphaseType::SWEEP_AND_PRUNE;
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker("BulletDiscreteBVHManager", config);
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionLargeDataSetUnit, BulletDiscreteBVHHashGridCollisionLargeDataSetUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletBroadphaseConfig config;
+  config.type = tesseract_collision_bullet::BulletBroadphaseType::HASH_GRID;
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker("BulletDiscreteBVHManager", config);
+  test_suite::runTest(checker);
+}
+
 TEST(TesseractCollisionLargeDataSetUnit, FCLDiscreteBVHCollisionLargeDataSetConvexHullUnit)  // NOLINT
 {
   tesseract_collision_fcl::FCLDiscreteBVHManager checker;
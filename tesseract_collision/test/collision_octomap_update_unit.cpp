@@ -0,0 +1,117 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/test_suite/collision_octomap_update_unit.hpp>
+#include <tesseract_collision/bullet/bullet_discrete_simple_manager.h>
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/bullet/bullet_cast_simple_manager.h>
+#include <tesseract_collision/bullet/bullet_cast_bvh_manager.h>
+#include <tesseract_collision/fcl/fcl_discrete_managers.h>
+
+using namespace tesseract_collision;
+
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionOctomapUpdateUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  test_suite::runTest(checker, false);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionOctomapUpdateCompoundUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  test_suite::runTest(checker, true);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionOctomapUpdateUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  test_suite::runTest(checker, false);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionOctomapUpdateCompoundUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  test_suite::runTest(checker, true);
+}
+
+TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionOctomapUpdateUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLDiscreteBVHManager checker;
+  test_suite::runTest(checker, false);
+}
+
+TEST(TesseractCollisionUnit, BulletContinuousSimpleCollisionOctomapUpdateUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletCastSimpleManager checker;
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, BulletContinuousBVHCollisionOctomapUpdateUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletCastBVHManager checker;
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, BulletCollisionObjectOctomapUpdateUnit)  // NOLINT
+{
+  using namespace tesseract_collision_bullet;
+
+  auto ot = std::make_shared<octomap::OcTree>(0.1);
+  ot->updateNode(0.05, 0.05, 0.05, true);
+  ot->updateNode(0.55, 0.05, 0.05, true);
+  ot->updateNode(0.05, 0.55, 0.05, true);
+  auto octree = std::make_shared<tesseract_geometry::Octree>(ot, tesseract_geometry::Octree::BOX);
+  COW::Ptr cow = createCollisionObject("octomap_link", 0, { octree }, { Eigen::Isometry3d::Identity() });
+  ASSERT_TRUE(cow != nullptr);
+
+  auto* compound = static_cast<btCompoundShape*>(cow->getCollisionShape());  // NOLINT
+  ASSERT_EQ(compound->getNumChildShapes(), 3);
+  std::vector<const btCollisionShape*> children;
+  std::vector<btVector3> origins;
+  for (int i = 0; i < compound->getNumChildShapes(); ++i)
+  {
+    children.push_back(compound->getChildShape(i));
+    origins.push_back(compound->getChildTransform(i).getOrigin());
+  }
+
+  // The children outside of the changed octree nodes are reused when the compound is not shared
+  const Eigen::Vector3d voxel(0.55, 0.55, 0.05);
+  OctreeDelta occupy_delta;
+  occupy_delta.occupied.push_back(voxel);
+  tesseract_geometry::Octree::ConstPtr updated_octree = applyOctreeDelta(*octree, occupy_delta);
+  EXPECT_TRUE(cow->updateOctree(0, updated_octree, occupy_delta));
+  EXPECT_EQ(cow->getCollisionShape(), compound);
+  ASSERT_EQ(compound->getNumChildShapes(), 4);
+  for (int i = 0; i < 3; ++i)
+  {
+    EXPECT_EQ(compound->getChildShape(i), children[static_cast<std::size_t>(i)]);
+    EXPECT_TRUE(compound->getChildTransform(i).getOrigin() == origins[static_cast<std::size_t>(i)]);
+  }
+
+  // A compound shared with a clone is copied once, the clone keeps the previous children
+  COW::Ptr clone = cow->clone();
+  OctreeDelta free_delta;
+  free_delta.free.push_back(voxel);
+  updated_octree = applyOctreeDelta(*updated_octree, free_delta);
+  EXPECT_TRUE(cow->updateOctree(0, updated_octree, free_delta));
+  auto* copied_compound = static_cast<btCompoundShape*>(cow->getCollisionShape());  // NOLINT
+  EXPECT_NE(copied_compound, compound);
+  EXPECT_EQ(clone->getCollisionShape(), compound);
+  EXPECT_EQ(compound->getNumChildShapes(), 4);
+  EXPECT_EQ(copied_compound->getNumChildShapes(), 3);
+
+  // Later updates modify the copy in place
+  updated_octree = applyOctreeDelta(*updated_octree, occupy_delta);
+  EXPECT_TRUE(cow->updateOctree(0, updated_octree, occupy_delta));
+  EXPECT_EQ(cow->getCollisionShape(), copied_compound);
+  EXPECT_EQ(copied_compound->getNumChildShapes(), 4);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,176 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/sdf/sdf_discrete_manager.h>
+#include <tesseract_collision/sdf/sdf_utils.h>
+#include <tesseract_geometry/geometries.h>
+
+using namespace tesseract_collision;
+using namespace tesseract_collision::tesseract_collision_sdf;
+
+tesseract_geometry::Mesh::Ptr createBoxMesh(double half_extent)
+{
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  for (int i = 0; i < 8; ++i)
+    vertices->push_back(Eigen::Vector3d((i & 1) ? half_extent : -half_extent,
+                                        (i & 2) ? half_extent : -half_extent,
+                                        (i & 4) ? half_extent : -half_extent));
+
+  auto faces = std::make_shared<Eigen::VectorXi>(48);
+  // clang-format off
+  *faces << 3, 0, 2, 3,  3, 0, 3, 1,  3, 4, 5, 7,  3, 4, 7, 6,
+            3, 0, 1, 5,  3, 0, 5, 4,  3, 2, 6, 7,  3, 2, 7, 3,
+            3, 0, 4, 6,  3, 0, 6, 2,  3, 1, 3, 7,  3, 1, 7, 5;
+  // clang-format on
+  return std::make_shared<tesseract_geometry::Mesh>(vertices, faces);
+}
+
+TEST(TesseractCollisionSDFUnit, SignedDistanceFieldPrimitiveUnit)  // NOLINT
+{
+  const double resolution = 0.02;
+  CollisionShapesConst shapes{ std::make_shared<tesseract_geometry::Box>(1, 1, 1),
+                               std::make_shared<tesseract_geometry::Sphere>(0.25) };
+  tesseract_common::VectorIsometry3d poses{ Eigen::Isometry3d::Identity(),
+                                            Eigen::Isometry3d::Identity() * Eigen::Translation3d(1, 0, 0) };
+
+  SignedDistanceField::Ptr sdf = createSignedDistanceField(shapes, poses, resolution, 0.1);
+  ASSERT_TRUE(sdf != nullptr);
+  EXPECT_NEAR(sdf->getDistance(Eigen::Vector3d(0, 0, 0)), -0.5, resolution);
+  EXPECT_NEAR(sdf->getDistance(Eigen::Vector3d(0.6, 0, 0.2)), 0.1, resolution);
+  EXPECT_NEAR(sdf->getDistance(Eigen::Vector3d(1, 0, 0)), -0.25, resolution);
+  EXPECT_NEAR(sdf->getDistance(Eigen::Vector3d(1, 0, 0.35)), 0.1, resolution);
+
+  // Outside the grid the distance to the grid is added
+  EXPECT_GT(sdf->getDistance(Eigen::Vector3d(0, 0, 5)), 4.4);
+  EXPECT_GT(sdf->getDistanceToBounds(Eigen::Vector3d(0, 0, 5)), 4.3);
+  EXPECT_NEAR(sdf->getDistanceToBounds(Eigen::Vector3d(0, 0, 0)), 0, 1e-6);
+
+  Eigen::Vector3d gradient;
+  int shape_id{ -1 };
+  sdf->getDistance(Eigen::Vector3d(0.6, 0, 0), gradient, shape_id);
+  EXPECT_EQ(shape_id, 0);
+  EXPECT_GT(gradient.normalized().dot(Eigen::Vector3d::UnitX()), 0.9);
+
+  sdf->getDistance(Eigen::Vector3d(1, 0, 0.3), gradient, shape_id);
+  EXPECT_EQ(shape_id, 1);
+  EXPECT_GT(gradient.normalized().dot(Eigen::Vector3d::UnitZ()), 0.9);
+}
+
+TEST(TesseractCollisionSDFUnit, SignedDistanceFieldMeshUnit)  // NOLINT
+{
+  const double resolution = 0.02;
+  CollisionShapesConst shapes{ createBoxMesh(0.5) };
+  tesseract_common::VectorIsometry3d poses{ Eigen::Isometry3d::Identity() };
+
+  SignedDistanceField::Ptr sdf = createSignedDistanceField(shapes, poses, resolution, 0.1);
+  ASSERT_TRUE(sdf != nullptr);
+  EXPECT_NEAR(sdf->getDistance(Eigen::Vector3d(0, 0, 0)), -0.5, 2 * resolution);
+  EXPECT_NEAR(sdf->getDistance(Eigen::Vector3d(0, 0.3, 0)), -0.2, 2 * resolution);
+  EXPECT_NEAR(sdf->getDistance(Eigen::Vector3d(0, 0.6, 0)), 0.1, 2 * resolution);
+
+  CollisionSpheres spheres = createCollisionSpheres(shapes, poses, resolution);
+  EXPECT_FALSE(spheres.empty());
+  for (const auto& sphere : spheres)
+  {
+    EXPECT_EQ(sphere.shape_id, 0);
+    EXPECT_LT(sphere.center.cwiseAbs().maxCoeff(), 0.5 + resolution);
+  }
+}
+
+TEST(TesseractCollisionSDFUnit, SDFDiscreteManagerUnit)  // NOLINT
+{
+  SDFDiscreteManager checker;
+  EXPECT_EQ(checker.getName(), "SDFDiscreteManager");
+
+  CollisionShapesConst box_shapes{ std::make_shared<tesseract_geometry::Box>(1, 1, 1) };
+  tesseract_common::VectorIsometry3d box_poses{ Eigen::Isometry3d::Identity() };
+  EXPECT_TRUE(checker.addCollisionObject("box_link", 0, box_shapes, box_poses));
+
+  CollisionShapesConst sphere_shapes{ std::make_shared<tesseract_geometry::Sphere>(0.25) };
+  tesseract_common::VectorIsometry3d sphere_poses{ Eigen::Isometry3d::Identity() };
+  EXPECT_TRUE(checker.addCollisionObject("sphere_link", 0, sphere_shapes, sphere_poses));
+
+  // Objects without geometry are rejected
+  EXPECT_FALSE(checker.addCollisionObject("empty_link", 0, CollisionShapesConst(), box_poses));
+  EXPECT_FALSE(checker.hasCollisionObject("empty_link"));
+  EXPECT_EQ(checker.getCollisionObjects().size(), 2);
+
+  checker.setActiveCollisionObjects({ "sphere_link" });
+  checker.setDefaultCollisionMarginData(0.5);
+
+  // Separated
+  checker.setCollisionObjectsTransform("sphere_link", Eigen::Isometry3d::Identity() * Eigen::Translation3d(1, 0, 0));
+  {
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+    ContactResultVector result_vector;
+    flattenMoveResults(std::move(result), result_vector);
+    ASSERT_EQ(result_vector.size(), 1);
+    const ContactResult& cr = result_vector[0];
+    EXPECT_EQ(cr.link_names[0], "box_link");
+    EXPECT_EQ(cr.link_names[1], "sphere_link");
+    EXPECT_NEAR(cr.distance, 0.25, 0.05);
+    EXPECT_TRUE(cr.normal.isApprox(Eigen::Vector3d::UnitX(), 1e-3));
+    EXPECT_NEAR(cr.nearest_points[0][0], 0.5, 0.05);
+    EXPECT_NEAR(cr.nearest_points[1][0], 0.75, 0.05);
+  }
+
+  // In collision
+  checker.setCollisionObjectsTransform("sphere_link", Eigen::Isometry3d::Identity() * Eigen::Translation3d(0, 0.6, 0));
+  {
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+    ContactResultVector result_vector;
+    flattenMoveResults(std::move(result), result_vector);
+    ASSERT_EQ(result_vector.size(), 1);
+    EXPECT_NEAR(result_vector[0].distance, -0.15, 0.05);
+    EXPECT_TRUE(result_vector[0].normal.isApprox(Eigen::Vector3d::UnitY(), 1e-3));
+    EXPECT_TRUE(checker.anyContactTest(ContactRequest(ContactTestType::FIRST)));
+  }
+
+  // Outside the margin
+  checker.setCollisionObjectsTransform("sphere_link", Eigen::Isometry3d::Identity() * Eigen::Translation3d(0, 0, 2));
+  {
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+    EXPECT_TRUE(result.empty());
+    EXPECT_FALSE(checker.anyContactTest(ContactRequest(ContactTestType::FIRST)));
+  }
+
+  // The clone shares the distance fields and reports the same contacts
+  checker.setCollisionObjectsTransform("sphere_link", Eigen::Isometry3d::Identity() * Eigen::Translation3d(0, 0.6, 0));
+  DiscreteContactManager::UPtr cloned_checker = checker.clone();
+  {
+    ContactResultMap result;
+    cloned_checker->contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+    EXPECT_EQ(result.size(), 1);
+  }
+
+  // Allowed collisions and disabled objects are skipped
+  cloned_checker->setIsContactAllowedFn([](const std::string&, const std::string&) { return true; });
+  {
+    ContactResultMap result;
+    cloned_checker->contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+    EXPECT_TRUE(result.empty());
+  }
+
+  EXPECT_TRUE(checker.disableCollisionObject("box_link"));
+  {
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+    EXPECT_TRUE(result.empty());
+  }
+
+  EXPECT_TRUE(checker.removeCollisionObject("box_link"));
+  EXPECT_FALSE(checker.hasCollisionObject("box_link"));
+  EXPECT_EQ(checker.getCollisionObjects().size(), 1);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
@@ -6,6 +6,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_collision/test_suite/collision_sphere_sphere_cast_unit.hpp>
 #include <tesseract_collision/bullet/bullet_cast_simple_manager.h>
 #include <tesseract_collision/bullet/bullet_cast_bvh_manager.h>
+#include <tesseract_collision/fcl/fcl_cast_managers.h>
 
 using namespace tesseract_collision;
 
@@ -33,6 +34,12 @@ TEST(TesseractCollisionUnit, BulletContinuousBVHCollisionSphereSphereConvexHullU
   test_suite::runTest(checker, true);
 }
 
+TEST(TesseractCollisionUnit, FCLContinuousBVHCollisionSphereSphereUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLCastBVHManager checker;
+  test_suite::runTest(checker, false, true);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,196 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/sphere_tree/sphere_tree_discrete_manager.h>
+#include <tesseract_collision/core/voxel_utils.h>
+#include <tesseract_geometry/geometries.h>
+
+using namespace tesseract_collision;
+using namespace tesseract_collision::tesseract_collision_sphere_tree;
+
+/** @brief Run a closest contact test and return the contacts */
+ContactResultVector getClosestContacts(DiscreteContactManager& checker)
+{
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  ContactResultVector result_vector;
+  flattenMoveResults(std::move(result), result_vector);
+  return result_vector;
+}
+
+/** @brief Check if a point is inside any of the spheres */
+bool isCovered(const CollisionSpheres& spheres, const Eigen::Vector3d& point)
+{
+  return std::any_of(spheres.begin(), spheres.end(), [&point](const CollisionSphere& sphere) {
+    return (sphere.center - point).norm() <= sphere.radius;
+  });
+}
+
+TEST(TesseractCollisionSphereTreeUnit, CollisionSpheresInteriorUnit)  // NOLINT
+{
+  const double resolution = 0.05;
+  const double voxel_radius = (std::sqrt(3.0) * resolution) / 2.0;
+  auto box = std::make_shared<tesseract_geometry::Box>(0.6, 0.4, 0.3);
+  CollisionShapesConst shapes{ box };
+  tesseract_common::VectorIsometry3d poses{ Eigen::Isometry3d::Identity() };
+
+  CollisionSpheres surface_spheres = createCollisionSpheres(shapes, poses, resolution);
+  CollisionSpheres spheres = createCollisionSpheres(shapes, poses, resolution, true);
+  EXPECT_GT(spheres.size(), surface_spheres.size());
+
+  // The center of the box is only covered when the interior is filled
+  EXPECT_FALSE(isCovered(surface_spheres, Eigen::Vector3d::Zero()));
+  for (double x = -0.29; x <= 0.29; x += 0.029)
+  {
+    for (double y = -0.19; y <= 0.19; y += 0.019)
+    {
+      for (double z = -0.14; z <= 0.14; z += 0.014)
+        EXPECT_TRUE(isCovered(spheres, Eigen::Vector3d(x, y, z)));
+    }
+  }
+
+  // No sphere extends more than a voxel diagonal beyond the surface, the interior spheres no more than half of it
+  for (const auto& sphere : spheres)
+  {
+    double distance{ 0 };
+    EXPECT_TRUE(getPrimitiveSignedDistance(*box, sphere.center, distance));
+    EXPECT_LE(distance + sphere.radius, 2 * voxel_radius + 1e-9);
+    if (sphere.radius > voxel_radius + 1e-9)
+    {
+      EXPECT_LE(distance + sphere.radius, voxel_radius + 1e-9);
+    }
+    EXPECT_EQ(sphere.shape_id, 0);
+  }
+}
+
+TEST(TesseractCollisionSphereTreeUnit, SphereTreeNodeBoundsUnit)  // NOLINT
+{
+  CollisionShapesConst shapes{ std::make_shared<tesseract_geometry::Box>(1, 0.5, 0.25),
+                               std::make_shared<tesseract_geometry::Cylinder>(0.1, 0.5) };
+  tesseract_common::VectorIsometry3d poses{ Eigen::Isometry3d::Identity(),
+                                            Eigen::Isometry3d::Identity() * Eigen::Translation3d(0, 0, 0.5) };
+
+  CollisionSpheres spheres;
+  double bound = createCollisionSpheres(spheres, shapes, poses, 0.02, 0);
+  EXPECT_NEAR(bound, std::sqrt(3.0) * 0.02, 1e-6);
+  ASSERT_FALSE(spheres.empty());
+
+  const std::size_t leaf_size = 8;
+  SphereTree tree(spheres, leaf_size);
+  EXPECT_EQ(tree.size(), spheres.size());
+  ASSERT_FALSE(tree.getNodes().empty());
+  for (const auto& node : tree.getNodes())
+  {
+    EXPECT_LT(node.begin, node.end);
+    if (node.left < 0)
+    {
+      EXPECT_LE(node.end - node.begin, leaf_size);
+    }
+
+    for (std::size_t i = node.begin; i < node.end; ++i)
+    {
+      Eigen::Vector3d center(tree.getX()[i], tree.getY()[i], tree.getZ()[i]);
+      EXPECT_LE((center - node.center).norm() + tree.getRadii()[i], node.radius + 1e-9);
+    }
+  }
+
+  // Limiting the number of spheres coarsens the voxels and increases the bound
+  CollisionSpheres coarse_spheres;
+  double coarse_bound = createCollisionSpheres(coarse_spheres, shapes, poses, 0.02, 200);
+  EXPECT_LE(coarse_spheres.size(), 200);
+  EXPECT_GT(coarse_bound, bound);
+
+  // A link made only of spheres is represented exactly
+  CollisionShapesConst sphere_shapes{ std::make_shared<tesseract_geometry::Sphere>(0.25) };
+  tesseract_common::VectorIsometry3d sphere_poses{ Eigen::Isometry3d::Identity() };
+  EXPECT_NEAR(createCollisionSpheres(spheres, sphere_shapes, sphere_poses, 0.02, 0), 0, 1e-6);
+  EXPECT_EQ(spheres.size(), 1);
+}
+
+TEST(TesseractCollisionSphereTreeUnit, SphereTreeDiscreteManagerContainedUnit)  // NOLINT
+{
+  SphereTreeDiscreteManager checker;
+  CollisionShapesConst outer_shapes{ std::make_shared<tesseract_geometry::Box>(1, 1, 1) };
+  CollisionShapesConst inner_shapes{ std::make_shared<tesseract_geometry::Box>(0.1, 0.1, 0.1) };
+  tesseract_common::VectorIsometry3d poses{ Eigen::Isometry3d::Identity() };
+  EXPECT_TRUE(checker.addCollisionObject("outer_link", 0, outer_shapes, poses));
+  EXPECT_TRUE(checker.addCollisionObject("inner_link", 0, inner_shapes, poses));
+  checker.setActiveCollisionObjects({ "inner_link" });
+  checker.setDefaultCollisionMarginData(0);
+
+  // The inner link does not touch the surface of the outer link anywhere inside it
+  for (const auto& translation : { Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(0.3, -0.2, 0.1) })
+  {
+    Eigen::Isometry3d pose = Eigen::Isometry3d::Identity() * Eigen::Translation3d(translation);
+    checker.setCollisionObjectsTransform("inner_link", pose);
+    ContactResultVector contacts = getClosestContacts(checker);
+    ASSERT_EQ(contacts.size(), 1);
+    EXPECT_LT(contacts[0].distance, 0);
+    EXPECT_TRUE(checker.anyContactTest(ContactRequest(ContactTestType::FIRST)));
+  }
+}
+
+TEST(TesseractCollisionSphereTreeUnit, SphereTreeDiscreteManagerUnit)  // NOLINT
+{
+  SphereTreeDiscreteManager checker;
+  EXPECT_EQ(checker.getName(), "SphereTreeDiscreteManager");
+
+  CollisionShapesConst box_shapes{ std::make_shared<tesseract_geometry::Box>(1, 1, 1) };
+  CollisionShapesConst sphere_shapes{ std::make_shared<tesseract_geometry::Sphere>(0.25) };
+  tesseract_common::VectorIsometry3d poses{ Eigen::Isometry3d::Identity() };
+  EXPECT_TRUE(checker.addCollisionObject("box_link", 0, box_shapes, poses));
+  EXPECT_TRUE(checker.addCollisionObject("sphere_link", 0, sphere_shapes, poses));
+  EXPECT_FALSE(checker.addCollisionObject("empty_link", 0, CollisionShapesConst(), poses));
+  EXPECT_EQ(checker.getCollisionObjects().size(), 2);
+
+  const double bound = checker.getConservativeBound("box_link");
+  EXPECT_GT(bound, 0);
+  EXPECT_NEAR(checker.getConservativeBound("sphere_link"), 0, 1e-6);
+  EXPECT_EQ(checker.getSphereCount("sphere_link"), 1);
+
+  checker.setActiveCollisionObjects({ "sphere_link" });
+  checker.setDefaultCollisionMarginData(0.5);
+
+  // The reported distance is never larger than the true distance and at most the bound smaller
+  const std::vector<std::pair<Eigen::Vector3d, double>> cases{ { Eigen::Vector3d(1, 0, 0), 0.25 },
+                                                               { Eigen::Vector3d(0, 0.6, 0), -0.15 },
+                                                               { Eigen::Vector3d(0, 0, -0.9), 0.15 } };
+  for (const auto& c : cases)
+  {
+    checker.setCollisionObjectsTransform("sphere_link", Eigen::Isometry3d::Identity() * Eigen::Translation3d(c.first));
+    ContactResultVector contacts = getClosestContacts(checker);
+    ASSERT_EQ(contacts.size(), 1);
+    EXPECT_EQ(contacts[0].link_names[0], "box_link");
+    EXPECT_EQ(contacts[0].link_names[1], "sphere_link");
+    EXPECT_LE(contacts[0].distance, c.second + 1e-6);
+    EXPECT_GE(contacts[0].distance, c.second - bound - 1e-6);
+    EXPECT_GT(contacts[0].normal.dot(c.first.normalized()), 0.9);
+  }
+
+  checker.setCollisionObjectsTransform("sphere_link", Eigen::Isometry3d::Identity() * Eigen::Translation3d(0, 0, 2));
+  EXPECT_TRUE(getClosestContacts(checker).empty());
+  EXPECT_FALSE(checker.anyContactTest(ContactRequest(ContactTestType::FIRST)));
+
+  // A clone shares the sphere trees, it keeps its own allowed collision function
+  checker.setCollisionObjectsTransform("sphere_link", Eigen::Isometry3d::Identity() * Eigen::Translation3d(0, 0.6, 0));
+  DiscreteContactManager::UPtr cloned_checker = checker.clone();
+  EXPECT_EQ(getClosestContacts(*cloned_checker).size(), 1);
+  cloned_checker->setIsContactAllowedFn([](const std::string&, const std::string&) { return true; });
+  EXPECT_TRUE(getClosestContacts(*cloned_checker).empty());
+  EXPECT_EQ(getClosestContacts(checker).size(), 1);
+
+  EXPECT_TRUE(checker.disableCollisionObject("box_link"));
+  EXPECT_TRUE(getClosestContacts(checker).empty());
+  EXPECT_TRUE(checker.removeCollisionObject("box_link"));
+  EXPECT_FALSE(checker.hasCollisionObject("box_link"));
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
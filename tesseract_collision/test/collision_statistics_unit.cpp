@@ -0,0 +1,71 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/test_suite/collision_statistics_unit.hpp>
+#include <tesseract_collision/bullet/bullet_discrete_simple_manager.h>
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/bullet/bullet_cast_simple_manager.h>
+#include <tesseract_collision/bullet/bullet_cast_bvh_manager.h>
+#include <tesseract_collision/fcl/fcl_discrete_managers.h>
+#include <tesseract_collision/fcl/fcl_cast_managers.h>
+#include <tesseract_collision/sdf/sdf_discrete_manager.h>
+#include <tesseract_collision/sphere_tree/sphere_tree_discrete_manager.h>
+
+using namespace tesseract_collision;
+
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionStatisticsUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionStatisticsUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, BulletContinuousSimpleCollisionStatisticsUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletCastSimpleManager checker;
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, BulletContinuousBVHCollisionStatisticsUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletCastBVHManager checker;
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionStatisticsUnsupportedUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLDiscreteBVHManager checker;
+  test_suite::runUnsupportedTest(checker);
+}
+
+TEST(TesseractCollisionUnit, FCLContinuousBVHCollisionStatisticsUnsupportedUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLCastBVHManager checker;
+  test_suite::runUnsupportedTest(checker);
+}
+
+TEST(TesseractCollisionUnit, SDFDiscreteCollisionStatisticsUnsupportedUnit)  // NOLINT
+{
+  tesseract_collision_sdf::SDFDiscreteManager checker;
+  test_suite::runUnsupportedTest(checker);
+}
+
+TEST(TesseractCollisionUnit, SphereTreeDiscreteCollisionStatisticsUnsupportedUnit)  // NOLINT
+{
+  tesseract_collision_sphere_tree::SphereTreeDiscreteManager checker;
+  test_suite::runUnsupportedTest(checker);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
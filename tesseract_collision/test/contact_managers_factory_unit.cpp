@@ -30,6 +30,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/core/contact_managers_plugin_factory.h>
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/bullet/bullet_cast_bvh_manager.h>
 
 using namespace tesseract_collision;
 
@@ -56,7 +58,7 @@ void runContactManagersFactoryTest(const tesseract_common::fs::path& config_path
 
   {
     std::set<std::string> sl = factory.getSearchLibraries();
-    EXPECT_EQ(sl.size(), 2);
+    EXPECT_EQ(sl.size(), 4);
 
     for (auto it = search_libraries.begin(); it != search_libraries.end(); ++it)
     {
@@ -64,7 +66,7 @@ void runContactManagersFactoryTest(const tesseract_common::fs::path& config_path
     }
   }
 
-  EXPECT_EQ(discrete_plugins.size(), 3);
+  EXPECT_EQ(discrete_plugins.size(), 5);
   for (auto cm_it = discrete_plugins.begin(); cm_it != discrete_plugins.end(); ++cm_it)
   {
     auto name = cm_it->first.as<std::string>();
@@ -73,7 +75,7 @@ void runContactManagersFactoryTest(const tesseract_common::fs::path& config_path
     EXPECT_TRUE(cm != nullptr);
   }
 
-  EXPECT_EQ(continuous_plugins.size(), 2);
+  EXPECT_EQ(continuous_plugins.size(), 3);
   for (auto cm_it = continuous_plugins.begin(); cm_it != continuous_plugins.end(); ++cm_it)
   {
     auto name = cm_it->first.as<std::string>();
@@ -148,7 +150,9 @@ TEST(TesseractContactManagersFactoryUnit, LoadStringPluginTest)  // NOLINT
                                 BulletCastBVHManager:
                                   class: BulletCastBVHManagerFactory
                                 BulletCastSimpleManager:
-                                  class: BulletCastSimpleManagerFactory)";
+                                  class: BulletCastSimpleManagerFactory
+                                FCLCastBVHManager:
+                                  class: FCLCastBVHManagerFactory)";
 
   ContactManagersPluginFactory factory(config);
   YAML::Node plugin_config = YAML::Load(config);
@@ -171,7 +175,7 @@ TEST(TesseractContactManagersFactoryUnit, LoadStringPluginTest)  // NOLINT
 
   {
     std::set<std::string> sl = factory.getSearchLibraries();
-    EXPECT_EQ(sl.size(), 2);
+    EXPECT_EQ(sl.size(), 4);
 
     for (auto it = search_libraries.begin(); it != search_libraries.end(); ++it)
     {
@@ -188,7 +192,7 @@ TEST(TesseractContactManagersFactoryUnit, LoadStringPluginTest)  // NOLINT
     EXPECT_TRUE(cm != nullptr);
   }
 
-  EXPECT_EQ(continuous_plugins.size(), 2);
+  EXPECT_EQ(continuous_plugins.size(), 3);
   for (auto cm_it = continuous_plugins.begin(); cm_it != continuous_plugins.end(); ++cm_it)
   {
     auto name = cm_it->first.as<std::string>();
@@ -204,7 +208,7 @@ TEST(TesseractContactManagersFactoryUnit, PluginFactorAPIUnit)  // NOLINT
   EXPECT_FALSE(factory.getSearchPaths().empty());
   EXPECT_EQ(factory.getSearchPaths().size(), 1);
   EXPECT_FALSE(factory.getSearchLibraries().empty());
-  EXPECT_EQ(factory.getSearchLibraries().size(), 2);
+  EXPECT_EQ(factory.getSearchLibraries().size(), 4);
   EXPECT_EQ(factory.getDiscreteContactManagerPlugins().size(), 0);
   EXPECT_EQ(factory.getContinuousContactManagerPlugins().size(), 0);
   EXPECT_ANY_THROW(factory.getDefaultDiscreteContactManagerPlugin());    // NOLINT
@@ -212,11 +216,11 @@ TEST(TesseractContactManagersFactoryUnit, PluginFactorAPIUnit)  // NOLINT
 
   factory.addSearchPath("/usr/local/lib");
   EXPECT_EQ(factory.getSearchPaths().size(), 2);
-  EXPECT_EQ(factory.getSearchLibraries().size(), 2);
+  EXPECT_EQ(factory.getSearchLibraries().size(), 4);
 
   factory.addSearchLibrary("tesseract_collision");
   EXPECT_EQ(factory.getSearchPaths().size(), 2);
-  EXPECT_EQ(factory.getSearchLibraries().size(), 3);
+  EXPECT_EQ(factory.getSearchLibraries().size(), 5);
 
   {
     tesseract_common::PluginInfoMap map = factory.getDiscreteContactManagerPlugins();
@@ -362,7 +366,9 @@ TEST(TesseractContactManagersFactoryUnit, LoadOnlyContinuousPluginTest)  // NOLI
                                 BulletCastBVHManager:
                                   class: BulletCastBVHManagerFactory
                                 BulletCastSimpleManager:
-                                  class: BulletCastSimpleManagerFactory)";
+                                  class: BulletCastSimpleManagerFactory
+                                FCLCastBVHManager:
+                                  class: FCLCastBVHManagerFactory)";
 
   ContactManagersPluginFactory factory(config);
   YAML::Node plugin_config = YAML::Load(config);
@@ -392,7 +398,7 @@ TEST(TesseractContactManagersFactoryUnit, LoadOnlyContinuousPluginTest)  // NOLI
     }
   }
 
-  EXPECT_EQ(continuous_plugins.size(), 2);
+  EXPECT_EQ(continuous_plugins.size(), 3);
   for (auto cm_it = continuous_plugins.begin(); cm_it != continuous_plugins.end(); ++cm_it)
   {
     auto name = cm_it->first.as<std::string>();
@@ -402,6 +408,96 @@ TEST(TesseractContactManagersFactoryUnit, LoadOnlyContinuousPluginTest)  // NOLI
   }
 }
 
+TEST(TesseractContactManagersFactoryUnit, LoadBulletBroadphaseConfigPluginTest)  // NOLINT
+{
+  std::string config = R"(contact_manager_plugins:
+                            search_paths:
+                              - /usr/local/lib
+                            search_libraries:
+                              - tesseract_collision_bullet_factories
+                            discrete_plugins:
+                              default: BulletDiscreteBVHManager
+                              plugins:
+                                BulletDiscreteBVHManager:
+                                  class: BulletDiscreteBVHManagerFactory
+                                  config:
+                                    broadphase:
+                                      type: SWEEP_AND_PRUNE
+                                      world_min: [-2, -2, -1]
+                                      world_max: [2, 2, 3]
+                                      max_handles: 4096
+                                BulletDiscreteBVHHashGridManager:
+                                  class: BulletDiscreteBVHManagerFactory
+                                  config:
+                                    broadphase:
+                                      type: HASH_GRID
+                                      cell_size: 0.1
+                                      max_cells_per_proxy: 128
+                                BulletDiscreteBVHInvalidManager:
+                                  class: BulletDiscreteBVHManagerFactory
+                                  config:
+                                    broadphase:
+                                      type: DOES_NOT_EXIST
+                            continuous_plugins:
+                              default: BulletCastBVHManager
+                              plugins:
+                                BulletCastBVHManager:
+                                  class: BulletCastBVHManagerFactory
+                                  config:
+                                    broadphase:
+                                      type: HASH_GRID
+                                      cell_size: 0.1
+                                BulletCastBVHInvalidManager:
+                                  class: BulletCastBVHManagerFactory
+                                  config:
+                                    broadphase:
+                                      type: SWEEP_AND_PRUNE
+                                      world_min: [1, 1, 1]
+                                      world_max: [-1, -1, -1])";
+
+  using tesseract_collision_bullet::BulletBroadphaseType;
+  using tesseract_collision_bullet::BulletCastBVHManager;
+  using tesseract_collision_bullet::BulletDiscreteBVHManager;
+
+  ContactManagersPluginFactory factory(config);
+
+  {
+    DiscreteContactManager::UPtr cm = factory.createDiscreteContactManager("BulletDiscreteBVHManager");
+    auto* bvh_cm = dynamic_cast<BulletDiscreteBVHManager*>(cm.get());
+    ASSERT_TRUE(bvh_cm != nullptr);
+    const auto& broadphase_config = bvh_cm->getBroadphaseConfig();
+    EXPECT_EQ(broadphase_config.type, BulletBroadphaseType::SWEEP_AND_PRUNE);
+    EXPECT_TRUE(broadphase_config.world_min.isApprox(Eigen::Vector3d(-2, -2, -1)));
+    EXPECT_TRUE(broadphase_config.world_max.isApprox(Eigen::Vector3d(2, 2, 3)));
+    EXPECT_EQ(broadphase_config.max_handles, 4096U);
+  }
+
+  {
+    DiscreteContactManager::UPtr cm = factory.createDiscreteContactManager("BulletDiscreteBVHHashGridManager");
+    auto* bvh_cm = dynamic_cast<BulletDiscreteBVHManager*>(cm.get());
+    ASSERT_TRUE(bvh_cm != nullptr);
+    const auto& broadphase_config = bvh_cm->getBroadphaseConfig();
+    EXPECT_EQ(broadphase_config.type, BulletBroadphaseType::HASH_GRID);
+    EXPECT_NEAR(broadphase_config.cell_size, 0.1, 1e-8);
+    EXPECT_EQ(broadphase_config.max_cells_per_proxy, 128U);
+  }
+
+  {
+    ContinuousContactManager::UPtr cm = factory.createContinuousContactManager("BulletCastBVHManager");
+    auto* bvh_cm = dynamic_cast<BulletCastBVHManager*>(cm.get());
+    ASSERT_TRUE(bvh_cm != nullptr);
+    const auto& broadphase_config = bvh_cm->getBroadphaseConfig();
+    EXPECT_EQ(broadphase_config.type, BulletBroadphaseType::HASH_GRID);
+    EXPECT_NEAR(broadphase_config.cell_size, 0.1, 1e-8);
+
+    // Settings missing from the config keep their defaults
+    EXPECT_EQ(broadphase_config.max_cells_per_proxy, 64U);
+  }
+
+  EXPECT_TRUE(factory.createDiscreteContactManager("BulletDiscreteBVHInvalidManager") == nullptr);
+  EXPECT_TRUE(factory.createContinuousContactManager("BulletCastBVHInvalidManager") == nullptr);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
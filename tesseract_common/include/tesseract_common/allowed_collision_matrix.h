@@ -4,6 +4,8 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/access.hpp>
+#include <algorithm>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
@@ -19,6 +21,119 @@ using AllowedCollisionEntries =
 
 bool operator==(const AllowedCollisionEntries& entries_1, const AllowedCollisionEntries& entries_2);
 
+/**
+ * @brief A compiled form of the allowed collision matrix
+ * @details Link names are interned to integer ids and the allowed pairs are stored in a lower triangular bitset, so a
+ * query does not copy or hash a pair of strings. Only links which are part of an allowed pair hold an id, and the id
+ * of a link is reused once its last allowed pair is removed.
+ *
+ * Callers may cache link ids to query without any string lookup. The cached ids remain valid as long as
+ * getLinkIdRevision() returns the value it had when they were looked up.
+ */
+class CompiledAllowedCollisionMatrix
+{
+public:
+  CompiledAllowedCollisionMatrix() = default;
+  explicit CompiledAllowedCollisionMatrix(const AllowedCollisionEntries& entries);
+
+  /**
+   * @brief Allow or disallow collision between two links, interning the link names as needed
+   * @param link_name1 First link name
+   * @param link_name2 Second link name
+   * @param allowed True if allowed to be in collision, otherwise false
+   */
+  void setCollisionAllowed(const std::string& link_name1, const std::string& link_name2, bool allowed);
+
+  /**
+   * @brief Disallow collision for every pair containing the link
+   * @param link_name The link name
+   */
+  void removeLink(const std::string& link_name);
+
+  /** @brief Clear all allowed pairs and interned link names */
+  void clear();
+
+  /**
+   * @brief Get the id of a link name
+   * @param link_name The link name
+   * @return The link id, or -1 if the link name is not part of any allowed collision pair
+   */
+  long getLinkId(const std::string& link_name) const;
+
+  /**
+   * @brief Get the revision of the link ids
+   * @details The revision changes whenever a link name is given an id or releases its id. Revisions are unique across
+   * all instances and copies keep the revision of their source, so equal revisions always mean equal link ids.
+   * @return The link id revision
+   */
+  std::size_t getLinkIdRevision() const { return link_id_revision_; }
+
+  /**
+   * @brief Get the number of links which are part of at least one allowed pair
+   * @return The number of interned link names
+   */
+  std::size_t size() const;
+
+  /**
+   * @brief This checks if two links are allowed to be in collision
+   * @param link_name1 First link name
+   * @param link_name2 Second link name
+   * @return True if allowed to be in collision, otherwise false
+   */
+  bool isCollisionAllowed(const std::string& link_name1, const std::string& link_name2) const
+  {
+    auto it1 = link_ids_.find(link_name1);
+    if (it1 == link_ids_.end())
+      return false;
+
+    auto it2 = link_ids_.find(link_name2);
+    if (it2 == link_ids_.end())
+      return false;
+
+    return isBitSet(getBitIndex(it1->second, it2->second));
+  }
+
+  /**
+   * @brief This checks if two links are allowed to be in collision
+   * @param link_id1 First link id
+   * @param link_id2 Second link id
+   * @return True if allowed to be in collision, otherwise false (including unknown ids)
+   */
+  bool isCollisionAllowed(long link_id1, long link_id2) const
+  {
+    if (link_id1 < 0 || link_id2 < 0)
+      return false;
+
+    return isBitSet(getBitIndex(static_cast<std::size_t>(link_id1), static_cast<std::size_t>(link_id2)));
+  }
+
+private:
+  std::unordered_map<std::string, std::size_t> link_ids_; /**< @brief The link name map to link id */
+  std::vector<std::string> link_names_;                   /**< @brief The link names ordered by id */
+  std::vector<std::size_t> pair_counts_;                  /**< @brief The number of allowed pairs of each link id */
+  std::vector<std::size_t> free_ids_;                     /**< @brief The link ids available for reuse */
+  std::vector<std::uint64_t> bits_;                       /**< @brief The lower triangular bitset of allowed pairs */
+  std::size_t link_id_revision_{ 0 };                     /**< @brief The revision of the link ids */
+
+  /** @brief Give the link ids a new unique revision */
+  void updateLinkIdRevision();
+
+  /** @brief Get the id of a link name, interning it if it does not exist */
+  std::size_t addLinkName(const std::string& link_name);
+
+  /** @brief Clear the bit of an allowed pair and release the link ids which no longer have an allowed pair */
+  void clearPair(std::size_t link_id1, std::size_t link_id2);
+
+  bool isBitSet(std::size_t bit) const { return ((bits_[bit >> 6U] >> (bit & 63U)) & 1U) != 0; }
+
+  static std::size_t getBitIndex(std::size_t link_id1, std::size_t link_id2)
+  {
+    const std::size_t row = std::max(link_id1, link_id2);
+    const std::size_t col = std::min(link_id1, link_id2);
+    return ((row * (row + 1)) / 2) + col;
+  }
+};
+
 class AllowedCollisionMatrix
 {
 public:
@@ -48,6 +163,7 @@ public:
   {
     auto link_pair = tesseract_common::makeOrderedLinkPair(link_name1, link_name2);
     lookup_table_[link_pair] = reason;
+    compiled_.setCollisionAllowed(link_name1, link_name2, true);
   }
 
   /**
@@ -67,6 +183,7 @@ public:
   {
     auto link_pair = tesseract_common::makeOrderedLinkPair(link_name1, link_name2);
     lookup_table_.erase(link_pair);
+    compiled_.setCollisionAllowed(link_name1, link_name2, false);
   }
 
   /**
@@ -86,6 +203,7 @@ public:
         ++it;
       }
     }
+    compiled_.removeLink(link_name);
   }
 
   /**
@@ -96,15 +214,26 @@ public:
    */
   virtual bool isCollisionAllowed(const std::string& link_name1, const std::string& link_name2) const
   {
-    auto link_pair = tesseract_common::makeOrderedLinkPair(link_name1, link_name2);
-    return (lookup_table_.find(link_pair) != lookup_table_.end());
+    return compiled_.isCollisionAllowed(link_name1, link_name2);
   }
 
+  /**
+   * @brief Get the compiled form of the allowed collision matrix
+   * @details This is kept in sync with every modification of the allowed collision matrix. Derived classes which
+   * override isCollisionAllowed are not reflected in the compiled form.
+   * @return The compiled allowed collision matrix
+   */
+  const CompiledAllowedCollisionMatrix& getCompiledAllowedCollisionMatrix() const { return compiled_; }
+
   /**
    * @brief Clears the list of allowed collisions, so that no collision will be
    *        allowed.
    */
-  void clearAllowedCollisions() { lookup_table_.clear(); }
+  void clearAllowedCollisions()
+  {
+    lookup_table_.clear();
+    compiled_.clear();
+  }
 
   /**
    * @brief Inserts an allowable collision matrix ignoring duplicate pairs
@@ -113,6 +242,8 @@ public:
   void insertAllowedCollisionMatrix(const AllowedCollisionMatrix& acm)
   {
     lookup_table_.insert(acm.getAllAllowedCollisions().begin(), acm.getAllAllowedCollisions().end());
+    for (const auto& entry : acm.getAllAllowedCollisions())
+      compiled_.setCollisionAllowed(entry.first.first, entry.first.second, true);
   }
 
   friend std::ostream& operator<<(std::ostream& os, const AllowedCollisionMatrix& acm)
@@ -126,6 +257,7 @@ public:
 
 private:
   AllowedCollisionEntries lookup_table_;
+  CompiledAllowedCollisionMatrix compiled_;
 
   friend class boost::serialization::access;
   template <class Archive>
@@ -29,6 +29,7 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <array>
+#include <functional>
 #include <vector>
 #include <string>
 #include <sstream>
@@ -263,6 +264,37 @@ bool isIdenticalMap(
   return true;
 }
 
+/**
+ * @brief Assign the entries of one map to another, reusing the existing entries when both hold the same keys
+ * @details Copy assignment re-constructs every key, which allocates for long strings. When the keys of both maps
+ * match, only the values are assigned so no allocation takes place. Otherwise this falls back to copy assignment.
+ * @param target The map to assign to
+ * @param source The map to assign from
+ */
+template <typename KeyValueContainerType>
+void assignMapValues(KeyValueContainerType& target, const KeyValueContainerType& source)
+{
+  if (target.size() == source.size())
+  {
+    bool keys_match{ true };
+    for (const auto& entry : source)
+    {
+      auto it = target.find(entry.first);
+      if (it == target.end())
+      {
+        keys_match = false;
+        break;
+      }
+      it->second = entry.second;
+    }
+
+    if (keys_match)
+      return;
+  }
+
+  target = source;
+}
+
 /**
  * @brief Checks if 2 sets are identical
  * @param map_1 First map
@@ -530,5 +562,15 @@ std::vector<std::string> getAllowedCollisions(const std::vector<std::string>& li
                                               const AllowedCollisionEntries& acm_entries,
                                               bool remove_duplicates = true);
 
+/**
+ * @brief Run a function over the index range [0, size) split into contiguous chunks across worker threads
+ * @details The calling thread processes the first chunk itself, so no thread is created when a single thread is
+ * requested. If a chunk throws, the first exception is rethrown after all workers have finished.
+ * @param size The number of indices
+ * @param num_threads The maximum number of threads to use
+ * @param fn The function called for each chunk [start, end), it must be safe to call concurrently
+ */
+void parallelFor(long size, std::size_t num_threads, const std::function<void(long start, long end)>& fn);
+
 }  // namespace tesseract_common
 #endif  // TESSERACT_COMMON_UTILS_H
@@ -32,6 +32,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/library_version_type.hpp>
 #endif
 #include <boost/serialization/unordered_map.hpp>
+#include <algorithm>
+#include <atomic>
 #include <memory>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -58,6 +60,129 @@ bool operator==(const AllowedCollisionEntries& entries_1, const AllowedCollision
   return true;
 }
 
+CompiledAllowedCollisionMatrix::CompiledAllowedCollisionMatrix(const AllowedCollisionEntries& entries)
+{
+  for (const auto& entry : entries)
+    setCollisionAllowed(entry.first.first, entry.first.second, true);
+}
+
+void CompiledAllowedCollisionMatrix::setCollisionAllowed(const std::string& link_name1,
+                                                         const std::string& link_name2,
+                                                         bool allowed)
+{
+  if (!allowed)
+  {
+    auto it1 = link_ids_.find(link_name1);
+    auto it2 = link_ids_.find(link_name2);
+    if (it1 != link_ids_.end() && it2 != link_ids_.end())
+      clearPair(it1->second, it2->second);
+
+    return;
+  }
+
+  const std::size_t link_id1 = addLinkName(link_name1);
+  const std::size_t link_id2 = addLinkName(link_name2);
+  const std::size_t bit = getBitIndex(link_id1, link_id2);
+  if (isBitSet(bit))
+    return;
+
+  bits_[bit >> 6U] |= std::uint64_t(1) << (bit & 63U);
+  ++pair_counts_[link_id1];
+  if (link_id2 != link_id1)
+    ++pair_counts_[link_id2];
+}
+
+void CompiledAllowedCollisionMatrix::removeLink(const std::string& link_name)
+{
+  auto it = link_ids_.find(link_name);
+  if (it == link_ids_.end())
+    return;
+
+  // The link id is released with its last pair, so stop once all of its pairs are cleared
+  const std::size_t link_id = it->second;
+  for (std::size_t i = 0; i < pair_counts_.size() && pair_counts_[link_id] > 0; ++i)
+  {
+    if (pair_counts_[i] > 0 && isBitSet(getBitIndex(link_id, i)))
+      clearPair(link_id, i);
+  }
+}
+
+void CompiledAllowedCollisionMatrix::clear()
+{
+  link_ids_.clear();
+  link_names_.clear();
+  pair_counts_.clear();
+  free_ids_.clear();
+  bits_.clear();
+  updateLinkIdRevision();
+}
+
+std::size_t CompiledAllowedCollisionMatrix::size() const { return link_ids_.size(); }
+
+long CompiledAllowedCollisionMatrix::getLinkId(const std::string& link_name) const
+{
+  auto it = link_ids_.find(link_name);
+  return (it != link_ids_.end()) ? static_cast<long>(it->second) : -1;
+}
+
+void CompiledAllowedCollisionMatrix::updateLinkIdRevision()
+{
+  // Revision zero is reserved for a default constructed matrix
+  static std::atomic<std::size_t> next_revision{ 1 };
+  link_id_revision_ = next_revision++;
+}
+
+std::size_t CompiledAllowedCollisionMatrix::addLinkName(const std::string& link_name)
+{
+  auto it = link_ids_.find(link_name);
+  if (it != link_ids_.end())
+    return it->second;
+
+  // A released id has no allowed pairs left, so its bits are already cleared
+  if (!free_ids_.empty())
+  {
+    const std::size_t link_id = free_ids_.back();
+    free_ids_.pop_back();
+    link_ids_[link_name] = link_id;
+    link_names_[link_id] = link_name;
+    updateLinkIdRevision();
+    return link_id;
+  }
+
+  // Rows are appended for new ids so the bits of existing pairs do not move
+  const std::size_t link_id = link_names_.size();
+  link_ids_[link_name] = link_id;
+  link_names_.push_back(link_name);
+  pair_counts_.push_back(0);
+
+  const std::size_t num_bits = getBitIndex(link_id, link_id) + 1;
+  bits_.resize((num_bits + 63) / 64, 0);
+  updateLinkIdRevision();
+  return link_id;
+}
+
+void CompiledAllowedCollisionMatrix::clearPair(std::size_t link_id1, std::size_t link_id2)
+{
+  const std::size_t bit = getBitIndex(link_id1, link_id2);
+  if (!isBitSet(bit))
+    return;
+
+  bits_[bit >> 6U] &= ~(std::uint64_t(1) << (bit & 63U));
+  for (std::size_t link_id : { link_id1, link_id2 })
+  {
+    if (--pair_counts_[link_id] == 0)
+    {
+      link_ids_.erase(link_names_[link_id]);
+      link_names_[link_id].clear();
+      free_ids_.push_back(link_id);
+      updateLinkIdRevision();
+    }
+
+    if (link_id1 == link_id2)
+      break;
+  }
+}
+
 bool AllowedCollisionMatrix::operator==(const AllowedCollisionMatrix& rhs) const
 {
   bool equal = true;
@@ -71,6 +196,10 @@ template <class Archive>
 void AllowedCollisionMatrix::serialize(Archive& ar, const unsigned int /*version*/)
 {
   ar& BOOST_SERIALIZATION_NVP(lookup_table_);
+
+  // The compiled form is not serialized, rebuild it from the entries
+  if (Archive::is_loading::value)
+    compiled_ = CompiledAllowedCollisionMatrix(lookup_table_);
 }
 }  // namespace tesseract_common
 
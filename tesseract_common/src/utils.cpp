@@ -26,8 +26,11 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
 #include <ctime>
+#include <exception>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <console_bridge/console.h>
 #include <fstream>
@@ -462,4 +465,58 @@ std::vector<std::string> getAllowedCollisions(const std::vector<std::string>& li
   return results;
 }
 
+void parallelFor(long size, std::size_t num_threads, const std::function<void(long start, long end)>& fn)
+{
+  if (size <= 0)
+    return;
+
+  const long num_chunks = std::min(std::max(static_cast<long>(num_threads), 1L), size);
+  if (num_chunks == 1)
+  {
+    fn(0, size);
+    return;
+  }
+
+  const long chunk_size = (size + num_chunks - 1) / num_chunks;
+  std::vector<std::exception_ptr> errors(static_cast<std::size_t>(num_chunks));
+  std::vector<std::thread> workers;
+  workers.reserve(static_cast<std::size_t>(num_chunks - 1));
+  for (long c = 1; c < num_chunks; ++c)
+  {
+    const long start = c * chunk_size;
+    const long end = std::min(start + chunk_size, size);
+    if (start >= end)
+      break;
+
+    workers.emplace_back([&fn, &errors, c, start, end]() {
+      try
+      {
+        fn(start, end);
+      }
+      catch (...)
+      {
+        errors[static_cast<std::size_t>(c)] = std::current_exception();
+      }
+    });
+  }
+
+  try
+  {
+    fn(0, std::min(chunk_size, size));
+  }
+  catch (...)
+  {
+    errors[0] = std::current_exception();
+  }
+
+  for (auto& worker : workers)
+    worker.join();
+
+  for (const auto& error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+}
+
 }  // namespace tesseract_common
@@ -15,6 +15,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_common/any_poly.h>
 #include <tesseract_common/kinematic_limits.h>
 #include <tesseract_common/yaml_utils.h>
+#include <tesseract_common/allowed_collision_matrix.h>
 
 TEST(TesseractCommonUnit, isNumeric)  // NOLINT
 {
@@ -1834,6 +1835,141 @@ TEST(TesseractCommonUnit, linkNamesPairUnit)  // NOLINT
   EXPECT_EQ(hash(p1), hash(p2));
 }
 
+TEST(TesseractCommonUnit, CompiledAllowedCollisionMatrixUnit)  // NOLINT
+{
+  tesseract_common::AllowedCollisionMatrix acm;
+  for (int i = 0; i < 100; ++i)
+    acm.addAllowedCollision("link_" + std::to_string(i), "link_" + std::to_string(i + 1), "adjacent");
+  acm.addAllowedCollision("link_7", "link_7", "self");
+
+  for (int i = 0; i < 101; ++i)
+  {
+    for (int j = 0; j < 101; ++j)
+    {
+      std::string l1 = "link_" + std::to_string(i);
+      std::string l2 = "link_" + std::to_string(j);
+      bool expected = (std::abs(i - j) == 1) || (i == 7 && j == 7);
+      EXPECT_EQ(acm.isCollisionAllowed(l1, l2), expected);
+    }
+  }
+
+  // The id based query matches the name based query
+  const tesseract_common::CompiledAllowedCollisionMatrix& acm_compiled = acm.getCompiledAllowedCollisionMatrix();
+  EXPECT_EQ(acm_compiled.size(), 101);
+  for (int i = 0; i < 101; ++i)
+  {
+    for (int j = 0; j < 101; ++j)
+    {
+      std::string l1 = "link_" + std::to_string(i);
+      std::string l2 = "link_" + std::to_string(j);
+      EXPECT_EQ(acm_compiled.isCollisionAllowed(acm_compiled.getLinkId(l1), acm_compiled.getLinkId(l2)),
+                acm.isCollisionAllowed(l1, l2));
+    }
+  }
+
+  // Unknown links are never allowed
+  EXPECT_FALSE(acm.isCollisionAllowed("link_1", "does_not_exist"));
+  EXPECT_EQ(acm_compiled.getLinkId("does_not_exist"), -1);
+  EXPECT_FALSE(acm_compiled.isCollisionAllowed(-1, acm_compiled.getLinkId("link_1")));
+
+  // Link ids stay valid while the link id revision does not change
+  const long id_1 = acm_compiled.getLinkId("link_1");
+  const long id_2 = acm_compiled.getLinkId("link_2");
+  const std::size_t revision = acm_compiled.getLinkIdRevision();
+  acm.removeAllowedCollision("link_2", "link_1");
+  EXPECT_EQ(acm_compiled.getLinkIdRevision(), revision);
+  EXPECT_FALSE(acm_compiled.isCollisionAllowed(id_1, id_2));
+  EXPECT_TRUE(acm_compiled.isCollisionAllowed(id_2, acm_compiled.getLinkId("link_3")));
+  EXPECT_FALSE(acm.isCollisionAllowed("link_1", "link_2"));
+  EXPECT_TRUE(acm.isCollisionAllowed("link_2", "link_3"));
+
+  // Removing the last pair of link_2 releases its id, so cached ids must be looked up again
+  acm.removeAllowedCollision("link_3");
+  EXPECT_NE(acm_compiled.getLinkIdRevision(), revision);
+  EXPECT_EQ(acm_compiled.getLinkId("link_2"), -1);
+  EXPECT_FALSE(acm.isCollisionAllowed("link_2", "link_3"));
+  EXPECT_FALSE(acm.isCollisionAllowed("link_3", "link_4"));
+  EXPECT_TRUE(acm.isCollisionAllowed("link_4", "link_5"));
+
+  acm.addAllowedCollision("link_2", "link_1", "adjacent");
+  EXPECT_TRUE(acm.isCollisionAllowed("link_1", "link_2"));
+  EXPECT_EQ(acm_compiled.getLinkId("link_1"), id_1);
+  EXPECT_TRUE(acm_compiled.isCollisionAllowed(id_1, acm_compiled.getLinkId("link_2")));
+
+  // A compiled matrix built from the entries matches the one kept in sync
+  tesseract_common::CompiledAllowedCollisionMatrix rebuilt(acm.getAllAllowedCollisions());
+  for (int i = 0; i < 101; ++i)
+  {
+    for (int j = 0; j < 101; ++j)
+    {
+      std::string l1 = "link_" + std::to_string(i);
+      std::string l2 = "link_" + std::to_string(j);
+      EXPECT_EQ(rebuilt.isCollisionAllowed(l1, l2), acm.isCollisionAllowed(l1, l2));
+    }
+  }
+
+  tesseract_common::AllowedCollisionMatrix other;
+  other.addAllowedCollision("link_200", "link_3", "inserted");
+  acm.insertAllowedCollisionMatrix(other);
+  EXPECT_TRUE(acm.isCollisionAllowed("link_3", "link_200"));
+
+  // Only links with an allowed pair hold an id, and ids are reused once a link has no allowed pair left
+  tesseract_common::CompiledAllowedCollisionMatrix compiled;
+  compiled.setCollisionAllowed("link_a", "link_b", true);
+  compiled.setCollisionAllowed("link_b", "link_c", true);
+  compiled.setCollisionAllowed("link_c", "link_c", true);
+  EXPECT_EQ(compiled.size(), 3);
+
+  compiled.setCollisionAllowed("link_b", "link_a", false);
+  EXPECT_EQ(compiled.size(), 2);
+  EXPECT_FALSE(compiled.isCollisionAllowed("link_a", "link_b"));
+  EXPECT_TRUE(compiled.isCollisionAllowed("link_b", "link_c"));
+
+  const long id_b = compiled.getLinkId("link_b");
+  const std::size_t revision_b = compiled.getLinkIdRevision();
+  compiled.removeLink("link_c");
+  EXPECT_EQ(compiled.size(), 0);
+  EXPECT_EQ(compiled.getLinkId("link_b"), -1);
+  EXPECT_NE(compiled.getLinkIdRevision(), revision_b);
+  EXPECT_FALSE(compiled.isCollisionAllowed("link_b", "link_c"));
+  EXPECT_FALSE(compiled.isCollisionAllowed("link_c", "link_c"));
+
+  // Copies keep the link id revision of their source
+  tesseract_common::CompiledAllowedCollisionMatrix copied(compiled);
+  EXPECT_EQ(copied.getLinkIdRevision(), compiled.getLinkIdRevision());
+
+  // Repeatedly adding and removing links does not grow the number of ids
+  for (int i = 0; i < 100; ++i)
+  {
+    std::string link_name = "temp_link_" + std::to_string(i);
+    compiled.setCollisionAllowed(link_name, "link_d", true);
+    EXPECT_TRUE(compiled.isCollisionAllowed("link_d", link_name));
+    EXPECT_EQ(compiled.size(), 2);
+    compiled.removeLink(link_name);
+    EXPECT_FALSE(compiled.isCollisionAllowed("link_d", link_name));
+    EXPECT_EQ(compiled.size(), 0);
+  }
+
+  // A reused id does not carry over the pairs of the released link
+  compiled.setCollisionAllowed("link_e", "link_f", true);
+  compiled.setCollisionAllowed("link_g", "link_h", true);
+  EXPECT_TRUE(compiled.getLinkId("link_e") == id_b || compiled.getLinkId("link_f") == id_b ||
+              compiled.getLinkId("link_g") == id_b || compiled.getLinkId("link_h") == id_b);
+  EXPECT_TRUE(compiled.isCollisionAllowed(compiled.getLinkId("link_e"), compiled.getLinkId("link_f")));
+  EXPECT_FALSE(compiled.isCollisionAllowed(compiled.getLinkId("link_e"), compiled.getLinkId("link_g")));
+  EXPECT_FALSE(compiled.isCollisionAllowed("link_e", "link_g"));
+  EXPECT_FALSE(compiled.isCollisionAllowed("link_f", "link_h"));
+
+  compiled.clear();
+  EXPECT_EQ(compiled.size(), 0);
+  EXPECT_FALSE(compiled.isCollisionAllowed("link_e", "link_f"));
+
+  acm.clearAllowedCollisions();
+  EXPECT_EQ(acm_compiled.size(), 0);
+  EXPECT_EQ(acm_compiled.getLinkId("link_4"), -1);
+  EXPECT_FALSE(acm.isCollisionAllowed("link_4", "link_5"));
+}
+
 /** @brief Tests calcRotationalError which return angle between [-PI, PI]*/
 TEST(TesseractCommonUnit, calcRotationalError)  // NOLINT
 {
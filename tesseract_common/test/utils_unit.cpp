@@ -3,6 +3,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
 #include <iostream>
 #include <fstream>
+#include <unordered_map>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_common/utils.h>
 
@@ -48,6 +49,55 @@ TEST(TesseractCommonUtilsUnit, TestGetAllowedCollisions)  // NOLINT
   }
 }
 
+/// Testing parallelFor
+TEST(TesseractCommonUtilsUnit, TestParallelFor)  // NOLINT
+{
+  for (std::size_t num_threads : std::vector<std::size_t>{ 0, 1, 3, 8, 20 })
+  {
+    std::vector<int> visited(10, 0);
+    tesseract_common::parallelFor(10, num_threads, [&visited](long start, long end) {
+      for (long i = start; i < end; ++i)
+        ++visited[static_cast<std::size_t>(i)];
+    });
+
+    for (int v : visited)
+      EXPECT_EQ(v, 1);
+  }
+
+  // Nothing to do
+  bool called = false;
+  tesseract_common::parallelFor(0, 4, [&called](long /*start*/, long /*end*/) { called = true; });
+  EXPECT_FALSE(called);
+
+  // Exceptions are forwarded to the caller
+  EXPECT_ANY_THROW(tesseract_common::parallelFor(10, 4, [](long start, long /*end*/) {  // NOLINT
+    if (start > 0)
+      throw std::runtime_error("failure");
+  }));
+}
+
+TEST(TesseractCommonUtilsUnit, TestAssignMapValues)  // NOLINT
+{
+  using MapType = std::unordered_map<std::string, double>;
+  MapType source{ { "joint_a", 1 }, { "joint_b", 2 } };
+
+  // Matching keys only update the values
+  MapType target{ { "joint_a", 0 }, { "joint_b", 0 } };
+  const double* value_address = &target.at("joint_a");
+  tesseract_common::assignMapValues(target, source);
+  EXPECT_TRUE((tesseract_common::isIdenticalMap<MapType, double>(target, source)));
+  EXPECT_EQ(value_address, &target.at("joint_a"));
+
+  // Different keys are replaced
+  target = { { "joint_a", 0 }, { "joint_c", 0 } };
+  tesseract_common::assignMapValues(target, source);
+  EXPECT_TRUE((tesseract_common::isIdenticalMap<MapType, double>(target, source)));
+
+  target = { { "joint_a", 0 } };
+  tesseract_common::assignMapValues(target, source);
+  EXPECT_TRUE((tesseract_common::isIdenticalMap<MapType, double>(target, source)));
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
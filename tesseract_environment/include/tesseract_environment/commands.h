@@ -37,6 +37,7 @@
 #include <tesseract_environment/commands/change_joint_position_limits_command.h>
 #include <tesseract_environment/commands/change_joint_velocity_limits_command.h>
 #include <tesseract_environment/commands/change_link_collision_enabled_command.h>
+#include <tesseract_environment/commands/change_link_octree_command.h>
 #include <tesseract_environment/commands/change_link_origin_command.h>
 #include <tesseract_environment/commands/change_link_visibility_command.h>
 #include <tesseract_environment/commands/modify_allowed_collisions_command.h>
@@ -0,0 +1,89 @@
+/**
+ * @file change_link_octree_command.h
+ * @brief Used to apply changed voxels to an octree collision geometry of a link in environment
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, agent
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_CHANGE_LINK_OCTREE_COMMAND_H
+#define TESSERACT_ENVIRONMENT_CHANGE_LINK_OCTREE_COMMAND_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/serialization/access.hpp>
+#include <memory>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/command.h>
+#include <tesseract_collision/core/types.h>
+
+namespace tesseract_environment
+{
+/**
+ * @brief Apply changed voxels, typically a sensor update, to an octree collision geometry of a link
+ * @details The octree is shared with the contact managers and their clones, so the changed voxels are applied to a
+ * copy which replaces the octree in the scene graph and in every contact manager. Contact managers supporting
+ * incremental octree updates only rebuild the parts of the collision object containing the changed voxels.
+ */
+class ChangeLinkOctreeCommand : public Command
+{
+public:
+  using Ptr = std::shared_ptr<ChangeLinkOctreeCommand>;
+  using ConstPtr = std::shared_ptr<const ChangeLinkOctreeCommand>;
+
+  ChangeLinkOctreeCommand() : Command(CommandType::CHANGE_LINK_OCTREE){};
+
+  /**
+   * @brief Apply changed voxels to an octree collision geometry of a link
+   * @param link_name The link name to modify
+   * @param collision_index The index of the collision with the octree geometry in the link
+   * @param delta The voxels that became occupied or free
+   */
+  ChangeLinkOctreeCommand(std::string link_name, std::size_t collision_index, tesseract_collision::OctreeDelta delta)
+    : Command(CommandType::CHANGE_LINK_OCTREE)
+    , link_name_(std::move(link_name))
+    , collision_index_(collision_index)
+    , delta_(std::move(delta))
+  {
+  }
+
+  const std::string& getLinkName() const { return link_name_; }
+  std::size_t getCollisionIndex() const { return collision_index_; }
+  const tesseract_collision::OctreeDelta& getDelta() const { return delta_; }
+
+  bool operator==(const ChangeLinkOctreeCommand& rhs) const;
+  bool operator!=(const ChangeLinkOctreeCommand& rhs) const;
+
+private:
+  std::string link_name_;
+  std::size_t collision_index_{ 0 };
+  tesseract_collision::OctreeDelta delta_;
+
+  friend class boost::serialization::access;
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int version);  // NOLINT
+};
+}  // namespace tesseract_environment
+
+#include <boost/serialization/export.hpp>
+#include <boost/serialization/tracking.hpp>
+BOOST_CLASS_EXPORT_KEY2(tesseract_environment::ChangeLinkOctreeCommand, "ChangeLinkOctreeCommand")
+#endif  // TESSERACT_ENVIRONMENT_CHANGE_LINK_OCTREE_COMMAND_H
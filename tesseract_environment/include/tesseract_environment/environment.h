@@ -30,6 +30,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <vector>
 #include <string>
 #include <shared_mutex>
+#include <mutex>
 #include <chrono>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
@@ -61,6 +62,28 @@ namespace tesseract_environment
  */
 using FindTCPOffsetCallbackFn = std::function<Eigen::Isometry3d(const tesseract_common::ManipulatorInfo&)>;
 
+/**
+ * @brief A contact manager checked out of the environment pool
+ * @details The manager is returned to the pool when it is destroyed or reset. It is destroyed instead if the
+ * environment changed since it was checked out or the environment no longer exists.
+ */
+template <typename ManagerType>
+using PooledContactManager = std::unique_ptr<ManagerType, std::function<void(ManagerType*)>>;
+using PooledDiscreteContactManager = PooledContactManager<tesseract_collision::DiscreteContactManager>;
+using PooledContinuousContactManager = PooledContactManager<tesseract_collision::ContinuousContactManager>;
+
+/** @brief The contact managers available for checkout, shared with the checked out managers */
+template <typename ManagerType>
+struct ContactManagerPool
+{
+  using Ptr = std::shared_ptr<ContactManagerPool<ManagerType>>;
+
+  std::vector<std::unique_ptr<ManagerType>> managers;
+  /** @brief Incremented when the pool is cleared, managers checked out of an earlier generation are not returned */
+  std::size_t generation{ 0 };
+  std::mutex mutex;
+};
+
 class Environment
 {
 public:
@@ -297,6 +320,20 @@ public:
   tesseract_scene_graph::SceneState getState(const std::vector<std::string>& joint_names,
                                              const Eigen::Ref<const Eigen::VectorXd>& joint_values) const;
 
+  /**
+   * @brief Get the state of the environment for a subset of joint values, filling the provided state in place
+   *
+   * This does not change the internal state of the environment. Passing the same state across calls reuses its
+   * storage, so it does not allocate once populated.
+   *
+   * @param state The state to populate
+   * @param joint_names The joint names
+   * @param joint_values The joint values, must be the same size and order as the joint names
+   */
+  void getState(tesseract_scene_graph::SceneState& state,
+                const std::vector<std::string>& joint_names,
+                const Eigen::Ref<const Eigen::VectorXd>& joint_values) const;
+
   /** @brief Get the current state of the environment */
   tesseract_scene_graph::SceneState getState() const;
 
@@ -483,6 +520,17 @@ public:
   /** @brief Get a copy of the environments available discrete contact manager by name */
   tesseract_collision::DiscreteContactManager::UPtr getDiscreteContactManager(const std::string& name) const;
 
+  /**
+   * @brief Check out a copy of the environments active discrete contact manager from the pool
+   * @details The manager is returned to the pool when it is destroyed and reused instead of cloning the active manager.
+   * Pooled managers are dropped when the environment revision or the active manager changes, and a reused manager is
+   * reset to the current state, active links, enabled links, collision margin data, contact allowed function, dense
+   * link names and statistics. A returned manager whose collision objects were added, removed or replaced by the caller
+   * is discarded on the next checkout and a new copy of the active manager is used instead.
+   * @return A discrete contact manager, nullptr if the active manager could not be created
+   */
+  PooledDiscreteContactManager checkoutDiscreteContactManager() const;
+
   /**
    * @brief Set the active continuous contact manager
    * @param name The name used to register the contact manager
@@ -502,6 +550,13 @@ public:
   /** @brief Get a copy of the environments available continuous contact manager by name */
   tesseract_collision::ContinuousContactManager::UPtr getContinuousContactManager(const std::string& name) const;
 
+  /**
+   * @brief Check out a copy of the environments active continuous contact manager from the pool
+   * @details See checkoutDiscreteContactManager
+   * @return A continuous contact manager, nullptr if the active manager could not be created
+   */
+  PooledContinuousContactManager checkoutContinuousContactManager() const;
+
   /** @brief Get the environment collision margin data */
   tesseract_common::CollisionMarginData getCollisionMarginData() const;
 
@@ -631,6 +686,24 @@ protected:
   mutable tesseract_collision::ContinuousContactManager::UPtr continuous_manager_{ nullptr };
   mutable std::shared_mutex continuous_manager_mutex_;
 
+  /**
+   * @brief The pool of returned discrete contact managers
+   * @details This is cleared when the environment or the active discrete contact manager changes
+   * @note This is intentionally not serialized it will auto updated
+   */
+  ContactManagerPool<tesseract_collision::DiscreteContactManager>::Ptr discrete_manager_pool_{
+    std::make_shared<ContactManagerPool<tesseract_collision::DiscreteContactManager>>()
+  };
+
+  /**
+   * @brief The pool of returned continuous contact managers
+   * @details This is cleared when the environment or the active continuous contact manager changes
+   * @note This is intentionally not serialized it will auto updated
+   */
+  ContactManagerPool<tesseract_collision::ContinuousContactManager>::Ptr continuous_manager_pool_{
+    std::make_shared<ContactManagerPool<tesseract_collision::ContinuousContactManager>>()
+  };
+
   /**
    * @brief A cache of group joint names to provide faster access
    * @details This will cleared when environment changes
@@ -641,7 +714,8 @@ protected:
 
   /**
    * @brief A cache of joint groups to provide faster access
-   * @details This will cleared when environment changes
+   * @details This will cleared when environment changes. When only the current state changes the groups are re-based
+   * on the new state and only removed if a joint outside of the group which moves its active links changed.
    * @note This is intentionally not serialized it will auto updated
    */
   mutable std::unordered_map<std::string, tesseract_kinematics::JointGroup::UPtr> joint_group_cache_{};
@@ -649,7 +723,8 @@ protected:
 
   /**
    * @brief A cache of kinematic groups to provide faster access
-   * @details This will cleared when environment changes
+   * @details This will cleared when environment changes. When only the current state changes the groups are re-based
+   * on the new state and only removed if a joint outside of the group which moves its active links changed.
    * @note This is intentionally not serialized it will auto updated
    */
   mutable std::map<std::pair<std::string, std::string>, tesseract_kinematics::KinematicGroup::UPtr>
@@ -691,6 +766,18 @@ private:
 
   tesseract_collision::ContinuousContactManager::UPtr getContinuousContactManagerHelper(const std::string& name) const;
 
+  /** @brief Clone the cached active discrete contact manager, creating it if needed. This does not lock mutex_ */
+  tesseract_collision::DiscreteContactManager::UPtr cloneDiscreteContactManagerHelper() const;
+
+  /** @brief Clone the cached active continuous contact manager, creating it if needed. This does not lock mutex_ */
+  tesseract_collision::ContinuousContactManager::UPtr cloneContinuousContactManagerHelper() const;
+
+  /** @brief Drop the pooled discrete contact managers, checked out managers are no longer accepted back */
+  void clearDiscreteContactManagerPool() const;
+
+  /** @brief Drop the pooled continuous contact managers, checked out managers are no longer accepted back */
+  void clearContinuousContactManagerPool() const;
+
   bool initHelper(const Commands& commands);
   static Commands getInitCommands(const tesseract_scene_graph::SceneGraph& scene_graph,
                                   const tesseract_srdf::SRDFModel::ConstPtr& srdf_model = nullptr);
@@ -708,6 +795,7 @@ private:
   bool applyChangeLinkOriginCommand(const ChangeLinkOriginCommand::ConstPtr& cmd);
   bool applyChangeJointOriginCommand(const ChangeJointOriginCommand::ConstPtr& cmd);
   bool applyChangeLinkCollisionEnabledCommand(const ChangeLinkCollisionEnabledCommand::ConstPtr& cmd);
+  bool applyChangeLinkOctreeCommand(const ChangeLinkOctreeCommand::ConstPtr& cmd);
   bool applyChangeLinkVisibilityCommand(const ChangeLinkVisibilityCommand::ConstPtr& cmd);
   bool applyModifyAllowedCollisionsCommand(const ModifyAllowedCollisionsCommand::ConstPtr& cmd);
   bool applyRemoveAllowedCollisionLinkCommand(const RemoveAllowedCollisionLinkCommand::ConstPtr& cmd);
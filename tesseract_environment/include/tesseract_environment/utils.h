@@ -79,6 +79,58 @@ checkTrajectorySegment(tesseract_collision::ContinuousContactManager& manager,
                        const tesseract_common::TransformMap& state1,
                        const tesseract_collision::ContactRequest& contact_request);
 
+/**
+ * @brief Should perform a continuous collision check between two dense states only passing along the contact_request
+ * to the manager
+ * @details The link transforms must be ordered as the manager's dense link names, see
+ * ContinuousContactManager::setDenseLinkNames
+ * @param manager A continuous contact manager
+ * @param state0 First environment state link transforms
+ * @param state1 Second environment state link transforms
+ * @param contact_request Contact request passed to the manager
+ * @return Return the contact results map. If empty not contacts were found
+ */
+tesseract_collision::ContactResultMap
+checkTrajectorySegment(tesseract_collision::ContinuousContactManager& manager,
+                       const tesseract_common::VectorIsometry3d& state0,
+                       const tesseract_common::VectorIsometry3d& state1,
+                       const tesseract_collision::ContactRequest& contact_request);
+
+/**
+ * @brief Should perform a continuous collision check between two states only passing along the contact_request to the
+ * manager, storing the results in a provided contact results map
+ * @details The contact results map is cleared with ContinuousContactManager::clearContactResults, so when it is reused
+ * across checks its entries are recycled instead of allocated.
+ * @param contacts The contact results map. If empty no contacts were found
+ * @param manager A continuous contact manager
+ * @param state0 First environment state
+ * @param state1 Second environment state
+ * @param contact_request Contact request passed to the manager
+ */
+void checkTrajectorySegment(tesseract_collision::ContactResultMap& contacts,
+                            tesseract_collision::ContinuousContactManager& manager,
+                            const tesseract_common::TransformMap& state0,
+                            const tesseract_common::TransformMap& state1,
+                            const tesseract_collision::ContactRequest& contact_request);
+
+/**
+ * @brief Should perform a continuous collision check between two dense states only passing along the contact_request
+ * to the manager, storing the results in a provided contact results map
+ * @details The link transforms must be ordered as the manager's dense link names. The contact results map is cleared
+ * with ContinuousContactManager::clearContactResults, so when it is reused across checks its entries are recycled
+ * instead of allocated.
+ * @param contacts The contact results map. If empty no contacts were found
+ * @param manager A continuous contact manager
+ * @param state0 First environment state link transforms
+ * @param state1 Second environment state link transforms
+ * @param contact_request Contact request passed to the manager
+ */
+void checkTrajectorySegment(tesseract_collision::ContactResultMap& contacts,
+                            tesseract_collision::ContinuousContactManager& manager,
+                            const tesseract_common::VectorIsometry3d& state0,
+                            const tesseract_common::VectorIsometry3d& state1,
+                            const tesseract_collision::ContactRequest& contact_request);
+
 /**
  * @brief Should perform a discrete collision check a state first configuring manager with config
  * @param manager A discrete contact manager
@@ -101,6 +153,50 @@ tesseract_collision::ContactResultMap checkTrajectoryState(tesseract_collision::
                                                            const tesseract_common::TransformMap& state,
                                                            const tesseract_collision::ContactRequest& contact_request);
 
+/**
+ * @brief Should perform a discrete collision check a dense state only passing contact_request to the manager
+ * @details The link transforms must be ordered as the manager's dense link names, see
+ * DiscreteContactManager::setDenseLinkNames
+ * @param manager A discrete contact manager
+ * @param state The environment state link transforms
+ * @param contact_request Contact request passed to the manager
+ * @return Return the contact results map. If empty no contacts were found
+ */
+tesseract_collision::ContactResultMap checkTrajectoryState(tesseract_collision::DiscreteContactManager& manager,
+                                                           const tesseract_common::VectorIsometry3d& state,
+                                                           const tesseract_collision::ContactRequest& contact_request);
+
+/**
+ * @brief Should perform a discrete collision check a state only passing contact_request to the manager, storing the
+ * results in a provided contact results map
+ * @details The contact results map is cleared with DiscreteContactManager::clearContactResults, so when it is reused
+ * across checks its entries are recycled instead of allocated.
+ * @param contacts The contact results map. If empty no contacts were found
+ * @param manager A discrete contact manager
+ * @param state First environment state
+ * @param contact_request Contact request passed to the manager
+ */
+void checkTrajectoryState(tesseract_collision::ContactResultMap& contacts,
+                          tesseract_collision::DiscreteContactManager& manager,
+                          const tesseract_common::TransformMap& state,
+                          const tesseract_collision::ContactRequest& contact_request);
+
+/**
+ * @brief Should perform a discrete collision check a dense state only passing contact_request to the manager, storing
+ * the results in a provided contact results map
+ * @details The link transforms must be ordered as the manager's dense link names. The contact results map is cleared
+ * with DiscreteContactManager::clearContactResults, so when it is reused across checks its entries are recycled instead
+ * of allocated.
+ * @param contacts The contact results map. If empty no contacts were found
+ * @param manager A discrete contact manager
+ * @param state The environment state link transforms
+ * @param contact_request Contact request passed to the manager
+ */
+void checkTrajectoryState(tesseract_collision::ContactResultMap& contacts,
+                          tesseract_collision::DiscreteContactManager& manager,
+                          const tesseract_common::VectorIsometry3d& state,
+                          const tesseract_collision::ContactRequest& contact_request);
+
 /**
  * @brief This processes interpolated contact results and updated cc_time and cc_type
  * @details This is copied from the trajopt utility processInterpolatedCollisionResults
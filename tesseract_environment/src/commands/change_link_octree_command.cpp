@@ -0,0 +1,74 @@
+/**
+ * @file change_link_octree_command.cpp
+ * @brief Used to apply changed voxels to an octree collision geometry of a link
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/serialization/access.hpp>
+#include <boost/serialization/nvp.hpp>
+#if (BOOST_VERSION >= 107400) && (BOOST_VERSION < 107500)
+#include <boost/serialization/library_version_type.hpp>
+#endif
+#include <boost/serialization/vector.hpp>
+#include <memory>
+#include <string>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/eigen_serialization.h>
+#include <tesseract_common/utils.h>
+#include <tesseract_environment/commands/change_link_octree_command.h>
+
+namespace tesseract_environment
+{
+bool ChangeLinkOctreeCommand::operator==(const ChangeLinkOctreeCommand& rhs) const
+{
+  auto voxels_equal = [](const tesseract_common::VectorVector3d& v1, const tesseract_common::VectorVector3d& v2) {
+    return std::equal(v1.begin(), v1.end(), v2.begin(), v2.end(), [](const auto& p1, const auto& p2) {
+      return p1.isApprox(p2, 1e-5);
+    });
+  };
+
+  bool equal = true;
+  equal &= Command::operator==(rhs);
+  equal &= link_name_ == rhs.link_name_;
+  equal &= collision_index_ == rhs.collision_index_;
+  equal &= voxels_equal(delta_.occupied, rhs.delta_.occupied);
+  equal &= voxels_equal(delta_.free, rhs.delta_.free);
+  return equal;
+}
+bool ChangeLinkOctreeCommand::operator!=(const ChangeLinkOctreeCommand& rhs) const { return !operator==(rhs); }
+
+template <class Archive>
+void ChangeLinkOctreeCommand::serialize(Archive& ar, const unsigned int /*version*/)
+{
+  ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(Command);
+  ar& BOOST_SERIALIZATION_NVP(link_name_);
+  ar& BOOST_SERIALIZATION_NVP(collision_index_);
+  ar& boost::serialization::make_nvp("occupied", delta_.occupied);
+  ar& boost::serialization::make_nvp("free", delta_.free);
+}
+}  // namespace tesseract_environment
+
+#include <tesseract_common/serialization.h>
+TESSERACT_SERIALIZE_ARCHIVES_INSTANTIATE(tesseract_environment::ChangeLinkOctreeCommand)
+BOOST_CLASS_EXPORT_IMPLEMENT(tesseract_environment::ChangeLinkOctreeCommand)
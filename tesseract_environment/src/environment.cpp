@@ -59,9 +59,7 @@ bool Environment::initHelper(const Commands& commands)
       std::static_pointer_cast<const AddSceneGraphCommand>(commands.at(0))->getSceneGraph()->getName());
   scene_graph_const_ = scene_graph_;
 
-  is_contact_allowed_fn_ = [this](const std::string& l1, const std::string& l2) {
-    return scene_graph_->isCollisionAllowed(l1, l2);
-  };
+  is_contact_allowed_fn_ = tesseract_collision::AllowedCollisionMatrixFn(scene_graph_->getAllowedCollisionMatrix());
 
   if (!applyCommandsHelper(commands))
   {
@@ -583,6 +581,14 @@ tesseract_scene_graph::SceneState Environment::getState(const std::vector<std::s
   return state_solver_->getState(joint_names, joint_values);
 }
 
+void Environment::getState(tesseract_scene_graph::SceneState& state,
+                           const std::vector<std::string>& joint_names,
+                           const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  state_solver_->getState(state, joint_names, joint_values);
+}
+
 tesseract_scene_graph::SceneState Environment::getState() const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
@@ -796,6 +802,11 @@ bool Environment::setActiveContinuousContactManager(const std::string& name)
 tesseract_collision::DiscreteContactManager::UPtr Environment::getDiscreteContactManager() const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
+  return cloneDiscreteContactManagerHelper();
+}
+
+tesseract_collision::DiscreteContactManager::UPtr Environment::cloneDiscreteContactManagerHelper() const
+{
   {  // Clone cached manager if exists
     std::shared_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex_);
     if (discrete_manager_)
@@ -821,11 +832,139 @@ void Environment::clearCachedDiscreteContactManager() const
   std::shared_lock<std::shared_mutex> lock;
   std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex_);
   discrete_manager_ = nullptr;
+  clearDiscreteContactManagerPool();
+}
+
+/**
+ * @brief Wrap a contact manager so it is returned to the pool when it is destroyed
+ * @param manager The contact manager
+ * @param pool The pool the manager is returned to, it is only referenced weakly
+ * @param generation The generation of the pool when the manager was checked out
+ */
+template <typename ManagerType>
+PooledContactManager<ManagerType> makePooledContactManager(std::unique_ptr<ManagerType> manager,
+                                                           const typename ContactManagerPool<ManagerType>::Ptr& pool,
+                                                           std::size_t generation)
+{
+  std::weak_ptr<ContactManagerPool<ManagerType>> weak_pool = pool;
+  std::function<void(ManagerType*)> deleter = [weak_pool, generation](ManagerType* ptr) {
+    std::unique_ptr<ManagerType> owned_manager(ptr);
+    auto pool = weak_pool.lock();
+    if (pool == nullptr)
+      return;
+
+    std::unique_lock<std::mutex> pool_lock(pool->mutex);
+    if (pool->generation == generation)
+      pool->managers.push_back(std::move(owned_manager));
+  };
+
+  return PooledContactManager<ManagerType>(manager.release(), std::move(deleter));
+}
+
+/**
+ * @brief Check if a pooled contact manager still has the same collision objects as the cached manager
+ * @details A previous user may have added, removed or replaced collision objects, which can not be undone
+ * @param manager The pooled contact manager
+ * @param cached_manager The environments cached contact manager
+ * @return True if the collision objects, their geometries and geometry transforms match
+ */
+template <typename ManagerType>
+bool hasSameCollisionObjects(const ManagerType& manager, const ManagerType& cached_manager)
+{
+  const std::vector<std::string>& names = manager.getCollisionObjects();
+  if (names != cached_manager.getCollisionObjects())
+    return false;
+
+  for (const auto& name : names)
+  {
+    if (manager.getCollisionObjectGeometries(name) != cached_manager.getCollisionObjectGeometries(name))
+      return false;
+
+    const tesseract_common::VectorIsometry3d& shape_poses = manager.getCollisionObjectGeometriesTransforms(name);
+    const tesseract_common::VectorIsometry3d& cached_shape_poses =
+        cached_manager.getCollisionObjectGeometriesTransforms(name);
+    if (shape_poses.size() != cached_shape_poses.size())
+      return false;
+
+    for (std::size_t i = 0; i < shape_poses.size(); ++i)
+    {
+      if (!shape_poses[i].isApprox(cached_shape_poses[i], 1e-8))
+        return false;
+    }
+  }
+
+  return true;
+}
+
+PooledDiscreteContactManager Environment::checkoutDiscreteContactManager() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  tesseract_collision::DiscreteContactManager::UPtr manager;
+  std::size_t generation{ 0 };
+  {
+    std::unique_lock<std::mutex> pool_lock(discrete_manager_pool_->mutex);
+    generation = discrete_manager_pool_->generation;
+    if (!discrete_manager_pool_->managers.empty())
+    {
+      manager = std::move(discrete_manager_pool_->managers.back());
+      discrete_manager_pool_->managers.pop_back();
+    }
+  }
+
+  if (manager != nullptr)
+  {  // Undo any changes made by the previous user, the manager is discarded if its collision objects changed
+    std::shared_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex_);
+    if (discrete_manager_ == nullptr || !hasSameCollisionObjects(*manager, *discrete_manager_))
+    {
+      manager = nullptr;
+    }
+    else
+    {
+      manager->setActiveCollisionObjects(state_solver_->getActiveLinkNames());
+      manager->setCollisionMarginData(collision_margin_data_);
+      manager->setIsContactAllowedFn(is_contact_allowed_fn_);
+      manager->setCollisionObjectsTransform(current_state_.link_transforms);
+      manager->setDenseLinkNames(discrete_manager_->getDenseLinkNames());
+      manager->setStatisticsEnabled(discrete_manager_->getStatisticsEnabled());
+      manager->resetStatistics();
+      for (const auto& name : manager->getCollisionObjects())
+      {
+        if (discrete_manager_->isCollisionObjectEnabled(name))
+          manager->enableCollisionObject(name);
+        else
+          manager->disableCollisionObject(name);
+      }
+    }
+  }
+
+  if (manager == nullptr)
+  {
+    manager = cloneDiscreteContactManagerHelper();
+    if (manager == nullptr)
+      return nullptr;
+  }
+
+  return makePooledContactManager(std::move(manager), discrete_manager_pool_, generation);
+}
+
+void Environment::clearDiscreteContactManagerPool() const
+{
+  std::vector<tesseract_collision::DiscreteContactManager::UPtr> managers;
+  {
+    std::unique_lock<std::mutex> pool_lock(discrete_manager_pool_->mutex);
+    managers.swap(discrete_manager_pool_->managers);
+    ++discrete_manager_pool_->generation;
+  }
 }
 
 tesseract_collision::ContinuousContactManager::UPtr Environment::getContinuousContactManager() const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
+  return cloneContinuousContactManagerHelper();
+}
+
+tesseract_collision::ContinuousContactManager::UPtr Environment::cloneContinuousContactManagerHelper() const
+{
   {  // Clone cached manager if exists
     std::shared_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex_);
     if (continuous_manager_)
@@ -851,6 +990,75 @@ void Environment::clearCachedContinuousContactManager() const
   std::shared_lock<std::shared_mutex> lock(mutex_);
   std::unique_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex_);
   continuous_manager_ = nullptr;
+  clearContinuousContactManagerPool();
+}
+
+PooledContinuousContactManager Environment::checkoutContinuousContactManager() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  tesseract_collision::ContinuousContactManager::UPtr manager;
+  std::size_t generation{ 0 };
+  {
+    std::unique_lock<std::mutex> pool_lock(continuous_manager_pool_->mutex);
+    generation = continuous_manager_pool_->generation;
+    if (!continuous_manager_pool_->managers.empty())
+    {
+      manager = std::move(continuous_manager_pool_->managers.back());
+      continuous_manager_pool_->managers.pop_back();
+    }
+  }
+
+  if (manager != nullptr)
+  {  // Undo any changes made by the previous user, the manager is discarded if its collision objects changed
+    std::shared_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex_);
+    if (continuous_manager_ == nullptr || !hasSameCollisionObjects(*manager, *continuous_manager_))
+    {
+      manager = nullptr;
+    }
+    else
+    {
+      std::vector<std::string> active_link_names = state_solver_->getActiveLinkNames();
+      manager->setActiveCollisionObjects(active_link_names);
+      manager->setCollisionMarginData(collision_margin_data_);
+      manager->setIsContactAllowedFn(is_contact_allowed_fn_);
+      for (const auto& tf : current_state_.link_transforms)
+      {
+        if (std::find(active_link_names.begin(), active_link_names.end(), tf.first) != active_link_names.end())
+          manager->setCollisionObjectsTransform(tf.first, tf.second, tf.second);
+        else
+          manager->setCollisionObjectsTransform(tf.first, tf.second);
+      }
+      manager->setDenseLinkNames(continuous_manager_->getDenseLinkNames());
+      manager->setStatisticsEnabled(continuous_manager_->getStatisticsEnabled());
+      manager->resetStatistics();
+      for (const auto& name : manager->getCollisionObjects())
+      {
+        if (continuous_manager_->isCollisionObjectEnabled(name))
+          manager->enableCollisionObject(name);
+        else
+          manager->disableCollisionObject(name);
+      }
+    }
+  }
+
+  if (manager == nullptr)
+  {
+    manager = cloneContinuousContactManagerHelper();
+    if (manager == nullptr)
+      return nullptr;
+  }
+
+  return makePooledContactManager(std::move(manager), continuous_manager_pool_, generation);
+}
+
+void Environment::clearContinuousContactManagerPool() const
+{
+  std::vector<tesseract_collision::ContinuousContactManager::UPtr> managers;
+  {
+    std::unique_lock<std::mutex> pool_lock(continuous_manager_pool_->mutex);
+    managers.swap(continuous_manager_pool_->managers);
+    ++continuous_manager_pool_->generation;
+  }
 }
 
 tesseract_collision::ContinuousContactManager::UPtr
@@ -928,6 +1136,7 @@ bool Environment::setActiveDiscreteContactManagerHelper(const std::string& name)
 
   // The calling function should be locking discrete_manager_mutex_
   discrete_manager_ = std::move(manager);
+  clearDiscreteContactManagerPool();
 
   return true;
 }
@@ -951,6 +1160,7 @@ bool Environment::setActiveContinuousContactManagerHelper(const std::string& nam
 
   // The calling function should be locking continuous_manager_mutex_
   continuous_manager_ = std::move(manager);
+  clearContinuousContactManagerPool();
 
   return true;
 }
@@ -1061,11 +1271,24 @@ void Environment::currentStateChanged()
     }
   }
 
-  {  // Clear JointGroup and KinematicGroup
+  {  // Re-base cached JointGroup and KinematicGroup, only remove the ones depending on joints that changed
     std::unique_lock<std::shared_mutex> jg_lock(joint_group_cache_mutex_);
     std::unique_lock<std::shared_mutex> kg_lock(kinematic_group_cache_mutex_);
-    joint_group_cache_.clear();
-    kinematic_group_cache_.clear();
+    for (auto it = joint_group_cache_.begin(); it != joint_group_cache_.end();)
+    {
+      if (it->second->setSceneState(current_state_))
+        ++it;
+      else
+        it = joint_group_cache_.erase(it);
+    }
+
+    for (auto it = kinematic_group_cache_.begin(); it != kinematic_group_cache_.end();)
+    {
+      if (it->second->setSceneState(current_state_))
+        ++it;
+      else
+        it = kinematic_group_cache_.erase(it);
+    }
   }
 }
 
@@ -1086,11 +1309,22 @@ void Environment::environmentChanged()
       continuous_manager_->setActiveCollisionObjects(active_link_names);
   }
 
+  // Pooled contact managers may have stale collision objects
+  clearDiscreteContactManagerPool();
+  clearContinuousContactManagerPool();
+
   {  // Clear JointGroup, KinematicGroup and GroupJointNames cache
     std::unique_lock<std::shared_mutex> jn_lock(group_joint_names_cache_mutex_);
     group_joint_names_cache_.clear();
   }
 
+  {
+    std::unique_lock<std::shared_mutex> jg_lock(joint_group_cache_mutex_);
+    std::unique_lock<std::shared_mutex> kg_lock(kinematic_group_cache_mutex_);
+    joint_group_cache_.clear();
+    kinematic_group_cache_.clear();
+  }
+
   currentStateChanged();
 }
 
@@ -1193,11 +1427,8 @@ Environment::UPtr Environment::clone() const
 
   cloned_env->group_joint_names_cache_ = group_joint_names_cache_;
 
-  // NOLINTNEXTLINE
-  cloned_env->is_contact_allowed_fn_ = std::bind(&tesseract_scene_graph::SceneGraph::isCollisionAllowed,
-                                                 cloned_env->scene_graph_,
-                                                 std::placeholders::_1,
-                                                 std::placeholders::_2);
+  cloned_env->is_contact_allowed_fn_ =
+      tesseract_collision::AllowedCollisionMatrixFn(cloned_env->scene_graph_->getAllowedCollisionMatrix());
 
   if (discrete_manager_)
   {
@@ -1355,6 +1586,12 @@ bool Environment::applyCommandsHelper(const Commands& commands)
         success &= applySetActiveDiscreteContactManagerCommand(cmd);
         break;
       }
+      case tesseract_environment::CommandType::CHANGE_LINK_OCTREE:
+      {
+        auto cmd = std::static_pointer_cast<const ChangeLinkOctreeCommand>(command);
+        success &= applyChangeLinkOctreeCommand(cmd);
+        break;
+      }
       // LCOV_EXCL_START
       default:
       {
@@ -1697,6 +1934,62 @@ bool Environment::applyChangeLinkCollisionEnabledCommand(const ChangeLinkCollisi
   return true;
 }
 
+bool Environment::applyChangeLinkOctreeCommand(const ChangeLinkOctreeCommand::ConstPtr& cmd)
+{
+  tesseract_scene_graph::Link::ConstPtr orig_link = scene_graph_->getLink(cmd->getLinkName());
+  if (orig_link == nullptr)
+  {
+    CONSOLE_BRIDGE_logWarn("Tried to change the octree of link (%s) which does not exist", cmd->getLinkName().c_str());
+    return false;
+  }
+
+  const std::size_t index = cmd->getCollisionIndex();
+  if (index >= orig_link->collision.size() ||
+      orig_link->collision[index]->geometry->getType() != tesseract_geometry::GeometryType::OCTREE)
+  {
+    CONSOLE_BRIDGE_logWarn("Tried to change the octree of link (%s) but collision %zu is not an octree",
+                           cmd->getLinkName().c_str(),
+                           index);
+    return false;
+  }
+
+  // The pooled contact managers are dropped anyway, they would only force the contact managers to copy their shapes
+  clearDiscreteContactManagerPool();
+  clearContinuousContactManagerPool();
+
+  // The octree is shared with anything holding the link, like scene graph clones, the contact managers and their
+  // clones, so the delta is applied to a copy
+  auto octree = std::static_pointer_cast<const tesseract_geometry::Octree>(orig_link->collision[index]->geometry);
+  tesseract_geometry::Octree::ConstPtr new_octree = tesseract_collision::applyOctreeDelta(*octree, cmd->getDelta());
+
+  tesseract_scene_graph::Link link = orig_link->clone();
+  link.collision[index]->geometry = new_octree;
+  if (!scene_graph_->addLink(link, true))
+    return false;
+
+  const std::string& link_name = cmd->getLinkName();
+  tesseract_collision::CollisionShapesConst shapes;
+  tesseract_common::VectorIsometry3d shape_poses;
+  getCollisionObject(shapes, shape_poses, link);
+  const bool enabled = scene_graph_->getLinkCollisionEnabled(link_name);
+
+  // Contact managers without incremental octree updates replace the collision object
+  std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex_);
+  if (discrete_manager_ != nullptr &&
+      !discrete_manager_->updateCollisionObjectOctree(link_name, index, new_octree, cmd->getDelta()))
+    discrete_manager_->addCollisionObject(link_name, 0, shapes, shape_poses, enabled);
+
+  std::unique_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex_);
+  if (continuous_manager_ != nullptr &&
+      !continuous_manager_->updateCollisionObjectOctree(link_name, index, new_octree, cmd->getDelta()))
+    continuous_manager_->addCollisionObject(link_name, 0, shapes, shape_poses, enabled);
+
+  ++revision_;
+  commands_.push_back(cmd);
+
+  return true;
+}
+
 bool Environment::applyChangeLinkVisibilityCommand(const ChangeLinkVisibilityCommand::ConstPtr& cmd)
 {
   scene_graph_->setLinkVisibility(cmd->getLinkName(), cmd->getEnabled());
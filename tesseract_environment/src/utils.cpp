@@ -24,11 +24,322 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_collision/core/utils.h>
 #include <tesseract_environment/utils.h>
 
 namespace tesseract_environment
 {
+namespace
+{
+/**
+ * @brief Run the contact test of a continuous contact manager whose transforms have already been set
+ * @param collisions The contact results map, which is cleared first. If empty no contacts were found
+ * @param manager A continuous contact manager
+ * @param contact_request Contact request passed to the manager
+ */
+void continuousContactTest(tesseract_collision::ContactResultMap& collisions,
+                           tesseract_collision::ContinuousContactManager& manager,
+                           const tesseract_collision::ContactRequest& contact_request)
+{
+  manager.clearContactResults(collisions);
+  manager.contactTest(collisions, contact_request);
+
+  if (!collisions.empty())
+  {
+    if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
+    {
+      for (auto& collision : collisions)
+      {
+        std::stringstream ss;
+        ss << "Continuous collision detected between '" << collision.first.first << "' and '" << collision.first.second
+           << "' with distance " << collision.second.front().distance << std::endl;
+
+        CONSOLE_BRIDGE_logError(ss.str().c_str());
+      }
+    }
+  }
+}
+
+/**
+ * @brief Run the contact test of a discrete contact manager whose transforms have already been set
+ * @param collisions The contact results map, which is cleared first. If empty no contacts were found
+ * @param manager A discrete contact manager
+ * @param contact_request Contact request passed to the manager
+ */
+void discreteContactTest(tesseract_collision::ContactResultMap& collisions,
+                         tesseract_collision::DiscreteContactManager& manager,
+                         const tesseract_collision::ContactRequest& contact_request)
+{
+  manager.clearContactResults(collisions);
+  manager.contactTest(collisions, contact_request);
+
+  if (!collisions.empty())
+  {
+    if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
+    {
+      for (auto& collision : collisions)
+      {
+        std::stringstream ss;
+        ss << "Discrete collision detected between '" << collision.first.first << "' and '" << collision.first.second
+           << "' with distance " << collision.second.front().distance << std::endl;
+
+        CONSOLE_BRIDGE_logError(ss.str().c_str());
+      }
+    }
+  }
+}
+
+/**
+ * @brief A pool of worker threads shared by all parallel trajectory checks
+ * @details The threads are started on first use and reused, so a parallel check only hands out its tasks instead of
+ * starting threads. The calling thread also runs the tasks of its own batch and only waits for the tasks a worker has
+ * already started, so a batch always completes even if every worker is busy, e.g. with a check started by a task.
+ */
+class TrajectoryCheckThreadPool
+{
+public:
+  /** @brief Get the pool shared by all parallel trajectory checks, with one worker less than the hardware threads */
+  static TrajectoryCheckThreadPool& instance()
+  {
+    static TrajectoryCheckThreadPool pool(std::max(std::thread::hardware_concurrency(), 2U) - 1);
+    return pool;
+  }
+
+  ~TrajectoryCheckThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    task_available_.notify_all();
+    for (auto& worker : workers_)
+      worker.join();
+  }
+  TrajectoryCheckThreadPool(const TrajectoryCheckThreadPool&) = delete;
+  TrajectoryCheckThreadPool& operator=(const TrajectoryCheckThreadPool&) = delete;
+  TrajectoryCheckThreadPool(TrajectoryCheckThreadPool&&) = delete;
+  TrajectoryCheckThreadPool& operator=(TrajectoryCheckThreadPool&&) = delete;
+
+  /**
+   * @brief Run fn(task) for every task in [0, num_tasks) on the calling thread and the free workers
+   * @param num_tasks The number of tasks
+   * @param fn The function called for each task, it must be safe to call concurrently and must not throw
+   */
+  void run(long num_tasks, const std::function<void(long task)>& fn)
+  {
+    if (num_tasks <= 0)
+      return;
+
+    auto batch = std::make_shared<Batch>();
+    batch->fn = &fn;
+    batch->num_tasks = num_tasks;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    batches_.push_back(batch);
+    task_available_.notify_all();
+
+    while (batch->next_task < batch->num_tasks)
+    {
+      const long task = claimTask(batch);
+      lock.unlock();
+      fn(task);
+      lock.lock();
+      ++batch->completed_tasks;
+    }
+
+    batch->done.wait(lock, [&batch]() { return batch->completed_tasks == batch->num_tasks; });
+  }
+
+private:
+  /** @brief The tasks of one run call, guarded by mutex_ */
+  struct Batch
+  {
+    const std::function<void(long task)>* fn{ nullptr };
+    long num_tasks{ 0 };
+    long next_task{ 0 };
+    long completed_tasks{ 0 };
+    std::condition_variable done;
+  };
+
+  std::mutex mutex_;
+  std::condition_variable task_available_;
+  std::deque<std::shared_ptr<Batch>> batches_; /**< @brief The batches with tasks which have not been claimed */
+  std::vector<std::thread> workers_;
+  bool stop_{ false };
+
+  explicit TrajectoryCheckThreadPool(unsigned num_workers)
+  {
+    workers_.reserve(num_workers);
+    for (unsigned i = 0; i < num_workers; ++i)
+      workers_.emplace_back([this]() { work(); });
+  }
+
+  /** @brief Claim the next task of a batch and remove the batch once all of its tasks are claimed, requires mutex_ */
+  long claimTask(const std::shared_ptr<Batch>& batch)
+  {
+    const long task = batch->next_task++;
+    if (batch->next_task == batch->num_tasks)
+      batches_.erase(std::find(batches_.begin(), batches_.end(), batch));
+
+    return task;
+  }
+
+  void work()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+      task_available_.wait(lock, [this]() { return stop_ || !batches_.empty(); });
+      if (stop_)
+        return;
+
+      std::shared_ptr<Batch> batch = batches_.front();
+      const long task = claimTask(batch);
+      lock.unlock();
+      (*batch->fn)(task);
+      lock.lock();
+      if (++batch->completed_tasks == batch->num_tasks)
+        batch->done.notify_all();
+    }
+  }
+};
+
+/** @brief Checks the trajectory steps [start, end) and stores the results in the corresponding contacts entries */
+using ChunkCheckFn = std::function<void(long start, long end)>;
+
+/**
+ * @brief Creates the chunk check function of a worker
+ * @details If use_clones is true the chunk check function must use its own clones of the contact manager and state
+ * solver, otherwise it uses the ones provided by the caller.
+ */
+using ChunkCheckerFactoryFn = std::function<ChunkCheckFn(bool use_clones)>;
+
+/**
+ * @brief Distribute the steps (segments or states) of a trajectory check across worker threads
+ * @details The steps are split into contiguous chunks which are handed out to the workers in order. The workers run on
+ * the shared TrajectoryCheckThreadPool and the calling thread. A worker creates its chunk check function when it gets
+ * its first chunk. Only workers on other threads clone the contact manager and state solver, so a short trajectory
+ * mostly checked by the calling thread makes few clones.
+ *
+ * For ContactTestType::FIRST a worker stops pulling chunks once a collision was found in an earlier step and every
+ * result after the first colliding step is cleared, so the output matches the serial check.
+ *
+ * @param contacts The results, must already be sized to num_steps
+ * @param num_steps The number of steps to check
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param num_threads The number of workers
+ * @param make_chunk_checker Creates the chunk check function of a worker
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectoryParallel(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                             long num_steps,
+                             const tesseract_collision::CollisionCheckConfig& config,
+                             long num_threads,
+                             const ChunkCheckerFactoryFn& make_chunk_checker)
+{
+  assert(static_cast<long>(contacts.size()) == num_steps);
+  const bool first_only = (config.contact_request.type == tesseract_collision::ContactTestType::FIRST);
+
+  // Use several chunks per thread so an uneven cost per step (LVS subdivision) is balanced between the workers
+  const long chunk_size = std::max(1L, num_steps / (4 * num_threads));
+  const long num_chunks = (num_steps + chunk_size - 1) / chunk_size;
+
+  std::atomic<long> next_chunk{ 0 };
+  std::atomic<long> first_found{ num_steps };
+  std::vector<std::exception_ptr> errors(static_cast<std::size_t>(num_threads));
+  const std::thread::id caller_id = std::this_thread::get_id();
+  TrajectoryCheckThreadPool::instance().run(num_threads, [&](long t) {
+    try
+    {
+      ChunkCheckFn check_chunk;
+      for (long c = next_chunk++; c < num_chunks; c = next_chunk++)
+      {
+        const long start = c * chunk_size;
+        const long end = std::min(start + chunk_size, num_steps);
+
+        // Chunks are handed out in order so all remaining chunks are after the first collision
+        if (first_only && start > first_found.load())
+          break;
+
+        if (!check_chunk)
+          check_chunk = make_chunk_checker(std::this_thread::get_id() != caller_id);
+
+        check_chunk(start, end);
+
+        if (!first_only)
+          continue;
+
+        for (long i = start; i < end; ++i)
+        {
+          if (!contacts[static_cast<std::size_t>(i)].empty())
+          {
+            long current = first_found.load();
+            while (i < current && !first_found.compare_exchange_weak(current, i))
+            {
+            }
+            break;
+          }
+        }
+      }
+    }
+    catch (...)
+    {
+      errors[static_cast<std::size_t>(t)] = std::current_exception();
+    }
+  });
+
+  for (const auto& error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+
+  if (first_only)
+  {
+    for (long i = first_found.load() + 1; i < num_steps; ++i)
+      contacts[static_cast<std::size_t>(i)].clear();
+  }
+
+  return std::any_of(contacts.begin(), contacts.end(), [](const auto& c) { return !c.empty(); });
+}
+
+/**
+ * @brief Get the number of worker threads to use for checking a trajectory
+ * @param num_steps The number of steps (segments or states) to check
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @return The number of threads, one means the serial check is used
+ */
+long getTrajectoryCheckThreadCount(long num_steps, const tesseract_collision::CollisionCheckConfig& config)
+{
+  return std::min(static_cast<long>(config.num_threads), num_steps);
+}
+
+/**
+ * @brief Get the trajectory rows required to check the discrete states [start, end)
+ * @details For LVS_DISCRETE the interpolation of the last state in the chunk requires the following state.
+ */
+long getDiscreteChunkRows(long start, long end, long traj_rows, const tesseract_collision::CollisionCheckConfig& config)
+{
+  if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE && end < traj_rows)
+    return end - start + 1;
+
+  return end - start;
+}
+}  // namespace
+
 /**
  * @brief Get the active Link Names Recursively
  *
@@ -77,28 +388,41 @@ tesseract_collision::ContactResultMap checkTrajectorySegment(tesseract_collision
                                                              const tesseract_common::TransformMap& state1,
                                                              const tesseract_collision::ContactRequest& contact_request)
 {
-  for (const auto& link_name : manager.getActiveCollisionObjects())
-    manager.setCollisionObjectsTransform(link_name, state0.at(link_name), state1.at(link_name));
+  tesseract_collision::ContactResultMap collisions;
+  checkTrajectorySegment(collisions, manager, state0, state1, contact_request);
+  return collisions;
+}
 
+tesseract_collision::ContactResultMap checkTrajectorySegment(tesseract_collision::ContinuousContactManager& manager,
+                                                             const tesseract_common::VectorIsometry3d& state0,
+                                                             const tesseract_common::VectorIsometry3d& state1,
+                                                             const tesseract_collision::ContactRequest& contact_request)
+{
   tesseract_collision::ContactResultMap collisions;
-  manager.contactTest(collisions, contact_request);
+  checkTrajectorySegment(collisions, manager, state0, state1, contact_request);
+  return collisions;
+}
 
-  if (!collisions.empty())
-  {
-    if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
-    {
-      for (auto& collision : collisions)
-      {
-        std::stringstream ss;
-        ss << "Continuous collision detected between '" << collision.first.first << "' and '" << collision.first.second
-           << "' with distance " << collision.second.front().distance << std::endl;
+void checkTrajectorySegment(tesseract_collision::ContactResultMap& contacts,
+                            tesseract_collision::ContinuousContactManager& manager,
+                            const tesseract_common::TransformMap& state0,
+                            const tesseract_common::TransformMap& state1,
+                            const tesseract_collision::ContactRequest& contact_request)
+{
+  for (const auto& link_name : manager.getActiveCollisionObjects())
+    manager.setCollisionObjectsTransform(link_name, state0.at(link_name), state1.at(link_name));
 
-        CONSOLE_BRIDGE_logError(ss.str().c_str());
-      }
-    }
-  }
+  continuousContactTest(contacts, manager, contact_request);
+}
 
-  return collisions;
+void checkTrajectorySegment(tesseract_collision::ContactResultMap& contacts,
+                            tesseract_collision::ContinuousContactManager& manager,
+                            const tesseract_common::VectorIsometry3d& state0,
+                            const tesseract_common::VectorIsometry3d& state1,
+                            const tesseract_collision::ContactRequest& contact_request)
+{
+  manager.setDenseCollisionObjectsTransform(state0, state1);
+  continuousContactTest(contacts, manager, contact_request);
 }
 
 tesseract_collision::ContactResultMap checkTrajectoryState(tesseract_collision::DiscreteContactManager& manager,
@@ -114,28 +438,37 @@ tesseract_collision::ContactResultMap checkTrajectoryState(tesseract_collision::
                                                            const tesseract_collision::ContactRequest& contact_request)
 {
   tesseract_collision::ContactResultMap collisions;
+  checkTrajectoryState(collisions, manager, state, contact_request);
+  return collisions;
+}
+
+tesseract_collision::ContactResultMap checkTrajectoryState(tesseract_collision::DiscreteContactManager& manager,
+                                                           const tesseract_common::VectorIsometry3d& state,
+                                                           const tesseract_collision::ContactRequest& contact_request)
+{
+  tesseract_collision::ContactResultMap collisions;
+  checkTrajectoryState(collisions, manager, state, contact_request);
+  return collisions;
+}
 
+void checkTrajectoryState(tesseract_collision::ContactResultMap& contacts,
+                          tesseract_collision::DiscreteContactManager& manager,
+                          const tesseract_common::TransformMap& state,
+                          const tesseract_collision::ContactRequest& contact_request)
+{
   for (const auto& link_name : manager.getActiveCollisionObjects())
     manager.setCollisionObjectsTransform(link_name, state.at(link_name));
 
-  manager.contactTest(collisions, contact_request);
-
-  if (!collisions.empty())
-  {
-    if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
-    {
-      for (auto& collision : collisions)
-      {
-        std::stringstream ss;
-        ss << "Discrete collision detected between '" << collision.first.first << "' and '" << collision.first.second
-           << "' with distance " << collision.second.front().distance << std::endl;
-
-        CONSOLE_BRIDGE_logError(ss.str().c_str());
-      }
-    }
-  }
+  discreteContactTest(contacts, manager, contact_request);
+}
 
-  return collisions;
+void checkTrajectoryState(tesseract_collision::ContactResultMap& contacts,
+                          tesseract_collision::DiscreteContactManager& manager,
+                          const tesseract_common::VectorIsometry3d& state,
+                          const tesseract_collision::ContactRequest& contact_request)
+{
+  manager.setDenseCollisionObjectsTransform(state);
+  discreteContactTest(contacts, manager, contact_request);
 }
 
 /**
@@ -219,14 +552,50 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
 
   manager.applyContactManagerConfig(config.contact_manager_config);
 
+  const long num_threads = getTrajectoryCheckThreadCount(traj.rows() - 1, config);
+  if (num_threads > 1)
+  {
+    contacts.resize(static_cast<size_t>(traj.rows() - 1));
+    tesseract_collision::CollisionCheckConfig chunk_config(config);
+    chunk_config.num_threads = 1;
+
+    auto make_chunk_checker = [&](bool use_clones) -> ChunkCheckFn {
+      std::shared_ptr<tesseract_collision::ContinuousContactManager> local_manager;
+      std::shared_ptr<tesseract_scene_graph::StateSolver> local_state_solver;
+      if (use_clones)
+      {
+        local_manager = manager.clone();
+        local_state_solver = state_solver.clone();
+      }
+
+      return [&, local_manager, local_state_solver](long start, long end) {
+        std::vector<tesseract_collision::ContactResultMap> chunk_contacts;
+        checkTrajectory(chunk_contacts,
+                        (local_manager != nullptr) ? *local_manager : manager,
+                        (local_state_solver != nullptr) ? *local_state_solver : state_solver,
+                        joint_names,
+                        traj.middleRows(start, end - start + 1),
+                        chunk_config);
+        std::move(chunk_contacts.begin(), chunk_contacts.end(), contacts.begin() + start);
+      };
+    };
+
+    return checkTrajectoryParallel(contacts, traj.rows() - 1, config, num_threads, make_chunk_checker);
+  }
+
   bool found = false;
   contacts.resize(static_cast<size_t>(traj.rows() - 1));
+  manager.setDenseLinkNames(state_solver.getLinkNames());
+  tesseract_scene_graph::DenseSceneState state0;
+  tesseract_scene_graph::DenseSceneState state1;
+  // The sub step results are reused, so their entries are recycled by the contact manager
+  tesseract_collision::ContactResultMap sub_segment_results;
   if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
   {
     for (int iStep = 0; iStep < traj.rows() - 1; ++iStep)
     {
       tesseract_collision::ContactResultMap& segment_results = contacts[static_cast<size_t>(iStep)];
-      segment_results.clear();
+      manager.clearContactResults(segment_results);
 
       double dist = (traj.row(iStep + 1) - traj.row(iStep)).norm();
       if (dist > config.longest_valid_segment_length)
@@ -238,10 +607,10 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
 
         for (int iSubStep = 0; iSubStep < subtraj.rows() - 1; ++iSubStep)
         {
-          tesseract_scene_graph::SceneState state0 = state_solver.getState(joint_names, subtraj.row(iSubStep));
-          tesseract_scene_graph::SceneState state1 = state_solver.getState(joint_names, subtraj.row(iSubStep + 1));
-          tesseract_collision::ContactResultMap sub_segment_results =
-              checkTrajectorySegment(manager, state0.link_transforms, state1.link_transforms, config.contact_request);
+          state_solver.getState(state0, joint_names, subtraj.row(iSubStep));
+          state_solver.getState(state1, joint_names, subtraj.row(iSubStep + 1));
+          checkTrajectorySegment(
+              sub_segment_results, manager, state0.link_transforms, state1.link_transforms, config.contact_request);
           if (!sub_segment_results.empty())
           {
             found = true;
@@ -279,10 +648,10 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
       }
       else
       {
-        tesseract_scene_graph::SceneState state0 = state_solver.getState(joint_names, traj.row(iStep));
-        tesseract_scene_graph::SceneState state1 = state_solver.getState(joint_names, traj.row(iStep + 1));
-        segment_results =
-            checkTrajectorySegment(manager, state0.link_transforms, state1.link_transforms, config.contact_request);
+        state_solver.getState(state0, joint_names, traj.row(iStep));
+        state_solver.getState(state1, joint_names, traj.row(iStep + 1));
+        checkTrajectorySegment(
+            segment_results, manager, state0.link_transforms, state1.link_transforms, config.contact_request);
         if (!segment_results.empty())
         {
           found = true;
@@ -313,13 +682,13 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
     for (int iStep = 0; iStep < traj.rows() - 1; ++iStep)
     {
       tesseract_collision::ContactResultMap& segment_results = contacts[static_cast<size_t>(iStep)];
-      segment_results.clear();
+      manager.clearContactResults(segment_results);
 
-      tesseract_scene_graph::SceneState state0 = state_solver.getState(joint_names, traj.row(iStep));
-      tesseract_scene_graph::SceneState state1 = state_solver.getState(joint_names, traj.row(iStep + 1));
+      state_solver.getState(state0, joint_names, traj.row(iStep));
+      state_solver.getState(state1, joint_names, traj.row(iStep + 1));
 
-      segment_results =
-          checkTrajectorySegment(manager, state0.link_transforms, state1.link_transforms, config.contact_request);
+      checkTrajectorySegment(
+          segment_results, manager, state0.link_transforms, state1.link_transforms, config.contact_request);
       if (!segment_results.empty())
       {
         found = true;
@@ -365,14 +734,46 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
 
   manager.applyContactManagerConfig(config.contact_manager_config);
 
+  const long num_threads = getTrajectoryCheckThreadCount(traj.rows() - 1, config);
+  if (num_threads > 1)
+  {
+    contacts.resize(static_cast<size_t>(traj.rows() - 1));
+    tesseract_collision::CollisionCheckConfig chunk_config(config);
+    chunk_config.num_threads = 1;
+
+    auto make_chunk_checker = [&](bool use_clones) -> ChunkCheckFn {
+      std::shared_ptr<tesseract_collision::ContinuousContactManager> local_manager;
+      std::shared_ptr<tesseract_kinematics::JointGroup> local_manip;
+      if (use_clones)
+      {
+        local_manager = manager.clone();
+        local_manip = std::make_shared<tesseract_kinematics::JointGroup>(manip);
+      }
+
+      return [&, local_manager, local_manip](long start, long end) {
+        std::vector<tesseract_collision::ContactResultMap> chunk_contacts;
+        checkTrajectory(chunk_contacts,
+                        (local_manager != nullptr) ? *local_manager : manager,
+                        (local_manip != nullptr) ? *local_manip : manip,
+                        traj.middleRows(start, end - start + 1),
+                        chunk_config);
+        std::move(chunk_contacts.begin(), chunk_contacts.end(), contacts.begin() + start);
+      };
+    };
+
+    return checkTrajectoryParallel(contacts, traj.rows() - 1, config, num_threads, make_chunk_checker);
+  }
+
   bool found = false;
   contacts.resize(static_cast<size_t>(traj.rows() - 1));
+  // The sub step results are reused, so their entries are recycled by the contact manager
+  tesseract_collision::ContactResultMap sub_segment_results;
   if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
   {
     for (int iStep = 0; iStep < traj.rows() - 1; ++iStep)
     {
       tesseract_collision::ContactResultMap& segment_results = contacts[static_cast<size_t>(iStep)];
-      segment_results.clear();
+      manager.clearContactResults(segment_results);
 
       double dist = (traj.row(iStep + 1) - traj.row(iStep)).norm();
       if (dist > config.longest_valid_segment_length)
@@ -386,8 +787,7 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
         {
           tesseract_common::TransformMap state0 = manip.calcFwdKin(subtraj.row(iSubStep));
           tesseract_common::TransformMap state1 = manip.calcFwdKin(subtraj.row(iSubStep + 1));
-          tesseract_collision::ContactResultMap sub_segment_results =
-              checkTrajectorySegment(manager, state0, state1, config.contact_request);
+          checkTrajectorySegment(sub_segment_results, manager, state0, state1, config.contact_request);
           if (!sub_segment_results.empty())
           {
             found = true;
@@ -427,7 +827,7 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
       {
         tesseract_common::TransformMap state0 = manip.calcFwdKin(traj.row(iStep));
         tesseract_common::TransformMap state1 = manip.calcFwdKin(traj.row(iStep + 1));
-        segment_results = checkTrajectorySegment(manager, state0, state1, config.contact_request);
+        checkTrajectorySegment(segment_results, manager, state0, state1, config.contact_request);
         if (!segment_results.empty())
         {
           found = true;
@@ -458,12 +858,12 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
     for (int iStep = 0; iStep < traj.rows() - 1; ++iStep)
     {
       tesseract_collision::ContactResultMap& segment_results = contacts[static_cast<size_t>(iStep)];
-      segment_results.clear();
+      manager.clearContactResults(segment_results);
 
       tesseract_common::TransformMap state0 = manip.calcFwdKin(traj.row(iStep));
       tesseract_common::TransformMap state1 = manip.calcFwdKin(traj.row(iStep + 1));
 
-      segment_results = checkTrajectorySegment(manager, state0, state1, config.contact_request);
+      checkTrajectorySegment(segment_results, manager, state0, state1, config.contact_request);
       if (!segment_results.empty())
       {
         found = true;
@@ -509,14 +909,19 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
 
   manager.applyContactManagerConfig(config.contact_manager_config);
 
+  // The dense state is computed without name lookups and reused for every state of the trajectory
+  manager.setDenseLinkNames(state_solver.getLinkNames());
+  tesseract_scene_graph::DenseSceneState state;
+  // The sub step results are reused, so their entries are recycled by the contact manager
+  tesseract_collision::ContactResultMap sub_state_results;
+
   contacts.resize(static_cast<size_t>(traj.rows()));
   if (traj.rows() == 1)
   {
     tesseract_collision::ContactResultMap& state_results = contacts[0];
-    state_results.clear();
-    tesseract_scene_graph::SceneState state = state_solver.getState(joint_names, traj.row(0));
-    tesseract_collision::ContactResultMap sub_state_results =
-        checkTrajectoryState(manager, state.link_transforms, config.contact_request);
+    manager.clearContactResults(state_results);
+    state_solver.getState(state, joint_names, traj.row(0));
+    checkTrajectoryState(sub_state_results, manager, state.link_transforms, config.contact_request);
     processInterpolatedSubSegmentCollisionResults(state_results,
                                                   sub_state_results,
                                                   0,
@@ -526,13 +931,43 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
     return (!state_results.empty());
   }
 
+  const long num_threads = getTrajectoryCheckThreadCount(traj.rows(), config);
+  if (num_threads > 1)
+  {
+    tesseract_collision::CollisionCheckConfig chunk_config(config);
+    chunk_config.num_threads = 1;
+
+    auto make_chunk_checker = [&](bool use_clones) -> ChunkCheckFn {
+      std::shared_ptr<tesseract_collision::DiscreteContactManager> local_manager;
+      std::shared_ptr<tesseract_scene_graph::StateSolver> local_state_solver;
+      if (use_clones)
+      {
+        local_manager = manager.clone();
+        local_state_solver = state_solver.clone();
+      }
+
+      return [&, local_manager, local_state_solver](long start, long end) {
+        std::vector<tesseract_collision::ContactResultMap> chunk_contacts;
+        checkTrajectory(chunk_contacts,
+                        (local_manager != nullptr) ? *local_manager : manager,
+                        (local_state_solver != nullptr) ? *local_state_solver : state_solver,
+                        joint_names,
+                        traj.middleRows(start, getDiscreteChunkRows(start, end, traj.rows(), config)),
+                        chunk_config);
+        std::move(chunk_contacts.begin(), chunk_contacts.begin() + (end - start), contacts.begin() + start);
+      };
+    };
+
+    return checkTrajectoryParallel(contacts, traj.rows(), config, num_threads, make_chunk_checker);
+  }
+
   bool found = false;
   if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE)
   {
     for (int iStep = 0; iStep < traj.rows(); ++iStep)
     {
       tesseract_collision::ContactResultMap& segment_results = contacts[static_cast<size_t>(iStep)];
-      segment_results.clear();
+      manager.clearContactResults(segment_results);
 
       double dist = -1;
       if (iStep < traj.rows() - 1)
@@ -547,9 +982,8 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
 
         for (int iSubStep = 0; iSubStep < subtraj.rows() - 1; ++iSubStep)
         {
-          tesseract_scene_graph::SceneState state = state_solver.getState(joint_names, subtraj.row(iSubStep));
-          tesseract_collision::ContactResultMap sub_state_results =
-              checkTrajectoryState(manager, state.link_transforms, config.contact_request);
+          state_solver.getState(state, joint_names, subtraj.row(iSubStep));
+          checkTrajectoryState(sub_state_results, manager, state.link_transforms, config.contact_request);
           if (!sub_state_results.empty())
           {
             found = true;
@@ -585,14 +1019,13 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
       }
       else
       {
-        tesseract_scene_graph::SceneState state = state_solver.getState(joint_names, traj.row(iStep));
-        tesseract_collision::ContactResultMap sub_segment_results =
-            checkTrajectoryState(manager, state.link_transforms, config.contact_request);
-        if (!sub_segment_results.empty())
+        state_solver.getState(state, joint_names, traj.row(iStep));
+        checkTrajectoryState(sub_state_results, manager, state.link_transforms, config.contact_request);
+        if (!sub_state_results.empty())
         {
           found = true;
           processInterpolatedSubSegmentCollisionResults(
-              segment_results, sub_segment_results, 0, 0, manager.getActiveCollisionObjects(), true);
+              segment_results, sub_state_results, 0, 0, manager.getActiveCollisionObjects(), true);
           if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
           {
             std::stringstream ss;
@@ -618,11 +1051,10 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
     for (int iStep = 0; iStep < traj.rows(); ++iStep)
     {
       tesseract_collision::ContactResultMap& state_results = contacts[static_cast<size_t>(iStep)];
-      state_results.clear();
+      manager.clearContactResults(state_results);
 
-      tesseract_scene_graph::SceneState state = state_solver.getState(joint_names, traj.row(iStep));
-      tesseract_collision::ContactResultMap sub_state_results =
-          checkTrajectoryState(manager, state.link_transforms, config.contact_request);
+      state_solver.getState(state, joint_names, traj.row(iStep));
+      checkTrajectoryState(sub_state_results, manager, state.link_transforms, config.contact_request);
       if (!sub_state_results.empty())
       {
         found = true;
@@ -666,27 +1098,58 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
 
   manager.applyContactManagerConfig(config.contact_manager_config);
 
+  // The sub step results are reused, so their entries are recycled by the contact manager
+  tesseract_collision::ContactResultMap sub_state_results;
+
   contacts.resize(static_cast<size_t>(traj.rows()));
   if (traj.rows() == 1)
   {
     tesseract_collision::ContactResultMap& state_results = contacts[0];
-    state_results.clear();
+    manager.clearContactResults(state_results);
 
     tesseract_common::TransformMap state = manip.calcFwdKin(traj.row(0));
-    tesseract_collision::ContactResultMap sub_state_results =
-        checkTrajectoryState(manager, state, config.contact_request);
+    checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
     processInterpolatedSubSegmentCollisionResults(
         state_results, sub_state_results, 0, 0, manager.getActiveCollisionObjects(), true);
     return (!state_results.empty());
   }
 
+  const long num_threads = getTrajectoryCheckThreadCount(traj.rows(), config);
+  if (num_threads > 1)
+  {
+    tesseract_collision::CollisionCheckConfig chunk_config(config);
+    chunk_config.num_threads = 1;
+
+    auto make_chunk_checker = [&](bool use_clones) -> ChunkCheckFn {
+      std::shared_ptr<tesseract_collision::DiscreteContactManager> local_manager;
+      std::shared_ptr<tesseract_kinematics::JointGroup> local_manip;
+      if (use_clones)
+      {
+        local_manager = manager.clone();
+        local_manip = std::make_shared<tesseract_kinematics::JointGroup>(manip);
+      }
+
+      return [&, local_manager, local_manip](long start, long end) {
+        std::vector<tesseract_collision::ContactResultMap> chunk_contacts;
+        checkTrajectory(chunk_contacts,
+                        (local_manager != nullptr) ? *local_manager : manager,
+                        (local_manip != nullptr) ? *local_manip : manip,
+                        traj.middleRows(start, getDiscreteChunkRows(start, end, traj.rows(), config)),
+                        chunk_config);
+        std::move(chunk_contacts.begin(), chunk_contacts.begin() + (end - start), contacts.begin() + start);
+      };
+    };
+
+    return checkTrajectoryParallel(contacts, traj.rows(), config, num_threads, make_chunk_checker);
+  }
+
   bool found = false;
   if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE)
   {
     for (int iStep = 0; iStep < traj.rows(); ++iStep)
     {
       tesseract_collision::ContactResultMap& segment_results = contacts[static_cast<size_t>(iStep)];
-      segment_results.clear();
+      manager.clearContactResults(segment_results);
 
       double dist = -1;
       if (iStep < traj.rows() - 1)
@@ -702,8 +1165,7 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
         for (int iSubStep = 0; iSubStep < subtraj.rows() - 1; ++iSubStep)
         {
           tesseract_common::TransformMap state = manip.calcFwdKin(subtraj.row(iSubStep));
-          tesseract_collision::ContactResultMap sub_state_results =
-              checkTrajectoryState(manager, state, config.contact_request);
+          checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
           if (!sub_state_results.empty())
           {
             found = true;
@@ -740,8 +1202,7 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
       else
       {
         tesseract_common::TransformMap state = manip.calcFwdKin(traj.row(iStep));
-        tesseract_collision::ContactResultMap sub_state_results =
-            checkTrajectoryState(manager, state, config.contact_request);
+        checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
         if (!sub_state_results.empty())
         {
           found = true;
@@ -773,11 +1234,10 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
     for (int iStep = 0; iStep < traj.rows(); ++iStep)
     {
       tesseract_collision::ContactResultMap& state_results = contacts[static_cast<size_t>(iStep)];
-      state_results.clear();
+      manager.clearContactResults(state_results);
 
       tesseract_common::TransformMap state = manip.calcFwdKin(traj.row(iStep));
-      tesseract_collision::ContactResultMap sub_state_results =
-          checkTrajectoryState(manager, state, config.contact_request);
+      checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
       if (!sub_state_results.empty())
       {
         found = true;
@@ -0,0 +1,157 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+#include <tesseract_environment/environment.h>
+#include <tesseract_environment/utils.h>
+#include <tesseract_environment/commands/add_link_command.h>
+#include <tesseract_geometry/impl/box.h>
+#include <tesseract_common/resource_locator.h>
+#include <tesseract_urdf/urdf_parser.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_scene_graph;
+using namespace tesseract_srdf;
+using namespace tesseract_collision;
+using namespace tesseract_environment;
+
+SceneGraph::Ptr getSceneGraph()
+{
+  std::string path = std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf";
+
+  tesseract_common::TesseractSupportResourceLocator locator;
+  return tesseract_urdf::parseURDFFile(path, locator);
+}
+
+SRDFModel::Ptr getSRDFModel(const SceneGraph& scene_graph)
+{
+  std::string path = std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf";
+  tesseract_common::TesseractSupportResourceLocator locator;
+
+  auto srdf = std::make_shared<SRDFModel>();
+  srdf->initFile(scene_graph, path, locator);
+
+  return srdf;
+}
+
+/** @brief Add a box obstacle next to the robot so the broadphase has pairs to check along the trajectory */
+void addObstacle(Environment& env)
+{
+  Link link("obstacle");
+  Collision::Ptr c = std::make_shared<Collision>();
+  c->origin.translation() = Eigen::Vector3d(0.9, 0, 0.6);
+  c->geometry = std::make_shared<tesseract_geometry::Box>(0.2, 0.2, 0.2);
+  link.collision.push_back(c);
+
+  Joint joint("obstacle_joint");
+  joint.parent_link_name = env.getRootLinkName();
+  joint.child_link_name = link.getName();
+  joint.type = JointType::FIXED;
+
+  env.applyCommand(std::make_shared<AddLinkCommand>(link, joint));
+}
+
+/** @brief Get a trajectory which sweeps the first two joints of the manipulator */
+tesseract_common::TrajArray getTrajectory(long num_waypoints)
+{
+  Eigen::VectorXd start_pos = Eigen::VectorXd::Zero(7);
+  start_pos(0) = -1.5;
+  start_pos(3) = -1.5;
+  Eigen::VectorXd end_pos = start_pos;
+  end_pos(0) = 1.5;
+  end_pos(1) = 0.5;
+
+  tesseract_common::TrajArray traj(num_waypoints, start_pos.size());
+  for (long i = 0; i < start_pos.size(); ++i)
+    traj.col(i) = Eigen::VectorXd::LinSpaced(num_waypoints, start_pos(i), end_pos(i));
+
+  return traj;
+}
+
+/** @brief Benchmark that checks a trajectory using a discrete contact manager */
+static void BM_CHECK_TRAJECTORY_DISCRETE(benchmark::State& state,
+                                         Environment::Ptr env,
+                                         tesseract_common::TrajArray traj,
+                                         CollisionCheckConfig config)
+{
+  DiscreteContactManager::UPtr manager = env->getDiscreteContactManager();
+  tesseract_kinematics::JointGroup::UPtr manip = env->getJointGroup("manipulator");
+
+  // The contacts are reused so their entries are recycled by the manager, as when called repeatedly by a planner
+  std::vector<ContactResultMap> contacts;
+  for (auto _ : state)  // NOLINT
+  {
+    benchmark::DoNotOptimize(checkTrajectory(contacts, *manager, *manip, traj, config));
+  }
+}
+
+/** @brief Benchmark that checks a trajectory using a continuous contact manager */
+static void BM_CHECK_TRAJECTORY_CONTINUOUS(benchmark::State& state,
+                                           Environment::Ptr env,
+                                           tesseract_common::TrajArray traj,
+                                           CollisionCheckConfig config)
+{
+  ContinuousContactManager::UPtr manager = env->getContinuousContactManager();
+  tesseract_kinematics::JointGroup::UPtr manip = env->getJointGroup("manipulator");
+
+  // The contacts are reused so their entries are recycled by the manager, as when called repeatedly by a planner
+  std::vector<ContactResultMap> contacts;
+  for (auto _ : state)  // NOLINT
+  {
+    benchmark::DoNotOptimize(checkTrajectory(contacts, *manager, *manip, traj, config));
+  }
+}
+
+int main(int argc, char** argv)
+{
+  SceneGraph::Ptr scene_graph = getSceneGraph();
+  Environment::Ptr env = std::make_shared<Environment>();
+  env->init(*scene_graph, getSRDFModel(*scene_graph));
+  addObstacle(*env);
+
+  std::function<void(benchmark::State&, Environment::Ptr, tesseract_common::TrajArray, CollisionCheckConfig)>
+      BM_CHECK_TRAJECTORY_DISCRETE_FUNC = BM_CHECK_TRAJECTORY_DISCRETE;
+  std::function<void(benchmark::State&, Environment::Ptr, tesseract_common::TrajArray, CollisionCheckConfig)>
+      BM_CHECK_TRAJECTORY_CONTINUOUS_FUNC = BM_CHECK_TRAJECTORY_CONTINUOUS;
+
+  std::vector<long> num_waypoints = { 2, 10, 50 };
+  std::vector<double> lvs_lengths = { 0.01, 0.05, 0.1 };
+  std::vector<ContactTestType> test_types = { ContactTestType::FIRST, ContactTestType::ALL };
+
+  //////////////////////////////////////
+  // checkTrajectory LVS_DISCRETE vs LVS_CONTINUOUS
+  //////////////////////////////////////
+  for (const auto& test_type : test_types)
+  {
+    for (const auto& num_waypoint : num_waypoints)
+    {
+      for (const auto& lvs_length : lvs_lengths)
+      {
+        CollisionCheckConfig config;
+        config.contact_request.type = test_type;
+        config.longest_valid_segment_length = lvs_length;
+
+        std::string suffix = std::string(ContactTestTypeStrings[static_cast<std::size_t>(test_type)]) +
+                             "_WAYPOINTS_" + std::to_string(num_waypoint) + "_LVS_" + std::to_string(lvs_length);
+
+        config.type = CollisionEvaluatorType::LVS_DISCRETE;
+        std::string name = "BM_CHECK_TRAJECTORY_LVS_DISCRETE_" + suffix;
+        benchmark::RegisterBenchmark(
+            name.c_str(), BM_CHECK_TRAJECTORY_DISCRETE_FUNC, env, getTrajectory(num_waypoint), config)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMillisecond);
+
+        config.type = CollisionEvaluatorType::LVS_CONTINUOUS;
+        name = "BM_CHECK_TRAJECTORY_LVS_CONTINUOUS_" + suffix;
+        benchmark::RegisterBenchmark(
+            name.c_str(), BM_CHECK_TRAJECTORY_CONTINUOUS_FUNC, env, getTrajectory(num_waypoint), config)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMillisecond);
+      }
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
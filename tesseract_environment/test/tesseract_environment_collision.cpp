@@ -238,6 +238,124 @@ TEST(TesseractEnvironmentCollisionUnit, runEnvironmentClearContinuousCollisionTe
   EXPECT_FALSE(collision.empty());
 }
 
+TEST(TesseractEnvironmentCollisionUnit, runEnvironmentContactManagerPoolTest)  // NOLINT
+{
+  // Get the environment
+  auto env = getEnvironment();
+
+  {  // Discrete
+    PooledDiscreteContactManager manager = env->checkoutDiscreteContactManager();
+    ASSERT_TRUE(manager != nullptr);
+    const DiscreteContactManager* pooled = manager.get();
+    std::vector<std::string> active_links = manager->getActiveCollisionObjects();
+
+    // Changes made by the previous user are undone when checked out again
+    manager->setActiveCollisionObjects({ "link_n1" });
+    manager->disableCollisionObject("link_n2");
+    manager->setDefaultCollisionMarginData(1.0);
+    manager.reset();
+
+    manager = env->checkoutDiscreteContactManager();
+    ASSERT_TRUE(manager != nullptr);
+    EXPECT_EQ(manager.get(), pooled);
+    EXPECT_EQ(manager->getActiveCollisionObjects(), active_links);
+    EXPECT_TRUE(manager->isCollisionObjectEnabled("link_n2"));
+    EXPECT_NEAR(manager->getCollisionMarginData().getDefaultCollisionMargin(),
+                env->getCollisionMarginData().getDefaultCollisionMargin(),
+                1e-6);
+
+    // Managers whose collision objects were added or removed by the previous user are discarded
+    CollisionShapesConst shapes{ std::make_shared<tesseract_geometry::Box>(1, 1, 1) };
+    tesseract_common::VectorIsometry3d shape_poses{ Eigen::Isometry3d::Identity() };
+    EXPECT_TRUE(manager->addCollisionObject("pool_test_object", 0, shapes, shape_poses));
+    EXPECT_TRUE(manager->removeCollisionObject("link_n2"));
+    manager.reset();
+
+    manager = env->checkoutDiscreteContactManager();
+    ASSERT_TRUE(manager != nullptr);
+    EXPECT_FALSE(manager->hasCollisionObject("pool_test_object"));
+    EXPECT_TRUE(manager->hasCollisionObject("link_n2"));
+    EXPECT_EQ(manager->getCollisionObjects(), env->getDiscreteContactManager()->getCollisionObjects());
+    pooled = manager.get();
+
+    // Managers whose collision object geometry was replaced by the previous user are discarded
+    EXPECT_TRUE(manager->removeCollisionObject("link_n1"));
+    EXPECT_TRUE(manager->addCollisionObject("link_n1", 0, shapes, shape_poses));
+    manager.reset();
+
+    manager = env->checkoutDiscreteContactManager();
+    ASSERT_TRUE(manager != nullptr);
+    EXPECT_EQ(manager->getCollisionObjects(), env->getDiscreteContactManager()->getCollisionObjects());
+    EXPECT_EQ(manager->getCollisionObjectGeometries("link_n1"),
+              env->getDiscreteContactManager()->getCollisionObjectGeometries("link_n1"));
+    pooled = manager.get();
+
+    // Statistics and dense link names of the previous user are reset
+    manager->setDenseLinkNames({ "link_n1" });
+    manager->setStatisticsEnabled(true);
+    ContactResultMap result;
+    manager->contactTest(result, ContactRequest(ContactTestType::ALL));
+    manager.reset();
+
+    manager = env->checkoutDiscreteContactManager();
+    ASSERT_TRUE(manager != nullptr);
+    EXPECT_EQ(manager.get(), pooled);
+    EXPECT_TRUE(manager->getDenseLinkNames().empty());
+    EXPECT_FALSE(manager->getStatisticsEnabled());
+    EXPECT_EQ(manager->getStatistics().contact_tests, 0U);
+
+    // A second checkout gets its own manager while the first is checked out
+    PooledDiscreteContactManager manager2 = env->checkoutDiscreteContactManager();
+    ASSERT_TRUE(manager2 != nullptr);
+    EXPECT_NE(manager2.get(), pooled);
+
+    // Managers checked out before the environment changed are not returned to the pool
+    env->applyCommand(std::make_shared<RemoveLinkCommand>("link_n2"));
+    manager.reset();
+    manager2.reset();
+
+    manager = env->checkoutDiscreteContactManager();
+    ASSERT_TRUE(manager != nullptr);
+    const std::vector<std::string>& objects = manager->getCollisionObjects();
+    EXPECT_TRUE(std::find(objects.begin(), objects.end(), "link_n2") == objects.end());
+
+    // Managers outliving the environment are destroyed
+    env.reset();
+    manager.reset();
+    env = getEnvironment();
+  }
+
+  {  // Continuous
+    PooledContinuousContactManager manager = env->checkoutContinuousContactManager();
+    ASSERT_TRUE(manager != nullptr);
+    const ContinuousContactManager* pooled = manager.get();
+    std::vector<std::string> active_links = manager->getActiveCollisionObjects();
+
+    manager->setActiveCollisionObjects({ "link_n1" });
+    manager->disableCollisionObject("link_n1");
+    manager.reset();
+
+    manager = env->checkoutContinuousContactManager();
+    ASSERT_TRUE(manager != nullptr);
+    EXPECT_EQ(manager.get(), pooled);
+    EXPECT_EQ(manager->getActiveCollisionObjects(), active_links);
+    EXPECT_TRUE(manager->isCollisionObjectEnabled("link_n1"));
+
+    // Managers whose collision objects were added or removed by the previous user are discarded
+    CollisionShapesConst shapes{ std::make_shared<tesseract_geometry::Box>(1, 1, 1) };
+    tesseract_common::VectorIsometry3d shape_poses{ Eigen::Isometry3d::Identity() };
+    EXPECT_TRUE(manager->addCollisionObject("pool_test_object", 0, shapes, shape_poses));
+    EXPECT_TRUE(manager->removeCollisionObject("link_n2"));
+    manager.reset();
+
+    manager = env->checkoutContinuousContactManager();
+    ASSERT_TRUE(manager != nullptr);
+    EXPECT_FALSE(manager->hasCollisionObject("pool_test_object"));
+    EXPECT_TRUE(manager->hasCollisionObject("link_n2"));
+    EXPECT_EQ(manager->getCollisionObjects(), env->getContinuousContactManager()->getCollisionObjects());
+  }
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
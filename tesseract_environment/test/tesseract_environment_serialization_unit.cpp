@@ -198,6 +198,17 @@ TEST(EnvironmentCommandsSerializeUnit, ChangeLinkCollisionEnabledCommand)  // NO
                                                                             "ChangeLinkCollisionEnabledCommand");
 }
 
+TEST(EnvironmentCommandsSerializeUnit, ChangeLinkOctreeCommand)  // NOLINT
+{
+  tesseract_collision::OctreeDelta delta;
+  delta.occupied.emplace_back(0.55, 0.05, 0.05);
+  delta.occupied.emplace_back(0.65, 0.05, 0.05);
+  delta.free.emplace_back(0.05, 0.05, 0.05);
+  auto object = std::make_shared<ChangeLinkOctreeCommand>("octomap link", 2, delta);
+  testSerialization<ChangeLinkOctreeCommand>(*object, "ChangeLinkOctreeCommand");
+  testSerializationDerivedClass<Command, ChangeLinkOctreeCommand>(object, "ChangeLinkOctreeCommand");
+}
+
 TEST(EnvironmentCommandsSerializeUnit, ChangeLinkOriginCommand)  // NOLINT
 {
   Eigen::Isometry3d origin = Eigen::Isometry3d::Identity();
@@ -8,6 +8,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_urdf/urdf_parser.h>
 #include <tesseract_geometry/impl/box.h>
+#include <tesseract_geometry/impl/octree.h>
 #include <tesseract_common/resource_locator.h>
 #include <tesseract_common/utils.h>
 #include <tesseract_state_solver/kdl/kdl_state_solver.h>
@@ -1111,6 +1112,103 @@ TEST(TesseractEnvironmentUnit, EnvChangeLinkCollisionEnabledCommandUnit)  // NOL
   EXPECT_TRUE(env->getSceneGraph()->getLinkCollisionEnabled(link_name));
 }
 
+TEST(TesseractEnvironmentUnit, EnvChangeLinkOctreeCommandUnit)  // NOLINT
+{
+  // Get the environment
+  auto env = getEnvironment();
+
+  auto ot = std::make_shared<octomap::OcTree>(0.1);
+  ot->updateNode(0.05, 0.05, 0.05, true);
+  auto octree = std::make_shared<tesseract_geometry::Octree>(ot, tesseract_geometry::Octree::BOX);
+
+  const std::string link_name = "octomap_link";
+  Link link(link_name);
+  auto collision = std::make_shared<Collision>();
+  collision->geometry = octree;
+  link.collision.push_back(collision);
+  EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(link)));
+  EXPECT_EQ(env->getRevision(), 4);
+  EXPECT_EQ(env->getCommandHistory().size(), 4);
+
+  auto discrete_manager = env->getDiscreteContactManager();
+  auto continuous_manager = env->getContinuousContactManager();
+
+  tesseract_collision::OctreeDelta delta;
+  delta.occupied.emplace_back(0.55, 0.05, 0.05);
+  delta.free.emplace_back(0.05, 0.05, 0.05);
+  auto cmd = std::make_shared<ChangeLinkOctreeCommand>(link_name, 0, delta);
+  EXPECT_TRUE(cmd != nullptr);
+  EXPECT_EQ(cmd->getType(), CommandType::CHANGE_LINK_OCTREE);
+  EXPECT_EQ(cmd->getLinkName(), link_name);
+  EXPECT_EQ(cmd->getCollisionIndex(), 0);
+  EXPECT_EQ(cmd->getDelta().occupied.size(), 1);
+  EXPECT_EQ(cmd->getDelta().free.size(), 1);
+  EXPECT_TRUE(env->applyCommand(cmd));
+  EXPECT_EQ(env->getCommandHistory().back(), cmd);
+  EXPECT_EQ(env->getRevision(), 5);
+  EXPECT_EQ(env->getCommandHistory().size(), 5);
+
+  // The octree in the scene graph and the contact managers is replaced, the previous octree is not modified
+  auto new_octree = std::dynamic_pointer_cast<const tesseract_geometry::Octree>(
+      env->getSceneGraph()->getLink(link_name)->collision.front()->geometry);
+  ASSERT_TRUE(new_octree != nullptr);
+  EXPECT_NE(new_octree, octree);
+  EXPECT_EQ(octree->getOctree(), ot);
+  EXPECT_TRUE(ot->search(0.05, 0.05, 0.05) != nullptr && ot->isNodeOccupied(ot->search(0.05, 0.05, 0.05)));
+  EXPECT_TRUE(ot->search(0.55, 0.05, 0.05) == nullptr);
+  const octomap::OcTreeNode* occupied_node = new_octree->getOctree()->search(0.55, 0.05, 0.05);
+  ASSERT_TRUE(occupied_node != nullptr);
+  EXPECT_TRUE(new_octree->getOctree()->isNodeOccupied(occupied_node));
+  const octomap::OcTreeNode* free_node = new_octree->getOctree()->search(0.05, 0.05, 0.05);
+  ASSERT_TRUE(free_node != nullptr);
+  EXPECT_FALSE(new_octree->getOctree()->isNodeOccupied(free_node));
+
+  EXPECT_EQ(env->getDiscreteContactManager()->getCollisionObjectGeometries(link_name).front(), new_octree);
+  EXPECT_EQ(env->getContinuousContactManager()->getCollisionObjectGeometries(link_name).front(), new_octree);
+
+  // Contact managers retrieved before the command keep the previous octree
+  EXPECT_EQ(discrete_manager->getCollisionObjectGeometries(link_name).front(), octree);
+  EXPECT_EQ(continuous_manager->getCollisionObjectGeometries(link_name).front(), octree);
+
+  // Only octree collision geometries can be changed
+  EXPECT_FALSE(env->applyCommand(std::make_shared<ChangeLinkOctreeCommand>("missing_link", 0, delta)));
+  EXPECT_FALSE(env->applyCommand(std::make_shared<ChangeLinkOctreeCommand>(link_name, 1, delta)));
+  EXPECT_FALSE(env->applyCommand(std::make_shared<ChangeLinkOctreeCommand>("link_1", 0, delta)));
+  EXPECT_EQ(env->getRevision(), 5);
+  EXPECT_EQ(env->getCommandHistory().size(), 5);
+
+  auto getOctree = [&env, &link_name]() {
+    return std::dynamic_pointer_cast<const tesseract_geometry::Octree>(
+        env->getSceneGraph()->getLink(link_name)->collision.front()->geometry);
+  };
+  auto isOccupied = [](const tesseract_geometry::Octree& octree, const Eigen::Vector3d& voxel) {
+    const octomap::OcTreeNode* node = octree.getOctree()->search(voxel.x(), voxel.y(), voxel.z());
+    return (node != nullptr && octree.getOctree()->isNodeOccupied(node));
+  };
+
+  // Every command applies the delta to a copy, so anything holding the previous link keeps its octree
+  const Eigen::Vector3d voxel(0.05, 0.55, 0.05);
+  tesseract_collision::OctreeDelta occupy_delta;
+  occupy_delta.occupied.push_back(voxel);
+  EXPECT_TRUE(env->applyCommand(std::make_shared<ChangeLinkOctreeCommand>(link_name, 0, occupy_delta)));
+  auto copied_octree = getOctree();
+  ASSERT_TRUE(copied_octree != nullptr);
+  EXPECT_NE(copied_octree, new_octree);
+  EXPECT_FALSE(isOccupied(*new_octree, voxel));
+  EXPECT_TRUE(isOccupied(*copied_octree, voxel));
+
+  tesseract_scene_graph::Link::ConstPtr held_link = env->getLink(link_name);
+  tesseract_collision::OctreeDelta free_delta;
+  free_delta.free.push_back(voxel);
+  EXPECT_TRUE(env->applyCommand(std::make_shared<ChangeLinkOctreeCommand>(link_name, 0, free_delta)));
+  EXPECT_NE(getOctree(), copied_octree);
+  EXPECT_FALSE(isOccupied(*getOctree(), voxel));
+  EXPECT_EQ(held_link->collision.front()->geometry, copied_octree);
+  EXPECT_TRUE(isOccupied(*copied_octree, voxel));
+  EXPECT_EQ(env->getRevision(), 7);
+  EXPECT_EQ(env->getCommandHistory().size(), 7);
+}
+
 TEST(TesseractEnvironmentUnit, EnvChangeLinkVisibilityCommandUnit)  // NOLINT
 {
   // Get the environment
@@ -1520,6 +1618,98 @@ TEST(TesseractEnvironmentUnit, EnvCurrentStatePreservedWhenEnvChanges)  // NOLIN
   }
 }
 
+TEST(TesseractEnvironmentUnit, EnvGroupCacheRebasedOnStateChangeUnit)  // NOLINT
+{
+  // Get the environment
+  auto env = getEnvironment();
+  std::vector<std::string> joint_names = env->getGroupJointNames("manipulator");
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Zero(static_cast<Eigen::Index>(joint_names.size()));
+  joint_values(3) = -1.57;
+
+  // Populate the cache
+  EXPECT_TRUE(env->getJointGroup("manipulator") != nullptr);
+  EXPECT_TRUE(env->getKinematicGroup("manipulator") != nullptr);
+
+  // Only group joints changed so the cached groups must match freshly created ones
+  env->setState(joint_names, joint_values);
+  tesseract_kinematics::JointGroup::UPtr cached_jg = env->getJointGroup("manipulator");
+  tesseract_kinematics::JointGroup::UPtr new_jg = env->getJointGroup("manipulator", joint_names);
+  tesseract_kinematics::KinematicGroup::UPtr cached_kg = env->getKinematicGroup("manipulator");
+
+  joint_values(1) = 0.5;
+  tesseract_common::TransformMap cached_jg_poses = cached_jg->calcFwdKin(joint_values);
+  tesseract_common::TransformMap cached_kg_poses = cached_kg->calcFwdKin(joint_values);
+  tesseract_common::TransformMap new_poses = new_jg->calcFwdKin(joint_values);
+  for (const auto& pose : new_poses)
+  {
+    EXPECT_TRUE(pose.second.isApprox(cached_jg_poses.at(pose.first), 1e-6));
+    EXPECT_TRUE(pose.second.isApprox(cached_kg_poses.at(pose.first), 1e-6));
+  }
+
+  // A group built on a subset of the joints can only be re-based while the other joints are unchanged
+  std::vector<std::string> sub_joint_names(joint_names.begin() + 1, joint_names.end());
+  tesseract_kinematics::JointGroup sub_jg("sub_group", sub_joint_names, *env->getSceneGraph(), env->getState());
+
+  SceneState state = env->getState();
+  state.joints[sub_joint_names.front()] = 0.3;
+  EXPECT_TRUE(sub_jg.setSceneState(state));
+
+  state.joints[joint_names.front()] = 0.3;
+  EXPECT_FALSE(sub_jg.setSceneState(state));
+
+  // A joint which does not move the group links only moves static links
+  Link aux_link("aux_link");
+  Joint aux_joint("aux_joint");
+  aux_joint.parent_link_name = env->getRootLinkName();
+  aux_joint.child_link_name = "aux_link";
+  aux_joint.type = JointType::REVOLUTE;
+  aux_joint.axis = Eigen::Vector3d::UnitZ();
+  aux_joint.parent_to_joint_origin_transform.translation() = Eigen::Vector3d(1, 0, 0);
+  aux_joint.limits = std::make_shared<JointLimits>(-1.0, 1.0, 0, 1.0, 1.0);
+  EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(aux_link, aux_joint)));
+
+  tesseract_kinematics::JointGroup jg("manipulator", joint_names, *env->getSceneGraph(), env->getState());
+  EXPECT_TRUE(env->getJointGroup("manipulator") != nullptr);
+  env->setState({ "aux_joint" }, Eigen::VectorXd::Constant(1, 0.5));
+  state = env->getState();
+  EXPECT_TRUE(jg.setSceneState(state));
+
+  cached_jg = env->getJointGroup("manipulator");
+  tesseract_common::TransformMap jg_poses = jg.calcFwdKin(joint_values);
+  cached_jg_poses = cached_jg->calcFwdKin(joint_values);
+  EXPECT_TRUE(jg_poses.at("aux_link").isApprox(state.link_transforms.at("aux_link"), 1e-6));
+  EXPECT_TRUE(cached_jg_poses.at("aux_link").isApprox(state.link_transforms.at("aux_link"), 1e-6));
+}
+
+TEST(TesseractEnvironmentUnit, EnvGroupBatchedFwdKinUnit)  // NOLINT
+{
+  // Get the environment
+  auto env = getEnvironment();
+  tesseract_kinematics::JointGroup::UPtr jg = env->getJointGroup("manipulator");
+  std::vector<std::string> link_names = jg->getLinkNames();
+
+  tesseract_common::KinematicLimits limits = jg->getLimits();
+  Eigen::MatrixXd joint_values(7, jg->numJoints());
+  for (Eigen::Index r = 0; r < joint_values.rows(); ++r)
+    joint_values.row(r) = tesseract_common::generateRandomNumber(limits.joint_limits).transpose();
+
+  std::vector<tesseract_common::VectorIsometry3d> poses;
+  for (std::size_t num_threads : std::vector<std::size_t>{ 1, 3 })
+  {
+    jg->calcFwdKin(poses, joint_values, num_threads);
+    ASSERT_EQ(poses.size(), static_cast<std::size_t>(joint_values.rows()));
+    for (Eigen::Index r = 0; r < joint_values.rows(); ++r)
+    {
+      Eigen::VectorXd row = joint_values.row(r).transpose();
+      tesseract_common::TransformMap expected = jg->calcFwdKin(row);
+      const tesseract_common::VectorIsometry3d& batch_poses = poses[static_cast<std::size_t>(r)];
+      ASSERT_EQ(batch_poses.size(), link_names.size());
+      for (std::size_t i = 0; i < link_names.size(); ++i)
+        EXPECT_TRUE(batch_poses[i].isApprox(expected.at(link_names[i]), 1e-6));
+    }
+  }
+}
+
 TEST(TesseractEnvironmentUnit, EnvResetUnit)  // NOLINT
 {
   // Get the environment
@@ -2526,6 +2716,31 @@ int getContactCount(const std::vector<tesseract_collision::ContactResultMap>& co
   return total;
 }
 
+/** @brief Verify that the parallel results match the serial results */
+void checkParallelResults(const std::vector<tesseract_collision::ContactResultMap>& serial_contacts,
+                          const std::vector<tesseract_collision::ContactResultMap>& parallel_contacts)
+{
+  ASSERT_EQ(serial_contacts.size(), parallel_contacts.size());
+  for (std::size_t i = 0; i < serial_contacts.size(); ++i)
+  {
+    ASSERT_EQ(serial_contacts[i].size(), parallel_contacts[i].size());
+    for (const auto& pair : serial_contacts[i])
+    {
+      auto it = parallel_contacts[i].find(pair.first);
+      ASSERT_TRUE(it != parallel_contacts[i].end());
+      ASSERT_EQ(pair.second.size(), it->second.size());
+      for (std::size_t j = 0; j < pair.second.size(); ++j)
+      {
+        EXPECT_NEAR(pair.second[j].distance, it->second[j].distance, 1e-6);
+        EXPECT_NEAR(pair.second[j].cc_time[0], it->second[j].cc_time[0], 1e-6);
+        EXPECT_NEAR(pair.second[j].cc_time[1], it->second[j].cc_time[1], 1e-6);
+        EXPECT_EQ(pair.second[j].cc_type[0], it->second[j].cc_type[0]);
+        EXPECT_EQ(pair.second[j].cc_type[1], it->second[j].cc_type[1]);
+      }
+    }
+  }
+}
+
 TEST(TesseractEnvironmentUnit, checkTrajectoryUnit)  // NOLINT
 {
   // Get the environment
@@ -3239,6 +3454,74 @@ TEST(TesseractEnvironmentUnit, checkTrajectoryUnit)  // NOLINT
     EXPECT_ANY_THROW(tesseract_environment::checkTrajectory(
         contacts, *continuous_manager, *joint_group, tesseract_common::TrajArray(), config));
   }
+
+  // Parallel check must produce the same results as the serial check
+  tesseract_common::TrajArray traj3(21, joint_start_pos.size());
+  for (int i = 0; i < joint_start_pos.size(); ++i)
+    traj3.col(i) = Eigen::VectorXd::LinSpaced(21, joint_start_pos(i), joint_end_pos(i));
+
+  for (auto type : { CollisionEvaluatorType::DISCRETE,
+                     CollisionEvaluatorType::LVS_DISCRETE,
+                     CollisionEvaluatorType::CONTINUOUS,
+                     CollisionEvaluatorType::LVS_CONTINUOUS })
+  {
+    for (auto test_type : { tesseract_collision::ContactTestType::FIRST,
+                            tesseract_collision::ContactTestType::CLOSEST,
+                            tesseract_collision::ContactTestType::ALL })
+    {
+      tesseract_collision::CollisionCheckConfig config;
+      config.type = type;
+      config.contact_request.type = test_type;
+      config.longest_valid_segment_length = 0.01;
+
+      tesseract_collision::CollisionCheckConfig parallel_config(config);
+      parallel_config.num_threads = 4;
+
+      bool discrete = (type == CollisionEvaluatorType::DISCRETE || type == CollisionEvaluatorType::LVS_DISCRETE);
+      std::vector<tesseract_collision::ContactResultMap> serial_contacts;
+      std::vector<tesseract_collision::ContactResultMap> parallel_contacts;
+      if (discrete)
+      {
+        bool serial_found = tesseract_environment::checkTrajectory(
+            serial_contacts, *discrete_manager, *state_solver, joint_names, traj3, config);
+        bool parallel_found = tesseract_environment::checkTrajectory(
+            parallel_contacts, *discrete_manager, *state_solver, joint_names, traj3, parallel_config);
+        EXPECT_TRUE(serial_found);
+        EXPECT_EQ(serial_found, parallel_found);
+        checkParallelResults(serial_contacts, parallel_contacts);
+
+        serial_contacts.clear();
+        parallel_contacts.clear();
+        serial_found =
+            tesseract_environment::checkTrajectory(serial_contacts, *discrete_manager, *joint_group, traj3, config);
+        parallel_found = tesseract_environment::checkTrajectory(
+            parallel_contacts, *discrete_manager, *joint_group, traj3, parallel_config);
+        EXPECT_TRUE(serial_found);
+        EXPECT_EQ(serial_found, parallel_found);
+        checkParallelResults(serial_contacts, parallel_contacts);
+      }
+      else
+      {
+        bool serial_found = tesseract_environment::checkTrajectory(
+            serial_contacts, *continuous_manager, *state_solver, joint_names, traj3, config);
+        bool parallel_found = tesseract_environment::checkTrajectory(
+            parallel_contacts, *continuous_manager, *state_solver, joint_names, traj3, parallel_config);
+        EXPECT_TRUE(serial_found);
+        EXPECT_EQ(serial_found, parallel_found);
+        checkParallelResults(serial_contacts, parallel_contacts);
+
+        serial_contacts.clear();
+        parallel_contacts.clear();
+        serial_found =
+            tesseract_environment::checkTrajectory(serial_contacts, *continuous_manager, *joint_group, traj3, config);
+        parallel_found = tesseract_environment::checkTrajectory(
+            parallel_contacts, *continuous_manager, *joint_group, traj3, parallel_config);
+        EXPECT_TRUE(serial_found);
+        EXPECT_EQ(serial_found, parallel_found);
+        checkParallelResults(serial_contacts, parallel_contacts);
+      }
+    }
+  }
 }
 
 int main(int argc, char** argv)
@@ -31,6 +31,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/access.hpp>
 #include <boost/serialization/export.hpp>
 #include <Eigen/Geometry>
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <octomap/octomap.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
@@ -52,8 +54,25 @@ public:
     SPHERE_OUTSIDE
   };
 
-  Octree(std::shared_ptr<const octomap::OcTree> octree, const SubType sub_type)
-    : Geometry(GeometryType::OCTREE), octree_(std::move(octree)), sub_type_(sub_type)
+  /**
+   * @brief Create an octree geometry
+   * @param octree The octree
+   * @param sub_type The shape used for the occupied nodes
+   * @param merge_occupied_nodes If true, the largest fully occupied nodes are a single sub shape instead of one sub
+   * shape per occupied leaf. Unlike prune this does not modify the octree.
+   * @param max_collision_depth The deepest octree depth used for the sub shapes, zero uses the depth of the octree.
+   * Deeper nodes are represented by their ancestor at this depth, which is occupied if any of its children is occupied.
+   * @note The FCL managers traverse the octree directly and ignore both options.
+   */
+  Octree(std::shared_ptr<const octomap::OcTree> octree,
+         const SubType sub_type,
+         const bool merge_occupied_nodes = false,
+         const unsigned max_collision_depth = 0)
+    : Geometry(GeometryType::OCTREE)
+    , octree_(std::move(octree))
+    , sub_type_(sub_type)
+    , merge_occupied_nodes_(merge_occupied_nodes)
+    , max_collision_depth_(max_collision_depth)
   {
   }
 
@@ -97,7 +116,23 @@ public:
 
   bool getPruned() const { return pruned_; }
 
-  Geometry::Ptr clone() const override final { return std::make_shared<Octree>(octree_, sub_type_); }
+  /** @brief Check if the largest fully occupied nodes are a single sub shape */
+  bool getMergeOccupiedNodes() const { return merge_occupied_nodes_; }
+
+  /** @brief Get the deepest octree depth used for the sub shapes, zero uses the depth of the octree */
+  unsigned getMaxCollisionDepth() const { return max_collision_depth_; }
+
+  /** @brief Get the depth of the deepest sub shapes, which is the octree depth limited by the max collision depth */
+  unsigned getSubShapeDepth() const
+  {
+    const unsigned tree_depth = octree_->getTreeDepth();
+    return (max_collision_depth_ == 0) ? tree_depth : std::min(max_collision_depth_, tree_depth);
+  }
+
+  Geometry::Ptr clone() const override final
+  {
+    return std::make_shared<Octree>(octree_, sub_type_, merge_occupied_nodes_, max_collision_depth_);
+  }
   bool operator==(const Octree& rhs) const;
   bool operator!=(const Octree& rhs) const;
 
@@ -117,21 +152,117 @@ public:
   long calcNumSubShapes() const
   {
     long cnt = 0;
-    double occupancy_threshold = octree_->getOccupancyThres();
-    for (auto it = octree_->begin(static_cast<unsigned char>(octree_->getTreeDepth())), end = octree_->end(); it != end;
-         ++it)
-      if (it->getOccupancy() >= occupancy_threshold)
-        ++cnt;
-
+    forEachSubShape([&cnt](const octomap::OcTreeKey& /*key*/, unsigned /*depth*/) { ++cnt; });
     return cnt;
   }
 
+  /**
+   * @brief Check if every voxel inside an octree node is occupied, nodes at the sub shape depth are treated as leaves
+   * @param node The octree node
+   * @param depth The depth of the node
+   * @return True if the node is fully occupied, otherwise false
+   */
+  // NOLINTNEXTLINE(misc-no-recursion)
+  bool isNodeFullyOccupied(const octomap::OcTreeNode* node, unsigned depth) const
+  {
+    if (depth >= getSubShapeDepth() || !octree_->nodeHasChildren(node))
+      return (node->getOccupancy() >= octree_->getOccupancyThres());
+
+    for (unsigned int i = 0; i < 8; i++)
+    {
+      if (!octree_->nodeChildExists(node, i) || !isNodeFullyOccupied(octree_->getNodeChild(node, i), depth + 1))
+        return false;
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief Call fn(key, depth) for every sub shape of the octree
+   *
+   * The key is the key of the first maximum depth voxel inside the node of the sub shape. The node center is
+   * octree->keyToCoord(key, depth) and its size is octree->getNodeSize(depth).
+   *
+   * @param fn The function called for every sub shape
+   */
+  template <typename Fn>
+  void forEachSubShape(Fn&& fn) const
+  {
+    if (octree_->getRoot() != nullptr)
+      forEachSubShape(octree_->getRoot(), octomap::OcTreeKey(0, 0, 0), 0, fn);
+  }
+
+  /**
+   * @brief Call fn(key, depth) for every sub shape inside an octree node
+   * @param node The octree node
+   * @param key The key of the first maximum depth voxel inside the node
+   * @param depth The depth of the node
+   * @param fn The function called for every sub shape
+   */
+  template <typename Fn>
+  void forEachSubShape(const octomap::OcTreeNode* node, const octomap::OcTreeKey& key, unsigned depth, Fn&& fn) const
+  {
+    if (forEachSubShapeRecurs(node, key, depth, fn))
+      fn(key, depth);
+  }
+
 private:
   std::shared_ptr<const octomap::OcTree> octree_;
   SubType sub_type_{ SubType::BOX };
   double resolution_{ 0.01 };
   bool pruned_{ false };
   bool binary_octree_{ false };
+  bool merge_occupied_nodes_{ false };
+  unsigned max_collision_depth_{ 0 };
+
+  /**
+   * @brief Call fn(key, depth) for every sub shape inside an octree node, except for the node itself
+   * @details If merging is enabled the sub shape of a fully occupied node is left to the caller, because its parent may
+   * be fully occupied too.
+   * @return True if the node is a sub shape which was not passed to fn, otherwise false
+   */
+  template <typename Fn>
+  // NOLINTNEXTLINE(misc-no-recursion)
+  bool forEachSubShapeRecurs(const octomap::OcTreeNode* node,
+                             const octomap::OcTreeKey& key,
+                             unsigned depth,
+                             Fn& fn) const
+  {
+    const unsigned tree_depth = octree_->getTreeDepth();
+    if (depth >= getSubShapeDepth() || !octree_->nodeHasChildren(node))
+      return (node->getOccupancy() >= octree_->getOccupancyThres());
+
+    std::array<bool, 8> occupied{};
+    const auto half = static_cast<octomap::key_type>(1U << (tree_depth - depth - 1));
+    for (unsigned int i = 0; i < 8; i++)
+    {
+      if (octree_->nodeChildExists(node, i))
+        occupied[i] = forEachSubShapeRecurs(octree_->getNodeChild(node, i), getChildKey(key, i, half), depth + 1, fn);
+    }
+
+    if (merge_occupied_nodes_ && std::all_of(occupied.begin(), occupied.end(), [](bool v) { return v; }))
+      return true;
+
+    for (unsigned int i = 0; i < 8; i++)
+    {
+      if (occupied[i])
+        fn(getChildKey(key, i, half), depth + 1);
+    }
+
+    return false;
+  }
+
+  /** @brief Get the key of the first maximum depth voxel inside a child node */
+  static octomap::OcTreeKey getChildKey(const octomap::OcTreeKey& key, unsigned int pos, octomap::key_type half)
+  {
+    octomap::OcTreeKey child_key(key);
+    for (unsigned int j = 0; j < 3; j++)
+    {
+      if ((pos & (1U << j)) != 0)
+        child_key[j] = static_cast<octomap::key_type>(child_key[j] + half);
+    }
+    return child_key;
+  }
 
   static bool isNodeCollapsible(octomap::OcTree& octree, octomap::OcTreeNode* node)
   {
@@ -244,6 +375,8 @@ public:
 }  // namespace tesseract_geometry
 
 #include <boost/serialization/tracking.hpp>
+#include <boost/serialization/version.hpp>
 BOOST_CLASS_EXPORT_KEY2(tesseract_geometry::Octree, "Octree")
 BOOST_CLASS_TRACKING(tesseract_geometry::Octree, boost::serialization::track_never)
+BOOST_CLASS_VERSION(tesseract_geometry::Octree, 1)
 #endif
@@ -46,6 +46,8 @@ bool Octree::operator==(const Octree& rhs) const
   equal &= sub_type_ == rhs.sub_type_;
   equal &= pruned_ == rhs.pruned_;
   equal &= resolution_ == rhs.resolution_;
+  equal &= merge_occupied_nodes_ == rhs.merge_occupied_nodes_;
+  equal &= max_collision_depth_ == rhs.max_collision_depth_;
 
   // octree_ == rhs.octree_ looks for exact double equality
   equal &= octree_->getTreeDepth() == rhs.octree_->getTreeDepth();                             // tree_depth
@@ -82,6 +84,8 @@ void Octree::save(Archive& ar, const unsigned int /*version*/) const
   ar& BOOST_SERIALIZATION_NVP(resolution_);
   ar& BOOST_SERIALIZATION_NVP(pruned_);
   ar& BOOST_SERIALIZATION_NVP(binary_octree_);
+  ar& BOOST_SERIALIZATION_NVP(merge_occupied_nodes_);
+  ar& BOOST_SERIALIZATION_NVP(max_collision_depth_);
 
   // Read the data to a stream which does not guarantee contiguous memory
   std::ostringstream s;
@@ -98,7 +102,7 @@ void Octree::save(Archive& ar, const unsigned int /*version*/) const
 }
 
 template <class Archive>
-void Octree::load(Archive& ar, const unsigned int /*version*/)
+void Octree::load(Archive& ar, const unsigned int version)
 {
   using namespace boost::serialization;
   ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(Geometry);
@@ -107,6 +111,13 @@ void Octree::load(Archive& ar, const unsigned int /*version*/)
   ar& BOOST_SERIALIZATION_NVP(pruned_);
   ar& BOOST_SERIALIZATION_NVP(binary_octree_);
 
+  // Version 0 archives were written before the collision options were added, so they keep their defaults
+  if (version >= 1)
+  {
+    ar& BOOST_SERIALIZATION_NVP(merge_occupied_nodes_);
+    ar& BOOST_SERIALIZATION_NVP(max_collision_depth_);
+  }
+
   // Initialize the octree to the right size
   auto local_octree = std::make_shared<octomap::OcTree>(resolution_);
 
@@ -276,6 +276,59 @@ TEST(TesseractGeometryUnit, Octree)  // NOLINT
   EXPECT_TRUE(std::static_pointer_cast<T>(geom_clone)->getSubType() == tesseract_geometry::Octree::SubType::BOX);
 }
 
+TEST(TesseractGeometryUnit, OctreeSubShapes)  // NOLINT
+{
+  using T = tesseract_geometry::Octree;
+
+  // Fill the eight voxels of one node above the maximum depth and add one voxel next to it
+  auto ot = std::make_shared<octomap::OcTree>(0.1);
+  for (double x : { 0.05, 0.15 })
+    for (double y : { 0.05, 0.15 })
+      for (double z : { 0.05, 0.15 })
+        ot->updateNode(x, y, z, true, true);
+
+  ot->updateNode(0.25, 0.05, 0.05, true, true);
+  ot->updateInnerOccupancy();
+  ot->toMaxLikelihood();
+
+  const unsigned tree_depth = ot->getTreeDepth();
+  for (auto sub_type : { T::SubType::BOX, T::SubType::SPHERE_INSIDE, T::SubType::SPHERE_OUTSIDE })
+  {
+    auto geom = std::make_shared<T>(ot, sub_type);
+    EXPECT_FALSE(geom->getMergeOccupiedNodes());
+    EXPECT_EQ(geom->getMaxCollisionDepth(), 0U);
+    EXPECT_EQ(geom->getSubShapeDepth(), tree_depth);
+    EXPECT_EQ(geom->calcNumSubShapes(), 9);
+
+    // The full node is a single sub shape
+    geom = std::make_shared<T>(ot, sub_type, true);
+    EXPECT_TRUE(geom->getMergeOccupiedNodes());
+    EXPECT_EQ(geom->calcNumSubShapes(), 2);
+
+    std::vector<unsigned> depths;
+    geom->forEachSubShape([&depths](const octomap::OcTreeKey& /*key*/, unsigned depth) { depths.push_back(depth); });
+    std::sort(depths.begin(), depths.end());
+    ASSERT_EQ(depths.size(), 2U);
+    EXPECT_EQ(depths[0], tree_depth - 1);
+    EXPECT_EQ(depths[1], tree_depth);
+
+    // Capping the depth merges the single voxel into its occupied parent
+    geom = std::make_shared<T>(ot, sub_type, false, tree_depth - 1);
+    EXPECT_EQ(geom->getSubShapeDepth(), tree_depth - 1);
+    EXPECT_EQ(geom->calcNumSubShapes(), 2);
+
+    // The cap is limited to the depth of the octree
+    geom = std::make_shared<T>(ot, sub_type, true, tree_depth + 1);
+    EXPECT_EQ(geom->getSubShapeDepth(), tree_depth);
+    EXPECT_EQ(geom->calcNumSubShapes(), 2);
+
+    auto geom_clone = std::static_pointer_cast<T>(geom->clone());
+    EXPECT_TRUE(geom_clone->getMergeOccupiedNodes());
+    EXPECT_EQ(geom_clone->getMaxCollisionDepth(), tree_depth + 1);
+    EXPECT_EQ(geom_clone->calcNumSubShapes(), 2);
+  }
+}
+
 TEST(TesseractGeometryUnit, LoadMeshUnit)  // NOLINT
 {
   using namespace tesseract_geometry;
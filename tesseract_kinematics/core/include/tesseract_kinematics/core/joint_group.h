@@ -77,6 +77,18 @@ public:
    */
   tesseract_common::TransformMap calcFwdKin(const Eigen::Ref<const Eigen::VectorXd>& joint_angles) const;
 
+  /**
+   * @brief Calculates the link transforms for a batch of joint configurations
+   * @details The transforms of each configuration are ordered as getLinkNames(). The poses are resized to the number
+   * of configurations and filled in place, so reusing the same vector across calls avoids allocation.
+   * @param poses The link transforms to populate, one entry per row of joint_angles
+   * @param joint_angles The joint configurations, one per row (columns must match the joints of the group)
+   * @param num_threads The number of threads the configurations are distributed across
+   */
+  void calcFwdKin(std::vector<tesseract_common::VectorIsometry3d>& poses,
+                  const Eigen::Ref<const Eigen::MatrixXd>& joint_angles,
+                  std::size_t num_threads = 1) const;
+
   /**
    * @brief Calculated jacobian of robot given joint angles
    * @param joint_angles Input vector of joint angles
@@ -199,6 +211,18 @@ public:
    */
   bool checkJoints(const Eigen::Ref<const Eigen::VectorXd>& vec) const;
 
+  /**
+   * @brief Re-base the group on a new scene state without rebuilding the kinematics
+   * @details The values of the joints outside the group which move the active links, because they are upstream of or
+   * between the group joints, are baked into the kinematics when the group is created. If they are identical in the
+   * provided state only the stored scene state and the transforms of the static links are replaced, which is cheap.
+   * Changes to any other joint, like the joints of another robot, only move static links.
+   * @param scene_state The new scene state
+   * @return True if the group was updated, false if a joint baked into the kinematics changed and the group must be
+   * recreated
+   */
+  bool setSceneState(const tesseract_scene_graph::SceneState& scene_state);
+
 protected:
   std::string name_;
   tesseract_scene_graph::SceneState state_;
@@ -210,6 +234,9 @@ protected:
   tesseract_common::KinematicLimits limits_;
   std::vector<Eigen::Index> redundancy_indices_;
   std::vector<Eigen::Index> jacobian_map_;
+  std::vector<long> link_state_indices_; /**< @brief The state solver dense link index of each link, -1 if static */
+  tesseract_common::VectorIsometry3d link_static_transforms_; /**< @brief The static transform of each link */
+  std::vector<std::string> baked_joint_names_; /**< @brief The joints outside the group which move the active links */
 };
 
 }  // namespace tesseract_kinematics
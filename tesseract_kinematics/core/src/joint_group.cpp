@@ -26,6 +26,7 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <console_bridge/console.h>
+#include <set>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_kinematics/core/joint_group.h>
@@ -65,6 +66,13 @@ JointGroup::JointGroup(std::string name,
     {
       static_link_names_.push_back(link->getName());
       static_link_transforms_[link->getName()] = scene_state.link_transforms.at(link->getName());
+      link_state_indices_.push_back(-1);
+      link_static_transforms_.push_back(scene_state.link_transforms.at(link->getName()));
+    }
+    else
+    {
+      link_state_indices_.push_back(state_solver_->getLinkIndex(link->getName()));
+      link_static_transforms_.emplace_back(Eigen::Isometry3d::Identity());
     }
   }
 
@@ -93,6 +101,23 @@ JointGroup::JointGroup(std::string name,
 
   if (static_link_names_.size() + active_link_names.size() != scene_graph.getLinks().size())
     throw std::runtime_error("JointGroup: Static link names are not correct!");
+
+  // The joints outside the group between the root and the active links are fixed at their current value in the state
+  // solver, so they are found by walking from each active link up to the root
+  std::set<std::string> visited_joint_names;
+  for (const auto& link_name : active_link_names)
+  {
+    std::vector<tesseract_scene_graph::Joint::ConstPtr> inbound_joints = scene_graph.getInboundJoints(link_name);
+    while (!inbound_joints.empty() && visited_joint_names.insert(inbound_joints.front()->getName()).second)
+    {
+      tesseract_scene_graph::Joint::ConstPtr joint = inbound_joints.front();
+      if (scene_state.joints.find(joint->getName()) != scene_state.joints.end() &&
+          std::find(joint_names_.begin(), joint_names_.end(), joint->getName()) == joint_names_.end())
+        baked_joint_names_.push_back(joint->getName());
+
+      inbound_joints = scene_graph.getInboundJoints(joint->parent_link_name);
+    }
+  }
 }
 
 JointGroup::JointGroup(const JointGroup& other) { *this = other; }
@@ -109,6 +134,9 @@ JointGroup& JointGroup::operator=(const JointGroup& other)
   limits_ = other.limits_;
   redundancy_indices_ = other.redundancy_indices_;
   jacobian_map_ = other.jacobian_map_;
+  link_state_indices_ = other.link_state_indices_;
+  link_static_transforms_ = other.link_static_transforms_;
+  baked_joint_names_ = other.baked_joint_names_;
   return *this;
 }
 
@@ -119,6 +147,35 @@ tesseract_common::TransformMap JointGroup::calcFwdKin(const Eigen::Ref<const Eig
   return state;
 }
 
+void JointGroup::calcFwdKin(std::vector<tesseract_common::VectorIsometry3d>& poses,
+                            const Eigen::Ref<const Eigen::MatrixXd>& joint_angles,
+                            std::size_t num_threads) const
+{
+  assert(joint_angles.cols() == numJoints());
+  poses.resize(static_cast<std::size_t>(joint_angles.rows()));
+
+  // KDL joints cache values internally, so every worker thread other than the caller uses its own copy of the solver
+  tesseract_common::parallelFor(joint_angles.rows(), num_threads, [&](long start, long end) {
+    tesseract_scene_graph::StateSolver::UPtr local_solver = (start == 0) ? nullptr : state_solver_->clone();
+    const tesseract_scene_graph::StateSolver& solver = (local_solver != nullptr) ? *local_solver : *state_solver_;
+    tesseract_scene_graph::DenseSceneState state;
+    Eigen::VectorXd values(joint_angles.cols());
+    for (long i = start; i < end; ++i)
+    {
+      values = joint_angles.row(i).transpose();
+      solver.getState(state, joint_names_, values);
+
+      tesseract_common::VectorIsometry3d& link_poses = poses[static_cast<std::size_t>(i)];
+      link_poses.resize(link_names_.size());
+      for (std::size_t j = 0; j < link_names_.size(); ++j)
+      {
+        const long idx = link_state_indices_[j];
+        link_poses[j] = (idx < 0) ? link_static_transforms_[j] : state.link_transforms[static_cast<std::size_t>(idx)];
+      }
+    }
+  });
+}
+
 Eigen::MatrixXd JointGroup::calcJacobian(const Eigen::Ref<const Eigen::VectorXd>& joint_angles,
                                          const std::string& link_name) const
 {
@@ -253,6 +310,36 @@ bool JointGroup::checkJoints(const Eigen::Ref<const Eigen::VectorXd>& vec) const
   return true;
 }
 
+bool JointGroup::setSceneState(const tesseract_scene_graph::SceneState& scene_state)
+{
+  for (const auto& joint_name : baked_joint_names_)
+  {
+    auto it = scene_state.joints.find(joint_name);
+    if (it == scene_state.joints.end() || it->second != state_.joints.at(joint_name))
+      return false;
+  }
+
+  for (const auto& link_name : static_link_names_)
+  {
+    if (scene_state.link_transforms.find(link_name) == scene_state.link_transforms.end())
+      return false;
+  }
+
+  // Joints which do not move the active links may still move static links
+  for (std::size_t i = 0; i < link_names_.size(); ++i)
+  {
+    if (link_state_indices_[i] >= 0)
+      continue;
+
+    const Eigen::Isometry3d& link_transform = scene_state.link_transforms.at(link_names_[i]);
+    link_static_transforms_[i] = link_transform;
+    static_link_transforms_[link_names_[i]] = link_transform;
+  }
+
+  state_ = scene_state;
+  return true;
+}
+
 std::vector<std::string> JointGroup::getJointNames() const { return joint_names_; }
 
 std::vector<std::string> JointGroup::getLinkNames() const { return link_names_; }
@@ -34,7 +34,6 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <kdl/chainjnttojacsolver.hpp>
 #include <unordered_map>
 #include <console_bridge/console.h>
-#include <mutex>
 
 #include <tesseract_scene_graph/graph.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
@@ -107,12 +106,20 @@ public:
   ForwardKinematics::UPtr clone() const override final;
 
 private:
-  KDLChainData kdl_data_;                                      /**< KDL data parsed from Scene Graph */
-  std::string name_;                                           /**< Name of the kinematic chain */
-  std::unique_ptr<KDL::ChainFkSolverPos_recursive> fk_solver_; /**< KDL Forward Kinematic Solver */
-  std::unique_ptr<KDL::ChainJntToJacSolver> jac_solver_;       /**< KDL Jacobian Solver */
-  std::string solver_name_{ KDL_FWD_KIN_CHAIN_SOLVER_NAME };   /**< @brief Name of this solver */
-  mutable std::mutex mutex_; /**< @brief KDL is not thread safe due to mutable variables in Joint Class */
+  /** @brief The KDL solvers leased by a single call, KDL is not thread safe due to mutable variables in Joint Class */
+  struct Solvers
+  {
+    explicit Solvers(const KDL::Chain& robot_chain) : chain(robot_chain), fk_solver(chain), jac_solver(chain) {}
+
+    KDL::Chain chain;                          /**< KDL Chain owned by the solvers */
+    KDL::ChainFkSolverPos_recursive fk_solver; /**< KDL Forward Kinematic Solver */
+    KDL::ChainJntToJacSolver jac_solver;       /**< KDL Jacobian Solver */
+  };
+
+  KDLChainData kdl_data_;                                    /**< KDL data parsed from Scene Graph */
+  std::string name_;                                         /**< Name of the kinematic chain */
+  std::unique_ptr<KDLSolverPool<Solvers>> solvers_;          /**< KDL solvers, one per concurrent caller */
+  std::string solver_name_{ KDL_FWD_KIN_CHAIN_SOLVER_NAME }; /**< @brief Name of this solver */
 
   /** @brief calcFwdKin helper function */
   tesseract_common::TransformMap calcFwdKinHelperAll(const Eigen::Ref<const Eigen::VectorXd>& joint_angles) const;
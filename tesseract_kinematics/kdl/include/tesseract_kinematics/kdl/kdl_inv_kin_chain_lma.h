@@ -32,7 +32,6 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <kdl/chainiksolverpos_lma.hpp>
 #include <unordered_map>
 #include <console_bridge/console.h>
-#include <mutex>
 
 #include <tesseract_scene_graph/graph.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
@@ -102,10 +101,18 @@ public:
   InverseKinematics::UPtr clone() const override final;
 
 private:
+  /** @brief The KDL solvers leased by a single call, KDL is not thread safe due to mutable variables in Joint Class */
+  struct Solvers
+  {
+    explicit Solvers(const KDL::Chain& robot_chain) : chain(robot_chain), ik_solver(chain) {}
+
+    KDL::Chain chain;                   /**< @brief KDL Chain owned by the solvers */
+    KDL::ChainIkSolverPos_LMA ik_solver; /**< @brief KDL Inverse kinematic solver */
+  };
+
   KDLChainData kdl_data_;                                        /**< @brief KDL data parsed from Scene Graph */
-  std::unique_ptr<KDL::ChainIkSolverPos_LMA> ik_solver_;         /**< @brief KDL Inverse kinematic solver */
+  std::unique_ptr<KDLSolverPool<Solvers>> solvers_;              /**< @brief KDL solvers, one per concurrent caller */
   std::string solver_name_{ KDL_INV_KIN_CHAIN_LMA_SOLVER_NAME }; /**< @brief Name of this solver */
-  mutable std::mutex mutex_; /**< @brief KDL is not thread safe due to mutable variables in Joint Class */
 
   /** @brief calcFwdKin helper function */
   IKSolutions calcInvKinHelper(const Eigen::Isometry3d& pose,
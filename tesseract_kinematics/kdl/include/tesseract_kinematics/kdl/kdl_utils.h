@@ -30,7 +30,11 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <kdl/frames.hpp>
 #include <kdl/jntarray.hpp>
+#include <kdl/chain.hpp>
 #include <Eigen/Eigen>
+#include <memory>
+#include <mutex>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/types.h>
@@ -126,5 +130,85 @@ bool parseSceneGraph(KDLChainData& results,
                      const tesseract_scene_graph::SceneGraph& scene_graph,
                      const std::string& base_name,
                      const std::string& tip_name);
+
+/**
+ * @brief A pool of KDL solvers so concurrent calls on a single kinematics object do not serialize
+ *
+ * KDL solvers and the KDL::Joint objects of the chain they reference store mutable scratch data, so every solver in
+ * the pool owns a copy of the chain. A solver is leased for the duration of a single call and the lock is only held
+ * while taking or returning it. New solvers are created on demand, so the pool grows to the number of concurrent
+ * callers.
+ *
+ * @tparam SolverT A type constructible from a const KDL::Chain& which keeps a copy of the chain
+ */
+template <typename SolverT>
+class KDLSolverPool
+{
+public:
+  using Ptr = std::shared_ptr<KDLSolverPool<SolverT>>;
+  using ConstPtr = std::shared_ptr<const KDLSolverPool<SolverT>>;
+  using UPtr = std::unique_ptr<KDLSolverPool<SolverT>>;
+  using ConstUPtr = std::unique_ptr<const KDLSolverPool<SolverT>>;
+
+  /** @brief A solver leased from the pool, it is returned to the pool on destruction */
+  class Lease
+  {
+  public:
+    Lease(const KDLSolverPool<SolverT>& pool, std::unique_ptr<SolverT> solver)
+      : pool_(pool), solver_(std::move(solver))
+    {
+    }
+    ~Lease() { pool_.release(std::move(solver_)); }
+    Lease(const Lease&) = delete;
+    Lease& operator=(const Lease&) = delete;
+    Lease(Lease&&) = delete;
+    Lease& operator=(Lease&&) = delete;
+
+    SolverT& operator*() const { return *solver_; }
+    SolverT* operator->() const { return solver_.get(); }
+
+  private:
+    const KDLSolverPool<SolverT>& pool_;
+    std::unique_ptr<SolverT> solver_;
+  };
+
+  explicit KDLSolverPool(KDL::Chain chain) : chain_(std::move(chain)) {}
+  ~KDLSolverPool() = default;
+  KDLSolverPool(const KDLSolverPool&) = delete;
+  KDLSolverPool& operator=(const KDLSolverPool&) = delete;
+  KDLSolverPool(KDLSolverPool&&) = delete;
+  KDLSolverPool& operator=(KDLSolverPool&&) = delete;
+
+  /**
+   * @brief Lease a solver, creating a new one if all solvers are in use
+   * @return The leased solver
+   */
+  Lease acquire() const
+  {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      if (!solvers_.empty())
+      {
+        std::unique_ptr<SolverT> solver = std::move(solvers_.back());
+        solvers_.pop_back();
+        return Lease(*this, std::move(solver));
+      }
+    }
+
+    return Lease(*this, std::make_unique<SolverT>(chain_));
+  }
+
+private:
+  KDL::Chain chain_;                                      /**< @brief The chain every solver is created from */
+  mutable std::vector<std::unique_ptr<SolverT>> solvers_; /**< @brief The solvers not currently leased */
+  mutable std::mutex mutex_;                              /**< @brief Protects solvers_ */
+
+  void release(std::unique_ptr<SolverT> solver) const
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    solvers_.push_back(std::move(solver));
+  }
+};
+
 }  // namespace tesseract_kinematics
 #endif  // TESSERACT_KINEMATICS_KDL_UTILS_H
@@ -48,8 +48,7 @@ KDLFwdKinChain::KDLFwdKinChain(const tesseract_scene_graph::SceneGraph& scene_gr
   if (!parseSceneGraph(kdl_data_, scene_graph, chains))
     throw std::runtime_error("Failed to parse KDL data from Scene Graph");
 
-  fk_solver_ = std::make_unique<KDL::ChainFkSolverPos_recursive>(kdl_data_.robot_chain);
-  jac_solver_ = std::make_unique<KDL::ChainJntToJacSolver>(kdl_data_.robot_chain);
+  solvers_ = std::make_unique<KDLSolverPool<Solvers>>(kdl_data_.robot_chain);
 }
 
 KDLFwdKinChain::KDLFwdKinChain(const tesseract_scene_graph::SceneGraph& scene_graph,
@@ -67,8 +66,7 @@ KDLFwdKinChain& KDLFwdKinChain::operator=(const KDLFwdKinChain& other)
 {
   name_ = other.name_;
   kdl_data_ = other.kdl_data_;
-  fk_solver_ = std::make_unique<KDL::ChainFkSolverPos_recursive>(kdl_data_.robot_chain);
-  jac_solver_ = std::make_unique<KDL::ChainJntToJacSolver>(kdl_data_.robot_chain);
+  solvers_ = std::make_unique<KDLSolverPool<Solvers>>(kdl_data_.robot_chain);
   solver_name_ = other.solver_name_;
   return *this;
 }
@@ -84,8 +82,8 @@ KDLFwdKinChain::calcFwdKinHelperAll(const Eigen::Ref<const Eigen::VectorXd>& joi
 
   KDL::Frame kdl_pose;
   {
-    std::lock_guard<std::mutex> guard(mutex_);
-    fk_solver_->JntToCart(kdl_joints, kdl_pose);
+    auto solvers = solvers_->acquire();
+    solvers->fk_solver.JntToCart(kdl_joints, kdl_pose);
   }
 
   Eigen::Isometry3d pose;
@@ -115,8 +113,8 @@ bool KDLFwdKinChain::calcJacobianHelper(KDL::Jacobian& jacobian,
   jacobian.resize(static_cast<unsigned>(joint_angles.size()));
   int success{ -1 };
   {
-    std::lock_guard<std::mutex> guard(mutex_);
-    success = jac_solver_->JntToJac(kdl_joints, jacobian, segment_num);
+    auto solvers = solvers_->acquire();
+    success = solvers->jac_solver.JntToJac(kdl_joints, jacobian, segment_num);
   }
 
   if (success < 0)
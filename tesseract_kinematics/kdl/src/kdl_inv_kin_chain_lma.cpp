@@ -51,7 +51,7 @@ KDLInvKinChainLMA::KDLInvKinChainLMA(const tesseract_scene_graph::SceneGraph& sc
     throw std::runtime_error("Failed to parse KDL data from Scene Graph");
 
   // Create KDL IK Solver
-  ik_solver_ = std::make_unique<KDL::ChainIkSolverPos_LMA>(kdl_data_.robot_chain);
+  solvers_ = std::make_unique<KDLSolverPool<Solvers>>(kdl_data_.robot_chain);
 }
 
 KDLInvKinChainLMA::KDLInvKinChainLMA(const tesseract_scene_graph::SceneGraph& scene_graph,
@@ -69,7 +69,7 @@ KDLInvKinChainLMA::KDLInvKinChainLMA(const KDLInvKinChainLMA& other) { *this = o
 KDLInvKinChainLMA& KDLInvKinChainLMA::operator=(const KDLInvKinChainLMA& other)
 {
   kdl_data_ = other.kdl_data_;
-  ik_solver_ = std::make_unique<KDL::ChainIkSolverPos_LMA>(kdl_data_.robot_chain);
+  solvers_ = std::make_unique<KDLSolverPool<Solvers>>(kdl_data_.robot_chain);
   solver_name_ = other.solver_name_;
 
   return *this;
@@ -90,8 +90,8 @@ IKSolutions KDLInvKinChainLMA::calcInvKinHelper(const Eigen::Isometry3d& pose,
   EigenToKDL(pose, kdl_pose);
   int status{ -1 };
   {
-    std::lock_guard<std::mutex> guard(mutex_);
-    status = ik_solver_->CartToJnt(kdl_seed, kdl_pose, kdl_solution);
+    auto solvers = solvers_->acquire();
+    status = solvers->ik_solver.CartToJnt(kdl_seed, kdl_pose, kdl_solution);
   }
   if (status < 0)
   {
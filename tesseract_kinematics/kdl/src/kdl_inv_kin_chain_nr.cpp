@@ -51,9 +51,7 @@ KDLInvKinChainNR::KDLInvKinChainNR(const tesseract_scene_graph::SceneGraph& scen
     throw std::runtime_error("Failed to parse KDL data from Scene Graph");
 
   // Create KDL FK and IK Solver
-  fk_solver_ = std::make_unique<KDL::ChainFkSolverPos_recursive>(kdl_data_.robot_chain);
-  ik_vel_solver_ = std::make_unique<KDL::ChainIkSolverVel_pinv>(kdl_data_.robot_chain);
-  ik_solver_ = std::make_unique<KDL::ChainIkSolverPos_NR>(kdl_data_.robot_chain, *fk_solver_, *ik_vel_solver_);
+  solvers_ = std::make_unique<KDLSolverPool<Solvers>>(kdl_data_.robot_chain);
 }
 
 KDLInvKinChainNR::KDLInvKinChainNR(const tesseract_scene_graph::SceneGraph& scene_graph,
@@ -71,9 +69,7 @@ KDLInvKinChainNR::KDLInvKinChainNR(const KDLInvKinChainNR& other) { *this = othe
 KDLInvKinChainNR& KDLInvKinChainNR::operator=(const KDLInvKinChainNR& other)
 {
   kdl_data_ = other.kdl_data_;
-  fk_solver_ = std::make_unique<KDL::ChainFkSolverPos_recursive>(kdl_data_.robot_chain);
-  ik_vel_solver_ = std::make_unique<KDL::ChainIkSolverVel_pinv>(kdl_data_.robot_chain);
-  ik_solver_ = std::make_unique<KDL::ChainIkSolverPos_NR>(kdl_data_.robot_chain, *fk_solver_, *ik_vel_solver_);
+  solvers_ = std::make_unique<KDLSolverPool<Solvers>>(kdl_data_.robot_chain);
   solver_name_ = other.solver_name_;
 
   return *this;
@@ -95,8 +91,8 @@ IKSolutions KDLInvKinChainNR::calcInvKinHelper(const Eigen::Isometry3d& pose,
   EigenToKDL(pose, kdl_pose);
   int status{ -1 };
   {
-    std::lock_guard<std::mutex> guard(mutex_);
-    status = ik_solver_->CartToJnt(kdl_seed, kdl_pose, kdl_solution);
+    auto solvers = solvers_->acquire();
+    status = solvers->ik_solver.CartToJnt(kdl_seed, kdl_pose, kdl_solution);
   }
 
   if (status < 0)
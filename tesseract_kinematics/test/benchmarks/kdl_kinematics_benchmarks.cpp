@@ -0,0 +1,122 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <Eigen/Eigen>
+#include <algorithm>
+#include <thread>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_kinematics/kdl/kdl_fwd_kin_chain.h>
+#include <tesseract_kinematics/kdl/kdl_inv_kin_chain_lma.h>
+#include <tesseract_kinematics/kdl/kdl_inv_kin_chain_nr.h>
+#include <tesseract_common/resource_locator.h>
+#include <tesseract_urdf/urdf_parser.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_kinematics;
+
+tesseract_scene_graph::SceneGraph::UPtr getSceneGraph()
+{
+  std::string path = std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf";
+
+  tesseract_common::TesseractSupportResourceLocator locator;
+  return tesseract_urdf::parseURDFFile(path, locator);
+}
+
+/** @brief Benchmark calcFwdKin on a single solver object shared by all benchmark threads */
+static void BM_CALC_FWD_KIN(benchmark::State& state, const ForwardKinematics::ConstPtr& fwd_kin)
+{
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Zero(fwd_kin->numJoints());
+  joint_values(1) = 0.5;
+  joint_values(3) = -1.57;
+  tesseract_common::TransformMap poses;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(poses = fwd_kin->calcFwdKin(joint_values));
+  }
+}
+
+/** @brief Benchmark calcJacobian on a single solver object shared by all benchmark threads */
+static void BM_CALC_JACOBIAN(benchmark::State& state, const ForwardKinematics::ConstPtr& fwd_kin)
+{
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Zero(fwd_kin->numJoints());
+  joint_values(1) = 0.5;
+  joint_values(3) = -1.57;
+  std::string tip_link = fwd_kin->getTipLinkNames().front();
+  Eigen::MatrixXd jacobian;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(jacobian = fwd_kin->calcJacobian(joint_values, tip_link));
+  }
+}
+
+/** @brief Benchmark calcInvKin on a single solver object shared by all benchmark threads */
+static void BM_CALC_INV_KIN(benchmark::State& state,
+                            const ForwardKinematics::ConstPtr& fwd_kin,
+                            const InverseKinematics::ConstPtr& inv_kin)
+{
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Zero(fwd_kin->numJoints());
+  joint_values(1) = 0.5;
+  joint_values(3) = -1.57;
+  tesseract_common::TransformMap tip_poses = fwd_kin->calcFwdKin(joint_values);
+
+  Eigen::VectorXd seed = Eigen::VectorXd::Zero(fwd_kin->numJoints());
+  seed(3) = -1.0;
+  IKSolutions solutions;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(solutions = inv_kin->calcInvKin(tip_poses, seed));
+  }
+}
+
+int main(int argc, char** argv)
+{
+  auto scene_graph = getSceneGraph();
+  const int max_threads = static_cast<int>(std::max(1U, std::thread::hardware_concurrency()));
+
+  ForwardKinematics::ConstPtr fwd_kin = std::make_shared<KDLFwdKinChain>(*scene_graph, "base_link", "tool0");
+  InverseKinematics::ConstPtr inv_kin_lma = std::make_shared<KDLInvKinChainLMA>(*scene_graph, "base_link", "tool0");
+  InverseKinematics::ConstPtr inv_kin_nr = std::make_shared<KDLInvKinChainNR>(*scene_graph, "base_link", "tool0");
+
+  //////////////////////////////////////
+  // Forward Kinematics
+  //////////////////////////////////////
+
+  {
+    std::function<void(benchmark::State&, ForwardKinematics::ConstPtr)> BM_CALC_FWD_KIN_FUNC = BM_CALC_FWD_KIN;
+    std::string name = "BM_CALC_FWD_KIN_" + fwd_kin->getSolverName();
+    benchmark::RegisterBenchmark(name.c_str(), BM_CALC_FWD_KIN_FUNC, fwd_kin)
+        ->ThreadRange(1, max_threads)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kNanosecond);
+  }
+
+  {
+    std::function<void(benchmark::State&, ForwardKinematics::ConstPtr)> BM_CALC_JACOBIAN_FUNC = BM_CALC_JACOBIAN;
+    std::string name = "BM_CALC_JACOBIAN_" + fwd_kin->getSolverName();
+    benchmark::RegisterBenchmark(name.c_str(), BM_CALC_JACOBIAN_FUNC, fwd_kin)
+        ->ThreadRange(1, max_threads)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kNanosecond);
+  }
+
+  //////////////////////////////////////
+  // Inverse Kinematics
+  //////////////////////////////////////
+
+  {
+    std::function<void(benchmark::State&, ForwardKinematics::ConstPtr, InverseKinematics::ConstPtr)>
+        BM_CALC_INV_KIN_FUNC = BM_CALC_INV_KIN;
+    for (const auto& inv_kin : { inv_kin_lma, inv_kin_nr })
+    {
+      std::string name = "BM_CALC_INV_KIN_" + inv_kin->getSolverName();
+      benchmark::RegisterBenchmark(name.c_str(), BM_CALC_INV_KIN_FUNC, fwd_kin, inv_kin)
+          ->ThreadRange(1, max_threads)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -2,6 +2,7 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
 #include <fstream>
+#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include "kinematics_test_utils.h"
@@ -32,6 +33,62 @@ TEST(TesseractKinematicsUnit, KDLKinChainNRInverseKinematicUnit)  // NOLINT
   runInvKinIIWATest(factory, "KDLInvKinChainNRFactory", "KDLFwdKinChainFactory");
 }
 
+TEST(TesseractKinematicsUnit, KDLKinChainConcurrentUnit)  // NOLINT
+{
+  auto scene_graph = getSceneGraphIIWA();
+
+  tesseract_kinematics::KDLFwdKinChain fwd_kin(*scene_graph, "base_link", "tool0");
+  tesseract_kinematics::KDLInvKinChainLMA inv_kin_lma(*scene_graph, "base_link", "tool0");
+  tesseract_kinematics::KDLInvKinChainNR inv_kin_nr(*scene_graph, "base_link", "tool0");
+
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Zero(fwd_kin.numJoints());
+  joint_values(1) = 0.5;
+  joint_values(3) = -1.57;
+  Eigen::VectorXd seed = Eigen::VectorXd::Zero(fwd_kin.numJoints());
+  seed(3) = -1.0;
+
+  // Serial reference results
+  tesseract_common::TransformMap poses = fwd_kin.calcFwdKin(joint_values);
+  Eigen::MatrixXd jacobian = fwd_kin.calcJacobian(joint_values, "tool0");
+  tesseract_kinematics::IKSolutions lma_solutions = inv_kin_lma.calcInvKin(poses, seed);
+  tesseract_kinematics::IKSolutions nr_solutions = inv_kin_nr.calcInvKin(poses, seed);
+  ASSERT_EQ(lma_solutions.size(), 1);
+  ASSERT_EQ(nr_solutions.size(), 1);
+
+  // All threads share the same solver objects
+  const std::size_t num_threads = 8;
+  std::vector<int> failures(num_threads, 0);
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (std::size_t t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&, t]() {
+      for (int i = 0; i < 50; ++i)
+      {
+        if (!fwd_kin.calcFwdKin(joint_values).at("tool0").isApprox(poses.at("tool0"), 1e-8))
+          ++failures[t];
+
+        if (!fwd_kin.calcJacobian(joint_values, "tool0").isApprox(jacobian, 1e-8))
+          ++failures[t];
+
+        tesseract_kinematics::IKSolutions lma = inv_kin_lma.calcInvKin(poses, seed);
+        if (lma.size() != 1 || !lma[0].isApprox(lma_solutions[0], 1e-8))
+          ++failures[t];
+
+        tesseract_kinematics::IKSolutions nr = inv_kin_nr.calcInvKin(poses, seed);
+        if (nr.size() != 1 || !nr[0].isApprox(nr_solutions[0], 1e-8))
+          ++failures[t];
+      }
+    });
+  }
+
+  for (auto& thread : threads)
+    thread.join();
+
+  for (const auto& failure : failures)
+    EXPECT_EQ(failure, 0);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
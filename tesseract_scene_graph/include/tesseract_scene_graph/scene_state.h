@@ -80,6 +80,37 @@ private:
   template <class Archive>
   void serialize(Archive& ar, const unsigned int version);  // NOLINT
 };
+
+/**
+ * @brief This holds a state of the scene in dense, index based storage
+ *
+ * Instead of looking up a link/joint by name, the transforms are stored in contiguous arrays and looked up by the index
+ * handed out by the state solver. The link transforms follow the order of StateSolver::getLinkNames(), the joint
+ * transforms follow the order of StateSolver::getJointNames() and the joint values follow the order of
+ * StateSolver::getActiveJointNames(). The indices remain valid until the structure of the state solver changes.
+ *
+ * The state solver resizes the containers as needed, so reusing the same object across calls does not allocate.
+ */
+struct DenseSceneState
+{
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  using Ptr = std::shared_ptr<DenseSceneState>;
+  using ConstPtr = std::shared_ptr<const DenseSceneState>;
+  using UPtr = std::unique_ptr<DenseSceneState>;
+  using ConstUPtr = std::unique_ptr<const DenseSceneState>;
+
+  /** @brief The active joint values used for calculating the joint and link transforms */
+  Eigen::VectorXd joints;
+
+  /** @brief The link transforms in world coordinate system */
+  tesseract_common::VectorIsometry3d link_transforms;
+
+  /** @brief The joint transforms in world coordinate system */
+  tesseract_common::VectorIsometry3d joint_transforms;
+};
 }  // namespace tesseract_scene_graph
 
 #include <boost/serialization/export.hpp>
@@ -69,6 +69,29 @@ public:
 
   SceneState getState() const override final;
 
+  void getState(SceneState& state, const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override final;
+
+  void getState(SceneState& state,
+                const std::vector<std::string>& joint_names,
+                const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override final;
+
+  void getState(DenseSceneState& state, const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override final;
+  void getState(DenseSceneState& state,
+                const std::vector<std::string>& joint_names,
+                const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override final;
+  void getState(DenseSceneState& state) const override final;
+  void getState(std::vector<DenseSceneState>& states,
+                const Eigen::Ref<const Eigen::MatrixXd>& joint_values,
+                std::size_t num_threads = 1) const override final;
+  void getState(std::vector<DenseSceneState>& states,
+                const std::vector<std::string>& joint_names,
+                const Eigen::Ref<const Eigen::MatrixXd>& joint_values,
+                std::size_t num_threads = 1) const override final;
+
+  long getLinkIndex(const std::string& link_name) const override final;
+
+  long getJointIndex(const std::string& joint_name) const override final;
+
   SceneState getRandomState() const override final;
 
   Eigen::MatrixXd getJacobian(const Eigen::Ref<const Eigen::VectorXd>& joint_values,
@@ -106,14 +129,40 @@ public:
   tesseract_common::KinematicLimits getLimits() const override final;
 
 private:
+  /**
+   * @brief The KDL tree flattened into a structure of arrays in tree order
+   * @details Every parent precedes its children, so the transforms of a dense state are computed in a single loop
+   * without looking up link and joint names. The segments point into data_.tree, so it is rebuilt whenever data_ is.
+   */
+  struct FlatTree
+  {
+    std::vector<const KDL::Segment*> segments; /**< @brief The segments */
+    std::vector<long> parent_indices;          /**< @brief The parent segment index, -1 for the root segment */
+    std::vector<long> link_indices;            /**< @brief The link index in link names, -1 if not included */
+    std::vector<long> joint_indices;           /**< @brief The joint index in joint names, -1 if not included */
+    std::vector<long> joint_value_indices;     /**< @brief The index in the active joint names, -1 if fixed */
+
+    void clear();
+  };
+
   SceneState current_state_;                                   /**< Current state of the environment */
   KDLTreeData data_;                                           /**< KDL tree data */
   std::unique_ptr<KDL::TreeJntToJacSolver> jac_solver_;        /**< KDL Jacobian Solver */
   std::unordered_map<std::string, unsigned int> joint_to_qnr_; /**< Map between joint name and kdl q index */
   std::vector<int> joint_qnr_;               /**< The kdl segment number corresponding to joint in joint names */
+  std::vector<long> qnr_joint_index_;        /**< The active joint index corresponding to the kdl q index */
   KDL::JntArray kdl_jnt_array_;              /**< The kdl joint array */
   tesseract_common::KinematicLimits limits_; /**< The kinematic limits */
   mutable std::mutex mutex_; /**< @brief KDL is not thread safe due to mutable variables in Joint Class */
+  mutable KDL::JntArray jnt_array_workspace_; /**< @brief Reusable joint array for queries, guarded by mutex_ */
+
+  /** @brief The world frame of each segment in the flattened tree, guarded by mutex_ */
+  mutable tesseract_common::VectorIsometry3d flat_tree_frames_;
+
+  std::unordered_map<std::string, long> link_indices_;         /**< The link name map to index in link names */
+  std::unordered_map<std::string, long> joint_indices_;        /**< The joint name map to index in joint names */
+  std::unordered_map<std::string, long> active_joint_indices_; /**< The joint name map to index in active names */
+  FlatTree flat_tree_;                                         /**< The flattened tree used for dense states */
 
   void calculateTransforms(SceneState& state,
                            const KDL::JntArray& q_in,
@@ -125,6 +174,19 @@ private:
                                  const KDL::SegmentMap::const_iterator& it,
                                  const Eigen::Isometry3d& parent_frame) const;
 
+  /** @brief Calculate the link and joint transforms of a dense state, the joint values must already be populated */
+  void calculateTransforms(DenseSceneState& state) const;
+
+  /** @brief Rebuild the flattened tree from data_ and the link and joint index maps */
+  void updateFlatTree();
+
+  /**
+   * @brief Append a segment and its children to the flattened tree in tree order
+   * @param it The segment to append
+   * @param parent_index The index of the parent segment in the flattened tree, -1 for the root segment
+   */
+  void updateFlatTreeRecursive(const KDL::SegmentMap::const_iterator& it, long parent_index);
+
   bool setJointValuesHelper(KDL::JntArray& q, const std::string& joint_name, const double& joint_value) const;
 
   bool calcJacobianHelper(KDL::Jacobian& jacobian, const KDL::JntArray& kdl_joints, const std::string& link_name) const;
@@ -87,6 +87,29 @@ public:
 
   SceneState getState() const override final;
 
+  void getState(SceneState& state, const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override final;
+
+  void getState(SceneState& state,
+                const std::vector<std::string>& joint_names,
+                const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override final;
+
+  void getState(DenseSceneState& state, const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override final;
+  void getState(DenseSceneState& state,
+                const std::vector<std::string>& joint_names,
+                const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override final;
+  void getState(DenseSceneState& state) const override final;
+  void getState(std::vector<DenseSceneState>& states,
+                const Eigen::Ref<const Eigen::MatrixXd>& joint_values,
+                std::size_t num_threads = 1) const override final;
+  void getState(std::vector<DenseSceneState>& states,
+                const std::vector<std::string>& joint_names,
+                const Eigen::Ref<const Eigen::MatrixXd>& joint_values,
+                std::size_t num_threads = 1) const override final;
+
+  long getLinkIndex(const std::string& link_name) const override final;
+
+  long getJointIndex(const std::string& joint_name) const override final;
+
   SceneState getRandomState() const override final;
 
   Eigen::MatrixXd getJacobian(const Eigen::Ref<const Eigen::VectorXd>& joint_values,
@@ -150,6 +173,28 @@ public:
   StateSolver::UPtr clone() const override final;
 
 private:
+  /**
+   * @brief The tree compiled into a flat, topologically sorted structure of arrays
+   *
+   * Each entry is a non-root node (a joint and its child link) and every parent precedes its children, so the world
+   * transforms can be computed in a single loop without recursion, pointer chasing or virtual calls. It is rebuilt
+   * whenever the tree changes.
+   */
+  struct FlatTree
+  {
+    std::vector<JointType> types;                  /**< @brief The joint types */
+    std::vector<long> parent_link_indices;         /**< @brief The parent link index, -1 if the parent is the root */
+    std::vector<long> link_indices;                /**< @brief The child link index in link_names_ */
+    std::vector<long> joint_indices;               /**< @brief The joint index in joint_names_ */
+    std::vector<long> joint_value_indices;         /**< @brief The index in active_joint_names_, -1 if fixed */
+    tesseract_common::VectorIsometry3d static_tfs; /**< @brief The static transform, the local transform if fixed */
+    tesseract_common::VectorVector3d axes;         /**< @brief The joint axis, zero if fixed */
+    long root_link_index{ -1 };                    /**< @brief The root link index, -1 if not in link_names_ */
+    Eigen::Isometry3d root_tf{ Eigen::Isometry3d::Identity() }; /**< @brief The root world transform */
+
+    void clear();
+  };
+
   SceneState current_state_;                              /**< Current state of the scene */
   std::vector<std::string> joint_names_;                  /**< The link names */
   std::vector<std::string> active_joint_names_;           /**< The active joint names */
@@ -160,6 +205,11 @@ private:
   OFKTNode::UPtr root_;                                   /**< The root node of the tree */
   int revision_{ 0 };                                     /**< The revision number */
 
+  std::unordered_map<std::string, long> link_indices_;         /**< The link name map to index in link_names_ */
+  std::unordered_map<std::string, long> joint_indices_;        /**< The joint name map to index in joint_names_ */
+  std::unordered_map<std::string, long> active_joint_indices_; /**< The joint name map to index in active names */
+  FlatTree flat_tree_;                                         /**< The compiled tree used for dense states */
+
   /** @brief The state solver can be accessed from multiple threads, need use mutex throughout */
   mutable std::shared_mutex mutex_;
 
@@ -190,6 +240,25 @@ private:
    */
   void update(SceneState& state, const OFKTNode* node, Eigen::Isometry3d parent_world_tf, bool update_required) const;
 
+  /**
+   * @brief This updates the link and joint transforms of a dense state using the flattened tree
+   * @param state The dense state, the joint values must already be populated and the transforms sized
+   */
+  void update(DenseSceneState& state) const;
+
+  /**
+   * @brief Rebuild the link and joint index maps and the flattened tree
+   * @details This must be called whenever the tree structure or a joint origin changes
+   */
+  void updateFlatTree();
+
+  /**
+   * @brief Append a node and its children to the flattened tree in topological order
+   * @param node The node to append
+   * @param parent_link_index The index of the node's parent link, -1 if the parent is the root
+   */
+  void updateFlatTreeRecursive(const OFKTNode* node, long parent_link_index);
+
   /**
    * @brief Given a set of joint values calculate the jacobian for the provided link_name
    * @param joints The joint values to calculate the jacobian for
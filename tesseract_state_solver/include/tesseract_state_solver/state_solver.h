@@ -107,6 +107,108 @@ public:
    */
   virtual SceneState getState() const = 0;
 
+  /**
+   * @brief Get the state of the solver given the joint values, filling the provided state in place
+   *
+   * This does not change the internal state of the solver. The storage of the provided state is reused, so passing
+   * the same state across calls avoids allocation once it has been populated.
+   *
+   * @details This must be the same size and order as what is returned by getActiveJointNames
+   * @param state The state to populate
+   * @param joint_values The joint values
+   */
+  virtual void getState(SceneState& state, const Eigen::Ref<const Eigen::VectorXd>& joint_values) const = 0;
+
+  /**
+   * @brief Get the state of the scene for a given subset of joint values, filling the provided state in place
+   *
+   * This does not change the internal state of the solver. Joints not provided use the current joint values.
+   *
+   * @param state The state to populate
+   * @param joint_names The joint names
+   * @param joint_values The joint values, must be the same size and order as the joint names
+   */
+  virtual void getState(SceneState& state,
+                        const std::vector<std::string>& joint_names,
+                        const Eigen::Ref<const Eigen::VectorXd>& joint_values) const = 0;
+
+  /**
+   * @brief Get the dense state of the solver given the joint values
+   *
+   * This does not change the internal state of the solver. The provided state is resized as needed, so reusing it
+   * across calls avoids allocation.
+   *
+   * @details This must be the same size and order as what is returned by getActiveJointNames
+   * @param state The dense state to populate
+   * @param joint_values The joint values
+   */
+  virtual void getState(DenseSceneState& state, const Eigen::Ref<const Eigen::VectorXd>& joint_values) const = 0;
+
+  /**
+   * @brief Get the dense state of the scene for a given subset of joint values.
+   *
+   * This does not change the internal state of the solver. Joints not provided use the current joint values.
+   *
+   * @param state The dense state to populate
+   * @param joint_names The joint names
+   * @param joint_values The joint values, must be the same size and order as the joint names
+   */
+  virtual void getState(DenseSceneState& state,
+                        const std::vector<std::string>& joint_names,
+                        const Eigen::Ref<const Eigen::VectorXd>& joint_values) const = 0;
+
+  /**
+   * @brief Get the current state of the scene in dense form
+   * @param state The dense state to populate
+   */
+  virtual void getState(DenseSceneState& state) const = 0;
+
+  /**
+   * @brief Get the dense states of the solver for a batch of joint configurations
+   *
+   * This does not change the internal state of the solver. The states are resized to the number of configurations and
+   * each state is filled in place, so reusing the same vector across calls avoids allocation.
+   *
+   * @details The columns must be the same size and order as what is returned by getActiveJointNames
+   * @param states The dense states to populate, one per row of joint_values
+   * @param joint_values The joint configurations, one per row
+   * @param num_threads The number of threads the configurations are distributed across
+   */
+  virtual void getState(std::vector<DenseSceneState>& states,
+                        const Eigen::Ref<const Eigen::MatrixXd>& joint_values,
+                        std::size_t num_threads = 1) const = 0;
+
+  /**
+   * @brief Get the dense states of the scene for a batch of configurations of a subset of joints
+   *
+   * This does not change the internal state of the solver. Joints not provided use the current joint values.
+   *
+   * @param states The dense states to populate, one per row of joint_values
+   * @param joint_names The joint names
+   * @param joint_values The joint configurations, one per row with columns in the same order as the joint names
+   * @param num_threads The number of threads the configurations are distributed across
+   */
+  virtual void getState(std::vector<DenseSceneState>& states,
+                        const std::vector<std::string>& joint_names,
+                        const Eigen::Ref<const Eigen::MatrixXd>& joint_values,
+                        std::size_t num_threads = 1) const = 0;
+
+  /**
+   * @brief Get the index of a link within the link transforms of a DenseSceneState
+   * @details This is the position of the link in getLinkNames() and remains valid until the structure changes
+   * @param link_name The link name
+   * @return The link index, or -1 if the link does not exist
+   */
+  virtual long getLinkIndex(const std::string& link_name) const = 0;
+
+  /**
+   * @brief Get the index of a joint within the joint transforms of a DenseSceneState
+   * @details This is the position of the joint in getJointNames() and remains valid until the structure changes
+   * @param joint_name The joint name
+   * @return The joint index, or -1 if the joint does not exist
+   */
+  virtual long getJointIndex(const std::string& joint_name) const = 0;
+
   /**
    * @brief Get the jacobian of the solver given the joint values
    * @details This must be the same size and order as what is returned by getJointNames
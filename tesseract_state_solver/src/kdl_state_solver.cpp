@@ -61,9 +61,15 @@ KDLStateSolver& KDLStateSolver::operator=(const KDLStateSolver& other)
   data_ = other.data_;
   joint_to_qnr_ = other.joint_to_qnr_;
   joint_qnr_ = other.joint_qnr_;
+  qnr_joint_index_ = other.qnr_joint_index_;
   kdl_jnt_array_ = other.kdl_jnt_array_;
+  jnt_array_workspace_ = other.jnt_array_workspace_;
+  link_indices_ = other.link_indices_;
+  joint_indices_ = other.joint_indices_;
+  active_joint_indices_ = other.active_joint_indices_;
   limits_ = other.limits_;
   jac_solver_ = std::make_unique<KDL::TreeJntToJacSolver>(data_.tree);
+  updateFlatTree();
   return *this;
 }
 
@@ -105,18 +111,8 @@ void KDLStateSolver::setState(const std::vector<std::string>& joint_names,
 
 SceneState KDLStateSolver::getState(const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
 {
-  assert(static_cast<Eigen::Index>(data_.active_joint_names.size()) == joint_values.size());
-  SceneState state{ current_state_ };
-  KDL::JntArray jnt_array = kdl_jnt_array_;
-
-  for (auto i = 0U; i < data_.active_joint_names.size(); ++i)
-  {
-    if (setJointValuesHelper(jnt_array, data_.active_joint_names[i], joint_values[i]))
-      state.joints[data_.active_joint_names[i]] = joint_values[i];
-  }
-
-  calculateTransforms(state, jnt_array, data_.tree.getRootSegment(), Eigen::Isometry3d::Identity());
-
+  SceneState state;
+  getState(state, joint_values);
   return state;
 }
 
@@ -140,22 +136,144 @@ SceneState KDLStateSolver::getState(const std::unordered_map<std::string, double
 SceneState KDLStateSolver::getState(const std::vector<std::string>& joint_names,
                                     const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
 {
-  SceneState state{ current_state_ };
-  KDL::JntArray jnt_array = kdl_jnt_array_;
+  SceneState state;
+  getState(state, joint_names, joint_values);
+  return state;
+}
 
+SceneState KDLStateSolver::getState() const { return current_state_; }
+
+void KDLStateSolver::getState(SceneState& state, const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  assert(static_cast<Eigen::Index>(data_.active_joint_names.size()) == joint_values.size());
+
+  // Only the values are assigned when the state already holds the same entries, so reusing a state does not allocate
+  tesseract_common::assignMapValues(state.joints, current_state_.joints);
+  tesseract_common::assignMapValues(state.link_transforms, current_state_.link_transforms);
+  tesseract_common::assignMapValues(state.joint_transforms, current_state_.joint_transforms);
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  jnt_array_workspace_.data = kdl_jnt_array_.data;
+  for (auto i = 0U; i < data_.active_joint_names.size(); ++i)
+  {
+    if (setJointValuesHelper(jnt_array_workspace_, data_.active_joint_names[i], joint_values[i]))
+      state.joints[data_.active_joint_names[i]] = joint_values[i];
+  }
+
+  calculateTransformsHelper(state, jnt_array_workspace_, data_.tree.getRootSegment(), Eigen::Isometry3d::Identity());
+}
+
+void KDLStateSolver::getState(SceneState& state,
+                              const std::vector<std::string>& joint_names,
+                              const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  assert(static_cast<Eigen::Index>(joint_names.size()) == joint_values.size());
+
+  // Only the values are assigned when the state already holds the same entries, so reusing a state does not allocate
+  tesseract_common::assignMapValues(state.joints, current_state_.joints);
+  tesseract_common::assignMapValues(state.link_transforms, current_state_.link_transforms);
+  tesseract_common::assignMapValues(state.joint_transforms, current_state_.joint_transforms);
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  jnt_array_workspace_.data = kdl_jnt_array_.data;
   for (auto i = 0U; i < joint_names.size(); ++i)
   {
-    if (setJointValuesHelper(jnt_array, joint_names[i], joint_values[i]))
+    if (setJointValuesHelper(jnt_array_workspace_, joint_names[i], joint_values[i]))
       state.joints[joint_names[i]] = joint_values[i];
   }
 
-  Eigen::Isometry3d parent_frame{ Eigen::Isometry3d::Identity() };
-  calculateTransforms(state, jnt_array, data_.tree.getRootSegment(), parent_frame);  // NOLINT
+  calculateTransformsHelper(state, jnt_array_workspace_, data_.tree.getRootSegment(), Eigen::Isometry3d::Identity());
+}
 
-  return state;
+void KDLStateSolver::getState(DenseSceneState& state, const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  assert(static_cast<Eigen::Index>(data_.active_joint_names.size()) == joint_values.size());
+  state.joints = joint_values;
+  calculateTransforms(state);
 }
 
-SceneState KDLStateSolver::getState() const { return current_state_; }
+void KDLStateSolver::getState(DenseSceneState& state,
+                              const std::vector<std::string>& joint_names,
+                              const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  assert(static_cast<Eigen::Index>(joint_names.size()) == joint_values.size());
+  state.joints.resize(static_cast<Eigen::Index>(data_.active_joint_names.size()));
+  for (std::size_t i = 0; i < joint_qnr_.size(); ++i)
+    state.joints(static_cast<Eigen::Index>(i)) = kdl_jnt_array_(static_cast<unsigned>(joint_qnr_[i]));
+
+  for (std::size_t i = 0; i < joint_names.size(); ++i)
+  {
+    auto it = active_joint_indices_.find(joint_names[i]);
+    if (it != active_joint_indices_.end())
+      state.joints(it->second) = joint_values(static_cast<Eigen::Index>(i));
+    else
+      CONSOLE_BRIDGE_logError("Tried to set joint name %s which does not exist!", joint_names[i].c_str());
+  }
+
+  calculateTransforms(state);
+}
+
+void KDLStateSolver::getState(DenseSceneState& state) const
+{
+  state.joints.resize(static_cast<Eigen::Index>(data_.active_joint_names.size()));
+  for (std::size_t i = 0; i < joint_qnr_.size(); ++i)
+    state.joints(static_cast<Eigen::Index>(i)) = kdl_jnt_array_(static_cast<unsigned>(joint_qnr_[i]));
+
+  calculateTransforms(state);
+}
+
+void KDLStateSolver::getState(std::vector<DenseSceneState>& states,
+                              const Eigen::Ref<const Eigen::MatrixXd>& joint_values,
+                              std::size_t num_threads) const
+{
+  assert(static_cast<Eigen::Index>(data_.active_joint_names.size()) == joint_values.cols());
+  states.resize(static_cast<std::size_t>(joint_values.rows()));
+
+  // KDL joints cache values internally, so every worker thread other than the caller uses its own copy of the tree
+  tesseract_common::parallelFor(joint_values.rows(), num_threads, [&](long start, long end) {
+    StateSolver::UPtr local_solver = (start == 0) ? nullptr : clone();
+    const StateSolver& solver = (local_solver != nullptr) ? *local_solver : *this;
+    Eigen::VectorXd values(joint_values.cols());
+    for (long i = start; i < end; ++i)
+    {
+      values = joint_values.row(i).transpose();
+      solver.getState(states[static_cast<std::size_t>(i)], values);
+    }
+  });
+}
+
+void KDLStateSolver::getState(std::vector<DenseSceneState>& states,
+                              const std::vector<std::string>& joint_names,
+                              const Eigen::Ref<const Eigen::MatrixXd>& joint_values,
+                              std::size_t num_threads) const
+{
+  assert(static_cast<Eigen::Index>(joint_names.size()) == joint_values.cols());
+  states.resize(static_cast<std::size_t>(joint_values.rows()));
+
+  // KDL joints cache values internally, so every worker thread other than the caller uses its own copy of the tree
+  tesseract_common::parallelFor(joint_values.rows(), num_threads, [&](long start, long end) {
+    StateSolver::UPtr local_solver = (start == 0) ? nullptr : clone();
+    const StateSolver& solver = (local_solver != nullptr) ? *local_solver : *this;
+    Eigen::VectorXd values(joint_values.cols());
+    for (long i = start; i < end; ++i)
+    {
+      values = joint_values.row(i).transpose();
+      solver.getState(states[static_cast<std::size_t>(i)], joint_names, values);
+    }
+  });
+}
+
+long KDLStateSolver::getLinkIndex(const std::string& link_name) const
+{
+  auto it = link_indices_.find(link_name);
+  return (it != link_indices_.end()) ? it->second : -1;
+}
+
+long KDLStateSolver::getJointIndex(const std::string& joint_name) const
+{
+  auto it = joint_indices_.find(joint_name);
+  return (it != joint_indices_.end()) ? it->second : -1;
+}
 
 SceneState KDLStateSolver::getRandomState() const
 {
@@ -248,11 +366,14 @@ bool KDLStateSolver::processKDLData(const tesseract_scene_graph::SceneGraph& sce
 {
   current_state_ = SceneState();
   kdl_jnt_array_.resize(data_.tree.getNrOfJoints());
+  jnt_array_workspace_.resize(data_.tree.getNrOfJoints());
   limits_.joint_limits.resize(static_cast<long int>(data_.tree.getNrOfJoints()), 2);
   limits_.velocity_limits.resize(static_cast<long int>(data_.tree.getNrOfJoints()));
   limits_.acceleration_limits.resize(static_cast<long int>(data_.tree.getNrOfJoints()));
   joint_qnr_.resize(data_.tree.getNrOfJoints());
+  qnr_joint_index_.resize(data_.tree.getNrOfJoints());
   joint_to_qnr_.clear();
+  active_joint_indices_.clear();
   size_t j = 0;
   for (const auto& seg : data_.tree.getSegments())
   {
@@ -266,6 +387,8 @@ bool KDLStateSolver::processKDLData(const tesseract_scene_graph::SceneGraph& sce
     current_state_.joints.insert(std::make_pair(jnt.getName(), 0.0));
     data_.active_joint_names[j] = jnt.getName();
     joint_qnr_[j] = static_cast<int>(seg.second.q_nr);
+    qnr_joint_index_[seg.second.q_nr] = static_cast<long>(j);
+    active_joint_indices_[jnt.getName()] = static_cast<long>(j);
 
     // Store joint limits.
     const auto& sj = scene_graph.getJoint(jnt.getName());
@@ -277,7 +400,16 @@ bool KDLStateSolver::processKDLData(const tesseract_scene_graph::SceneGraph& sce
     j++;
   }
 
+  link_indices_.clear();
+  for (std::size_t i = 0; i < data_.link_names.size(); ++i)
+    link_indices_[data_.link_names[i]] = static_cast<long>(i);
+
+  joint_indices_.clear();
+  for (std::size_t i = 0; i < data_.joint_names.size(); ++i)
+    joint_indices_[data_.joint_names[i]] = static_cast<long>(i);
+
   jac_solver_ = std::make_unique<KDL::TreeJntToJacSolver>(data_.tree);
+  updateFlatTree();
 
   calculateTransforms(current_state_, kdl_jnt_array_, data_.tree.getRootSegment(), Eigen::Isometry3d::Identity());
   return true;
@@ -334,6 +466,85 @@ void KDLStateSolver::calculateTransforms(SceneState& state,
   calculateTransformsHelper(state, q_in, it, parent_frame);  // NOLINT
 }
 
+void KDLStateSolver::calculateTransforms(DenseSceneState& state) const
+{
+  state.link_transforms.resize(data_.link_names.size());
+  state.joint_transforms.resize(data_.joint_names.size());
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  const FlatTree& tree = flat_tree_;
+  for (std::size_t i = 0; i < tree.segments.size(); ++i)
+  {
+    const long joint_value_index = tree.joint_value_indices[i];
+    const KDL::Frame frame = tree.segments[i]->pose((joint_value_index < 0) ? 0.0 : state.joints(joint_value_index));
+
+    const long parent_index = tree.parent_indices[i];
+    Eigen::Isometry3d& world_tf = flat_tree_frames_[i];
+    if (parent_index < 0)
+      world_tf = convert(frame);
+    else
+      world_tf = flat_tree_frames_[static_cast<std::size_t>(parent_index)] * convert(frame);
+
+    if (tree.link_indices[i] >= 0)
+      state.link_transforms[static_cast<std::size_t>(tree.link_indices[i])] = world_tf;
+
+    if (tree.joint_indices[i] >= 0)
+      state.joint_transforms[static_cast<std::size_t>(tree.joint_indices[i])] = world_tf;
+  }
+}
+
+void KDLStateSolver::FlatTree::clear()
+{
+  segments.clear();
+  parent_indices.clear();
+  link_indices.clear();
+  joint_indices.clear();
+  joint_value_indices.clear();
+}
+
+void KDLStateSolver::updateFlatTree()
+{
+  flat_tree_.clear();
+  flat_tree_.segments.reserve(data_.tree.getNrOfSegments() + 1);
+  flat_tree_.parent_indices.reserve(data_.tree.getNrOfSegments() + 1);
+  flat_tree_.link_indices.reserve(data_.tree.getNrOfSegments() + 1);
+  flat_tree_.joint_indices.reserve(data_.tree.getNrOfSegments() + 1);
+  flat_tree_.joint_value_indices.reserve(data_.tree.getNrOfSegments() + 1);
+  updateFlatTreeRecursive(data_.tree.getRootSegment(), -1);
+  flat_tree_frames_.resize(flat_tree_.segments.size());
+}
+
+void KDLStateSolver::updateFlatTreeRecursive(const KDL::SegmentMap::const_iterator& it, long parent_index)
+{
+  if (it == data_.tree.getSegments().end())
+    return;
+
+  const KDL::TreeElementType& element = it->second;
+  const KDL::Segment& segment = GetTreeElementSegment(element);
+  const auto index = static_cast<long>(flat_tree_.segments.size());
+  flat_tree_.segments.push_back(&segment);
+  flat_tree_.parent_indices.push_back(parent_index);
+
+  auto link_it = link_indices_.find(segment.getName());
+  flat_tree_.link_indices.push_back((link_it != link_indices_.end()) ? link_it->second : -1);
+
+  // The root segment has no joint and sub tree solvers add joints to connect to the base link which are not part of
+  // the joint names
+  auto joint_it = joint_indices_.find(segment.getJoint().getName());
+  if (parent_index < 0 || joint_it == joint_indices_.end())
+    flat_tree_.joint_indices.push_back(-1);
+  else
+    flat_tree_.joint_indices.push_back(joint_it->second);
+
+  if (segment.getJoint().getType() == KDL::Joint::None)
+    flat_tree_.joint_value_indices.push_back(-1);
+  else
+    flat_tree_.joint_value_indices.push_back(qnr_joint_index_[GetTreeElementQNr(element)]);
+
+  for (const auto& child : element.children)
+    updateFlatTreeRecursive(child, index);  // NOLINT
+}
+
 bool KDLStateSolver::calcJacobianHelper(KDL::Jacobian& jacobian,
                                         const KDL::JntArray& kdl_joints,
                                         const std::string& link_name) const
@@ -161,6 +161,10 @@ OFKTStateSolver& OFKTStateSolver::operator=(const OFKTStateSolver& other)
   link_map_[other.root_->getLinkName()] = root_.get();
   limits_ = other.limits_;
   revision_ = other.revision_;
+  link_indices_ = other.link_indices_;
+  joint_indices_ = other.joint_indices_;
+  active_joint_indices_ = other.active_joint_indices_;
+  flat_tree_ = other.flat_tree_;
   cloneHelper(*this, other.root_.get());
   return *this;
 }
@@ -195,6 +199,10 @@ void OFKTStateSolver::clear()
   link_map_.clear();
   limits_ = tesseract_common::KinematicLimits();
   root_ = nullptr;
+  link_indices_.clear();
+  joint_indices_.clear();
+  active_joint_indices_.clear();
+  flat_tree_.clear();
 }
 
 void OFKTStateSolver::setState(const Eigen::Ref<const Eigen::VectorXd>& joint_values)
@@ -241,13 +249,8 @@ void OFKTStateSolver::setState(const std::vector<std::string>& joint_names,
 
 SceneState OFKTStateSolver::getState(const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  assert(static_cast<Eigen::Index>(active_joint_names_.size()) == joint_values.size());
-  auto state = SceneState(current_state_);
-  for (std::size_t i = 0; i < active_joint_names_.size(); ++i)
-    state.joints[active_joint_names_[i]] = joint_values[static_cast<long>(i)];
-
-  update(state, root_.get(), Eigen::Isometry3d::Identity(), false);
+  SceneState state;
+  getState(state, joint_values);
   return state;
 }
 
@@ -263,21 +266,163 @@ SceneState OFKTStateSolver::getState(const std::unordered_map<std::string, doubl
 
 SceneState OFKTStateSolver::getState(const std::vector<std::string>& joint_names,
                                      const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  SceneState state;
+  getState(state, joint_names, joint_values);
+  return state;
+}
+
+SceneState OFKTStateSolver::getState() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return current_state_;
+}
+
+void OFKTStateSolver::getState(SceneState& state, const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  assert(static_cast<Eigen::Index>(active_joint_names_.size()) == joint_values.size());
+
+  // Only the values are assigned when the state already holds the same entries, so reusing a state does not allocate
+  tesseract_common::assignMapValues(state.joints, current_state_.joints);
+  tesseract_common::assignMapValues(state.link_transforms, current_state_.link_transforms);
+  tesseract_common::assignMapValues(state.joint_transforms, current_state_.joint_transforms);
+  for (std::size_t i = 0; i < active_joint_names_.size(); ++i)
+    state.joints[active_joint_names_[i]] = joint_values[static_cast<long>(i)];
+
+  update(state, root_.get(), Eigen::Isometry3d::Identity(), false);
+}
+
+void OFKTStateSolver::getState(SceneState& state,
+                               const std::vector<std::string>& joint_names,
+                               const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
   assert(static_cast<Eigen::Index>(joint_names.size()) == joint_values.size());
-  auto state = SceneState(current_state_);
+
+  // Only the values are assigned when the state already holds the same entries, so reusing a state does not allocate
+  tesseract_common::assignMapValues(state.joints, current_state_.joints);
+  tesseract_common::assignMapValues(state.link_transforms, current_state_.link_transforms);
+  tesseract_common::assignMapValues(state.joint_transforms, current_state_.joint_transforms);
   for (std::size_t i = 0; i < joint_names.size(); ++i)
     state.joints[joint_names[i]] = joint_values[static_cast<long>(i)];
 
   update(state, root_.get(), Eigen::Isometry3d::Identity(), false);
-  return state;
 }
 
-SceneState OFKTStateSolver::getState() const
+void OFKTStateSolver::getState(DenseSceneState& state, const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  return current_state_;
+  assert(static_cast<Eigen::Index>(active_joint_names_.size()) == joint_values.size());
+  state.joints = joint_values;
+  state.link_transforms.resize(link_names_.size());
+  state.joint_transforms.resize(joint_names_.size());
+
+  update(state);
+}
+
+void OFKTStateSolver::getState(DenseSceneState& state,
+                               const std::vector<std::string>& joint_names,
+                               const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  assert(static_cast<Eigen::Index>(joint_names.size()) == joint_values.size());
+  state.joints.resize(static_cast<Eigen::Index>(active_joint_names_.size()));
+  for (std::size_t i = 0; i < active_joint_names_.size(); ++i)
+    state.joints(static_cast<Eigen::Index>(i)) = current_state_.joints.at(active_joint_names_[i]);
+
+  for (std::size_t i = 0; i < joint_names.size(); ++i)
+    state.joints(active_joint_indices_.at(joint_names[i])) = joint_values(static_cast<Eigen::Index>(i));
+
+  state.link_transforms.resize(link_names_.size());
+  state.joint_transforms.resize(joint_names_.size());
+
+  update(state);
+}
+
+void OFKTStateSolver::getState(DenseSceneState& state) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  state.joints.resize(static_cast<Eigen::Index>(active_joint_names_.size()));
+  for (std::size_t i = 0; i < active_joint_names_.size(); ++i)
+    state.joints(static_cast<Eigen::Index>(i)) = current_state_.joints.at(active_joint_names_[i]);
+
+  state.link_transforms.resize(link_names_.size());
+  for (std::size_t i = 0; i < link_names_.size(); ++i)
+    state.link_transforms[i] = current_state_.link_transforms.at(link_names_[i]);
+
+  state.joint_transforms.resize(joint_names_.size());
+  for (std::size_t i = 0; i < joint_names_.size(); ++i)
+    state.joint_transforms[i] = current_state_.joint_transforms.at(joint_names_[i]);
+}
+
+void OFKTStateSolver::getState(std::vector<DenseSceneState>& states,
+                               const Eigen::Ref<const Eigen::MatrixXd>& joint_values,
+                               std::size_t num_threads) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  assert(static_cast<Eigen::Index>(active_joint_names_.size()) == joint_values.cols());
+  states.resize(static_cast<std::size_t>(joint_values.rows()));
+
+  // The flattened tree is read only, so the workers share it while the caller holds the lock
+  tesseract_common::parallelFor(joint_values.rows(), num_threads, [&](long start, long end) {
+    for (long i = start; i < end; ++i)
+    {
+      DenseSceneState& state = states[static_cast<std::size_t>(i)];
+      state.joints = joint_values.row(i).transpose();
+      state.link_transforms.resize(link_names_.size());
+      state.joint_transforms.resize(joint_names_.size());
+      update(state);
+    }
+  });
+}
+
+void OFKTStateSolver::getState(std::vector<DenseSceneState>& states,
+                               const std::vector<std::string>& joint_names,
+                               const Eigen::Ref<const Eigen::MatrixXd>& joint_values,
+                               std::size_t num_threads) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  assert(static_cast<Eigen::Index>(joint_names.size()) == joint_values.cols());
+  states.resize(static_cast<std::size_t>(joint_values.rows()));
+
+  Eigen::VectorXd current_joint_values(static_cast<Eigen::Index>(active_joint_names_.size()));
+  for (std::size_t i = 0; i < active_joint_names_.size(); ++i)
+    current_joint_values(static_cast<Eigen::Index>(i)) = current_state_.joints.at(active_joint_names_[i]);
+
+  std::vector<long> joint_value_indices;
+  joint_value_indices.reserve(joint_names.size());
+  for (const auto& joint_name : joint_names)
+    joint_value_indices.push_back(active_joint_indices_.at(joint_name));
+
+  // The flattened tree is read only, so the workers share it while the caller holds the lock
+  tesseract_common::parallelFor(joint_values.rows(), num_threads, [&](long start, long end) {
+    for (long i = start; i < end; ++i)
+    {
+      DenseSceneState& state = states[static_cast<std::size_t>(i)];
+      state.joints = current_joint_values;
+      for (std::size_t j = 0; j < joint_value_indices.size(); ++j)
+        state.joints(joint_value_indices[j]) = joint_values(i, static_cast<Eigen::Index>(j));
+
+      state.link_transforms.resize(link_names_.size());
+      state.joint_transforms.resize(joint_names_.size());
+      update(state);
+    }
+  });
+}
+
+long OFKTStateSolver::getLinkIndex(const std::string& link_name) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  auto it = link_indices_.find(link_name);
+  return (it != link_indices_.end()) ? it->second : -1;
+}
+
+long OFKTStateSolver::getJointIndex(const std::string& joint_name) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  auto it = joint_indices_.find(joint_name);
+  return (it != joint_indices_.end()) ? it->second : -1;
 }
 
 SceneState OFKTStateSolver::getRandomState() const
@@ -452,6 +597,7 @@ bool OFKTStateSolver::addLink(const Link& link, const Joint& joint)
   std::vector<JointLimits::ConstPtr> new_joint_limits;
   addNode(joint, joint.getName(), joint.parent_link_name, joint.child_link_name, new_joint_limits);
   addNewJointLimits(new_joint_limits);
+  updateFlatTree();
 
   update(root_.get(), false);
 
@@ -491,6 +637,7 @@ bool OFKTStateSolver::replaceJoint(const Joint& joint)
   std::vector<JointLimits::ConstPtr> new_joint_limits;
   replaceJointHelper(new_joint_limits, joint);
   addNewJointLimits(new_joint_limits);
+  updateFlatTree();
 
   update(root_.get(), false);
 
@@ -517,6 +664,7 @@ bool OFKTStateSolver::moveLink(const Joint& joint)
   std::vector<JointLimits::ConstPtr> new_joint_limits;
   moveLinkHelper(new_joint_limits, joint);
   addNewJointLimits(new_joint_limits);
+  updateFlatTree();
 
   update(root_.get(), false);
 
@@ -549,6 +697,7 @@ bool OFKTStateSolver::removeLink(const std::string& name)
 
   // Remove deleted joints
   removeJointHelper(removed_links, removed_joints, removed_active_joints, removed_active_joints_indices);
+  updateFlatTree();
 
   update(root_.get(), false);
 
@@ -581,6 +730,7 @@ bool OFKTStateSolver::removeJoint(const std::string& name)
 
   // Remove deleted joints
   removeJointHelper(removed_links, removed_joints, removed_active_joints, removed_active_joints_indices);
+  updateFlatTree();
 
   update(root_.get(), false);
 
@@ -611,6 +761,7 @@ bool OFKTStateSolver::moveJoint(const std::string& name, const std::string& pare
   n->setParent(new_parent);
   new_parent->addChild(n.get());
 
+  updateFlatTree();
   update(root_.get(), false);
 
   return true;
@@ -628,6 +779,7 @@ bool OFKTStateSolver::changeJointOrigin(const std::string& name, const Eigen::Is
 
   it->second->setStaticTransformation(new_origin);
 
+  updateFlatTree();
   update(root_.get(), false);
 
   return true;
@@ -735,6 +887,7 @@ bool OFKTStateSolver::insertSceneGraph(const SceneGraph& scene_graph, const Join
 
   // Populate Joint Limits
   addNewJointLimits(new_joints_limits);
+  updateFlatTree();
 
   update(root_.get(), false);
   return true;
@@ -834,6 +987,141 @@ void OFKTStateSolver::update(SceneState& state,
     update(state, child, parent_world_tf, update_required);
 }
 
+void OFKTStateSolver::update(DenseSceneState& state) const
+{
+  assert(state.link_transforms.size() == link_names_.size());
+  assert(state.joint_transforms.size() == joint_names_.size());
+  const FlatTree& tree = flat_tree_;
+  if (tree.root_link_index >= 0)
+    state.link_transforms[static_cast<std::size_t>(tree.root_link_index)] = tree.root_tf;
+
+  for (std::size_t i = 0; i < tree.types.size(); ++i)
+  {
+    const long parent_link_index = tree.parent_link_indices[i];
+    const Eigen::Isometry3d& parent_world_tf =
+        (parent_link_index < 0) ? tree.root_tf : state.link_transforms[static_cast<std::size_t>(parent_link_index)];
+
+    Eigen::Isometry3d& world_tf = state.link_transforms[static_cast<std::size_t>(tree.link_indices[i])];
+    switch (tree.types[i])
+    {
+      case tesseract_scene_graph::JointType::REVOLUTE:
+      case tesseract_scene_graph::JointType::CONTINUOUS:
+      {
+        const double joint_value = state.joints(tree.joint_value_indices[i]);
+        world_tf = parent_world_tf * (tree.static_tfs[i] * Eigen::AngleAxisd(joint_value, tree.axes[i]));
+        break;
+      }
+      case tesseract_scene_graph::JointType::PRISMATIC:
+      {
+        const double joint_value = state.joints(tree.joint_value_indices[i]);
+        world_tf = parent_world_tf * (tree.static_tfs[i] * Eigen::Translation3d(joint_value * tree.axes[i]));
+        break;
+      }
+      default:
+      {
+        world_tf = parent_world_tf * tree.static_tfs[i];
+        break;
+      }
+    }
+
+    state.joint_transforms[static_cast<std::size_t>(tree.joint_indices[i])] = world_tf;
+  }
+}
+
+void OFKTStateSolver::updateFlatTree()
+{
+  link_indices_.clear();
+  for (std::size_t i = 0; i < link_names_.size(); ++i)
+    link_indices_[link_names_[i]] = static_cast<long>(i);
+
+  joint_indices_.clear();
+  for (std::size_t i = 0; i < joint_names_.size(); ++i)
+    joint_indices_[joint_names_[i]] = static_cast<long>(i);
+
+  active_joint_indices_.clear();
+  for (std::size_t i = 0; i < active_joint_names_.size(); ++i)
+    active_joint_indices_[active_joint_names_[i]] = static_cast<long>(i);
+
+  flat_tree_.clear();
+  if (root_ == nullptr)
+    return;
+
+  auto it = link_indices_.find(root_->getLinkName());
+  flat_tree_.root_link_index = (it != link_indices_.end()) ? it->second : -1;
+  flat_tree_.root_tf = root_->getWorldTransformation();
+
+  flat_tree_.types.reserve(nodes_.size());
+  flat_tree_.parent_link_indices.reserve(nodes_.size());
+  flat_tree_.link_indices.reserve(nodes_.size());
+  flat_tree_.joint_indices.reserve(nodes_.size());
+  flat_tree_.joint_value_indices.reserve(nodes_.size());
+  flat_tree_.static_tfs.reserve(nodes_.size());
+  flat_tree_.axes.reserve(nodes_.size());
+  for (const auto* child : root_->getChildren())
+    updateFlatTreeRecursive(child, -1);
+}
+
+void OFKTStateSolver::updateFlatTreeRecursive(const OFKTNode* node, long parent_link_index)
+{
+  const long link_index = link_indices_.at(node->getLinkName());
+  flat_tree_.types.push_back(node->getType());
+  flat_tree_.parent_link_indices.push_back(parent_link_index);
+  flat_tree_.link_indices.push_back(link_index);
+  flat_tree_.joint_indices.push_back(joint_indices_.at(node->getJointName()));
+
+  switch (node->getType())
+  {
+    case tesseract_scene_graph::JointType::FIXED:
+    {
+      flat_tree_.joint_value_indices.push_back(-1);
+      flat_tree_.static_tfs.push_back(node->getLocalTransformation());
+      flat_tree_.axes.emplace_back(Eigen::Vector3d::Zero());
+      break;
+    }
+    case tesseract_scene_graph::JointType::REVOLUTE:
+    {
+      flat_tree_.joint_value_indices.push_back(active_joint_indices_.at(node->getJointName()));
+      flat_tree_.static_tfs.push_back(node->getStaticTransformation());
+      flat_tree_.axes.push_back(static_cast<const OFKTRevoluteNode*>(node)->getAxis());
+      break;
+    }
+    case tesseract_scene_graph::JointType::CONTINUOUS:
+    {
+      flat_tree_.joint_value_indices.push_back(active_joint_indices_.at(node->getJointName()));
+      flat_tree_.static_tfs.push_back(node->getStaticTransformation());
+      flat_tree_.axes.push_back(static_cast<const OFKTContinuousNode*>(node)->getAxis());
+      break;
+    }
+    case tesseract_scene_graph::JointType::PRISMATIC:
+    {
+      flat_tree_.joint_value_indices.push_back(active_joint_indices_.at(node->getJointName()));
+      flat_tree_.static_tfs.push_back(node->getStaticTransformation());
+      flat_tree_.axes.push_back(static_cast<const OFKTPrismaticNode*>(node)->getAxis());
+      break;
+    }
+    default:
+    {
+      throw std::runtime_error("Unsupported OFKTNode type!");
+    }
+  }
+
+  for (const auto* child : node->getChildren())
+    updateFlatTreeRecursive(child, link_index);
+}
+
+void OFKTStateSolver::FlatTree::clear()
+{
+  types.clear();
+  parent_link_indices.clear();
+  link_indices.clear();
+  joint_indices.clear();
+  joint_value_indices.clear();
+  static_tfs.clear();
+  axes.clear();
+  root_link_index = -1;
+  root_tf = Eigen::Isometry3d::Identity();
+}
+
 bool OFKTStateSolver::initHelper(const tesseract_scene_graph::SceneGraph& scene_graph, const std::string& prefix)
 {
   clear();
@@ -869,6 +1157,7 @@ bool OFKTStateSolver::initHelper(const tesseract_scene_graph::SceneGraph& scene_
 
   // Populate Joint Limits
   addNewJointLimits(new_joints_limits);
+  updateFlatTree();
 
   // Update transforms
   update(root_.get(), false);
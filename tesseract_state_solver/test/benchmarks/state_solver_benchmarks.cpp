@@ -0,0 +1,186 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <Eigen/Eigen>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <functional>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_state_solver/kdl/kdl_state_solver.h>
+#include <tesseract_state_solver/ofkt/ofkt_state_solver.h>
+#include <tesseract_common/resource_locator.h>
+#include <tesseract_urdf/urdf_parser.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_scene_graph;
+
+static std::atomic<std::size_t> allocation_count{ 0 };
+
+#if defined(__GLIBC__)
+// Count every heap allocation by interposing the C allocation functions, which operator new and Eigen's aligned
+// allocator (e.g. the link transform map nodes) both end up calling
+extern "C" void* __libc_malloc(std::size_t size) noexcept;                           // NOLINT
+extern "C" void* __libc_calloc(std::size_t num, std::size_t size) noexcept;          // NOLINT
+extern "C" void* __libc_realloc(void* ptr, std::size_t size) noexcept;               // NOLINT
+extern "C" void* __libc_memalign(std::size_t alignment, std::size_t size) noexcept;  // NOLINT
+
+extern "C" void* malloc(std::size_t size) noexcept  // NOLINT
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  return __libc_malloc(size);
+}
+
+extern "C" void* calloc(std::size_t num, std::size_t size) noexcept  // NOLINT
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  return __libc_calloc(num, size);
+}
+
+extern "C" void* realloc(void* ptr, std::size_t size) noexcept  // NOLINT
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  return __libc_realloc(ptr, size);
+}
+
+extern "C" void* aligned_alloc(std::size_t alignment, std::size_t size) noexcept  // NOLINT
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  return __libc_memalign(alignment, size);
+}
+
+extern "C" int posix_memalign(void** ptr, std::size_t alignment, std::size_t size) noexcept  // NOLINT
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  *ptr = __libc_memalign(alignment, size);
+  return (*ptr == nullptr && size != 0) ? ENOMEM : 0;
+}
+#endif
+
+SceneGraph::UPtr getSceneGraph()
+{
+  std::string path = std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf";
+
+  tesseract_common::TesseractSupportResourceLocator locator;
+  return tesseract_urdf::parseURDFFile(path, locator);
+}
+
+/**
+ * @brief Report the average number of heap allocations per iteration since the provided count
+ * @note Allocations are only counted with glibc, otherwise no counter is reported
+ */
+static void setAllocationCounter(benchmark::State& state, std::size_t start_count)
+{
+#if defined(__GLIBC__)
+  auto allocations = static_cast<double>(allocation_count.load() - start_count);
+  state.counters["allocs_per_iter"] = benchmark::Counter(allocations, benchmark::Counter::kAvgIterations);
+#else
+  (void)state;
+  (void)start_count;
+#endif
+}
+
+/** @brief Benchmark getState returning a new SceneState by value */
+static void BM_GET_STATE_BY_VALUE(benchmark::State& state, const StateSolver::ConstPtr& solver)
+{
+  std::vector<std::string> joint_names = solver->getActiveJointNames();
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Zero(static_cast<Eigen::Index>(joint_names.size()));
+  joint_values(1) = 0.5;
+  joint_values(3) = -1.57;
+  SceneState scene_state = solver->getState(joint_names, joint_values);
+
+  std::size_t start_count = allocation_count.load();
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(scene_state = solver->getState(joint_names, joint_values));
+  }
+  setAllocationCounter(state, start_count);
+}
+
+/** @brief Benchmark getState filling a SceneState that is reused across calls */
+static void BM_GET_STATE_IN_PLACE(benchmark::State& state, const StateSolver::ConstPtr& solver)
+{
+  std::vector<std::string> joint_names = solver->getActiveJointNames();
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Zero(static_cast<Eigen::Index>(joint_names.size()));
+  joint_values(1) = 0.5;
+  joint_values(3) = -1.57;
+
+  // Warm up so the state owns all of its storage before timing
+  SceneState scene_state;
+  solver->getState(scene_state, joint_names, joint_values);
+
+  std::size_t start_count = allocation_count.load();
+  for (auto _ : state)
+  {
+    solver->getState(scene_state, joint_names, joint_values);
+    benchmark::DoNotOptimize(scene_state);
+  }
+  setAllocationCounter(state, start_count);
+}
+
+/** @brief Benchmark getState filling a DenseSceneState that is reused across calls */
+static void BM_GET_DENSE_STATE_IN_PLACE(benchmark::State& state, const StateSolver::ConstPtr& solver)
+{
+  std::vector<std::string> joint_names = solver->getActiveJointNames();
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Zero(static_cast<Eigen::Index>(joint_names.size()));
+  joint_values(1) = 0.5;
+  joint_values(3) = -1.57;
+
+  // Warm up so the state owns all of its storage before timing
+  DenseSceneState scene_state;
+  solver->getState(scene_state, joint_names, joint_values);
+
+  std::size_t start_count = allocation_count.load();
+  for (auto _ : state)
+  {
+    solver->getState(scene_state, joint_names, joint_values);
+    benchmark::DoNotOptimize(scene_state);
+  }
+  setAllocationCounter(state, start_count);
+}
+
+int main(int argc, char** argv)
+{
+  auto scene_graph = getSceneGraph();
+
+  std::vector<std::pair<std::string, StateSolver::ConstPtr>> solvers;
+  solvers.emplace_back("KDL", std::make_shared<KDLStateSolver>(*scene_graph));
+  solvers.emplace_back("OFKT", std::make_shared<OFKTStateSolver>(*scene_graph));
+
+  //////////////////////////////////////
+  // Get State
+  //////////////////////////////////////
+
+  std::function<void(benchmark::State&, StateSolver::ConstPtr)> BM_GET_STATE_BY_VALUE_FUNC = BM_GET_STATE_BY_VALUE;
+  std::function<void(benchmark::State&, StateSolver::ConstPtr)> BM_GET_STATE_IN_PLACE_FUNC = BM_GET_STATE_IN_PLACE;
+  std::function<void(benchmark::State&, StateSolver::ConstPtr)> BM_GET_DENSE_STATE_IN_PLACE_FUNC =
+      BM_GET_DENSE_STATE_IN_PLACE;
+
+  for (const auto& solver : solvers)
+  {
+    {
+      std::string name = "BM_GET_STATE_BY_VALUE_" + solver.first;
+      benchmark::RegisterBenchmark(name.c_str(), BM_GET_STATE_BY_VALUE_FUNC, solver.second)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kNanosecond);
+    }
+
+    {
+      std::string name = "BM_GET_STATE_IN_PLACE_" + solver.first;
+      benchmark::RegisterBenchmark(name.c_str(), BM_GET_STATE_IN_PLACE_FUNC, solver.second)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kNanosecond);
+    }
+
+    {
+      std::string name = "BM_GET_DENSE_STATE_IN_PLACE_" + solver.first;
+      benchmark::RegisterBenchmark(name.c_str(), BM_GET_DENSE_STATE_IN_PLACE_FUNC, solver.second)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kNanosecond);
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
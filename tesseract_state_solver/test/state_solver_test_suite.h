@@ -5,6 +5,7 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <unordered_map>
 #include <vector>
 #include <tesseract_urdf/urdf_parser.h>
 #include <tesseract_geometry/impl/box.h>
@@ -79,6 +80,40 @@ inline void runCompareSceneStates(const SceneState& base_state, const SceneState
   }
 }
 
+inline void runCompareDenseSceneState(const StateSolver& state_solver,
+                                      const SceneState& base_state,
+                                      const DenseSceneState& dense_state)
+{
+  std::vector<std::string> active_joint_names = state_solver.getActiveJointNames();
+  std::vector<std::string> joint_names = state_solver.getJointNames();
+  std::vector<std::string> link_names = state_solver.getLinkNames();
+
+  EXPECT_EQ(dense_state.joints.size(), static_cast<Eigen::Index>(active_joint_names.size()));
+  EXPECT_EQ(dense_state.joint_transforms.size(), joint_names.size());
+  EXPECT_EQ(dense_state.link_transforms.size(), link_names.size());
+
+  for (std::size_t i = 0; i < active_joint_names.size(); ++i)
+  {
+    EXPECT_NEAR(dense_state.joints(static_cast<Eigen::Index>(i)), base_state.joints.at(active_joint_names[i]), 1e-6);
+  }
+
+  for (const auto& joint_name : joint_names)
+  {
+    long idx = state_solver.getJointIndex(joint_name);
+    ASSERT_GE(idx, 0);
+    EXPECT_TRUE(dense_state.joint_transforms[static_cast<std::size_t>(idx)].isApprox(
+        base_state.joint_transforms.at(joint_name), 1e-6));
+  }
+
+  for (const auto& link_name : link_names)
+  {
+    long idx = state_solver.getLinkIndex(link_name);
+    ASSERT_GE(idx, 0);
+    EXPECT_TRUE(dense_state.link_transforms[static_cast<std::size_t>(idx)].isApprox(
+        base_state.link_transforms.at(link_name), 1e-6));
+  }
+}
+
 inline void runCompareStateSolver(const StateSolver& base_solver, StateSolver& comp_solver)
 {
   EXPECT_EQ(base_solver.getBaseLinkName(), comp_solver.getBaseLinkName());
@@ -98,6 +133,10 @@ inline void runCompareStateSolver(const StateSolver& base_solver, StateSolver& c
 
     runCompareSceneStates(base_random_state, comp_state_const);
     runCompareSceneStates(base_random_state, comp_state);
+
+    DenseSceneState comp_dense_state;
+    comp_solver.getState(comp_dense_state, base_random_state.getJointValues(comp_solver.getActiveJointNames()));
+    runCompareDenseSceneState(comp_solver, base_random_state, comp_dense_state);
   }
 }
 
@@ -1176,6 +1215,146 @@ void runReplaceJointTest()
     runCompareStateSolverLimits(*scene_graph, base_state_solver);
   }
 }
+
+template <typename S>
+void runDenseStateTest()
+{
+  // Get the scene graph
+  auto scene_graph = getSceneGraph();
+  auto state_solver = S(*scene_graph);
+
+  std::vector<std::string> active_joint_names = state_solver.getActiveJointNames();
+  std::vector<std::string> link_names = state_solver.getLinkNames();
+  std::vector<std::string> joint_names = state_solver.getJointNames();
+
+  for (std::size_t i = 0; i < link_names.size(); ++i)
+    EXPECT_EQ(state_solver.getLinkIndex(link_names[i]), static_cast<long>(i));
+
+  for (std::size_t i = 0; i < joint_names.size(); ++i)
+    EXPECT_EQ(state_solver.getJointIndex(joint_names[i]), static_cast<long>(i));
+
+  EXPECT_EQ(state_solver.getLinkIndex("does_not_exist"), -1);
+  EXPECT_EQ(state_solver.getJointIndex("does_not_exist"), -1);
+
+  // The same dense state is reused for every call
+  DenseSceneState dense_state;
+  for (int i = 0; i < 10; ++i)
+  {
+    SceneState random_state = state_solver.getRandomState();
+    Eigen::VectorXd joint_values = random_state.getJointValues(active_joint_names);
+
+    state_solver.getState(dense_state, joint_values);
+    runCompareDenseSceneState(state_solver, random_state, dense_state);
+
+    std::vector<std::string> sub_joint_names(active_joint_names.begin(), active_joint_names.begin() + 3);
+    Eigen::VectorXd sub_joint_values = joint_values.head(3);
+    state_solver.getState(dense_state, sub_joint_names, sub_joint_values);
+    runCompareDenseSceneState(state_solver, state_solver.getState(sub_joint_names, sub_joint_values), dense_state);
+
+    state_solver.setState(joint_values);
+    state_solver.getState(dense_state);
+    runCompareDenseSceneState(state_solver, state_solver.getState(), dense_state);
+  }
+
+  // Batched states must match the single configuration results regardless of the number of threads
+  std::vector<SceneState> random_states;
+  Eigen::MatrixXd batch_values(5, static_cast<Eigen::Index>(active_joint_names.size()));
+  for (Eigen::Index r = 0; r < batch_values.rows(); ++r)
+  {
+    random_states.push_back(state_solver.getRandomState());
+    batch_values.row(r) = random_states.back().getJointValues(active_joint_names).transpose();
+  }
+
+  std::vector<DenseSceneState> dense_states;
+  for (std::size_t num_threads : std::vector<std::size_t>{ 1, 2, 8 })
+  {
+    state_solver.getState(dense_states, batch_values, num_threads);
+    ASSERT_EQ(dense_states.size(), static_cast<std::size_t>(batch_values.rows()));
+    for (std::size_t r = 0; r < dense_states.size(); ++r)
+      runCompareDenseSceneState(state_solver, random_states[r], dense_states[r]);
+
+    std::vector<std::string> sub_joint_names(active_joint_names.begin(), active_joint_names.begin() + 3);
+    Eigen::MatrixXd sub_batch_values = batch_values.leftCols(3);
+    state_solver.getState(dense_states, sub_joint_names, sub_batch_values, num_threads);
+    ASSERT_EQ(dense_states.size(), static_cast<std::size_t>(batch_values.rows()));
+    for (std::size_t r = 0; r < dense_states.size(); ++r)
+    {
+      Eigen::VectorXd sub_joint_values = sub_batch_values.row(static_cast<Eigen::Index>(r)).transpose();
+      SceneState expected = state_solver.getState(sub_joint_names, sub_joint_values);
+      runCompareDenseSceneState(state_solver, expected, dense_states[r]);
+    }
+  }
+}
+
+template <typename S>
+void runInPlaceStateTest()
+{
+  // Get the scene graph
+  auto scene_graph = getSceneGraph();
+  auto state_solver = S(*scene_graph);
+
+  std::vector<std::string> active_joint_names = state_solver.getActiveJointNames();
+  std::vector<std::string> sub_joint_names(active_joint_names.begin(), active_joint_names.begin() + 3);
+
+  // The same state is reused for every call and must match the state returned by value
+  SceneState state;
+  for (int i = 0; i < 10; ++i)
+  {
+    SceneState random_state = state_solver.getRandomState();
+    Eigen::VectorXd joint_values = random_state.getJointValues(active_joint_names);
+
+    state_solver.getState(state, joint_values);
+    runCompareSceneStates(state_solver.getState(joint_values), state);
+
+    Eigen::VectorXd sub_joint_values = joint_values.head(3);
+    state_solver.getState(state, sub_joint_names, sub_joint_values);
+    runCompareSceneStates(state_solver.getState(sub_joint_names, sub_joint_values), state);
+
+    state_solver.setState(joint_values);
+  }
+
+  // Once populated, the entries of the state are reused in place instead of being reallocated
+  std::unordered_map<std::string, const double*> joint_addresses;
+  for (const auto& joint : state.joints)
+    joint_addresses[joint.first] = &joint.second;
+
+  std::unordered_map<std::string, const Eigen::Isometry3d*> link_addresses;
+  for (const auto& link : state.link_transforms)
+    link_addresses[link.first] = &link.second;
+
+  std::unordered_map<std::string, const Eigen::Isometry3d*> joint_transform_addresses;
+  for (const auto& joint : state.joint_transforms)
+    joint_transform_addresses[joint.first] = &joint.second;
+
+  const std::size_t bucket_count = state.joints.bucket_count();
+  for (int i = 0; i < 10; ++i)
+  {
+    Eigen::VectorXd joint_values = state_solver.getRandomState().getJointValues(active_joint_names);
+    state_solver.getState(state, joint_values);
+    runCompareSceneStates(state_solver.getState(joint_values), state);
+
+    EXPECT_EQ(state.joints.bucket_count(), bucket_count);
+    EXPECT_EQ(state.joints.size(), joint_addresses.size());
+    for (const auto& joint : state.joints)
+      EXPECT_EQ(&joint.second, joint_addresses.at(joint.first));
+
+    EXPECT_EQ(state.link_transforms.size(), link_addresses.size());
+    for (const auto& link : state.link_transforms)
+      EXPECT_EQ(&link.second, link_addresses.at(link.first));
+
+    EXPECT_EQ(state.joint_transforms.size(), joint_transform_addresses.size());
+    for (const auto& joint : state.joint_transforms)
+      EXPECT_EQ(&joint.second, joint_transform_addresses.at(joint.first));
+  }
+
+  // A state from an unrelated solver is overwritten completely
+  SceneState other_state;
+  other_state.joints["does_not_exist"] = 1;
+  other_state.link_transforms["does_not_exist"] = Eigen::Isometry3d::Identity();
+  Eigen::VectorXd joint_values = state_solver.getRandomState().getJointValues(active_joint_names);
+  state_solver.getState(other_state, joint_values);
+  runCompareSceneStates(state_solver.getState(joint_values), other_state);
+}
 }  // namespace tesseract_scene_graph::test_suite
 
 #endif  // TESSERACT_STATE_SOLVER_
@@ -85,6 +85,26 @@ TEST(TesseractStateSolverUnit, OFKTGetJacobianUnit)  // NOLINT
   test_suite::runJacobianTest<OFKTStateSolver>();
 }
 
+TEST(TesseractStateSolverUnit, KDLDenseStateUnit)  // NOLINT
+{
+  test_suite::runDenseStateTest<KDLStateSolver>();
+}
+
+TEST(TesseractStateSolverUnit, OFKTDenseStateUnit)  // NOLINT
+{
+  test_suite::runDenseStateTest<OFKTStateSolver>();
+}
+
+TEST(TesseractStateSolverUnit, KDLInPlaceStateUnit)  // NOLINT
+{
+  test_suite::runInPlaceStateTest<KDLStateSolver>();
+}
+
+TEST(TesseractStateSolverUnit, OFKTInPlaceStateUnit)  // NOLINT
+{
+  test_suite::runInPlaceStateTest<OFKTStateSolver>();
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);